@@ -334,6 +334,13 @@ inline constexpr Acceleration<NumericType> Velocity<NumericType>::operator/(
   return Acceleration<NumericType>{*this, time};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Acceleration>{1};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -0,0 +1,102 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_ALIGNED_HPP
+#define PHQ_ALIGNED_HPP
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Returns the smallest power of two that is greater than or equal to the size of a given
+/// type. Internal implementation detail not intended to be used outside of the PhQ::Aligned class.
+template <typename Type>
+inline constexpr std::size_t AlignedSize() noexcept {
+  std::size_t size{1};
+  while (size < sizeof(Type)) {
+    size *= 2;
+  }
+  return size;
+}
+
+}  // namespace Internal
+
+/// \brief Padded and aligned storage for a given type, such as a PhQ::Vector, a PhQ::SymmetricDyad,
+/// or a physical quantity such as PhQ::Velocity or PhQ::Stress. The size and the alignment of the
+/// object are both rounded up to the next power of two, so that a PhQ::Vector<double> occupies 32
+/// bytes, like four doubles, and a PhQ::SymmetricDyad<double> occupies 64 bytes, like eight
+/// doubles. Arrays of such objects of up to 64 bytes each never straddle cache lines and can be
+/// read with aligned SIMD loads, at the cost of the unused padding, which is left uninitialized.
+/// PhQ::Aligned<Type> derives from Type and has the same public API: it inherits the constructors,
+/// member methods, and operators of Type, and it can be passed to any function that takes a Type by
+/// reference without a copy. Operations that return a new object return a Type, which converts
+/// implicitly back to PhQ::Aligned<Type>. For example:
+/// \code
+/// std::vector<PhQ::Aligned<PhQ::Vector<>>> vectors(1000, PhQ::Vector<>{1.0, 2.0, 3.0});
+/// vectors[0] = vectors[1] + vectors[2];
+/// const PhQ::Vector<>& vector = vectors[0];
+/// \endcode
+/// Only individual objects are interchangeable: an array of PhQ::Aligned<Type> has a different
+/// stride than an array of Type and cannot be reinterpreted as one.
+template <typename Type>
+class alignas(Internal::AlignedSize<Type>()) Aligned : public Type {
+public:
+  using Type::Type;
+
+  /// \brief Default constructor. Constructs an aligned object with the same default state as the
+  /// default constructor of the given type.
+  Aligned() = default;
+
+  /// \brief Constructor. Constructs an aligned object from a copy of a given object.
+  constexpr Aligned(const Type& other) : Type(other) {}
+
+  /// \brief Constructor. Constructs an aligned object by moving a given object.
+  constexpr Aligned(Type&& other) noexcept : Type(std::move(other)) {}
+
+  /// \brief Copy assignment operator. Assigns this aligned object by copying a given object. Only
+  /// the components of the given object are written; the padding is left untouched.
+  constexpr Aligned& operator=(const Type& other) {
+    Type::operator=(other);
+    return *this;
+  }
+};
+
+}  // namespace PhQ
+
+namespace std {
+
+template <typename Type>
+struct hash<PhQ::Aligned<Type>> {
+  inline size_t operator()(const PhQ::Aligned<Type>& aligned) const {
+    return hash<Type>()(aligned);
+  }
+};
+
+}  // namespace std
+
+#endif  // PHQ_ALIGNED_HPP
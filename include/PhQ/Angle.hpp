@@ -293,6 +293,39 @@ public:
     return Angle<NumericType>{ConvertStatically<Unit::Angle, Unit, Standard<Unit::Angle>>(value)};
   }
 
+  /// \brief Computes the angles between the given number of pairs of planar vectors stored
+  /// contiguously, and stores them in the given array of angles. Each angle is computed as
+  /// atan2(|a x b|, a · b), which requires no square roots and is accurate near 0 and π, unlike
+  /// acos(a · b / (|a| |b|)). The loop has no branches so that the compiler can vectorize it. The
+  /// angle between a zero planar vector and any other planar vector is zero.
+  static void Between(const PlanarVector<NumericType>* const planar_vectors_1,
+                      const PlanarVector<NumericType>* const planar_vectors_2,
+                      const std::size_t size, Angle<NumericType>* const angles) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const PlanarVector<NumericType>& first{planar_vectors_1[index]};
+      const PlanarVector<NumericType>& second{planar_vectors_2[index]};
+      angles[index].value = std::atan2(std::abs(first.x() * second.y() - first.y() * second.x()),
+                                       first.x() * second.x() + first.y() * second.y());
+    }
+  }
+
+  /// \brief Computes the angles between the given number of pairs of vectors stored contiguously,
+  /// and stores them in the given array of angles. Each angle is computed as atan2(|a x b|, a · b),
+  /// which requires a single square root and is accurate near 0 and π, unlike
+  /// acos(a · b / (|a| |b|)), which requires two. The loop has no branches so that the compiler can
+  /// vectorize it. The angle between a zero vector and any other vector is zero.
+  static void Between(const Vector<NumericType>* const vectors_1,
+                      const Vector<NumericType>* const vectors_2, const std::size_t size,
+                      Angle<NumericType>* const angles) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const Vector<NumericType>& first{vectors_1[index]};
+      const Vector<NumericType>& second{vectors_2[index]};
+      angles[index].value =
+          std::atan2(first.Cross(second).Magnitude(),
+                     first.x() * second.x() + first.y() * second.y() + first.z() * second.z());
+    }
+  }
+
   constexpr Angle<NumericType> operator+(const Angle<NumericType>& other) const {
     return Angle<NumericType>{this->value + other.value};
   }
@@ -401,6 +434,13 @@ inline PhQ::Angle<NumericType> Vector<NumericType>::Angle(const Vector<NumericTy
   return PhQ::Angle{*this, other};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Angle>{2};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
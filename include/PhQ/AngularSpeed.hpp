@@ -281,6 +281,13 @@ inline constexpr Time<NumericType> Angle<NumericType>::operator/(
   return Time<NumericType>{*this, angular_speed};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<AngularSpeed>{3};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -250,6 +250,13 @@ inline constexpr Area<NumericType> Length<NumericType>::operator*(
   return Area<NumericType>{*this, length};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Area>{4};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
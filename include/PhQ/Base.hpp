@@ -26,20 +26,28 @@
 #define PHQ_BASE_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
 #include <climits>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -92,11 +100,179 @@ template <typename Enumeration>
 
 namespace Internal {
 
-/// \brief Map of spellings to their corresponding enumeration values. This is an internal
-/// implementation detail and is not intended to be used except by the PhQ::ParseEnumeration
-/// function.
+/// \brief Hashes a given spelling with the 64-bit FNV-1a hash function. Usable at compile time.
+/// Internal implementation detail not intended to be used outside of the
+/// PhQ::Internal::SpellingTable class.
+[[nodiscard]] constexpr std::uint64_t HashSpelling(const std::string_view spelling) noexcept {
+  std::uint64_t hash{14695981039346656037ULL};
+  for (const char character : spelling) {
+    hash ^= static_cast<unsigned char>(character);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/// \brief Scrambles the bits of a given hash combined with a given seed so that the resulting low
+/// bits depend on all of the bits of the hash. Usable at compile time. Internal implementation
+/// detail not intended to be used outside of the PhQ::Internal::SpellingTable class.
+[[nodiscard]] constexpr std::uint64_t MixHash(
+    const std::uint64_t hash, const std::uint64_t seed) noexcept {
+  std::uint64_t mixed{hash ^ (seed * 0x9E3779B97F4A7C15ULL)};
+  mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+  return mixed ^ (mixed >> 31);
+}
+
+/// \brief Compile-time perfect hash table of spellings and their corresponding enumeration values.
+/// Constructed entirely at compile time by the hash-and-displace method: each spelling is first
+/// assigned to a bucket, and then each bucket is assigned a seed such that all of its spellings
+/// occupy distinct free slots of the table. A lookup therefore hashes the given spelling once and
+/// then compares it against a single candidate. Requires no static initialization. Internal
+/// implementation detail not intended to be used outside of the PhQ::ParseEnumeration function.
+template <typename Enumeration, std::size_t NumberOfSpellings>
+class SpellingTable {
+public:
+  /// \brief Constructs a perfect hash table from a given list of spellings and their corresponding
+  /// enumeration values. Spellings must be non-empty and unique; otherwise, the construction fails
+  /// to compile when evaluated at compile time.
+  explicit constexpr SpellingTable(
+      const std::pair<std::string_view, Enumeration> (&spellings)[NumberOfSpellings]) {
+    std::array<std::size_t, NumberOfSpellings> buckets{};
+    std::array<std::size_t, NumberOfBuckets> bucket_sizes{};
+    std::size_t largest_bucket_size{0};
+    for (std::size_t index = 0; index < NumberOfSpellings; ++index) {
+      if (spellings[index].first.empty()) {
+        throw std::logic_error("Spellings must not be empty.");
+      }
+      buckets[index] = MixHash(HashSpelling(spellings[index].first), 0) % NumberOfBuckets;
+      largest_bucket_size = std::max(largest_bucket_size, ++bucket_sizes[buckets[index]]);
+    }
+
+    // Place the largest buckets first, while the table is still mostly empty.
+    std::array<bool, NumberOfSlots> occupied{};
+    for (std::size_t bucket_size = largest_bucket_size; bucket_size > 0; --bucket_size) {
+      for (std::size_t bucket = 0; bucket < NumberOfBuckets; ++bucket) {
+        if (bucket_sizes[bucket] == bucket_size) {
+          PlaceBucket(spellings, buckets, bucket, occupied);
+        }
+      }
+    }
+  }
+
+  /// \brief Returns the enumeration value that corresponds to a given spelling, or std::nullopt if
+  /// the given spelling is not in this table.
+  [[nodiscard]] constexpr std::optional<Enumeration> Find(
+      const std::string_view spelling) const noexcept {
+    if (spelling.empty()) {
+      return std::nullopt;
+    }
+    const std::uint64_t hash{HashSpelling(spelling)};
+    const std::size_t slot{static_cast<std::size_t>(
+        MixHash(hash, seeds_[MixHash(hash, 0) % NumberOfBuckets]) % NumberOfSlots)};
+    if (spellings_[slot] == spelling) {
+      return enumerations_[slot];
+    }
+    return std::nullopt;
+  }
+
+  /// \brief Returns whether a given enumeration value has at least one spelling in this table.
+  [[nodiscard]] constexpr bool Contains(const Enumeration enumeration) const noexcept {
+    for (std::size_t slot = 0; slot < NumberOfSlots; ++slot) {
+      if (!spellings_[slot].empty() && enumerations_[slot] == enumeration) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  /// \brief Number of buckets into which the spellings are first distributed.
+  static constexpr std::size_t NumberOfBuckets{NumberOfSpellings / 2 + 1};
+
+  /// \brief Number of slots of the table. A power of two that is at least twice the number of
+  /// spellings, such that the table is at most half full.
+  static constexpr std::size_t NumberOfSlots{[] {
+    std::size_t number_of_slots{1};
+    while (number_of_slots < 2 * NumberOfSpellings) {
+      number_of_slots *= 2;
+    }
+    return number_of_slots;
+  }()};
+
+  /// \brief Finds a seed for a given bucket such that all of its spellings hash to distinct free
+  /// slots, and then places the spellings in those slots.
+  constexpr void PlaceBucket(
+      const std::pair<std::string_view, Enumeration> (&spellings)[NumberOfSpellings],
+      const std::array<std::size_t, NumberOfSpellings>& buckets, const std::size_t bucket,
+      std::array<bool, NumberOfSlots>& occupied) {
+    std::array<std::size_t, NumberOfSpellings> slots{};
+    for (std::uint64_t seed = 1; seed <= 1000000; ++seed) {
+      bool placeable{true};
+      for (std::size_t index = 0; index < NumberOfSpellings && placeable; ++index) {
+        if (buckets[index] == bucket) {
+          slots[index] = static_cast<std::size_t>(
+              MixHash(HashSpelling(spellings[index].first), seed) % NumberOfSlots);
+          placeable = !occupied[slots[index]];
+          for (std::size_t other = 0; other < index && placeable; ++other) {
+            if (buckets[other] == bucket) {
+              if (spellings[other].first == spellings[index].first) {
+                throw std::logic_error("Spellings must be unique.");
+              }
+              placeable = slots[other] != slots[index];
+            }
+          }
+        }
+      }
+      if (placeable) {
+        seeds_[bucket] = seed;
+        for (std::size_t index = 0; index < NumberOfSpellings; ++index) {
+          if (buckets[index] == bucket) {
+            occupied[slots[index]] = true;
+            spellings_[slots[index]] = spellings[index].first;
+            enumerations_[slots[index]] = spellings[index].second;
+          }
+        }
+        return;
+      }
+    }
+    throw std::logic_error("Could not construct a perfect hash table of spellings.");
+  }
+
+  /// \brief Seed of each bucket.
+  std::array<std::uint64_t, NumberOfBuckets> seeds_{};
+
+  /// \brief Spelling in each slot. Empty for unoccupied slots.
+  std::array<std::string_view, NumberOfSlots> spellings_{};
+
+  /// \brief Enumeration value in each slot.
+  std::array<Enumeration, NumberOfSlots> enumerations_{};
+};
+
+/// \brief Constructs a compile-time perfect hash table from a given list of spellings and their
+/// corresponding enumeration values. The number of spellings is deduced from the list. Internal
+/// implementation detail not intended to be used outside of the definitions of the
+/// PhQ::Internal::Spellings tables.
+template <typename Enumeration, std::size_t NumberOfSpellings>
+[[nodiscard]] constexpr SpellingTable<Enumeration, NumberOfSpellings> MakeSpellingTable(
+    const std::pair<std::string_view, Enumeration> (&spellings)[NumberOfSpellings]) {
+  return SpellingTable<Enumeration, NumberOfSpellings>{spellings};
+}
+
+/// \brief Compile-time table of spellings and their corresponding enumeration values. Each
+/// enumeration type defines its own table with PhQ::Internal::MakeSpellingTable; the type of the
+/// table depends on its number of spellings. This is an internal implementation detail and is not
+/// intended to be used except by the PhQ::ParseEnumeration function.
 template <typename Enumeration>
-inline const std::unordered_map<std::string_view, Enumeration> Spellings;
+inline constexpr SpellingTable<Enumeration, 1> Spellings;
+
+/// \brief Identifier of a physical quantity type template in the binary format of the Physical
+/// Quantities library. Each physical quantity declares its identifier explicitly next to its
+/// definition. Identifiers are permanent: an identifier is never changed or reused, even if its
+/// physical quantity is renamed or removed, so that binary data remains readable regardless of the
+/// compiler and of the version of the library. Internal implementation detail not intended to be
+/// used outside of the PhQ::WriteBinary and PhQ::ReadBinary functions.
+template <template <typename> class QuantityTemplate>
+inline constexpr std::uint64_t BinaryTypeIdentifier;
 
 }  // namespace Internal
 
@@ -104,140 +280,418 @@ inline const std::unordered_map<std::string_view, Enumeration> Spellings;
 /// std::optional container that contains the resulting enumeration if successful, or std::nullopt
 /// if the given string could not be parsed into an enumeration of the given type.
 template <typename Enumeration>
-[[nodiscard]] std::optional<Enumeration> ParseEnumeration(const std::string_view spelling) {
-  const typename std::unordered_map<std::string_view, Enumeration>::const_iterator found{
-    Internal::Spellings<Enumeration>.find(spelling)};
-  if (found != Internal::Spellings<Enumeration>.cend()) {
-    return found->second;
+[[nodiscard]] constexpr std::optional<Enumeration> ParseEnumeration(
+    const std::string_view spelling) {
+  return Internal::Spellings<Enumeration>.Find(spelling);
+}
+
+namespace Internal {
+
+/// \brief Powers of ten from 10^0 to 10^22, all of which are exactly representable as doubles.
+/// Internal implementation detail not intended to be used outside of the PhQ::ParseNumber function.
+inline constexpr std::array<double, 23> ExactPowersOfTen{
+  1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,  1.0e8,  1.0e9,  1.0e10, 1.0e11,
+  1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+
+/// \brief Largest decimal exponent whose power of ten is exactly representable in the given
+/// floating-point numeric type. Internal implementation detail not intended to be used outside of
+/// the PhQ::ParseNumber function.
+template <typename NumericType>
+inline constexpr int MaximumExactDecimalExponent;
+
+template <>
+inline constexpr const int MaximumExactDecimalExponent<float>{10};
+
+template <>
+inline constexpr const int MaximumExactDecimalExponent<double>{22};
+
+/// \brief Attempts to parse the given string as a plain decimal floating-point number, such as
+/// "-12.5" or "3.2e5", whose significant digits and power of ten are both exactly representable in
+/// the given numeric type. In that case, a single multiplication or division yields the correctly
+/// rounded result, which is stored in the given number, and a pointer past the last parsed
+/// character is returned. Returns a null pointer for any other string, in which case the caller
+/// must fall back to a general parser. Internal implementation detail not intended to be used
+/// outside of the PhQ::ParseNumber function.
+template <typename NumericType>
+[[nodiscard]] inline const char* ParseExactDecimalNumber(
+    const char* first, const char* const last, NumericType& number) noexcept {
+  const bool negative{first < last && *first == '-'};
+  if (negative) {
+    ++first;
+  }
+  std::uint64_t significand{0};
+  int significant_digits{0};
+  int exponent{0};
+  bool has_digits{false};
+  for (; first < last && *first >= '0' && *first <= '9'; ++first) {
+    if (significant_digits == 19) {
+      return nullptr;
+    }
+    significand = 10 * significand + static_cast<std::uint64_t>(*first - '0');
+    significant_digits += significand != 0 ? 1 : 0;
+    has_digits = true;
+  }
+  if (first < last && *first == '.') {
+    for (++first; first < last && *first >= '0' && *first <= '9'; ++first) {
+      if (significant_digits == 19) {
+        return nullptr;
+      }
+      significand = 10 * significand + static_cast<std::uint64_t>(*first - '0');
+      significant_digits += significand != 0 ? 1 : 0;
+      --exponent;
+      has_digits = true;
+    }
+  }
+  if (!has_digits) {
+    return nullptr;
+  }
+  if (first < last && (*first == 'e' || *first == 'E')) {
+    const char* digit{first + 1};
+    const bool negative_exponent{digit < last && *digit == '-'};
+    if (digit < last && (*digit == '-' || *digit == '+')) {
+      ++digit;
+    }
+    if (digit < last && *digit >= '0' && *digit <= '9') {
+      int explicit_exponent{0};
+      for (; digit < last && *digit >= '0' && *digit <= '9'; ++digit) {
+        if (explicit_exponent > 1000) {
+          return nullptr;
+        }
+        explicit_exponent = 10 * explicit_exponent + (*digit - '0');
+      }
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+      first = digit;
+    }
+  }
+  if (significand == 0) {
+    number = negative ? -static_cast<NumericType>(0) : static_cast<NumericType>(0);
+    return first;
+  }
+  if (significand > (std::uint64_t{1} << std::numeric_limits<NumericType>::digits)
+      || exponent < -MaximumExactDecimalExponent<NumericType>
+      || exponent > MaximumExactDecimalExponent<NumericType>) {
+    return nullptr;
+  }
+  number = static_cast<NumericType>(significand);
+  if (exponent < 0) {
+    number /= static_cast<NumericType>(ExactPowersOfTen[static_cast<std::size_t>(-exponent)]);
+  } else {
+    number *= static_cast<NumericType>(ExactPowersOfTen[static_cast<std::size_t>(exponent)]);
+  }
+  if (negative) {
+    number = -number;
+  }
+  return first;
+}
+
+/// \brief Parses the given string, delimited by a given pair of pointers, as a floating-point
+/// number of the given numeric type without allocating memory and without throwing exceptions. Like
+/// std::strtod, leading whitespace and a leading plus sign are skipped, and parsing stops at the
+/// first character that cannot be part of the number. Plain decimal numbers take an exact fast
+/// path; other numbers, such as those with many significant digits, large exponents, hexadecimal
+/// digits, infinities, and NaNs, are parsed by std::from_chars. If successful, stores the result in
+/// the given number and returns a pointer past the last parsed character; otherwise, returns a null
+/// pointer.
+/// Internal implementation detail not intended to be used outside of the PhQ::ParseNumber and
+/// PhQ::Parse functions.
+template <typename NumericType>
+[[nodiscard]] inline const char* ParseFloatingPointNumber(
+    const char* first, const char* const last, NumericType& number) noexcept {
+  while (first < last && std::isspace(static_cast<unsigned char>(*first)) != 0) {
+    ++first;
+  }
+  if (first < last && *first == '+') {
+    ++first;
+    if (first < last && *first == '-') {
+      return nullptr;
+    }
+  }
+  // Hexadecimal numbers, such as "0x1.8p3", are accepted like std::strtod does. A "0x" prefix that
+  // is not followed by a hexadecimal digit is parsed as the number zero, also like std::strtod.
+  const char* const digits{first < last && *first == '-' ? first + 1 : first};
+  const bool hexadecimal{
+      last - digits > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')
+      && (std::isxdigit(static_cast<unsigned char>(digits[2])) != 0 || digits[2] == '.')};
+#ifdef __cpp_lib_to_chars
+  if (hexadecimal) {
+    const std::from_chars_result result{
+        std::from_chars(digits + 2, last, number, std::chars_format::hex)};
+    if (result.ec == std::errc()) {
+      if (digits != first) {
+        number = -number;
+      }
+      return result.ptr;
+    }
+    if (result.ec == std::errc::result_out_of_range) {
+      return nullptr;
+    }
+  }
+#endif
+  if constexpr (!std::is_same_v<NumericType, long double>) {
+    if (!hexadecimal) {
+      const char* const end{ParseExactDecimalNumber<NumericType>(first, last, number)};
+      if (end != nullptr) {
+        return end;
+      }
+    }
+  }
+#ifdef __cpp_lib_to_chars
+  const std::from_chars_result result{std::from_chars(first, last, number)};
+  if (result.ec != std::errc()) {
+    return nullptr;
+  }
+  return result.ptr;
+#else
+  // Fallback for standard libraries that do not implement std::from_chars for floating-point
+  // numbers: copy the string into a null-terminated buffer on the stack and use std::strtod. A
+  // string that does not fit in the buffer is rejected rather than truncated, since truncation
+  // could silently change the parsed value.
+  std::array<char, 128> buffer;
+  if (static_cast<std::size_t>(last - first) >= buffer.size()) {
+    return nullptr;
+  }
+  *std::copy(first, last, buffer.begin()) = '\0';
+  char* end{nullptr};
+  errno = 0;
+  if constexpr (std::is_same_v<NumericType, float>) {
+    number = std::strtof(buffer.data(), &end);
+  } else if constexpr (std::is_same_v<NumericType, double>) {
+    number = std::strtod(buffer.data(), &end);
+  } else {
+    number = std::strtold(buffer.data(), &end);
+  }
+  if (end == buffer.data() || errno == ERANGE) {
+    return nullptr;
   }
-  return std::nullopt;
+  return first + (end - buffer.data());
+#endif
 }
 
+/// \brief Parses the given string as a floating-point number of the given numeric type without
+/// allocating memory and without throwing exceptions. Internal implementation detail not intended
+/// to be used outside of the PhQ::ParseNumber function.
+template <typename NumericType>
+[[nodiscard]] inline std::optional<NumericType> ParseFloatingPointNumber(
+    const std::string_view string) noexcept {
+  NumericType number;
+  if (ParseFloatingPointNumber(string.data(), string.data() + string.size(), number) == nullptr) {
+    return std::nullopt;
+  }
+  return number;
+}
+
+}  // namespace Internal
+
 /// \brief Parses the given string as a number of the given numeric type. Returns a std::optional
 /// container that contains the resulting number if successful, or std::nullopt if the string could
-/// not be parsed into the given numeric type.
+/// not be parsed into the given numeric type. Neither allocates memory nor throws exceptions.
 /// \tparam NumericType Floating-point numeric type: float, double, or long double. Defaults to
 /// double if unspecified.
 template <typename NumericType = double>
-[[nodiscard]] inline std::optional<NumericType> ParseNumber(const std::string& string);
+[[nodiscard]] inline std::optional<NumericType> ParseNumber(const std::string_view string);
 
 /// \brief Parses the given string as a single-precision floating-point number (a float). Returns a
 /// std::optional container that contains the resulting number if successful, or std::nullopt if the
-/// string could not be parsed into a float.
+/// string could not be parsed into a float. Neither allocates memory nor throws exceptions.
 template <>
-[[nodiscard]] inline std::optional<float> ParseNumber(const std::string& string) {
-  float number;
-  try {
-    number = std::stof(string);
-  } catch (...) {
-    return std::nullopt;
-  }
-  return number;
+[[nodiscard]] inline std::optional<float> ParseNumber(const std::string_view string) {
+  return Internal::ParseFloatingPointNumber<float>(string);
 }
 
 /// \brief Parses the given string as a double-precision floating-point number (a double). Returns a
 /// std::optional container that contains the resulting number if successful, or std::nullopt if the
-/// string could not be parsed into a double.
+/// string could not be parsed into a double. Neither allocates memory nor throws exceptions.
 template <>
-[[nodiscard]] inline std::optional<double> ParseNumber(const std::string& string) {
-  double number;
-  try {
-    number = std::stod(string);
-  } catch (...) {
-    return std::nullopt;
-  }
-  return number;
+[[nodiscard]] inline std::optional<double> ParseNumber(const std::string_view string) {
+  return Internal::ParseFloatingPointNumber<double>(string);
 }
 
 /// \brief Parses the given string as an extended-precision floating-point number (a long double).
 /// Returns a std::optional container that contains the resulting number if successful, or
-/// std::nullopt if the string could not be parsed into a long double.
+/// std::nullopt if the string could not be parsed into a long double. Neither allocates memory nor
+/// throws exceptions.
 template <>
-[[nodiscard]] inline std::optional<long double> ParseNumber(const std::string& string) {
-  long double number;
-  try {
-    number = std::stold(string);
-  } catch (...) {
-    return std::nullopt;
-  }
-  return number;
+[[nodiscard]] inline std::optional<long double> ParseNumber(const std::string_view string) {
+  return Internal::ParseFloatingPointNumber<long double>(string);
 }
 
-/// \brief Prints a given floating-point number as a string. Prints enough digits to represent the
-/// number exactly. The printed number of digits depends on the type of the floating-point number.
-/// \tparam NumericType Floating-point numeric type of the given value. Deduced automatically.
+/// \brief Formats in which floating-point numbers are printed by the PhQ::Print function and by the
+/// Print, JSON, XML, and YAML methods of the Physical Quantities library's classes.
+enum class PrintFormat : int8_t {
+  /// \brief Prints a number of digits that depends only on the magnitude of the number and on its
+  /// floating-point type, which is always enough to represent the number exactly. Numbers of
+  /// similar magnitude are printed with the same width. This is the default format.
+  Full,
+
+  /// \brief Prints the fewest digits that parse back to exactly the same floating-point number.
+  /// Produces shorter strings than the full format, especially for numbers such as 0.1 that are
+  /// typed in by hand.
+  Shortest,
+};
+
+namespace Internal {
+
+/// \brief Format in which floating-point numbers are printed when no format is specified.
+/// Internal implementation detail not intended to be used outside of the PhQ::DefaultPrintFormat
+/// and PhQ::SetDefaultPrintFormat functions.
+inline std::atomic<PrintFormat> DefaultPrintFormat{PrintFormat::Full};
+
+}  // namespace Internal
+
+/// \brief Returns the format in which floating-point numbers are printed when no format is
+/// specified. Initially PhQ::PrintFormat::Full.
+[[nodiscard]] inline PrintFormat DefaultPrintFormat() noexcept {
+  return Internal::DefaultPrintFormat.load(std::memory_order_relaxed);
+}
+
+/// \brief Sets the format in which floating-point numbers are printed when no format is specified.
+/// Affects all threads, including the Print, JSON, XML, and YAML methods of all physical
+/// quantities.
+inline void SetDefaultPrintFormat(const PrintFormat format) noexcept {
+  Internal::DefaultPrintFormat.store(format, std::memory_order_relaxed);
+}
+
+namespace Internal {
+
+/// \brief Prints a given floating-point number into the character range [first, last[ and returns a
+/// pointer past the last printed character. Prints enough digits to represent the number exactly.
+/// The range must hold at least 64 characters. Never allocates memory. Internal implementation
+/// detail not intended to be used outside of the PhQ::Print and PhQ::AppendPrint functions.
 template <typename NumericType>
-[[nodiscard]] inline std::string Print(const NumericType value) {
-  static_assert(std::is_floating_point<NumericType>::value,
-                "The NumericType template parameter of PhQ::Print<NumericType> must be a numeric "
-                "floating-point type: float, double, or long double.");
+[[nodiscard]] inline char* PrintFloatingPointNumber(
+    char* const first, char* const last, const NumericType value) noexcept {
+  constexpr int digits{std::numeric_limits<NumericType>::max_digits10};
   const NumericType absolute{std::abs(value)};
-  std::ostringstream stream;
-  if (absolute < 1.0) {
-    // Interval: [0, 1[
-    if (absolute < 0.001) {
-      // Interval: [0, 0.001[
-      if (absolute == 0.0) {
-        // Interval: [0, 0]
-        stream << 0;
-      } else {
-        // Interval: ]0, 0.001[
-        stream << std::scientific
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10) << value;
-      }
-    } else {
-      // Interval: [0.001, 1[
-      if (absolute < 0.1) {
-        // Interval: [0.001, 0.1[
-        if (absolute < 0.01) {
-          // Interval: [0.001, 0.01[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 + 3) << value;
-        } else {
-          // Interval: [0.01, 0.1[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 + 2) << value;
-        }
-      } else {
-        // Interval: [0.1, 1[
-        stream << std::fixed
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10 + 1) << value;
-      }
-    }
+  if (absolute == 0.0) {
+    // Interval: [0, 0]
+    *first = '0';
+    return first + 1;
+  }
+  bool scientific{false};
+  int precision{digits};
+  if (absolute < 0.001) {
+    // Interval: ]0, 0.001[
+    scientific = true;
+  } else if (absolute < 0.01) {
+    // Interval: [0.001, 0.01[
+    precision = digits + 3;
+  } else if (absolute < 0.1) {
+    // Interval: [0.01, 0.1[
+    precision = digits + 2;
+  } else if (absolute < 1.0) {
+    // Interval: [0.1, 1[
+    precision = digits + 1;
+  } else if (absolute < 10.0) {
+    // Interval: [1, 10[
+    precision = digits;
+  } else if (absolute < 100.0) {
+    // Interval: [10, 100[
+    precision = digits - 1;
+  } else if (absolute < 1000.0) {
+    // Interval: [100, 1000[
+    precision = digits - 2;
+  } else if (absolute < 10000.0) {
+    // Interval: [1000, 10000[
+    precision = digits - 3;
   } else {
-    // Interval: [1, +inf[
-    if (absolute < 1000.0) {
-      // Interval: [1, 1000[
-      if (absolute < 10.0) {
-        // Interval: [1, 10[
-        stream << std::fixed << std::setprecision(std::numeric_limits<NumericType>::max_digits10)
-               << value;
-      } else {
-        // Interval: [10, 1000[
-        if (absolute < 100.0) {
-          // Interval: [10, 100[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 - 1) << value;
-        } else {
-          // Interval: [100, 1000[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 - 2) << value;
-        }
+    // Interval: [10000, +inf[
+    scientific = true;
+  }
+#ifdef __cpp_lib_to_chars
+  return std::to_chars(first, last, value,
+                       scientific ? std::chars_format::scientific : std::chars_format::fixed,
+                       precision)
+      .ptr;
+#else
+  // Fallback for standard libraries that do not implement std::to_chars for floating-point
+  // numbers. Produces the same output since both follow the std::printf conversion rules.
+  const std::size_t capacity{static_cast<std::size_t>(last - first)};
+  int size{0};
+  if constexpr (std::is_same_v<NumericType, long double>) {
+    size = std::snprintf(first, capacity, scientific ? "%.*Le" : "%.*Lf", precision, value);
+  } else {
+    size = std::snprintf(
+        first, capacity, scientific ? "%.*e" : "%.*f", precision, static_cast<double>(value));
+  }
+  return first + std::clamp(size, 0, static_cast<int>(last - first) - 1);
+#endif
+}
+
+/// \brief Prints a given floating-point number into the character range [first, last[ using the
+/// fewest digits that parse back to exactly the same number, and returns a pointer past the last
+/// printed character. The range must hold at least 64 characters. Never allocates memory. Internal
+/// implementation detail not intended to be used outside of the PhQ::Print and PhQ::AppendPrint
+/// functions.
+template <typename NumericType>
+[[nodiscard]] inline char* PrintShortestFloatingPointNumber(
+    char* const first, char* const last, const NumericType value) noexcept {
+  if (value == 0.0) {
+    *first = '0';
+    return first + 1;
+  }
+#ifdef __cpp_lib_to_chars
+  return std::to_chars(first, last, value).ptr;
+#else
+  // Fallback for standard libraries that do not implement std::to_chars for floating-point
+  // numbers: try increasing precisions until the printed number parses back to the same value.
+  const std::size_t capacity{static_cast<std::size_t>(last - first)};
+  int size{0};
+  for (int precision = 1; precision <= std::numeric_limits<NumericType>::max_digits10;
+       ++precision) {
+    if constexpr (std::is_same_v<NumericType, long double>) {
+      size = std::snprintf(first, capacity, "%.*Lg", precision, value);
+      if (std::strtold(first, nullptr) == value) {
+        break;
       }
     } else {
-      // Interval: [1000, +inf[
-      if (absolute < 10000.0) {
-        // Interval: [1000, 10000[
-        stream << std::fixed
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10 - 3) << value;
-      } else {
-        // Interval: [10000, +inf[
-        stream << std::scientific
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10) << value;
+      size = std::snprintf(first, capacity, "%.*g", precision, static_cast<double>(value));
+      if (static_cast<NumericType>(std::strtod(first, nullptr)) == value) {
+        break;
       }
     }
   }
-  return stream.str();
+  return first + std::clamp(size, 0, static_cast<int>(capacity) - 1);
+#endif
+}
+
+}  // namespace Internal
+
+/// \brief Prints a given floating-point number and appends it to the end of the given string. By
+/// default, prints enough digits to represent the number exactly; the printed number of digits
+/// depends on the type of the floating-point number. This function and the AppendPrint,
+/// AppendJSON, AppendXML, and AppendYAML methods of the physical quantities and their underlying
+/// types all append to a caller-provided string: reusing the same string across many calls avoids
+/// allocating memory each time.
+/// \tparam NumericType Floating-point numeric type of the given value. Deduced automatically.
+template <typename NumericType>
+inline void AppendPrint(std::string& buffer, const NumericType value,
+                        const PrintFormat format = DefaultPrintFormat()) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::AppendPrint<NumericType> must be a "
+                "numeric floating-point type: float, double, or long double.");
+  std::array<char, 64> characters;
+  char* const end{
+      format == PrintFormat::Shortest ?
+          Internal::PrintShortestFloatingPointNumber(
+              characters.data(), characters.data() + characters.size(), value) :
+          Internal::PrintFloatingPointNumber(
+              characters.data(), characters.data() + characters.size(), value)};
+  buffer.append(characters.data(), static_cast<std::size_t>(end - characters.data()));
+}
+
+/// \brief Prints a given floating-point number as a string. By default, prints enough digits to
+/// represent the number exactly; the printed number of digits depends on the type of the
+/// floating-point number.
+/// \tparam NumericType Floating-point numeric type of the given value. Deduced automatically.
+template <typename NumericType>
+[[nodiscard]] inline std::string Print(
+    const NumericType value, const PrintFormat format = DefaultPrintFormat()) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::Print<NumericType> must be a numeric "
+                "floating-point type: float, double, or long double.");
+  std::string result;
+  AppendPrint(result, value, format);
+  return result;
 }
 
 /// \brief Returns a copy of the given string where all characters are lowercase.
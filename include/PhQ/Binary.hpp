@@ -0,0 +1,301 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_BINARY_HPP
+#define PHQ_BINARY_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Base.hpp"
+#include "Dimensions.hpp"
+
+namespace PhQ {
+
+/// \brief Version of the binary format written by the PhQ::WriteBinary functions. The
+/// PhQ::ReadBinary function only reads data written in this version of the binary format.
+inline constexpr std::uint8_t BinaryFormatVersion{1};
+
+namespace Internal {
+
+/// \brief Whether the processor on which the program runs stores numbers in big-endian byte order.
+/// The binary format of the Physical Quantities library is always little-endian. Internal
+/// implementation detail not intended to be used outside of the PhQ::WriteBinary and
+/// PhQ::ReadBinary functions.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) \
+    && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr bool BigEndian{true};
+#else
+inline constexpr bool BigEndian{false};
+#endif
+
+/// \brief Signature at the start of every block of binary data. Internal implementation detail not
+/// intended to be used outside of the PhQ::WriteBinary and PhQ::ReadBinary functions.
+inline constexpr std::array<char, 4> BinarySignature{'P', 'h', 'Q', 'B'};
+
+/// \brief Number of bytes in the header of every block of binary data. The header consists of:
+/// - bytes 0 to 3: the signature "PhQB";
+/// - byte 4: the version of the binary format;
+/// - byte 5: the number of components of each physical quantity, such as 3 for a vector;
+/// - byte 6: the number of significant bytes of each component, such as 8 for a double;
+/// - byte 7: reserved, always 0;
+/// - bytes 8 to 14: the exponents of the seven independent base physical dimensions of the physical
+///   quantity, in the order time, length, mass, electric current, temperature, substance amount,
+///   and luminous intensity;
+/// - byte 15: reserved, always 0;
+/// - bytes 16 to 23: the permanent identifier of the type of the physical quantity, as declared by
+///   PhQ::Internal::BinaryTypeIdentifier, as a little-endian integer;
+/// - bytes 24 to 31: the number of physical quantities that follow, as a little-endian integer.
+///
+/// The raw little-endian components of the physical quantities follow the header, expressed in
+/// their standard units of measure. Only the significant bytes of each component are written, so
+/// the padding bytes of extended-precision long double components are omitted. Internal
+/// implementation detail not intended to be used outside of the PhQ::WriteBinary and
+/// PhQ::ReadBinary functions.
+inline constexpr std::size_t BinaryHeaderSize{32};
+
+/// \brief Numeric type of a physical quantity type. Internal implementation detail not intended to
+/// be used outside of the PhQ::WriteBinary and PhQ::ReadBinary functions.
+template <typename Quantity>
+struct BinaryNumericType;
+
+template <template <typename> class QuantityTemplate, typename NumericType>
+struct BinaryNumericType<QuantityTemplate<NumericType>> {
+  using Type = NumericType;
+};
+
+/// \brief Number of significant bytes of a component of a physical quantity. This is the size of
+/// the numeric type, except for the 80-bit extended-precision long double type of x86 processors,
+/// which is padded to 12 or 16 bytes in memory. The padding bytes hold indeterminate values and
+/// are therefore neither written nor read. Internal implementation detail not intended to be used
+/// outside of the PhQ::WriteBinary and PhQ::ReadBinary functions.
+template <typename NumericType>
+inline constexpr std::size_t BinaryComponentSize{
+    std::numeric_limits<NumericType>::digits == 64 && std::numeric_limits<NumericType>::radix == 2
+            && sizeof(NumericType) > 10 ?
+        10 :
+        sizeof(NumericType)};
+
+/// \brief Identifier of the type of a physical quantity: the identifier explicitly declared by its
+/// type template through PhQ::Internal::BinaryTypeIdentifier. Distinguishes physical quantities
+/// that share the same numeric type, number of components, and physical dimension, such as
+/// PhQ::ScalarStress and PhQ::YoungModulus, or PhQ::PoissonRatio and PhQ::ReynoldsNumber. Internal
+/// implementation detail not intended to be used outside of the PhQ::WriteBinary and
+/// PhQ::ReadBinary functions.
+template <typename Quantity>
+inline constexpr std::uint64_t BinaryQuantityTypeIdentifier;
+
+template <template <typename> class QuantityTemplate, typename NumericType>
+inline constexpr std::uint64_t BinaryQuantityTypeIdentifier<QuantityTemplate<NumericType>>{
+    BinaryTypeIdentifier<QuantityTemplate>};
+
+/// \brief Returns the header of a block of binary data that holds a given number of physical
+/// quantities of a given type. Internal implementation detail not intended to be used outside of
+/// the PhQ::WriteBinary and PhQ::ReadBinary functions.
+template <typename Quantity>
+[[nodiscard]] inline std::array<char, BinaryHeaderSize> BinaryHeader(const std::uint64_t size) {
+  using NumericType = typename BinaryNumericType<Quantity>::Type;
+  static_assert(std::is_trivially_copyable_v<Quantity> && std::is_standard_layout_v<Quantity>
+                    && sizeof(Quantity) % sizeof(NumericType) == 0,
+                "The physical quantities written in binary must store exactly their components "
+                "and nothing else.");
+  const PhQ::Dimensions dimensions{Quantity::Dimensions()};
+  std::array<char, BinaryHeaderSize> header{};
+  std::copy(BinarySignature.begin(), BinarySignature.end(), header.begin());
+  header[4] = static_cast<char>(BinaryFormatVersion);
+  header[5] = static_cast<char>(sizeof(Quantity) / sizeof(NumericType));
+  header[6] = static_cast<char>(BinaryComponentSize<NumericType>);
+  header[8] = static_cast<char>(dimensions.Time().Value());
+  header[9] = static_cast<char>(dimensions.Length().Value());
+  header[10] = static_cast<char>(dimensions.Mass().Value());
+  header[11] = static_cast<char>(dimensions.ElectricCurrent().Value());
+  header[12] = static_cast<char>(dimensions.Temperature().Value());
+  header[13] = static_cast<char>(dimensions.SubstanceAmount().Value());
+  header[14] = static_cast<char>(dimensions.LuminousIntensity().Value());
+  for (std::size_t index = 0; index < 8; ++index) {
+    header[16 + index] =
+        static_cast<char>((BinaryQuantityTypeIdentifier<Quantity> >> (8 * index)) & 0xFF);
+    header[24 + index] = static_cast<char>((size >> (8 * index)) & 0xFF);
+  }
+  return header;
+}
+
+/// \brief Whether the components of a physical quantity type are written directly from memory.
+/// This is the case on little-endian processors, unless the components contain padding bytes.
+/// Internal implementation detail not intended to be used outside of the PhQ::WriteBinary and
+/// PhQ::ReadBinary functions.
+template <typename Quantity>
+inline constexpr bool BinaryDirect{
+    !BigEndian
+    && BinaryComponentSize<typename BinaryNumericType<Quantity>::Type>
+           == sizeof(typename BinaryNumericType<Quantity>::Type)};
+
+/// \brief Number of bytes of a physical quantity in the binary format. Internal implementation
+/// detail not intended to be used outside of the PhQ::WriteBinary and PhQ::ReadBinary functions.
+template <typename Quantity>
+inline constexpr std::size_t BinaryQuantitySize{
+    sizeof(Quantity) / sizeof(typename BinaryNumericType<Quantity>::Type)
+    * BinaryComponentSize<typename BinaryNumericType<Quantity>::Type>};
+
+/// \brief Copies the significant bytes of each component of a given number of contiguous physical
+/// quantities into a given buffer in little-endian byte order. Internal implementation detail not
+/// intended to be used outside of the PhQ::WriteBinary function.
+template <typename Quantity>
+inline void PackBinary(
+    const Quantity* const quantities, const std::size_t size, char* bytes) noexcept {
+  using NumericType = typename BinaryNumericType<Quantity>::Type;
+  constexpr std::size_t width{BinaryComponentSize<NumericType>};
+  const char* component{reinterpret_cast<const char*>(quantities)};
+  const char* const end{component + size * sizeof(Quantity)};
+  for (; component < end; component += sizeof(NumericType), bytes += width) {
+    std::memcpy(bytes, component, width);
+    if constexpr (BigEndian) {
+      std::reverse(bytes, bytes + width);
+    }
+  }
+}
+
+/// \brief Copies the significant bytes of each component of a given number of contiguous physical
+/// quantities from a given buffer in little-endian byte order. The padding bytes of the components,
+/// if any, are set to zero. Internal implementation detail not intended to be used outside of the
+/// PhQ::ReadBinary function.
+template <typename Quantity>
+inline void UnpackBinary(
+    const char* bytes, const std::size_t size, Quantity* const quantities) noexcept {
+  using NumericType = typename BinaryNumericType<Quantity>::Type;
+  constexpr std::size_t width{BinaryComponentSize<NumericType>};
+  char* component{reinterpret_cast<char*>(quantities)};
+  char* const end{component + size * sizeof(Quantity)};
+  for (; component < end; component += sizeof(NumericType), bytes += width) {
+    std::memset(component, 0, sizeof(NumericType));
+    std::memcpy(component, bytes, width);
+    if constexpr (BigEndian) {
+      std::reverse(component, component + width);
+    }
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Writes a given number of contiguous physical quantities to a given output stream in the
+/// binary format of the Physical Quantities library. Writes a header that identifies the type,
+/// numeric type, and number of the physical quantities, followed by their raw little-endian
+/// components expressed in their standard units of measure. On little-endian processors, the
+/// components are written directly from the memory of the physical quantities in a single
+/// operation, unless they contain padding bytes, as extended-precision long double components do.
+/// Read the physical quantities back with the PhQ::ReadBinary function.
+template <typename Quantity>
+inline void WriteBinary(
+    std::ostream& stream, const Quantity* const quantities, const std::size_t size) {
+  const std::array<char, Internal::BinaryHeaderSize> header{
+      Internal::BinaryHeader<Quantity>(static_cast<std::uint64_t>(size))};
+  stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+  if constexpr (Internal::BinaryDirect<Quantity>) {
+    stream.write(reinterpret_cast<const char*>(quantities),
+                 static_cast<std::streamsize>(size * sizeof(Quantity)));
+  } else {
+    constexpr std::size_t chunk{256};
+    std::array<char, chunk * Internal::BinaryQuantitySize<Quantity>> bytes;
+    for (std::size_t first = 0; first < size; first += chunk) {
+      const std::size_t count{std::min(chunk, size - first)};
+      Internal::PackBinary(quantities + first, count, bytes.data());
+      stream.write(bytes.data(),
+                   static_cast<std::streamsize>(count * Internal::BinaryQuantitySize<Quantity>));
+    }
+  }
+}
+
+/// \brief Writes a collection of physical quantities to a given output stream in the binary format
+/// of the Physical Quantities library. Read the physical quantities back with the PhQ::ReadBinary
+/// function.
+template <typename Quantity>
+inline void WriteBinary(std::ostream& stream, const std::vector<Quantity>& quantities) {
+  WriteBinary(stream, quantities.data(), quantities.size());
+}
+
+/// \brief Writes a physical quantity to a given output stream in the binary format of the Physical
+/// Quantities library. Read the physical quantity back with the PhQ::ReadBinary function.
+template <typename Quantity>
+inline void WriteBinary(std::ostream& stream, const Quantity& quantity) {
+  WriteBinary(stream, &quantity, 1);
+}
+
+/// \brief Reads a collection of physical quantities of a given type from a given input stream in
+/// the binary format of the Physical Quantities library, as written by the PhQ::WriteBinary
+/// functions. Returns a std::optional container that contains the physical quantities if
+/// successful, or std::nullopt if the stream does not contain physical quantities of the given type
+/// and numeric type written in the current version of the binary format, or if the stream ends
+/// prematurely. Memory is allocated only as the physical quantities are read, so a corrupted header
+/// cannot cause a large allocation.
+/// \tparam Quantity Physical quantity type, such as PhQ::Stress<double> or PhQ::Velocity<float>.
+template <typename Quantity>
+[[nodiscard]] inline std::optional<std::vector<Quantity>> ReadBinary(std::istream& stream) {
+  const std::array<char, Internal::BinaryHeaderSize> expected{
+      Internal::BinaryHeader<Quantity>(0)};
+  std::array<char, Internal::BinaryHeaderSize> header;
+  if (!stream.read(header.data(), static_cast<std::streamsize>(header.size()))
+      || !std::equal(header.begin(), header.begin() + 24, expected.begin())) {
+    return std::nullopt;
+  }
+  std::uint64_t size{0};
+  for (std::size_t index = 0; index < 8; ++index) {
+    size |= static_cast<std::uint64_t>(static_cast<unsigned char>(header[24 + index]))
+            << (8 * index);
+  }
+  std::vector<Quantity> quantities;
+  std::vector<char> bytes;
+  constexpr std::uint64_t chunk{65536};
+  for (std::uint64_t first = 0; first < size; first += chunk) {
+    const std::size_t count{static_cast<std::size_t>(std::min(chunk, size - first))};
+    const std::size_t offset{quantities.size()};
+    quantities.resize(offset + count);
+    if constexpr (Internal::BinaryDirect<Quantity>) {
+      if (!stream.read(reinterpret_cast<char*>(quantities.data() + offset),
+                       static_cast<std::streamsize>(count * sizeof(Quantity)))) {
+        return std::nullopt;
+      }
+    } else {
+      bytes.resize(count * Internal::BinaryQuantitySize<Quantity>);
+      if (!stream.read(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+        return std::nullopt;
+      }
+      Internal::UnpackBinary(bytes.data(), count, quantities.data() + offset);
+    }
+  }
+  return quantities;
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_BINARY_HPP
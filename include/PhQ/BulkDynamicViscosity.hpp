@@ -189,6 +189,13 @@ inline constexpr BulkDynamicViscosity<NumericType> operator*(
   return mass_density * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<BulkDynamicViscosity>{5};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -29,6 +29,7 @@
 #include <functional>
 #include <ostream>
 #include <string>
+#include <type_traits>
 
 #include "Base.hpp"
 #include "Strain.hpp"
@@ -37,6 +38,103 @@
 
 namespace PhQ {
 
+namespace Internal {
+
+/// \brief Applies an isotropic linear map to a given number of contiguous symmetric dyadic tensors:
+/// output = a * input + b * trace(input) * identity_matrix. The tensors are given as sequences of
+/// their six components in the order xx, xy, xz, yy, yz, zz. Every isotropic linear constitutive
+/// model relates its stresses to its strains or strain rates through such a map. The components are
+/// converted to the evaluation numeric type of the coefficients, the map is evaluated in that
+/// numeric type, and the results are converted back. Internal implementation detail not intended
+/// to be used outside of the constitutive models.
+template <typename EvaluationNumericType, typename NumericType>
+inline void ApplyIsotropicLinearMapToComponents(
+    const EvaluationNumericType a, const EvaluationNumericType b, const NumericType* const input,
+    const std::size_t size, NumericType* const output) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    // Load all six components before storing any of them so that the compiler need not reload
+    // inputs that might alias the outputs.
+    const EvaluationNumericType xx{static_cast<EvaluationNumericType>(input[6 * index])};
+    const EvaluationNumericType xy{static_cast<EvaluationNumericType>(input[6 * index + 1])};
+    const EvaluationNumericType xz{static_cast<EvaluationNumericType>(input[6 * index + 2])};
+    const EvaluationNumericType yy{static_cast<EvaluationNumericType>(input[6 * index + 3])};
+    const EvaluationNumericType yz{static_cast<EvaluationNumericType>(input[6 * index + 4])};
+    const EvaluationNumericType zz{static_cast<EvaluationNumericType>(input[6 * index + 5])};
+    const EvaluationNumericType c{b * (xx + yy + zz)};
+    output[6 * index] = static_cast<NumericType>(a * xx + c);
+    output[6 * index + 1] = static_cast<NumericType>(a * xy);
+    output[6 * index + 2] = static_cast<NumericType>(a * xz);
+    output[6 * index + 3] = static_cast<NumericType>(a * yy + c);
+    output[6 * index + 4] = static_cast<NumericType>(a * yz);
+    output[6 * index + 5] = static_cast<NumericType>(a * zz + c);
+  }
+}
+
+/// \brief Applies an isotropic linear map to a given number of physical quantities whose values
+/// are symmetric dyadic tensors and stores the results in a given number of physical quantities of
+/// another type: output = a * input + b * trace(input) * identity_matrix. The map is evaluated in
+/// the numeric type of the coefficients. Internal implementation detail not intended to be used
+/// outside of the constitutive models.
+template <typename EvaluationNumericType, typename NumericType, template <typename> class Input,
+          template <typename> class Output>
+inline void ApplyIsotropicLinearMap(
+    const EvaluationNumericType a, const EvaluationNumericType b,
+    const Input<NumericType>* const inputs, const std::size_t size,
+    Output<NumericType>* const outputs) noexcept {
+  ApplyIsotropicLinearMapToComponents(
+      a, b, Components<6, const NumericType>(inputs), size, Components<6, NumericType>(outputs));
+}
+
+/// \brief Applies an isotropic linear map to the symmetric parts of a given number of contiguous
+/// dyadic tensors: output = a * symmetric(input) + b * trace(input) * identity_matrix, where
+/// symmetric(input) = (input + transpose(input)) / 2. The inputs are given as sequences of their
+/// nine components in the order xx, xy, xz, yx, yy, yz, zx, zy, zz, and the outputs as sequences of
+/// their six components in the order xx, xy, xz, yy, yz, zz. This fuses the symmetrization of a
+/// velocity gradient into a strain rate, or of a displacement gradient into a strain, with the
+/// constitutive map, in a single pass over the nine components without forming the symmetric part.
+/// Internal implementation detail not intended to be used outside of the constitutive models.
+template <typename EvaluationNumericType, typename NumericType>
+inline void ApplyIsotropicLinearMapToSymmetricPartOfComponents(
+    const EvaluationNumericType a, const EvaluationNumericType b, const NumericType* const input,
+    const std::size_t size, NumericType* const output) noexcept {
+  const EvaluationNumericType half_a{static_cast<EvaluationNumericType>(0.5) * a};
+  for (std::size_t index = 0; index < size; ++index) {
+    const EvaluationNumericType xx{static_cast<EvaluationNumericType>(input[9 * index])};
+    const EvaluationNumericType xy{static_cast<EvaluationNumericType>(input[9 * index + 1])};
+    const EvaluationNumericType xz{static_cast<EvaluationNumericType>(input[9 * index + 2])};
+    const EvaluationNumericType yx{static_cast<EvaluationNumericType>(input[9 * index + 3])};
+    const EvaluationNumericType yy{static_cast<EvaluationNumericType>(input[9 * index + 4])};
+    const EvaluationNumericType yz{static_cast<EvaluationNumericType>(input[9 * index + 5])};
+    const EvaluationNumericType zx{static_cast<EvaluationNumericType>(input[9 * index + 6])};
+    const EvaluationNumericType zy{static_cast<EvaluationNumericType>(input[9 * index + 7])};
+    const EvaluationNumericType zz{static_cast<EvaluationNumericType>(input[9 * index + 8])};
+    const EvaluationNumericType c{b * (xx + yy + zz)};
+    output[6 * index] = static_cast<NumericType>(a * xx + c);
+    output[6 * index + 1] = static_cast<NumericType>(half_a * (xy + yx));
+    output[6 * index + 2] = static_cast<NumericType>(half_a * (xz + zx));
+    output[6 * index + 3] = static_cast<NumericType>(a * yy + c);
+    output[6 * index + 4] = static_cast<NumericType>(half_a * (yz + zy));
+    output[6 * index + 5] = static_cast<NumericType>(a * zz + c);
+  }
+}
+
+/// \brief Applies an isotropic linear map to the symmetric parts of a given number of physical
+/// quantities whose values are dyadic tensors and stores the results in a given number of physical
+/// quantities whose values are symmetric dyadic tensors: output = a * symmetric(input) + b *
+/// trace(input) * identity_matrix. The map is evaluated in the numeric type of the coefficients.
+/// Internal implementation detail not intended to be used outside of the constitutive models.
+template <typename EvaluationNumericType, typename NumericType, template <typename> class Input,
+          template <typename> class Output>
+inline void ApplyIsotropicLinearMapToSymmetricPart(
+    const EvaluationNumericType a, const EvaluationNumericType b,
+    const Input<NumericType>* const inputs, const std::size_t size,
+    Output<NumericType>* const outputs) noexcept {
+  ApplyIsotropicLinearMapToSymmetricPartOfComponents(
+      a, b, Components<9, const NumericType>(inputs), size, Components<6, NumericType>(outputs));
+}
+
+}  // namespace Internal
+
 /// \brief Abstract base class for a material's constitutive model, which is a model that defines
 /// the relationship between the stress and the strain and strain rate at any point in the material.
 class ConstitutiveModel {
@@ -53,6 +151,10 @@ public:
   template <typename NumericType = double>
   class IncompressibleNewtonianFluid;
 
+  // Forward declaration for class PhQ::ConstitutiveModel.
+  template <typename NumericType = double>
+  class Variant;
+
   /// \brief Type of a material's constitutive model.
   enum class Type : int8_t {
     /// \brief Compressible Newtonian fluid constitutive model
@@ -65,6 +167,30 @@ public:
     IncompressibleNewtonianFluid,
   };
 
+  /// \brief Mixed-precision policy of a constitutive model. Determines the numeric type in which a
+  /// constitutive model whose parameters are stored in one numeric type evaluates strains, strain
+  /// rates, or stresses of another numeric type. In both cases, the coefficients of the
+  /// constitutive model are computed in the numeric type of its parameters and rounded only once.
+  enum class MixedPrecision : int8_t {
+    /// \brief Evaluates in the wider of the two numeric types. For example, a constitutive model
+    /// whose parameters are stored in double precision evaluates single-precision strains in double
+    /// precision and rounds only the results to single precision. This is the default policy.
+    Widest,
+
+    /// \brief Evaluates in the numeric type of the strains, strain rates, or stresses. For example,
+    /// a constitutive model whose parameters are stored in double precision evaluates
+    /// single-precision strains in single precision. This trades accuracy for throughput.
+    Input,
+  };
+
+  /// \brief Numeric type in which a constitutive model whose parameters are stored in a given
+  /// numeric type evaluates strains, strain rates, or stresses of another given numeric type under
+  /// a given mixed-precision policy.
+  template <MixedPrecision Policy, typename NumericType, typename OtherNumericType>
+  using EvaluationNumericType =
+      std::conditional_t<Policy == MixedPrecision::Widest,
+                         std::common_type_t<NumericType, OtherNumericType>, OtherNumericType>;
+
   /// \brief Default constructor. Constructs this constitutive model.
   constexpr ConstitutiveModel() = default;
 
@@ -147,6 +273,149 @@ public:
   [[nodiscard]] virtual inline PhQ::StrainRate<long double> StrainRate(
       const PhQ::Stress<long double>& stress) const = 0;
 
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates and
+  /// stores them in a given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::Strain<float>* const strains,
+                               const PhQ::StrainRate<float>* const strain_rates,
+                               const std::size_t size, PhQ::Stress<float>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strains[index], strain_rates[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates and
+  /// stores them in a given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::Strain<double>* const strains,
+                               const PhQ::StrainRate<double>* const strain_rates,
+                               const std::size_t size, PhQ::Stress<double>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strains[index], strain_rates[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates and
+  /// stores them in a given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::Strain<long double>* const strains,
+                               const PhQ::StrainRate<long double>* const strain_rates,
+                               const std::size_t size,
+                               PhQ::Stress<long double>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strains[index], strain_rates[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and stores them in a
+  /// given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::Strain<float>* const strains, const std::size_t size,
+                               PhQ::Stress<float>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strains[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and stores them in a
+  /// given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::Strain<double>* const strains, const std::size_t size,
+                               PhQ::Stress<double>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strains[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and stores them in a
+  /// given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::Strain<long double>* const strains,
+                               const std::size_t size,
+                               PhQ::Stress<long double>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strains[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates and stores them in
+  /// a given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::StrainRate<float>* const strain_rates,
+                               const std::size_t size, PhQ::Stress<float>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strain_rates[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates and stores them in
+  /// a given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::StrainRate<double>* const strain_rates,
+                               const std::size_t size, PhQ::Stress<double>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strain_rates[index]);
+    }
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates and stores them in
+  /// a given array. Evaluates each point in turn unless overridden.
+  virtual inline void Stresses(const PhQ::StrainRate<long double>* const strain_rates,
+                               const std::size_t size,
+                               PhQ::Stress<long double>* const stresses) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      stresses[index] = Stress(strain_rates[index]);
+    }
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses and stores them in a
+  /// given array. Evaluates each point in turn unless overridden.
+  virtual inline void Strains(const PhQ::Stress<float>* const stresses, const std::size_t size,
+                              PhQ::Strain<float>* const strains) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      strains[index] = Strain(stresses[index]);
+    }
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses and stores them in a
+  /// given array. Evaluates each point in turn unless overridden.
+  virtual inline void Strains(const PhQ::Stress<double>* const stresses, const std::size_t size,
+                              PhQ::Strain<double>* const strains) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      strains[index] = Strain(stresses[index]);
+    }
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses and stores them in a
+  /// given array. Evaluates each point in turn unless overridden.
+  virtual inline void Strains(const PhQ::Stress<long double>* const stresses,
+                              const std::size_t size,
+                              PhQ::Strain<long double>* const strains) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      strains[index] = Strain(stresses[index]);
+    }
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses and stores them in
+  /// a given array. Evaluates each point in turn unless overridden.
+  virtual inline void StrainRates(const PhQ::Stress<float>* const stresses, const std::size_t size,
+                                  PhQ::StrainRate<float>* const strain_rates) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      strain_rates[index] = StrainRate(stresses[index]);
+    }
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses and stores them in
+  /// a given array. Evaluates each point in turn unless overridden.
+  virtual inline void StrainRates(const PhQ::Stress<double>* const stresses, const std::size_t size,
+                                  PhQ::StrainRate<double>* const strain_rates) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      strain_rates[index] = StrainRate(stresses[index]);
+    }
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses and stores them in
+  /// a given array. Evaluates each point in turn unless overridden.
+  virtual inline void StrainRates(const PhQ::Stress<long double>* const stresses,
+                                  const std::size_t size,
+                                  PhQ::StrainRate<long double>* const strain_rates) const {
+    for (std::size_t index = 0; index < size; ++index) {
+      strain_rates[index] = StrainRate(stresses[index]);
+    }
+  }
+
   /// \brief Prints this constitutive model as a string.
   [[nodiscard]] virtual inline std::string Print() const = 0;
 
@@ -169,8 +438,8 @@ inline const std::map<typename ConstitutiveModel::Type, std::string_view> Intern
 };
 
 template <>
-inline const std::unordered_map<std::string_view, typename ConstitutiveModel::Type> Internal::
-    Spellings<typename ConstitutiveModel::Type>{
+inline constexpr auto Internal::Spellings<typename ConstitutiveModel::Type>{
+    Internal::MakeSpellingTable<typename ConstitutiveModel::Type>({
       {"Elastic Isotropic Solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
       {"ELASTIC ISOTROPIC SOLID",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
       {"elastic isotropic solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
@@ -189,7 +458,7 @@ inline const std::unordered_map<std::string_view, typename ConstitutiveModel::Ty
       {"CompressibleNewtonianFluid",     ConstitutiveModel::Type::CompressibleNewtonianFluid  },
       {"COMPRESSIBLE_NEWTONIAN_FLUID",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
       {"compressible_newtonian_fluid",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
-};
+})};
 
 inline std::ostream& operator<<(std::ostream& stream, const ConstitutiveModel& model) {
   stream << model.Print();
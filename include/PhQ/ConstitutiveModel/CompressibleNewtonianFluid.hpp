@@ -25,6 +25,7 @@
 #ifndef PHQ_CONSTITUTIVE_MODEL_COMPRESSIBLE_NEWTONIAN_FLUID_HPP
 #define PHQ_CONSTITUTIVE_MODEL_COMPRESSIBLE_NEWTONIAN_FLUID_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <ostream>
@@ -37,9 +38,7 @@
 #include "../Strain.hpp"
 #include "../StrainRate.hpp"
 #include "../Stress.hpp"
-#include "../SymmetricDyad.hpp"
-#include "../Unit/Frequency.hpp"
-#include "../Unit/Pressure.hpp"
+#include "../VelocityGradient.hpp"
 
 namespace PhQ {
 
@@ -159,53 +158,25 @@ public:
   /// \brief Returns the stress resulting from a given strain rate.
   [[nodiscard]] inline PhQ::Stress<float> Stress(
       const PhQ::StrainRate<float>& strain_rate) const override {
-    // stress = a * strain_rate + b * trace(strain_rate) * identity_matrix
-    // a = 2 * dynamic_viscosity
-    // b = bulk_dynamic_viscosity
-    const float a{static_cast<float>(2) * static_cast<float>(dynamic_viscosity.Value())};
-    const float b{static_cast<float>(bulk_dynamic_viscosity.Value())
-                  * static_cast<float>(strain_rate.Value().Trace())};
-    return PhQ::Stress<float>{
-      SymmetricDyad<float>{a * static_cast<SymmetricDyad<float>>(strain_rate.Value())}
-          + SymmetricDyad<float>{b, static_cast<float>(0), static_cast<float>(0), b,
-                           static_cast<float>(0), b},
-      Standard<Unit::Pressure>
-    };
+    PhQ::Stress<float> stress;
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(&strain_rate, 1, &stress);
+    return stress;
   }
 
   /// \brief Returns the stress resulting from a given strain rate.
   [[nodiscard]] inline PhQ::Stress<double> Stress(
       const PhQ::StrainRate<double>& strain_rate) const override {
-    // stress = a * strain_rate + b * trace(strain_rate) * identity_matrix
-    // a = 2 * dynamic_viscosity
-    // b = bulk_dynamic_viscosity
-    const double a{static_cast<double>(2) * static_cast<double>(dynamic_viscosity.Value())};
-    const double b{static_cast<double>(bulk_dynamic_viscosity.Value())
-                   * static_cast<double>(strain_rate.Value().Trace())};
-    return PhQ::Stress<double>{
-      SymmetricDyad<double>{a * static_cast<SymmetricDyad<double>>(strain_rate.Value())}
-          + SymmetricDyad<double>{b, static_cast<double>(0), static_cast<double>(0), b,
-                            static_cast<double>(0), b},
-      Standard<Unit::Pressure>
-    };
+    PhQ::Stress<double> stress;
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(&strain_rate, 1, &stress);
+    return stress;
   }
 
   /// \brief Returns the stress resulting from a given strain rate.
   [[nodiscard]] inline PhQ::Stress<long double> Stress(
       const PhQ::StrainRate<long double>& strain_rate) const override {
-    // stress = a * strain_rate + b * trace(strain_rate) * identity_matrix
-    // a = 2 * dynamic_viscosity
-    // b = bulk_dynamic_viscosity
-    const long double a{
-      static_cast<long double>(2) * static_cast<long double>(dynamic_viscosity.Value())};
-    const long double b{static_cast<long double>(bulk_dynamic_viscosity.Value())
-                        * static_cast<long double>(strain_rate.Value().Trace())};
-    return PhQ::Stress<long double>{
-      SymmetricDyad<long double>{a * static_cast<SymmetricDyad<long double>>(strain_rate.Value())}
-          + SymmetricDyad<long double>{b, static_cast<long double>(0), static_cast<long double>(0),
-                                 b, static_cast<long double>(0), b},
-      Standard<Unit::Pressure>
-    };
+    PhQ::Stress<long double> stress;
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(&strain_rate, 1, &stress);
+    return stress;
   }
 
   /// \brief Returns the strain resulting from a given stress. Since this is a compressible
@@ -235,72 +206,243 @@ public:
   /// \brief Returns the strain rate resulting from a given stress.
   [[nodiscard]] inline PhQ::StrainRate<float> StrainRate(
       const PhQ::Stress<float>& stress) const override {
-    // strain_rate = a * stress + b * trace(stress) * identity_matrix
-    // a = 1 / (2 * dynamic_viscosity)
-    // b = -1 * bulk_dynamic_viscosity /
-    //     (2 * dynamic_viscosity * (2 * dynamic_viscosity + 3 * bulk_dynamic_viscosity))
-    const float a{static_cast<float>(1)
-                  / (static_cast<float>(2) * static_cast<float>(dynamic_viscosity.Value()))};
-    const float b{
-      static_cast<float>(-bulk_dynamic_viscosity.Value())
-      / (static_cast<float>(2) * static_cast<float>(dynamic_viscosity.Value())
-         * (static_cast<float>(2) * static_cast<float>(dynamic_viscosity.Value())
-            + static_cast<float>(3) * static_cast<float>(bulk_dynamic_viscosity.Value())))};
-    const float c{b * static_cast<float>(stress.Value().Trace())};
-    return PhQ::StrainRate<float>{
-      a * static_cast<SymmetricDyad<float>>(stress.Value())
-          + SymmetricDyad<float>{c, static_cast<float>(0), static_cast<float>(0), c,
-                                 static_cast<float>(0), c},
-      Standard<Unit::Frequency>
-    };
+    PhQ::StrainRate<float> strain_rate;
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(&stress, 1, &strain_rate);
+    return strain_rate;
   }
 
   /// \brief Returns the strain rate resulting from a given stress.
   [[nodiscard]] inline PhQ::StrainRate<double> StrainRate(
       const PhQ::Stress<double>& stress) const override {
-    // strain_rate = a * stress + b * trace(stress) * identity_matrix
-    // a = 1 / (2 * dynamic_viscosity)
-    // b = -1 * bulk_dynamic_viscosity /
-    //     (2 * dynamic_viscosity * (2 * dynamic_viscosity + 3 * bulk_dynamic_viscosity))
-    const double a{static_cast<double>(1)
-                   / (static_cast<double>(2) * static_cast<double>(dynamic_viscosity.Value()))};
-    const double b{
-      static_cast<double>(-bulk_dynamic_viscosity.Value())
-      / (static_cast<double>(2) * static_cast<double>(dynamic_viscosity.Value())
-         * (static_cast<double>(2) * static_cast<double>(dynamic_viscosity.Value())
-            + static_cast<double>(3) * static_cast<double>(bulk_dynamic_viscosity.Value())))};
-    const double c{b * static_cast<double>(stress.Value().Trace())};
-    return PhQ::StrainRate<double>{
-      a * static_cast<SymmetricDyad<double>>(stress.Value())
-          + SymmetricDyad<double>{c, static_cast<double>(0), static_cast<double>(0), c,
-                                  static_cast<double>(0), c},
-      Standard<Unit::Frequency>
-    };
+    PhQ::StrainRate<double> strain_rate;
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(&stress, 1, &strain_rate);
+    return strain_rate;
   }
 
   /// \brief Returns the strain rate resulting from a given stress.
   [[nodiscard]] inline PhQ::StrainRate<long double> StrainRate(
       const PhQ::Stress<long double>& stress) const override {
+    PhQ::StrainRate<long double> strain_rate;
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(&stress, 1, &strain_rate);
+    return strain_rate;
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates. Since
+  /// this is a compressible Newtonian fluid constitutive model, the strains do not contribute to
+  /// the stresses and are ignored.
+  inline void Stresses(const PhQ::Strain<float>* const strains,
+                       const PhQ::StrainRate<float>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<float>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates. Since
+  /// this is a compressible Newtonian fluid constitutive model, the strains do not contribute to
+  /// the stresses and are ignored.
+  inline void Stresses(const PhQ::Strain<double>* const strains,
+                       const PhQ::StrainRate<double>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates. Since
+  /// this is a compressible Newtonian fluid constitutive model, the strains do not contribute to
+  /// the stresses and are ignored.
+  inline void Stresses(const PhQ::Strain<long double>* const strains,
+                       const PhQ::StrainRate<long double>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<long double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains. Since this is a
+  /// compressible Newtonian fluid constitutive model, the strains do not contribute to the
+  /// stresses, so this always fills the stresses with zero.
+  inline void Stresses(const PhQ::Strain<float>* const strains, const std::size_t size,
+                       PhQ::Stress<float>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains. Since this is a
+  /// compressible Newtonian fluid constitutive model, the strains do not contribute to the
+  /// stresses, so this always fills the stresses with zero.
+  inline void Stresses(const PhQ::Strain<double>* const strains, const std::size_t size,
+                       PhQ::Stress<double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains. Since this is a
+  /// compressible Newtonian fluid constitutive model, the strains do not contribute to the
+  /// stresses, so this always fills the stresses with zero.
+  inline void Stresses(const PhQ::Strain<long double>* const strains, const std::size_t size,
+                       PhQ::Stress<long double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates.
+  inline void Stresses(const PhQ::StrainRate<float>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<float>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates.
+  inline void Stresses(const PhQ::StrainRate<double>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates.
+  inline void Stresses(const PhQ::StrainRate<long double>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<long double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses. Since this is a
+  /// compressible Newtonian fluid constitutive model, stress does not depend on strain, so this
+  /// always fills the strains with zero.
+  inline void Strains(const PhQ::Stress<float>* const stresses, const std::size_t size,
+                      PhQ::Strain<float>* const strains) const override {
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strains);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses. Since this is a
+  /// compressible Newtonian fluid constitutive model, stress does not depend on strain, so this
+  /// always fills the strains with zero.
+  inline void Strains(const PhQ::Stress<double>* const stresses, const std::size_t size,
+                      PhQ::Strain<double>* const strains) const override {
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strains);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses. Since this is a
+  /// compressible Newtonian fluid constitutive model, stress does not depend on strain, so this
+  /// always fills the strains with zero.
+  inline void Strains(const PhQ::Stress<long double>* const stresses, const std::size_t size,
+                      PhQ::Strain<long double>* const strains) const override {
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strains);
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses.
+  inline void StrainRates(const PhQ::Stress<float>* const stresses, const std::size_t size,
+                          PhQ::StrainRate<float>* const strain_rates) const override {
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strain_rates);
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses.
+  inline void StrainRates(const PhQ::Stress<double>* const stresses, const std::size_t size,
+                          PhQ::StrainRate<double>* const strain_rates) const override {
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strain_rates);
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses.
+  inline void StrainRates(const PhQ::Stress<long double>* const stresses, const std::size_t size,
+                          PhQ::StrainRate<long double>* const strain_rates) const override {
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strain_rates);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates under a
+  /// given mixed-precision policy. Since this is a compressible Newtonian fluid constitutive model,
+  /// the strains do not contribute to the stresses and are ignored.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Stresses(const PhQ::Strain<OtherNumericType>* const /*strains*/,
+                       const PhQ::StrainRate<OtherNumericType>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    Stresses<Policy>(strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains under a given
+  /// mixed-precision policy. Since this is a compressible Newtonian fluid constitutive model, the
+  /// strains do not contribute to the stresses, so this always fills the stresses with zero.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Stresses(const PhQ::Strain<OtherNumericType>* const /*strains*/,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    std::fill(stresses, stresses + size, PhQ::Stress<OtherNumericType>::Zero());
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates under a given
+  /// mixed-precision policy. The coefficients are computed in the numeric type of this constitutive
+  /// model and then evaluated in the numeric type selected by the policy.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Stresses(const PhQ::StrainRate<OtherNumericType>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    // stress = a * strain_rate + b * trace(strain_rate) * identity_matrix
+    // a = 2 * dynamic_viscosity
+    // b = bulk_dynamic_viscosity
+    const NumericType a{static_cast<NumericType>(2) * dynamic_viscosity.Value()};
+    const NumericType b{bulk_dynamic_viscosity.Value()};
+    using EvaluationNumericType =
+        ConstitutiveModel::EvaluationNumericType<Policy, NumericType, OtherNumericType>;
+    Internal::ApplyIsotropicLinearMap(
+        static_cast<EvaluationNumericType>(a), static_cast<EvaluationNumericType>(b), strain_rates,
+        size, stresses);
+  }
+
+  /// \brief Returns the stress resulting from a given velocity gradient. This is equivalent to
+  /// computing the stress resulting from the strain rate of the velocity gradient, but makes a
+  /// single pass over the nine components of the velocity gradient without forming the strain rate.
+  template <typename OtherNumericType>
+  [[nodiscard]] inline PhQ::Stress<OtherNumericType> Stress(
+      const PhQ::VelocityGradient<OtherNumericType>& velocity_gradient) const {
+    PhQ::Stress<OtherNumericType> stress;
+    Stresses(&velocity_gradient, 1, &stress);
+    return stress;
+  }
+
+  /// \brief Computes the stresses resulting from a given number of velocity gradients under a given
+  /// mixed-precision policy. This is equivalent to computing the stresses resulting from the strain
+  /// rates of the velocity gradients, but makes a single pass over the nine components of each
+  /// velocity gradient without forming the strain rates.
+  template <ConstitutiveModel::MixedPrecision Policy = ConstitutiveModel::MixedPrecision::Widest,
+            typename OtherNumericType>
+  inline void Stresses(const PhQ::VelocityGradient<OtherNumericType>* const velocity_gradients,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    // stress = a * symmetric(velocity_gradient) + b * trace(velocity_gradient) * identity_matrix
+    // a = 2 * dynamic_viscosity
+    // b = bulk_dynamic_viscosity
+    const NumericType a{static_cast<NumericType>(2) * dynamic_viscosity.Value()};
+    const NumericType b{bulk_dynamic_viscosity.Value()};
+    using EvaluationNumericType =
+        ConstitutiveModel::EvaluationNumericType<Policy, NumericType, OtherNumericType>;
+    Internal::ApplyIsotropicLinearMapToSymmetricPart(
+        static_cast<EvaluationNumericType>(a), static_cast<EvaluationNumericType>(b),
+        velocity_gradients, size, stresses);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses under a given
+  /// mixed-precision policy. Since this is a compressible Newtonian fluid constitutive model,
+  /// stress does not depend on strain, so this always fills the strains with zero.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Strains(const PhQ::Stress<OtherNumericType>* const /*stresses*/,
+                      const std::size_t size, PhQ::Strain<OtherNumericType>* const strains) const {
+    std::fill(strains, strains + size, PhQ::Strain<OtherNumericType>::Zero());
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses under a given
+  /// mixed-precision policy. The coefficients are computed in the numeric type of this constitutive
+  /// model and then evaluated in the numeric type selected by the policy.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void StrainRates(const PhQ::Stress<OtherNumericType>* const stresses,
+                          const std::size_t size,
+                          PhQ::StrainRate<OtherNumericType>* const strain_rates) const {
     // strain_rate = a * stress + b * trace(stress) * identity_matrix
     // a = 1 / (2 * dynamic_viscosity)
     // b = -1 * bulk_dynamic_viscosity /
     //     (2 * dynamic_viscosity * (2 * dynamic_viscosity + 3 * bulk_dynamic_viscosity))
-    const long double a{
-      static_cast<long double>(1)
-      / (static_cast<long double>(2) * static_cast<long double>(dynamic_viscosity.Value()))};
-    const long double b{
-      static_cast<long double>(-bulk_dynamic_viscosity.Value())
-      / (static_cast<long double>(2) * static_cast<long double>(dynamic_viscosity.Value())
-         * (static_cast<long double>(2) * static_cast<long double>(dynamic_viscosity.Value())
-            + static_cast<long double>(3)
-                  * static_cast<long double>(bulk_dynamic_viscosity.Value())))};
-    const long double c{b * static_cast<long double>(stress.Value().Trace())};
-    return PhQ::StrainRate<long double>{
-      a * static_cast<SymmetricDyad<long double>>(stress.Value())
-          + SymmetricDyad<long double>{c, static_cast<long double>(0), static_cast<long double>(0),
-                                       c, static_cast<long double>(0), c},
-      Standard<Unit::Frequency>
-    };
+    const NumericType a{
+      static_cast<NumericType>(1) / (static_cast<NumericType>(2) * dynamic_viscosity.Value())};
+    const NumericType b{-bulk_dynamic_viscosity.Value()
+                        / (static_cast<NumericType>(2) * dynamic_viscosity.Value()
+                           * (static_cast<NumericType>(2) * dynamic_viscosity.Value()
+                              + static_cast<NumericType>(3) * bulk_dynamic_viscosity.Value()))};
+    using EvaluationNumericType =
+        ConstitutiveModel::EvaluationNumericType<Policy, NumericType, OtherNumericType>;
+    Internal::ApplyIsotropicLinearMap(
+        static_cast<EvaluationNumericType>(a), static_cast<EvaluationNumericType>(b), stresses,
+        size, strain_rates);
   }
 
   /// \brief Prints this compressible Newtonian fluid constitutive model as a string.
@@ -337,6 +479,7 @@ private:
 
   /// \brief Bulk dynamic viscosity of this compressible Newtonian fluid constitutive model.
   PhQ::BulkDynamicViscosity<NumericType> bulk_dynamic_viscosity;
+
 };
 
 template <typename NumericType>
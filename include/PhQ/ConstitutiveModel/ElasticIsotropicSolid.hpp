@@ -25,6 +25,7 @@
 #ifndef PHQ_CONSTITUTIVE_MODEL_ELASTIC_ISOTROPIC_SOLID_HPP
 #define PHQ_CONSTITUTIVE_MODEL_ELASTIC_ISOTROPIC_SOLID_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <functional>
@@ -34,6 +35,7 @@
 #include "../Base.hpp"
 #include "../BulkDynamicViscosity.hpp"
 #include "../ConstitutiveModel.hpp"
+#include "../DisplacementGradient.hpp"
 #include "../DynamicViscosity.hpp"
 #include "../IsentropicBulkModulus.hpp"
 #include "../IsothermalBulkModulus.hpp"
@@ -44,7 +46,6 @@
 #include "../Strain.hpp"
 #include "../StrainRate.hpp"
 #include "../Stress.hpp"
-#include "../SymmetricDyad.hpp"
 #include "../Unit/Pressure.hpp"
 #include "../YoungModulus.hpp"
 
@@ -57,7 +58,7 @@ class ConstitutiveModel::ElasticIsotropicSolid : public ConstitutiveModel {
 public:
   /// \brief Default constructor. Constructs an elastic isotropic solid constitutive model with an
   /// uninitialized value.
-  ElasticIsotropicSolid() : ConstitutiveModel() {}
+  ElasticIsotropicSolid() : ConstitutiveModel(), twice_shear_modulus() {}
 
   /// \brief Constructor. Constructs an elastic isotropic solid constitutive model from a given
   /// Young's modulus and Poisson's ratio.
@@ -387,53 +388,25 @@ public:
 
   /// \brief Returns the stress resulting from a given strain.
   [[nodiscard]] inline PhQ::Stress<float> Stress(const PhQ::Strain<float>& strain) const override {
-    // stress = a * strain + b * trace(strain) * identity_matrix
-    // a = 2 * shear_modulus
-    // b = lame_first_modulus
-    const float temporary{
-      static_cast<float>(lame_first_modulus.Value()) * static_cast<float>(strain.Value().Trace())};
-    return {
-      static_cast<float>(2) * static_cast<float>(shear_modulus.Value())
-              * static_cast<SymmetricDyad<float>>(strain.Value())
-          + SymmetricDyad<float>{temporary, static_cast<float>(0), static_cast<float>(0), temporary,
-                                 static_cast<float>(0), temporary},
-      Standard<Unit::Pressure>
-    };
+    PhQ::Stress<float> stress;
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(&strain, 1, &stress);
+    return stress;
   }
 
   /// \brief Returns the stress resulting from a given strain.
   [[nodiscard]] inline PhQ::Stress<double> Stress(
       const PhQ::Strain<double>& strain) const override {
-    // stress = a * strain + b * trace(strain) * identity_matrix
-    // a = 2 * shear_modulus
-    // b = lame_first_modulus
-    const double temporary{static_cast<double>(lame_first_modulus.Value())
-                           * static_cast<double>(strain.Value().Trace())};
-    return {
-      static_cast<double>(2) * static_cast<double>(shear_modulus.Value())
-              * static_cast<SymmetricDyad<double>>(strain.Value())
-          + SymmetricDyad<double>{temporary, static_cast<double>(0), static_cast<double>(0),
-                                  temporary, static_cast<double>(0), temporary},
-      Standard<Unit::Pressure>
-    };
+    PhQ::Stress<double> stress;
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(&strain, 1, &stress);
+    return stress;
   }
 
   /// \brief Returns the stress resulting from a given strain.
   [[nodiscard]] inline PhQ::Stress<long double> Stress(
       const PhQ::Strain<long double>& strain) const override {
-    // stress = a * strain + b * trace(strain) * identity_matrix
-    // a = 2 * shear_modulus
-    // b = lame_first_modulus
-    const long double temporary{static_cast<long double>(lame_first_modulus.Value())
-                                * static_cast<long double>(strain.Value().Trace())};
-    return {
-      static_cast<long double>(2) * static_cast<long double>(shear_modulus.Value())
-              * static_cast<SymmetricDyad<long double>>(strain.Value())
-          + SymmetricDyad<long double>{temporary, static_cast<long double>(0),
-                                       static_cast<long double>(0), temporary,
-                                       static_cast<long double>(0), temporary},
-      Standard<Unit::Pressure>
-    };
+    PhQ::Stress<long double> stress;
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(&strain, 1, &stress);
+    return stress;
   }
 
   /// \brief Returns the stress resulting from a given strain rate. Since this is an elastic
@@ -462,67 +435,25 @@ public:
 
   /// \brief Returns the strain resulting from a given stress.
   [[nodiscard]] inline PhQ::Strain<float> Strain(const PhQ::Stress<float>& stress) const override {
-    // strain = a * stress + b * trace(stress) * identity_matrix
-    // a = 1 / (2 * shear_modulus)
-    // b = -1 * lame_first_modulus / (2 * shear_modulus * (2 * shear_modulus + 3
-    //     * lame_first_modulus))
-    const float a{
-      static_cast<float>(1) / (static_cast<float>(2) * static_cast<float>(shear_modulus.Value()))};
-    const float b{-static_cast<float>(lame_first_modulus.Value())
-                  / (static_cast<float>(2) * static_cast<float>(shear_modulus.Value())
-                     * (static_cast<float>(2) * static_cast<float>(shear_modulus.Value())
-                        + static_cast<float>(3) * static_cast<float>(lame_first_modulus.Value())))};
-    const float c{b * static_cast<float>(stress.Value().Trace())};
-    return PhQ::Strain<float>{
-      a * static_cast<SymmetricDyad<float>>(stress.Value())
-      + SymmetricDyad<float>{
-                             c, static_cast<float>(0), static_cast<float>(0), c, static_cast<float>(0), c}
-    };
+    PhQ::Strain<float> strain;
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(&stress, 1, &strain);
+    return strain;
   }
 
   /// \brief Returns the strain resulting from a given stress.
   [[nodiscard]] inline PhQ::Strain<double> Strain(
       const PhQ::Stress<double>& stress) const override {
-    // strain = a * stress + b * trace(stress) * identity_matrix
-    // a = 1 / (2 * shear_modulus)
-    // b = -1 * lame_first_modulus / (2 * shear_modulus * (2 * shear_modulus + 3
-    //     * lame_first_modulus))
-    const double a{static_cast<double>(1)
-                   / (static_cast<double>(2) * static_cast<double>(shear_modulus.Value()))};
-    const double b{
-      -static_cast<double>(lame_first_modulus.Value())
-      / (static_cast<double>(2) * static_cast<double>(shear_modulus.Value())
-         * (static_cast<double>(2) * static_cast<double>(shear_modulus.Value())
-            + static_cast<double>(3) * static_cast<double>(lame_first_modulus.Value())))};
-    const double c{b * static_cast<double>(stress.Value().Trace())};
-    return PhQ::Strain<double>{
-      a * static_cast<SymmetricDyad<double>>(stress.Value())
-      + SymmetricDyad<double>{
-                              c, static_cast<double>(0), static_cast<double>(0), c, static_cast<double>(0), c}
-    };
+    PhQ::Strain<double> strain;
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(&stress, 1, &strain);
+    return strain;
   }
 
   /// \brief Returns the strain resulting from a given stress.
   [[nodiscard]] inline PhQ::Strain<long double> Strain(
       const PhQ::Stress<long double>& stress) const override {
-    // strain = a * stress + b * trace(stress) * identity_matrix
-    // a = 1 / (2 * shear_modulus)
-    // b = -1 * lame_first_modulus / (2 * shear_modulus * (2 * shear_modulus + 3
-    //     * lame_first_modulus))
-    const long double a{
-      static_cast<long double>(1)
-      / (static_cast<long double>(2) * static_cast<long double>(shear_modulus.Value()))};
-    const long double b{
-      -static_cast<long double>(lame_first_modulus.Value())
-      / (static_cast<long double>(2) * static_cast<long double>(shear_modulus.Value())
-         * (static_cast<long double>(2) * static_cast<long double>(shear_modulus.Value())
-            + static_cast<long double>(3) * static_cast<long double>(lame_first_modulus.Value())))};
-    const long double c{b * static_cast<long double>(stress.Value().Trace())};
-    return PhQ::Strain<long double>{
-      a * static_cast<SymmetricDyad<long double>>(stress.Value())
-      + SymmetricDyad<long double>{c, static_cast<long double>(0), static_cast<long double>(0), c,
-                                   static_cast<long double>(0), c}
-    };
+    PhQ::Strain<long double> strain;
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(&stress, 1, &strain);
+    return strain;
   }
 
   /// \brief Returns the strain rate resulting from a given stress. Since this is an elastic
@@ -549,6 +480,221 @@ public:
     return PhQ::StrainRate<long double>::Zero();
   }
 
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates. Since
+  /// this is an elastic isotropic solid constitutive model, the strain rates do not contribute to
+  /// the stresses and are ignored.
+  inline void Stresses(const PhQ::Strain<float>* const strains,
+                       const PhQ::StrainRate<float>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<float>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates. Since
+  /// this is an elastic isotropic solid constitutive model, the strain rates do not contribute to
+  /// the stresses and are ignored.
+  inline void Stresses(const PhQ::Strain<double>* const strains,
+                       const PhQ::StrainRate<double>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates. Since
+  /// this is an elastic isotropic solid constitutive model, the strain rates do not contribute to
+  /// the stresses and are ignored.
+  inline void Stresses(const PhQ::Strain<long double>* const strains,
+                       const PhQ::StrainRate<long double>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<long double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains.
+  inline void Stresses(const PhQ::Strain<float>* const strains, const std::size_t size,
+                       PhQ::Stress<float>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains.
+  inline void Stresses(const PhQ::Strain<double>* const strains, const std::size_t size,
+                       PhQ::Stress<double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains.
+  inline void Stresses(const PhQ::Strain<long double>* const strains, const std::size_t size,
+                       PhQ::Stress<long double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates. Since this is an
+  /// elastic isotropic solid constitutive model, the strain rates do not contribute to the
+  /// stresses, so this always fills the stresses with zero.
+  inline void Stresses(const PhQ::StrainRate<float>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<float>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates. Since this is an
+  /// elastic isotropic solid constitutive model, the strain rates do not contribute to the
+  /// stresses, so this always fills the stresses with zero.
+  inline void Stresses(const PhQ::StrainRate<double>* const strain_rates, const std::size_t size,
+                       PhQ::Stress<double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates. Since this is an
+  /// elastic isotropic solid constitutive model, the strain rates do not contribute to the
+  /// stresses, so this always fills the stresses with zero.
+  inline void Stresses(const PhQ::StrainRate<long double>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<long double>* const stresses) const override {
+    Stresses<ConstitutiveModel::MixedPrecision::Widest>(strain_rates, size, stresses);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses.
+  inline void Strains(const PhQ::Stress<float>* const stresses, const std::size_t size,
+                      PhQ::Strain<float>* const strains) const override {
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strains);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses.
+  inline void Strains(const PhQ::Stress<double>* const stresses, const std::size_t size,
+                      PhQ::Strain<double>* const strains) const override {
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strains);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses.
+  inline void Strains(const PhQ::Stress<long double>* const stresses, const std::size_t size,
+                      PhQ::Strain<long double>* const strains) const override {
+    Strains<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strains);
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses. Since this is an
+  /// elastic isotropic solid constitutive model, stress does not depend on strain rate, so this
+  /// always fills the strain rates with zero.
+  inline void StrainRates(const PhQ::Stress<float>* const stresses, const std::size_t size,
+                          PhQ::StrainRate<float>* const strain_rates) const override {
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strain_rates);
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses. Since this is an
+  /// elastic isotropic solid constitutive model, stress does not depend on strain rate, so this
+  /// always fills the strain rates with zero.
+  inline void StrainRates(const PhQ::Stress<double>* const stresses, const std::size_t size,
+                          PhQ::StrainRate<double>* const strain_rates) const override {
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strain_rates);
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses. Since this is an
+  /// elastic isotropic solid constitutive model, stress does not depend on strain rate, so this
+  /// always fills the strain rates with zero.
+  inline void StrainRates(const PhQ::Stress<long double>* const stresses, const std::size_t size,
+                          PhQ::StrainRate<long double>* const strain_rates) const override {
+    StrainRates<ConstitutiveModel::MixedPrecision::Widest>(stresses, size, strain_rates);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates under a
+  /// given mixed-precision policy. Since this is an elastic isotropic solid constitutive model, the
+  /// strain rates do not contribute to the stresses and are ignored.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Stresses(const PhQ::Strain<OtherNumericType>* const strains,
+                       const PhQ::StrainRate<OtherNumericType>* const /*strain_rates*/,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    Stresses<Policy>(strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains under a given
+  /// mixed-precision policy. The coefficients are computed in the numeric type of this constitutive
+  /// model and then evaluated in the numeric type selected by the policy.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Stresses(const PhQ::Strain<OtherNumericType>* const strains, const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    // stress = a * strain + b * trace(strain) * identity_matrix
+    // a = 2 * shear_modulus
+    // b = lame_first_modulus
+    using EvaluationNumericType =
+        ConstitutiveModel::EvaluationNumericType<Policy, NumericType, OtherNumericType>;
+    Internal::ApplyIsotropicLinearMap(
+        static_cast<EvaluationNumericType>(twice_shear_modulus),
+        static_cast<EvaluationNumericType>(lame_first_modulus.Value()), strains, size, stresses);
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates under a given
+  /// mixed-precision policy. Since this is an elastic isotropic solid constitutive model, the
+  /// strain rates do not contribute to the stresses, so this always fills the stresses with zero.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Stresses(const PhQ::StrainRate<OtherNumericType>* const /*strain_rates*/,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    std::fill(stresses, stresses + size, PhQ::Stress<OtherNumericType>::Zero());
+  }
+
+  /// \brief Returns the stress resulting from a given displacement gradient. This is equivalent to
+  /// computing the stress resulting from the strain of the displacement gradient, but makes a
+  /// single pass over the nine components of the displacement gradient without forming the strain.
+  template <typename OtherNumericType>
+  [[nodiscard]] inline PhQ::Stress<OtherNumericType> Stress(
+      const PhQ::DisplacementGradient<OtherNumericType>& displacement_gradient) const {
+    PhQ::Stress<OtherNumericType> stress;
+    Stresses(&displacement_gradient, 1, &stress);
+    return stress;
+  }
+
+  /// \brief Computes the stresses resulting from a given number of displacement gradients under a
+  /// given mixed-precision policy. This is equivalent to computing the stresses resulting from the
+  /// strains of the displacement gradients, but makes a single pass over the nine components of
+  /// each displacement gradient without forming the strains.
+  template <ConstitutiveModel::MixedPrecision Policy = ConstitutiveModel::MixedPrecision::Widest,
+            typename OtherNumericType>
+  inline void Stresses(
+      const PhQ::DisplacementGradient<OtherNumericType>* const displacement_gradients,
+      const std::size_t size, PhQ::Stress<OtherNumericType>* const stresses) const {
+    // stress = a * symmetric(displacement_gradient) + b * trace(displacement_gradient)
+    //          * identity_matrix
+    // a = 2 * shear_modulus
+    // b = lame_first_modulus
+    using EvaluationNumericType =
+        ConstitutiveModel::EvaluationNumericType<Policy, NumericType, OtherNumericType>;
+    Internal::ApplyIsotropicLinearMapToSymmetricPart(
+        static_cast<EvaluationNumericType>(twice_shear_modulus),
+        static_cast<EvaluationNumericType>(lame_first_modulus.Value()), displacement_gradients,
+        size, stresses);
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses under a given
+  /// mixed-precision policy. The coefficients are computed in the numeric type of this constitutive
+  /// model and then evaluated in the numeric type selected by the policy.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void Strains(const PhQ::Stress<OtherNumericType>* const stresses, const std::size_t size,
+                      PhQ::Strain<OtherNumericType>* const strains) const {
+    // strain = a * stress + b * trace(stress) * identity_matrix
+    // a = 1 / (2 * shear_modulus)
+    // b = -1 * lame_first_modulus / (2 * shear_modulus * (2 * shear_modulus + 3
+    //     * lame_first_modulus))
+    const NumericType a{
+      static_cast<NumericType>(1) / (static_cast<NumericType>(2) * shear_modulus.Value())};
+    const NumericType b{-lame_first_modulus.Value()
+                        / (static_cast<NumericType>(2) * shear_modulus.Value()
+                           * (static_cast<NumericType>(2) * shear_modulus.Value()
+                              + static_cast<NumericType>(3) * lame_first_modulus.Value()))};
+    using EvaluationNumericType =
+        ConstitutiveModel::EvaluationNumericType<Policy, NumericType, OtherNumericType>;
+    Internal::ApplyIsotropicLinearMap(
+        static_cast<EvaluationNumericType>(a), static_cast<EvaluationNumericType>(b), stresses,
+        size, strains);
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses under a given
+  /// mixed-precision policy. Since this is an elastic isotropic solid constitutive model, stress
+  /// does not depend on strain rate, so this always fills the strain rates with zero.
+  template <ConstitutiveModel::MixedPrecision Policy, typename OtherNumericType>
+  inline void StrainRates(const PhQ::Stress<OtherNumericType>* const /*stresses*/,
+                          const std::size_t size,
+                          PhQ::StrainRate<OtherNumericType>* const strain_rates) const {
+    std::fill(strain_rates, strain_rates + size, PhQ::StrainRate<OtherNumericType>::Zero());
+  }
+
   /// \brief Prints this elastic isotropic solid constitutive model as a string.
   [[nodiscard]] inline std::string Print() const override {
     return {"Type = " + std::string{Abbreviation(this->GetType())} + ", Shear Modulus = "
@@ -580,6 +726,11 @@ private:
 
   /// \brief Lamé's first modulus of this elastic isotropic solid constitutive model.
   PhQ::LameFirstModulus<NumericType> lame_first_modulus;
+
+  /// \brief Twice the shear modulus of this elastic isotropic solid constitutive model, which is
+  /// the coefficient of the strain in the stress. Computed once on construction so that evaluating
+  /// the stresses does not recompute it.
+  NumericType twice_shear_modulus{static_cast<NumericType>(2) * shear_modulus.Value()};
 };
 
 template <typename NumericType>
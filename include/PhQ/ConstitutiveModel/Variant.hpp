@@ -0,0 +1,330 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_CONSTITUTIVE_MODEL_VARIANT_HPP
+#define PHQ_CONSTITUTIVE_MODEL_VARIANT_HPP
+
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <variant>
+
+#include "../Base.hpp"
+#include "../BulkDynamicViscosity.hpp"
+#include "../ConstitutiveModel.hpp"
+#include "../DynamicViscosity.hpp"
+#include "../LameFirstModulus.hpp"
+#include "../ShearModulus.hpp"
+#include "../Strain.hpp"
+#include "../StrainRate.hpp"
+#include "../Stress.hpp"
+#include "CompressibleNewtonianFluid.hpp"
+#include "ElasticIsotropicSolid.hpp"
+#include "IncompressibleNewtonianFluid.hpp"
+
+namespace PhQ {
+
+/// \brief Statically dispatched constitutive model. Holds one of the constitutive models of the
+/// Physical Quantities library by value rather than through a pointer to the
+/// PhQ::ConstitutiveModel abstract base class. Since the set of constitutive models is closed, the
+/// type of the held model can be resolved once, for example with the Visit method outside of a loop
+/// over many points. The methods of this class then call the templated kernels of the held model
+/// rather than its virtual overrides, so they involve no virtual function call and can be fully
+/// inlined. A statically dispatched constitutive model can be created from any polymorphic
+/// constitutive model of the library with the Create method.
+template <typename NumericType = double>
+class ConstitutiveModel::Variant {
+public:
+  /// \brief Default constructor. Constructs a statically dispatched constitutive model holding a
+  /// compressible Newtonian fluid constitutive model with an uninitialized dynamic viscosity and
+  /// bulk dynamic viscosity.
+  Variant() = default;
+
+  /// \brief Constructor. Constructs a statically dispatched constitutive model holding a given
+  /// compressible Newtonian fluid constitutive model.
+  explicit Variant(const CompressibleNewtonianFluid<NumericType>& model) : model(model) {}
+
+  /// \brief Constructor. Constructs a statically dispatched constitutive model holding a given
+  /// elastic isotropic solid constitutive model.
+  explicit Variant(const ElasticIsotropicSolid<NumericType>& model) : model(model) {}
+
+  /// \brief Constructor. Constructs a statically dispatched constitutive model holding a given
+  /// incompressible Newtonian fluid constitutive model.
+  explicit Variant(const IncompressibleNewtonianFluid<NumericType>& model) : model(model) {}
+
+  /// \brief Destructor. Destroys this statically dispatched constitutive model.
+  ~Variant() noexcept = default;
+
+  /// \brief Copy constructor. Constructs a statically dispatched constitutive model by copying
+  /// another one.
+  Variant(const Variant& other) = default;
+
+  /// \brief Move constructor. Constructs a statically dispatched constitutive model by moving
+  /// another one.
+  Variant(Variant&& other) noexcept = default;
+
+  /// \brief Copy assignment operator. Assigns this statically dispatched constitutive model by
+  /// copying another one.
+  Variant& operator=(const Variant& other) = default;
+
+  /// \brief Move assignment operator. Assigns this statically dispatched constitutive model by
+  /// moving another one.
+  Variant& operator=(Variant&& other) noexcept = default;
+
+  /// \brief Creates a statically dispatched constitutive model from a given polymorphic
+  /// constitutive model. The polymorphic constitutive model may use any numeric type; its
+  /// parameters are converted to this numeric type. Returns std::nullopt if the polymorphic
+  /// constitutive model is not one of the constitutive models of the Physical Quantities library,
+  /// including if it is of a class derived from one of them.
+  [[nodiscard]] static std::optional<Variant> Create(const ConstitutiveModel& model) {
+    switch (model.GetType()) {
+      case ConstitutiveModel::Type::CompressibleNewtonianFluid:
+        return CreateFrom<ConstitutiveModel::CompressibleNewtonianFluid>(model);
+      case ConstitutiveModel::Type::ElasticIsotropicSolid:
+        return CreateFrom<ConstitutiveModel::ElasticIsotropicSolid>(model);
+      case ConstitutiveModel::Type::IncompressibleNewtonianFluid:
+        return CreateFrom<ConstitutiveModel::IncompressibleNewtonianFluid>(model);
+    }
+    return std::nullopt;
+  }
+
+  /// \brief Returns the type of the constitutive model held by this statically dispatched
+  /// constitutive model.
+  [[nodiscard]] inline ConstitutiveModel::Type GetType() const noexcept {
+    return Visit([](const auto& held_model) {
+      return held_model.std::decay_t<decltype(held_model)>::GetType();
+    });
+  }
+
+  /// \brief Calls a given function with the constitutive model held by this statically dispatched
+  /// constitutive model as its argument and returns the result. The function is instantiated
+  /// separately for each type of constitutive model, so it receives the held model as its concrete
+  /// type. Since the methods of the constitutive models that override those of the
+  /// PhQ::ConstitutiveModel base class are virtual, the function should call the templated kernels
+  /// of the held model, such as Stresses<ConstitutiveModel::MixedPrecision::Widest>, or qualified
+  /// methods, so that these calls are resolved at compile time. Call this once outside of a loop
+  /// over many points rather than calling the per-point methods of this class inside the loop.
+  template <typename Function>
+  inline decltype(auto) Visit(Function&& function) const {
+    return std::visit(std::forward<Function>(function), model);
+  }
+
+  /// \brief Returns the stress resulting from a given strain and strain rate.
+  template <typename OtherNumericType>
+  [[nodiscard]] inline PhQ::Stress<OtherNumericType> Stress(
+      const PhQ::Strain<OtherNumericType>& strain,
+      const PhQ::StrainRate<OtherNumericType>& strain_rate) const {
+    PhQ::Stress<OtherNumericType> stress;
+    Stresses(&strain, &strain_rate, 1, &stress);
+    return stress;
+  }
+
+  /// \brief Returns the stress resulting from a given strain.
+  template <typename OtherNumericType>
+  [[nodiscard]] inline PhQ::Stress<OtherNumericType> Stress(
+      const PhQ::Strain<OtherNumericType>& strain) const {
+    PhQ::Stress<OtherNumericType> stress;
+    Stresses(&strain, 1, &stress);
+    return stress;
+  }
+
+  /// \brief Returns the stress resulting from a given strain rate.
+  template <typename OtherNumericType>
+  [[nodiscard]] inline PhQ::Stress<OtherNumericType> Stress(
+      const PhQ::StrainRate<OtherNumericType>& strain_rate) const {
+    PhQ::Stress<OtherNumericType> stress;
+    Stresses(&strain_rate, 1, &stress);
+    return stress;
+  }
+
+  /// \brief Returns the strain resulting from a given stress.
+  template <typename OtherNumericType>
+  [[nodiscard]] inline PhQ::Strain<OtherNumericType> Strain(
+      const PhQ::Stress<OtherNumericType>& stress) const {
+    PhQ::Strain<OtherNumericType> strain;
+    Strains(&stress, 1, &strain);
+    return strain;
+  }
+
+  /// \brief Returns the strain rate resulting from a given stress.
+  template <typename OtherNumericType>
+  [[nodiscard]] inline PhQ::StrainRate<OtherNumericType> StrainRate(
+      const PhQ::Stress<OtherNumericType>& stress) const {
+    PhQ::StrainRate<OtherNumericType> strain_rate;
+    StrainRates(&stress, 1, &strain_rate);
+    return strain_rate;
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and strain rates and
+  /// stores them in a given array.
+  template <typename OtherNumericType>
+  inline void Stresses(const PhQ::Strain<OtherNumericType>* const strains,
+                       const PhQ::StrainRate<OtherNumericType>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    Visit([&](const auto& held_model) {
+      held_model.template Stresses<ConstitutiveModel::MixedPrecision::Widest>(
+          strains, strain_rates, size, stresses);
+    });
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strains and stores them in a
+  /// given array.
+  template <typename OtherNumericType>
+  inline void Stresses(const PhQ::Strain<OtherNumericType>* const strains, const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    Visit([&](const auto& held_model) {
+      held_model.template Stresses<ConstitutiveModel::MixedPrecision::Widest>(
+          strains, size, stresses);
+    });
+  }
+
+  /// \brief Computes the stresses resulting from a given number of strain rates and stores them in
+  /// a given array.
+  template <typename OtherNumericType>
+  inline void Stresses(const PhQ::StrainRate<OtherNumericType>* const strain_rates,
+                       const std::size_t size,
+                       PhQ::Stress<OtherNumericType>* const stresses) const {
+    Visit([&](const auto& held_model) {
+      held_model.template Stresses<ConstitutiveModel::MixedPrecision::Widest>(
+          strain_rates, size, stresses);
+    });
+  }
+
+  /// \brief Computes the strains resulting from a given number of stresses and stores them in a
+  /// given array.
+  template <typename OtherNumericType>
+  inline void Strains(const PhQ::Stress<OtherNumericType>* const stresses, const std::size_t size,
+                      PhQ::Strain<OtherNumericType>* const strains) const {
+    Visit([&](const auto& held_model) {
+      held_model.template Strains<ConstitutiveModel::MixedPrecision::Widest>(
+          stresses, size, strains);
+    });
+  }
+
+  /// \brief Computes the strain rates resulting from a given number of stresses and stores them in
+  /// a given array.
+  template <typename OtherNumericType>
+  inline void StrainRates(const PhQ::Stress<OtherNumericType>* const stresses,
+                          const std::size_t size,
+                          PhQ::StrainRate<OtherNumericType>* const strain_rates) const {
+    Visit([&](const auto& held_model) {
+      held_model.template StrainRates<ConstitutiveModel::MixedPrecision::Widest>(
+          stresses, size, strain_rates);
+    });
+  }
+
+  /// \brief Prints this statically dispatched constitutive model as a string.
+  [[nodiscard]] inline std::string Print() const {
+    return Visit([](const auto& held_model) {
+      return held_model.std::decay_t<decltype(held_model)>::Print();
+    });
+  }
+
+  /// \brief Serializes this statically dispatched constitutive model as a JSON message.
+  [[nodiscard]] inline std::string JSON() const {
+    return Visit([](const auto& held_model) {
+      return held_model.std::decay_t<decltype(held_model)>::JSON();
+    });
+  }
+
+  /// \brief Serializes this statically dispatched constitutive model as an XML message.
+  [[nodiscard]] inline std::string XML() const {
+    return Visit([](const auto& held_model) {
+      return held_model.std::decay_t<decltype(held_model)>::XML();
+    });
+  }
+
+  /// \brief Serializes this statically dispatched constitutive model as a YAML message.
+  [[nodiscard]] inline std::string YAML() const {
+    return Visit([](const auto& held_model) {
+      return held_model.std::decay_t<decltype(held_model)>::YAML();
+    });
+  }
+
+private:
+  /// \brief Creates a statically dispatched constitutive model from a given polymorphic
+  /// constitutive model of a given type and any numeric type. Only exact matches are accepted: a
+  /// user-defined class derived from one of the library's constitutive models may override its
+  /// behavior, so it is not converted.
+  template <template <typename> class Model>
+  [[nodiscard]] static std::optional<Variant> CreateFrom(const ConstitutiveModel& model) {
+    if (typeid(model) == typeid(Model<float>)) {
+      return Variant{Convert(static_cast<const Model<float>&>(model))};
+    }
+    if (typeid(model) == typeid(Model<double>)) {
+      return Variant{Convert(static_cast<const Model<double>&>(model))};
+    }
+    if (typeid(model) == typeid(Model<long double>)) {
+      return Variant{Convert(static_cast<const Model<long double>&>(model))};
+    }
+    return std::nullopt;
+  }
+
+  /// \brief Converts a compressible Newtonian fluid constitutive model to this numeric type.
+  template <typename OtherNumericType>
+  [[nodiscard]] static CompressibleNewtonianFluid<NumericType> Convert(
+      const CompressibleNewtonianFluid<OtherNumericType>& other) {
+    return CompressibleNewtonianFluid<NumericType>{
+      PhQ::DynamicViscosity<NumericType>{other.DynamicViscosity()},
+      PhQ::BulkDynamicViscosity<NumericType>{other.BulkDynamicViscosity()}};
+  }
+
+  /// \brief Converts an elastic isotropic solid constitutive model to this numeric type.
+  template <typename OtherNumericType>
+  [[nodiscard]] static ElasticIsotropicSolid<NumericType> Convert(
+      const ElasticIsotropicSolid<OtherNumericType>& other) {
+    return ElasticIsotropicSolid<NumericType>{
+      PhQ::ShearModulus<NumericType>{other.ShearModulus()},
+      PhQ::LameFirstModulus<NumericType>{other.LameFirstModulus()}};
+  }
+
+  /// \brief Converts an incompressible Newtonian fluid constitutive model to this numeric type.
+  template <typename OtherNumericType>
+  [[nodiscard]] static IncompressibleNewtonianFluid<NumericType> Convert(
+      const IncompressibleNewtonianFluid<OtherNumericType>& other) {
+    return IncompressibleNewtonianFluid<NumericType>{
+      PhQ::DynamicViscosity<NumericType>{other.DynamicViscosity()}};
+  }
+
+  /// \brief Constitutive model held by this statically dispatched constitutive model.
+  std::variant<CompressibleNewtonianFluid<NumericType>, ElasticIsotropicSolid<NumericType>,
+               IncompressibleNewtonianFluid<NumericType>>
+      model;
+};
+
+template <typename NumericType>
+inline std::ostream& operator<<(
+    std::ostream& stream, const ConstitutiveModel::Variant<NumericType>& model) {
+  stream << model.Print();
+  return stream;
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_CONSTITUTIVE_MODEL_VARIANT_HPP
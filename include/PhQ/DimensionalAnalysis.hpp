@@ -0,0 +1,539 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_DIMENSIONAL_ANALYSIS_HPP
+#define PHQ_DIMENSIONAL_ANALYSIS_HPP
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+#include "Area.hpp"
+#include "Base.hpp"
+#include "DimensionalScalar.hpp"
+#include "DimensionlessScalar.hpp"
+#include "Dimensions.hpp"
+#include "DynamicViscosity.hpp"
+#include "ElectricCharge.hpp"
+#include "ElectricCurrent.hpp"
+#include "Energy.hpp"
+#include "Frequency.hpp"
+#include "IsobaricHeatCapacity.hpp"
+#include "KinematicViscosity.hpp"
+#include "Length.hpp"
+#include "LinearThermalExpansionCoefficient.hpp"
+#include "Mass.hpp"
+#include "MassDensity.hpp"
+#include "MassRate.hpp"
+#include "Power.hpp"
+#include "ScalarAcceleration.hpp"
+#include "ScalarForce.hpp"
+#include "ScalarHeatFlux.hpp"
+#include "ScalarTemperatureGradient.hpp"
+#include "ScalarThermalConductivity.hpp"
+#include "SpecificEnergy.hpp"
+#include "SpecificIsobaricHeatCapacity.hpp"
+#include "SpecificPower.hpp"
+#include "Speed.hpp"
+#include "StaticPressure.hpp"
+#include "SubstanceAmount.hpp"
+#include "TemperatureDifference.hpp"
+#include "Time.hpp"
+#include "Volume.hpp"
+#include "VolumeRate.hpp"
+
+namespace PhQ {
+
+/// \brief Physical dimension set known at compile time. Each template parameter is the exponent of
+/// one of the seven independent base physical dimensions: time (T), length (L), mass (M), electric
+/// current (I), temperature (Θ), amount of substance (N), and luminous intensity (J). Unlike
+/// PhQ::Dimensions, which is a value, each physical dimension set is its own type, so products and
+/// quotients of physical dimension sets are computed by the compiler. For example, the physical
+/// dimension set of speed, T^(-1)·L, is PhQ::StaticDimensions<-1, 1, 0, 0, 0, 0, 0>.
+template <std::int8_t TimeExponent, std::int8_t LengthExponent, std::int8_t MassExponent,
+          std::int8_t ElectricCurrentExponent, std::int8_t TemperatureExponent,
+          std::int8_t SubstanceAmountExponent, std::int8_t LuminousIntensityExponent>
+class StaticDimensions {
+public:
+  /// \brief Returns this physical dimension set as a PhQ::Dimensions value.
+  [[nodiscard]] static constexpr PhQ::Dimensions Value() {
+    return PhQ::Dimensions{Dimension::Time(TimeExponent),
+                           Dimension::Length(LengthExponent),
+                           Dimension::Mass(MassExponent),
+                           Dimension::ElectricCurrent(ElectricCurrentExponent),
+                           Dimension::Temperature(TemperatureExponent),
+                           Dimension::SubstanceAmount(SubstanceAmountExponent),
+                           Dimension::LuminousIntensity(LuminousIntensityExponent)};
+  }
+};
+
+/// \brief Dimensionless physical dimension set known at compile time.
+using StaticDimensionless = StaticDimensions<0, 0, 0, 0, 0, 0, 0>;
+
+/// \brief Physical dimension set of a given physical quantity type, known at compile time. For
+/// example, PhQ::StaticDimensionsOf<PhQ::Speed<>> is PhQ::StaticDimensions<-1, 1, 0, 0, 0, 0, 0>.
+template <typename Quantity>
+using StaticDimensionsOf = StaticDimensions<
+    Quantity::Dimensions().Time().Value(), Quantity::Dimensions().Length().Value(),
+    Quantity::Dimensions().Mass().Value(), Quantity::Dimensions().ElectricCurrent().Value(),
+    Quantity::Dimensions().Temperature().Value(),
+    Quantity::Dimensions().SubstanceAmount().Value(),
+    Quantity::Dimensions().LuminousIntensity().Value()>;
+
+namespace Internal {
+
+/// \brief Product of two physical dimension sets known at compile time. Internal implementation
+/// detail not intended to be used outside of the PhQ::StaticDimensionsProduct type alias.
+template <typename Left, typename Right>
+struct StaticDimensionsProduct;
+
+template <std::int8_t... LeftExponents, std::int8_t... RightExponents>
+struct StaticDimensionsProduct<StaticDimensions<LeftExponents...>,
+                               StaticDimensions<RightExponents...>> {
+  using Type = StaticDimensions<static_cast<std::int8_t>(LeftExponents + RightExponents)...>;
+};
+
+/// \brief Quotient of two physical dimension sets known at compile time. Internal implementation
+/// detail not intended to be used outside of the PhQ::StaticDimensionsQuotient type alias.
+template <typename Left, typename Right>
+struct StaticDimensionsQuotient;
+
+template <std::int8_t... LeftExponents, std::int8_t... RightExponents>
+struct StaticDimensionsQuotient<StaticDimensions<LeftExponents...>,
+                                StaticDimensions<RightExponents...>> {
+  using Type = StaticDimensions<static_cast<std::int8_t>(LeftExponents - RightExponents)...>;
+};
+
+}  // namespace Internal
+
+/// \brief Product of two physical dimension sets known at compile time.
+template <typename Left, typename Right>
+using StaticDimensionsProduct = typename Internal::StaticDimensionsProduct<Left, Right>::Type;
+
+/// \brief Quotient of two physical dimension sets known at compile time.
+template <typename Left, typename Right>
+using StaticDimensionsQuotient = typename Internal::StaticDimensionsQuotient<Left, Right>::Type;
+
+// Forward declaration for the type traits below.
+template <typename StaticDimensionsType, typename NumericType>
+class StaticQuantity;
+
+namespace Internal {
+
+/// \brief Overload that matches physical quantities whose values are dimensional scalars.
+template <typename UnitType, typename NumericType>
+std::true_type IsScalarQuantityTest(const DimensionalScalar<UnitType, NumericType>*);
+
+/// \brief Overload that matches physical quantities whose values are dimensionless scalars.
+template <typename NumericType>
+std::true_type IsScalarQuantityTest(const DimensionlessScalar<NumericType>*);
+
+/// \brief Overload that matches every other type.
+std::false_type IsScalarQuantityTest(...);
+
+/// \brief Whether a given type is one of the named scalar physical quantities of the Physical
+/// Quantities library, such as PhQ::Length or PhQ::ReynoldsNumber. Internal implementation detail
+/// not intended to be used outside of the compile-time dimensional analysis.
+template <typename Type>
+struct IsScalarQuantity : decltype(IsScalarQuantityTest(std::declval<const Type*>())) {};
+
+/// \brief Whether a given named scalar physical quantity has a given physical dimension set.
+/// Internal implementation detail not intended to be used outside of the compile-time dimensional
+/// analysis.
+template <typename Quantity, typename StaticDimensionsType>
+struct HasStaticDimensions
+  : std::is_same<StaticDimensionsOf<Quantity>, StaticDimensionsType> {};
+
+/// \brief Whether a given type is a named scalar physical quantity with a given physical dimension
+/// set. The physical dimension set is only inspected once the type is known to be a named scalar
+/// physical quantity. Internal implementation detail not intended to be used outside of the
+/// compile-time dimensional analysis.
+template <typename Type, typename StaticDimensionsType>
+inline constexpr bool IsScalarQuantityWithStaticDimensions =
+    std::conjunction_v<IsScalarQuantity<Type>, HasStaticDimensions<Type, StaticDimensionsType>>;
+
+/// \brief Finds the first of a given list of named scalar physical quantity class templates whose
+/// physical dimension set is a given one, or PhQ::StaticQuantity if there is none. Internal
+/// implementation detail not intended to be used outside of the PhQ::NamedQuantity type alias.
+template <typename StaticDimensionsType, typename NumericType,
+          template <typename> class... Candidates>
+struct FindNamedQuantity {
+  using Type = StaticQuantity<StaticDimensionsType, NumericType>;
+};
+
+template <typename StaticDimensionsType, typename NumericType,
+          template <typename> class Candidate, template <typename> class... Candidates>
+struct FindNamedQuantity<StaticDimensionsType, NumericType, Candidate, Candidates...> {
+  using Type = std::conditional_t<
+      std::is_same_v<StaticDimensionsOf<Candidate<NumericType>>, StaticDimensionsType>,
+      Candidate<NumericType>,
+      typename FindNamedQuantity<StaticDimensionsType, NumericType, Candidates...>::Type>;
+};
+
+/// \brief Maps a physical dimension set known at compile time onto the named scalar physical
+/// quantity that represents it. When several named scalar physical quantities share a physical
+/// dimension set, such as PhQ::StaticPressure and PhQ::ScalarStress, the most general one is listed
+/// here. The temperature dimension maps onto PhQ::TemperatureDifference rather than the absolute
+/// PhQ::Temperature, since products and quotients yield temperature differences, such as a
+/// temperature gradient times a length. Dimensionless results map onto the plain numeric type.
+/// Internal implementation detail not intended to be used outside of the PhQ::NamedQuantity type
+/// alias.
+template <typename StaticDimensionsType, typename NumericType>
+struct NamedQuantity {
+  using Type = typename FindNamedQuantity<
+      StaticDimensionsType, NumericType, Time, Length, Mass, ElectricCurrent, TemperatureDifference,
+      SubstanceAmount, Frequency, Area, Volume, Speed, ScalarAcceleration, MassDensity,
+      ScalarForce, Energy, Power, StaticPressure, DynamicViscosity, KinematicViscosity, MassRate,
+      VolumeRate, ElectricCharge, SpecificEnergy, SpecificPower, SpecificIsobaricHeatCapacity,
+      IsobaricHeatCapacity, ScalarThermalConductivity, ScalarTemperatureGradient, ScalarHeatFlux,
+      LinearThermalExpansionCoefficient>::Type;
+};
+
+template <typename NumericType>
+struct NamedQuantity<StaticDimensionless, NumericType> {
+  using Type = NumericType;
+};
+
+/// \brief Numeric type of a given named scalar physical quantity or PhQ::StaticQuantity. Internal
+/// implementation detail not intended to be used outside of the compile-time dimensional analysis.
+template <typename Quantity>
+using NumericTypeOf = std::decay_t<decltype(std::declval<const Quantity&>().Value())>;
+
+/// \brief Constructs a given named scalar physical quantity, PhQ::StaticQuantity, or plain number
+/// from a given value expressed in the standard unit of measure. No unit conversion is performed.
+/// Internal implementation detail not intended to be used outside of the compile-time dimensional
+/// analysis.
+template <typename Quantity, typename NumericType>
+[[nodiscard]] inline constexpr Quantity MakeQuantity(const NumericType value) noexcept {
+  if constexpr (std::is_arithmetic_v<Quantity>) {
+    return value;
+  } else {
+    Quantity quantity{Quantity::Zero()};
+    quantity.SetValue(value);
+    return quantity;
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Named scalar physical quantity whose physical dimension set is a given one, such as
+/// PhQ::Speed<NumericType> for T^(-1)·L. If no named scalar physical quantity has this physical
+/// dimension set, this is PhQ::StaticQuantity<StaticDimensionsType, NumericType>. If the physical
+/// dimension set is dimensionless, this is NumericType.
+template <typename StaticDimensionsType, typename NumericType = double>
+using NamedQuantity =
+    typename Internal::NamedQuantity<StaticDimensionsType, NumericType>::Type;
+
+/// \brief Type of the product of two scalar physical quantities, synthesized at compile time from
+/// their physical dimension sets. For example, PhQ::Product<PhQ::Length<>, PhQ::Frequency<>> is
+/// PhQ::Speed<>.
+template <typename Left, typename Right>
+using Product = NamedQuantity<
+    StaticDimensionsProduct<StaticDimensionsOf<Left>, StaticDimensionsOf<Right>>,
+    Internal::NumericTypeOf<Left>>;
+
+/// \brief Type of the quotient of two scalar physical quantities, synthesized at compile time from
+/// their physical dimension sets. For example, PhQ::Quotient<PhQ::Length<>, PhQ::Time<>> is
+/// PhQ::Speed<>.
+template <typename Left, typename Right>
+using Quotient = NamedQuantity<
+    StaticDimensionsQuotient<StaticDimensionsOf<Left>, StaticDimensionsOf<Right>>,
+    Internal::NumericTypeOf<Left>>;
+
+/// \brief Scalar physical quantity whose physical dimension set is known at compile time but which
+/// need not correspond to any named physical quantity of the Physical Quantities library, such as
+/// the intermediate result L^2·T^(-2)·Θ^(-1) of a longer expression. Its value is always expressed
+/// in the standard unit of measure of the metre-kilogram-second-kelvin system, so arithmetic on it
+/// costs exactly as much as arithmetic on plain numbers. Products and quotients of static
+/// quantities, named scalar physical quantities, and numbers are static quantities whose physical
+/// dimension sets are computed by the compiler, and sums and differences are only allowed between
+/// static quantities of the same physical dimension set. A static quantity converts implicitly to
+/// any named scalar physical quantity with the same physical dimension set. For example:
+/// \code
+/// const PhQ::StaticQuantity<PhQ::StaticDimensionsOf<PhQ::Length<>>> length{2.0};
+/// const PhQ::Speed<> speed = length * PhQ::Frequency<>(3.0, PhQ::Unit::Frequency::Hertz);
+/// \endcode
+template <typename StaticDimensionsType, typename NumericType = double>
+class StaticQuantity {
+public:
+  static_assert(std::is_floating_point_v<NumericType>,
+                "The numeric type of a static quantity must be a floating-point number type.");
+
+  /// \brief Default constructor. Constructs a static quantity with an uninitialized value.
+  StaticQuantity() = default;
+
+  /// \brief Constructor. Constructs a static quantity with a given value expressed in the standard
+  /// unit of measure.
+  explicit constexpr StaticQuantity(const NumericType value) : value(value) {}
+
+  /// \brief Constructor. Constructs a static quantity from a named scalar physical quantity with
+  /// the same physical dimension set.
+  template <typename Quantity,
+            std::enable_if_t<
+                Internal::IsScalarQuantityWithStaticDimensions<Quantity, StaticDimensionsType>,
+                bool> = true>
+  constexpr StaticQuantity(const Quantity& quantity) : value(quantity.Value()) {}
+
+  /// \brief Statically creates a static quantity of zero.
+  [[nodiscard]] static constexpr StaticQuantity<StaticDimensionsType, NumericType> Zero() {
+    return StaticQuantity<StaticDimensionsType, NumericType>{static_cast<NumericType>(0)};
+  }
+
+  /// \brief Physical dimension set of this static quantity.
+  [[nodiscard]] static constexpr PhQ::Dimensions Dimensions() {
+    return StaticDimensionsType::Value();
+  }
+
+  /// \brief Value of this static quantity expressed in the standard unit of measure.
+  [[nodiscard]] constexpr NumericType Value() const noexcept {
+    return value;
+  }
+
+  /// \brief Sets the value of this static quantity expressed in the standard unit of measure.
+  constexpr void SetValue(const NumericType value) noexcept {
+    this->value = value;
+  }
+
+  /// \brief Converts this static quantity to the named scalar physical quantity with the same
+  /// physical dimension set. No unit conversion is performed.
+  template <typename Quantity,
+            std::enable_if_t<
+                Internal::IsScalarQuantityWithStaticDimensions<Quantity, StaticDimensionsType>,
+                bool> = true>
+  constexpr operator Quantity() const {
+    return Internal::MakeQuantity<Quantity>(value);
+  }
+
+  /// \brief Returns this static quantity as the named scalar physical quantity that represents its
+  /// physical dimension set, as given by PhQ::NamedQuantity.
+  [[nodiscard]] constexpr NamedQuantity<StaticDimensionsType, NumericType> Named() const {
+    return Internal::MakeQuantity<NamedQuantity<StaticDimensionsType, NumericType>>(value);
+  }
+
+  constexpr StaticQuantity<StaticDimensionsType, NumericType> operator+(
+      const StaticQuantity<StaticDimensionsType, NumericType>& other) const {
+    return StaticQuantity<StaticDimensionsType, NumericType>{value + other.value};
+  }
+
+  constexpr StaticQuantity<StaticDimensionsType, NumericType> operator-(
+      const StaticQuantity<StaticDimensionsType, NumericType>& other) const {
+    return StaticQuantity<StaticDimensionsType, NumericType>{value - other.value};
+  }
+
+  constexpr void operator+=(
+      const StaticQuantity<StaticDimensionsType, NumericType>& other) noexcept {
+    value += other.value;
+  }
+
+  constexpr void operator-=(
+      const StaticQuantity<StaticDimensionsType, NumericType>& other) noexcept {
+    value -= other.value;
+  }
+
+  constexpr void operator*=(const NumericType number) noexcept {
+    value *= number;
+  }
+
+  constexpr void operator/=(const NumericType number) noexcept {
+    value /= number;
+  }
+
+private:
+  /// \brief Value of this static quantity expressed in the standard unit of measure.
+  NumericType value;
+};
+
+/// \brief Returns a given named scalar physical quantity as a static quantity with the same
+/// physical dimension set and value.
+template <typename Quantity,
+          std::enable_if_t<Internal::IsScalarQuantity<Quantity>::value, bool> = true>
+[[nodiscard]] inline constexpr StaticQuantity<StaticDimensionsOf<Quantity>,
+                                              Internal::NumericTypeOf<Quantity>>
+MakeStaticQuantity(const Quantity& quantity) {
+  return StaticQuantity<StaticDimensionsOf<Quantity>, Internal::NumericTypeOf<Quantity>>{
+    quantity.Value()};
+}
+
+/// \brief Returns the product of two named scalar physical quantities or static quantities as the
+/// type synthesized by PhQ::Product, which is the named scalar physical quantity that represents
+/// the resulting physical dimension set where one exists. For example, PhQ::Multiply(length,
+/// frequency) returns a PhQ::Speed.
+template <typename Left, typename Right>
+[[nodiscard]] inline constexpr Product<Left, Right> Multiply(
+    const Left& left, const Right& right) {
+  return Internal::MakeQuantity<Product<Left, Right>>(left.Value() * right.Value());
+}
+
+/// \brief Returns the quotient of two named scalar physical quantities or static quantities as the
+/// type synthesized by PhQ::Quotient, which is the named scalar physical quantity that represents
+/// the resulting physical dimension set where one exists. For example, PhQ::Divide(length, time)
+/// returns a PhQ::Speed.
+template <typename Left, typename Right>
+[[nodiscard]] inline constexpr Quotient<Left, Right> Divide(const Left& left, const Right& right) {
+  return Internal::MakeQuantity<Quotient<Left, Right>>(left.Value() / right.Value());
+}
+
+template <typename LeftDimensions, typename RightDimensions, typename NumericType>
+inline constexpr StaticQuantity<StaticDimensionsProduct<LeftDimensions, RightDimensions>,
+                                NumericType>
+operator*(const StaticQuantity<LeftDimensions, NumericType>& left,
+          const StaticQuantity<RightDimensions, NumericType>& right) {
+  return StaticQuantity<StaticDimensionsProduct<LeftDimensions, RightDimensions>, NumericType>{
+    left.Value() * right.Value()};
+}
+
+template <typename LeftDimensions, typename RightDimensions, typename NumericType>
+inline constexpr StaticQuantity<StaticDimensionsQuotient<LeftDimensions, RightDimensions>,
+                                NumericType>
+operator/(const StaticQuantity<LeftDimensions, NumericType>& left,
+          const StaticQuantity<RightDimensions, NumericType>& right) {
+  return StaticQuantity<StaticDimensionsQuotient<LeftDimensions, RightDimensions>, NumericType>{
+    left.Value() / right.Value()};
+}
+
+template <typename StaticDimensionsType, typename NumericType, typename Quantity,
+          std::enable_if_t<Internal::IsScalarQuantity<Quantity>::value, bool> = true>
+inline constexpr auto operator*(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left, const Quantity& right) {
+  return left * MakeStaticQuantity(right);
+}
+
+template <typename StaticDimensionsType, typename NumericType, typename Quantity,
+          std::enable_if_t<Internal::IsScalarQuantity<Quantity>::value, bool> = true>
+inline constexpr auto operator*(
+    const Quantity& left, const StaticQuantity<StaticDimensionsType, NumericType>& right) {
+  return MakeStaticQuantity(left) * right;
+}
+
+template <typename StaticDimensionsType, typename NumericType, typename Quantity,
+          std::enable_if_t<Internal::IsScalarQuantity<Quantity>::value, bool> = true>
+inline constexpr auto operator/(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left, const Quantity& right) {
+  return left / MakeStaticQuantity(right);
+}
+
+template <typename StaticDimensionsType, typename NumericType, typename Quantity,
+          std::enable_if_t<Internal::IsScalarQuantity<Quantity>::value, bool> = true>
+inline constexpr auto operator/(
+    const Quantity& left, const StaticQuantity<StaticDimensionsType, NumericType>& right) {
+  return MakeStaticQuantity(left) / right;
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr StaticQuantity<StaticDimensionsType, NumericType> operator*(
+    const StaticQuantity<StaticDimensionsType, NumericType>& static_quantity,
+    const NumericType number) {
+  return StaticQuantity<StaticDimensionsType, NumericType>{static_quantity.Value() * number};
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr StaticQuantity<StaticDimensionsType, NumericType> operator*(
+    const NumericType number,
+    const StaticQuantity<StaticDimensionsType, NumericType>& static_quantity) {
+  return StaticQuantity<StaticDimensionsType, NumericType>{number * static_quantity.Value()};
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr StaticQuantity<StaticDimensionsType, NumericType> operator/(
+    const StaticQuantity<StaticDimensionsType, NumericType>& static_quantity,
+    const NumericType number) {
+  return StaticQuantity<StaticDimensionsType, NumericType>{static_quantity.Value() / number};
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr StaticQuantity<StaticDimensionsQuotient<StaticDimensionless, StaticDimensionsType>,
+                                NumericType>
+operator/(const NumericType number,
+          const StaticQuantity<StaticDimensionsType, NumericType>& static_quantity) {
+  return StaticQuantity<StaticDimensionsQuotient<StaticDimensionless, StaticDimensionsType>,
+                        NumericType>{number / static_quantity.Value()};
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr bool operator==(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left,
+    const StaticQuantity<StaticDimensionsType, NumericType>& right) noexcept {
+  return left.Value() == right.Value();
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr bool operator!=(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left,
+    const StaticQuantity<StaticDimensionsType, NumericType>& right) noexcept {
+  return left.Value() != right.Value();
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr bool operator<(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left,
+    const StaticQuantity<StaticDimensionsType, NumericType>& right) noexcept {
+  return left.Value() < right.Value();
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr bool operator>(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left,
+    const StaticQuantity<StaticDimensionsType, NumericType>& right) noexcept {
+  return left.Value() > right.Value();
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr bool operator<=(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left,
+    const StaticQuantity<StaticDimensionsType, NumericType>& right) noexcept {
+  return left.Value() <= right.Value();
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline constexpr bool operator>=(
+    const StaticQuantity<StaticDimensionsType, NumericType>& left,
+    const StaticQuantity<StaticDimensionsType, NumericType>& right) noexcept {
+  return left.Value() >= right.Value();
+}
+
+template <typename StaticDimensionsType, typename NumericType>
+inline std::ostream& operator<<(
+    std::ostream& stream,
+    const StaticQuantity<StaticDimensionsType, NumericType>& static_quantity) {
+  stream << Print(static_quantity.Value());
+  return stream;
+}
+
+}  // namespace PhQ
+
+namespace std {
+
+template <typename StaticDimensionsType, typename NumericType>
+struct hash<PhQ::StaticQuantity<StaticDimensionsType, NumericType>> {
+  inline size_t operator()(
+      const PhQ::StaticQuantity<StaticDimensionsType, NumericType>& static_quantity) const {
+    return hash<NumericType>()(static_quantity.Value());
+  }
+};
+
+}  // namespace std
+
+#endif  // PHQ_DIMENSIONAL_ANALYSIS_HPP
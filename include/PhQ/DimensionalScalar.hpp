@@ -93,73 +93,141 @@ public:
   /// \brief Prints this physical quantity as a string. This physical quantity's value is expressed
   /// in its standard unit of measure.
   [[nodiscard]] std::string Print() const {
-    return PhQ::Print(value).append(" ").append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    std::string buffer;
+    AppendPrint(buffer);
+    return buffer;
+  }
+
+  /// \brief Prints this physical quantity and appends it to the given string. This physical
+  /// quantity's value is expressed in its standard unit of measure.
+  void AppendPrint(std::string& buffer) const {
+    PhQ::AppendPrint(buffer, value);
+    buffer.push_back(' ');
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
   }
 
   /// \brief Prints this physical quantity as a string. This physical quantity's value is expressed
   /// in the given unit of measure.
   [[nodiscard]] std::string Print(const UnitType unit) const {
-    return PhQ::Print(Value(unit)).append(" ").append(PhQ::Abbreviation(unit));
+    std::string buffer;
+    AppendPrint(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Prints this physical quantity and appends it to the given string. This physical
+  /// quantity's value is expressed in the given unit of measure.
+  void AppendPrint(std::string& buffer, const UnitType unit) const {
+    PhQ::AppendPrint(buffer, Value(unit));
+    buffer.push_back(' ');
+    buffer.append(PhQ::Abbreviation(unit));
   }
 
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string JSON() const {
-    return std::string{"{\"value\":"}
-        .append(PhQ::Print(value))
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string buffer;
+    AppendJSON(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  void AppendJSON(std::string& buffer) const {
+    buffer.append("{\"value\":");
+    PhQ::AppendPrint(buffer, value);
+    buffer.append(",\"unit\":\"");
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    buffer.append("\"}");
   }
 
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string JSON(const UnitType unit) const {
-    return std::string{"{\"value\":"}
-        .append(PhQ::Print(Value(unit)))
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string buffer;
+    AppendJSON(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  void AppendJSON(std::string& buffer, const UnitType unit) const {
+    buffer.append("{\"value\":");
+    PhQ::AppendPrint(buffer, Value(unit));
+    buffer.append(",\"unit\":\"");
+    buffer.append(PhQ::Abbreviation(unit));
+    buffer.append("\"}");
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string XML() const {
-    return std::string{"<value>"}
-        .append(PhQ::Print(value))
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("</unit>");
+    std::string buffer;
+    AppendXML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  void AppendXML(std::string& buffer) const {
+    buffer.append("<value>");
+    PhQ::AppendPrint(buffer, value);
+    buffer.append("</value><unit>");
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    buffer.append("</unit>");
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string XML(const UnitType unit) const {
-    return std::string{"<value>"}
-        .append(PhQ::Print(Value(unit)))
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(unit))
-        .append("</unit>");
+    std::string buffer;
+    AppendXML(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  void AppendXML(std::string& buffer, const UnitType unit) const {
+    buffer.append("<value>");
+    PhQ::AppendPrint(buffer, Value(unit));
+    buffer.append("</value><unit>");
+    buffer.append(PhQ::Abbreviation(unit));
+    buffer.append("</unit>");
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string YAML() const {
-    return std::string{"{value:"}
-        .append(PhQ::Print(value))
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string buffer;
+    AppendYAML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  void AppendYAML(std::string& buffer) const {
+    buffer.append("{value:");
+    PhQ::AppendPrint(buffer, value);
+    buffer.append(",unit:\"");
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    buffer.append("\"}");
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string YAML(const UnitType unit) const {
-    return std::string{"{value:"}
-        .append(PhQ::Print(Value(unit)))
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string buffer;
+    AppendYAML(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  void AppendYAML(std::string& buffer, const UnitType unit) const {
+    buffer.append("{value:");
+    PhQ::AppendPrint(buffer, Value(unit));
+    buffer.append(",unit:\"");
+    buffer.append(PhQ::Abbreviation(unit));
+    buffer.append("\"}");
   }
 
 protected:
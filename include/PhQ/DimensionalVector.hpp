@@ -89,73 +89,141 @@ public:
   /// \brief Prints this physical quantity as a string. This physical quantity's value is expressed
   /// in its standard unit of measure.
   [[nodiscard]] std::string Print() const {
-    return value.Print().append(" ").append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    std::string buffer;
+    AppendPrint(buffer);
+    return buffer;
+  }
+
+  /// \brief Prints this physical quantity and appends it to the given string. This physical
+  /// quantity's value is expressed in its standard unit of measure.
+  void AppendPrint(std::string& buffer) const {
+    value.AppendPrint(buffer);
+    buffer.push_back(' ');
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
   }
 
   /// \brief Prints this physical quantity as a string. This physical quantity's value is expressed
   /// in the given unit of measure.
   [[nodiscard]] std::string Print(const UnitType unit) const {
-    return Value(unit).Print().append(" ").append(PhQ::Abbreviation(unit));
+    std::string buffer;
+    AppendPrint(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Prints this physical quantity and appends it to the given string. This physical
+  /// quantity's value is expressed in the given unit of measure.
+  void AppendPrint(std::string& buffer, const UnitType unit) const {
+    Value(unit).AppendPrint(buffer);
+    buffer.push_back(' ');
+    buffer.append(PhQ::Abbreviation(unit));
   }
 
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string JSON() const {
-    return std::string{"{\"value\":"}
-        .append(value.JSON())
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string buffer;
+    AppendJSON(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  void AppendJSON(std::string& buffer) const {
+    buffer.append("{\"value\":");
+    value.AppendJSON(buffer);
+    buffer.append(",\"unit\":\"");
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    buffer.append("\"}");
   }
 
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string JSON(const UnitType unit) const {
-    return std::string{"{\"value\":"}
-        .append(Value(unit).JSON())
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string buffer;
+    AppendJSON(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  void AppendJSON(std::string& buffer, const UnitType unit) const {
+    buffer.append("{\"value\":");
+    Value(unit).AppendJSON(buffer);
+    buffer.append(",\"unit\":\"");
+    buffer.append(PhQ::Abbreviation(unit));
+    buffer.append("\"}");
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string XML() const {
-    return std::string{"<value>"}
-        .append(value.XML())
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("</unit>");
+    std::string buffer;
+    AppendXML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  void AppendXML(std::string& buffer) const {
+    buffer.append("<value>");
+    value.AppendXML(buffer);
+    buffer.append("</value><unit>");
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    buffer.append("</unit>");
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string XML(const UnitType unit) const {
-    return std::string{"<value>"}
-        .append(Value(unit).XML())
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(unit))
-        .append("</unit>");
+    std::string buffer;
+    AppendXML(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  void AppendXML(std::string& buffer, const UnitType unit) const {
+    buffer.append("<value>");
+    Value(unit).AppendXML(buffer);
+    buffer.append("</value><unit>");
+    buffer.append(PhQ::Abbreviation(unit));
+    buffer.append("</unit>");
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string YAML() const {
-    return std::string{"{value:"}
-        .append(value.YAML())
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string buffer;
+    AppendYAML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  void AppendYAML(std::string& buffer) const {
+    buffer.append("{value:");
+    value.AppendYAML(buffer);
+    buffer.append(",unit:\"");
+    buffer.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    buffer.append("\"}");
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string YAML(const UnitType unit) const {
-    return std::string{"{value:"}
-        .append(Value(unit).YAML())
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string buffer;
+    AppendYAML(buffer, unit);
+    return buffer;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  void AppendYAML(std::string& buffer, const UnitType unit) const {
+    buffer.append("{value:");
+    Value(unit).AppendYAML(buffer);
+    buffer.append(",unit:\"");
+    buffer.append(PhQ::Abbreviation(unit));
+    buffer.append("\"}");
   }
 
 protected:
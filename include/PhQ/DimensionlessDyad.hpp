@@ -77,21 +77,41 @@ public:
     return value.Print();
   }
 
+  /// \brief Prints this physical quantity and appends it to the given string.
+  void AppendPrint(std::string& buffer) const {
+    value.AppendPrint(buffer);
+  }
+
   /// \brief Serializes this physical quantity as a JSON message.
   [[nodiscard]] std::string JSON() const {
     return value.JSON();
   }
 
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  void AppendJSON(std::string& buffer) const {
+    value.AppendJSON(buffer);
+  }
+
   /// \brief Serializes this physical quantity as an XML message.
   [[nodiscard]] std::string XML() const {
     return value.XML();
   }
 
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  void AppendXML(std::string& buffer) const {
+    value.AppendXML(buffer);
+  }
+
   /// \brief Serializes this physical quantity as a YAML message.
   [[nodiscard]] std::string YAML() const {
     return value.YAML();
   }
 
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  void AppendYAML(std::string& buffer) const {
+    value.AppendYAML(buffer);
+  }
+
 protected:
   /// \brief Default constructor. Constructs a dimensionless dyadic tensor physical quantity with an
   /// uninitialized value.
@@ -76,21 +76,41 @@ public:
     return PhQ::Print(value);
   }
 
+  /// \brief Prints this physical quantity and appends it to the given string.
+  void AppendPrint(std::string& buffer) const {
+    PhQ::AppendPrint(buffer, value);
+  }
+
   /// \brief Serializes this physical quantity as a JSON message.
   [[nodiscard]] std::string JSON() const {
     return PhQ::Print(value);
   }
 
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  void AppendJSON(std::string& buffer) const {
+    PhQ::AppendPrint(buffer, value);
+  }
+
   /// \brief Serializes this physical quantity as an XML message.
   [[nodiscard]] std::string XML() const {
     return PhQ::Print(value);
   }
 
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  void AppendXML(std::string& buffer) const {
+    PhQ::AppendPrint(buffer, value);
+  }
+
   /// \brief Serializes this physical quantity as a YAML message.
   [[nodiscard]] std::string YAML() const {
     return PhQ::Print(value);
   }
 
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  void AppendYAML(std::string& buffer) const {
+    PhQ::AppendPrint(buffer, value);
+  }
+
 protected:
   /// \brief Default constructor. Constructs a dimensionless scalar physical quantity with an
   /// uninitialized value.
@@ -250,6 +250,23 @@ public:
     Set(value.x_y_z());
   }
 
+  /// \brief Normalizes the given number of vectors stored contiguously to unit vectors, and stores
+  /// them in the given array of directions. Each vector is multiplied by the reciprocal of its
+  /// magnitude rather than divided by its magnitude, and the loop has no branches so that the
+  /// compiler can vectorize it. Zero vectors are normalized to the zero vector, as in Set().
+  static void Normalize(const Vector<NumericType>* const vectors, const std::size_t size,
+                        Direction<NumericType>* const directions) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const Vector<NumericType>& vector{vectors[index]};
+      const NumericType magnitude_squared{vector.MagnitudeSquared()};
+      const NumericType inverse_magnitude{
+          magnitude_squared > static_cast<NumericType>(0)
+              ? static_cast<NumericType>(1) / std::sqrt(magnitude_squared)
+              : static_cast<NumericType>(0)};
+      directions[index].value = vector * inverse_magnitude;
+    }
+  }
+
   /// \brief Returns the square of the magnitude of this direction. This is guaranteed to be exactly
   /// 1 if the direction is not the zero vector, or 0 if the direction is the zero vector.
   [[nodiscard]] constexpr NumericType MagnitudeSquared() const noexcept {
@@ -440,6 +457,13 @@ Direction<NumericType> PlanarDirection<NumericType>::Cross(
   return Direction<NumericType>{this->value.Cross(planar_direction.value)};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Direction>{6};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -304,6 +304,13 @@ inline constexpr PlanarDisplacement<NumericType>::PlanarDisplacement(
     const Displacement<NumericType>& displacement)
   : PlanarDisplacement(PlanarVector<NumericType>{displacement.Value()}) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Displacement>{7};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -271,6 +271,13 @@ inline constexpr Strain<NumericType>::Strain(
         0.5 * (displacement_gradient.Value().yz() + displacement_gradient.Value().zy()),
         displacement_gradient.Value().zz()) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<DisplacementGradient>{8};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
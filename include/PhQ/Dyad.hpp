@@ -382,35 +382,161 @@ public:
   /// std::nullopt otherwise.
   [[nodiscard]] constexpr std::optional<Dyad<NumericType>> Inverse() const;
 
+  /// \brief Returns the inverse of this three-dimensional dyadic tensor if it is far enough from
+  /// singular, or std::nullopt otherwise. This tensor is considered singular if the magnitude of
+  /// its determinant does not exceed the given tolerance times the product of the magnitudes of its
+  /// rows.
+  [[nodiscard]] constexpr std::optional<Dyad<NumericType>> Inverse(
+      const NumericType tolerance) const;
+
+  /// \brief Returns the solution x of the linear system A * x = b, where A is this
+  /// three-dimensional dyadic tensor and b is the given vector, if this tensor is far enough from
+  /// singular, or std::nullopt otherwise. The solution is computed with Cramer's rule without
+  /// forming the inverse. This tensor is considered singular if the magnitude of its determinant
+  /// does not exceed the given tolerance times the product of the magnitudes of its rows.
+  [[nodiscard]] constexpr std::optional<Vector<NumericType>> Solve(
+      const Vector<NumericType>& vector,
+      const NumericType tolerance = Internal::SingularityTolerance<NumericType>) const;
+
+  /// \brief Computes the inverses of the given number of three-dimensional dyadic tensors stored
+  /// contiguously, and stores them in the given array of inverses. Also stores whether each tensor
+  /// is far enough from singular to be inverted in the given array of flags; the inverse of each
+  /// singular tensor is set to zero. Tensors are considered singular as in Inverse(tolerance).
+  static void Inverse(const Dyad<NumericType>* const dyads, const std::size_t size,
+                      Dyad<NumericType>* const inverses, bool* const invertible,
+                      const NumericType tolerance = Internal::SingularityTolerance<NumericType>);
+
+  /// \brief Solves the given number of linear systems A * x = b, where the three-dimensional dyadic
+  /// tensors A and the vectors b are stored contiguously, and stores the solutions x in the given
+  /// array of solutions. Also stores whether each tensor is far enough from singular for its system
+  /// to be solved in the given array of flags; the solution of each singular system is set to
+  /// zero. Tensors are considered singular as in Solve(vector, tolerance).
+  static void Solve(const Dyad<NumericType>* const dyads, const Vector<NumericType>* const vectors,
+                    const std::size_t size, Vector<NumericType>* const solutions,
+                    bool* const solved,
+                    const NumericType tolerance = Internal::SingularityTolerance<NumericType>);
+
   /// \brief Prints this three-dimensional dyadic tensor as a string.
   [[nodiscard]] std::string Print() const {
-    return "(" + PhQ::Print(xx()) + ", " + PhQ::Print(xy()) + ", " + PhQ::Print(xz()) + "; "
-           + PhQ::Print(yx()) + ", " + PhQ::Print(yy()) + ", " + PhQ::Print(yz()) + "; "
-           + PhQ::Print(zx()) + ", " + PhQ::Print(zy()) + ", " + PhQ::Print(zz()) + ")";
+    std::string buffer;
+    AppendPrint(buffer);
+    return buffer;
+  }
+
+  /// \brief Prints this three-dimensional dyadic tensor and appends it to the given string.
+  void AppendPrint(std::string& buffer) const {
+    buffer.push_back('(');
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[0]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[1]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[2]);
+    buffer.append("; ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[3]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[4]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[5]);
+    buffer.append("; ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[6]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[7]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[8]);
+    buffer.push_back(')');
   }
 
   /// \brief Serializes this three-dimensional dyadic tensor as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return "{\"xx\":" + PhQ::Print(xx()) + ",\"xy\":" + PhQ::Print(xy()) + ",\"xz\":"
-           + PhQ::Print(xz()) + ",\"yx\":" + PhQ::Print(yx()) + ",\"yy\":" + PhQ::Print(yy())
-           + ",\"yz\":" + PhQ::Print(yz()) + ",\"zx\":" + PhQ::Print(zx())
-           + ",\"zy\":" + PhQ::Print(zy()) + ",\"zz\":" + PhQ::Print(zz()) + "}";
+    std::string buffer;
+    AppendJSON(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as a JSON message and appends it to the
+  /// given string.
+  void AppendJSON(std::string& buffer) const {
+    buffer.append("{\"xx\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[0]);
+    buffer.append(",\"xy\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[1]);
+    buffer.append(",\"xz\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[2]);
+    buffer.append(",\"yx\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[3]);
+    buffer.append(",\"yy\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[4]);
+    buffer.append(",\"yz\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[5]);
+    buffer.append(",\"zx\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[6]);
+    buffer.append(",\"zy\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[7]);
+    buffer.append(",\"zz\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[8]);
+    buffer.push_back('}');
   }
 
   /// \brief Serializes this three-dimensional dyadic tensor as an XML message.
   [[nodiscard]] std::string XML() const {
-    return "<xx>" + PhQ::Print(xx()) + "</xx><xy>" + PhQ::Print(xy()) + "</xy><xz>"
-           + PhQ::Print(xz()) + "</xz><yx>" + PhQ::Print(yx()) + "</yx><yy>" + PhQ::Print(yy())
-           + "</yy><yz>" + PhQ::Print(yz()) + "</yz><zx>" + PhQ::Print(zx()) + "</zx><zy>"
-           + PhQ::Print(zy()) + "</zy><zz>" + PhQ::Print(zz()) + "</zz>";
+    std::string buffer;
+    AppendXML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as an XML message and appends it to the
+  /// given string.
+  void AppendXML(std::string& buffer) const {
+    buffer.append("<xx>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[0]);
+    buffer.append("</xx><xy>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[1]);
+    buffer.append("</xy><xz>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[2]);
+    buffer.append("</xz><yx>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[3]);
+    buffer.append("</yx><yy>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[4]);
+    buffer.append("</yy><yz>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[5]);
+    buffer.append("</yz><zx>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[6]);
+    buffer.append("</zx><zy>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[7]);
+    buffer.append("</zy><zz>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[8]);
+    buffer.append("</zz>");
   }
 
   /// \brief Serializes this three-dimensional dyadic tensor as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return "{xx:" + PhQ::Print(xx()) + ",xy:" + PhQ::Print(xy()) + ",xz:" + PhQ::Print(xz())
-           + ",yx:" + PhQ::Print(yx()) + ",yy:" + PhQ::Print(yy()) + ",yz:" + PhQ::Print(yz())
-           + ",zx:" + PhQ::Print(zx()) + ",zy:" + PhQ::Print(zy()) + ",zz:" + PhQ::Print(zz())
-           + "}";
+    std::string buffer;
+    AppendYAML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as a YAML message and appends it to the
+  /// given string.
+  void AppendYAML(std::string& buffer) const {
+    buffer.append("{xx:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[0]);
+    buffer.append(",xy:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[1]);
+    buffer.append(",xz:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[2]);
+    buffer.append(",yx:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[3]);
+    buffer.append(",yy:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[4]);
+    buffer.append(",yz:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[5]);
+    buffer.append(",zx:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[6]);
+    buffer.append(",zy:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[7]);
+    buffer.append(",zz:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yx_yy_yz_zx_zy_zz_[8]);
+    buffer.push_back('}');
   }
 
   /// \brief Adds another three-dimensional dyadic tensor to this one.
@@ -472,6 +598,16 @@ public:
   }
 
 private:
+  /// \brief Returns whether this three-dimensional dyadic tensor, whose determinant is given, is
+  /// far enough from singular to be inverted with the given tolerance. The determinant must also be
+  /// nonzero, since it divides the adjugate.
+  [[nodiscard]] constexpr bool IsWellConditioned(
+      const NumericType determinant, const NumericType tolerance) const noexcept {
+    return determinant != static_cast<NumericType>(0)
+           && Internal::IsWellConditioned(
+               xx(), xy(), xz(), yx(), yy(), yz(), zx(), zy(), zz(), tolerance);
+  }
+
   /// \brief Cartesian components of this three-dimensional dyadic tensor.
   std::array<NumericType, 9> xx_xy_xz_yx_yy_yz_zx_zy_zz_;
 };
@@ -580,7 +716,8 @@ inline constexpr Dyad<NumericType> operator-(
                            left.zx() - right.zx(), left.zy() - right.zy(), left.zz() - right.zz()};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr Dyad<NumericType> operator*(
     const Dyad<NumericType>& dyad, const OtherNumericType number) {
   return Dyad<NumericType>{
@@ -591,7 +728,8 @@ inline constexpr Dyad<NumericType> operator*(
     dyad.zz() * static_cast<NumericType>(number)};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr Dyad<NumericType> operator*(
     const OtherNumericType number, const Dyad<NumericType>& dyad) {
   return Dyad<NumericType>{dyad * number};
@@ -692,7 +830,8 @@ inline constexpr Dyad<NumericType> operator*(
     left.zx() * right.xz() + left.zy() * right.yz() + left.zz() * right.zz()};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr Dyad<NumericType> operator/(
     const Dyad<NumericType>& dyad, const OtherNumericType number) {
   return Dyad<NumericType>{
@@ -718,6 +857,54 @@ inline constexpr std::optional<Dyad<NumericType>> Dyad<NumericType>::Inverse() c
   return std::nullopt;
 }
 
+template <typename NumericType>
+inline constexpr std::optional<Dyad<NumericType>> Dyad<NumericType>::Inverse(
+    const NumericType tolerance) const {
+  const NumericType determinant_{Determinant()};
+  if (IsWellConditioned(determinant_, tolerance)) {
+    return std::optional<Dyad<NumericType>>{Adjugate() / determinant_};
+  }
+  return std::nullopt;
+}
+
+template <typename NumericType>
+inline constexpr std::optional<Vector<NumericType>> Dyad<NumericType>::Solve(
+    const Vector<NumericType>& vector, const NumericType tolerance) const {
+  const NumericType determinant_{Determinant()};
+  if (IsWellConditioned(determinant_, tolerance)) {
+    return std::optional<Vector<NumericType>>{Adjugate() * vector / determinant_};
+  }
+  return std::nullopt;
+}
+
+template <typename NumericType>
+inline void Dyad<NumericType>::Inverse(
+    const Dyad<NumericType>* const dyads, const std::size_t size,
+    Dyad<NumericType>* const inverses, bool* const invertible, const NumericType tolerance) {
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType determinant_{dyads[index].Determinant()};
+    const bool is_invertible{dyads[index].IsWellConditioned(determinant_, tolerance)};
+    invertible[index] = is_invertible;
+    inverses[index] = is_invertible ? dyads[index].Adjugate() / determinant_
+                                    : Dyad<NumericType>::Zero();
+  }
+}
+
+template <typename NumericType>
+inline void Dyad<NumericType>::Solve(
+    const Dyad<NumericType>* const dyads, const Vector<NumericType>* const vectors,
+    const std::size_t size, Vector<NumericType>* const solutions, bool* const solved,
+    const NumericType tolerance) {
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType determinant_{dyads[index].Determinant()};
+    const bool is_solvable{dyads[index].IsWellConditioned(determinant_, tolerance)};
+    solved[index] = is_solvable;
+    solutions[index] = is_solvable
+                           ? dyads[index].Adjugate() * vectors[index] / determinant_
+                           : Vector<NumericType>::Zero();
+  }
+}
+
 template <typename NumericType>
 constexpr Dyad<NumericType> PlanarVector<NumericType>::Dyadic(
     const PlanarVector<NumericType>& planar_vector) const {
@@ -237,6 +237,13 @@ inline constexpr DynamicKinematicPressure<NumericType> DynamicPressure<NumericTy
   return DynamicKinematicPressure<NumericType>{*this, mass_density};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<DynamicKinematicPressure>{9};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
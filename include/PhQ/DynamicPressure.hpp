@@ -226,6 +226,13 @@ inline Speed<NumericType>::Speed(const DynamicPressure<NumericType>& dynamic_pre
                                  const MassDensity<NumericType>& mass_density)
   : Speed<NumericType>(std::sqrt(2.0 * dynamic_pressure.Value() / mass_density.Value())) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<DynamicPressure>{10};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -255,6 +255,13 @@ inline constexpr DynamicViscosity<NumericType> MassDensity<NumericType>::operato
   return DynamicViscosity<NumericType>{*this, kinematic_viscosity};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<DynamicViscosity>{11};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -211,6 +211,13 @@ inline constexpr ElectricCharge<NumericType> operator*(
   return electric_charge * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ElectricCharge>{12};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
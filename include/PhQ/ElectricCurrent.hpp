@@ -264,6 +264,13 @@ inline constexpr Time<NumericType> ElectricCharge<NumericType>::operator/(
   return Time<NumericType>{*this, electric_current};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ElectricCurrent>{13};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
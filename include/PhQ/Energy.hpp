@@ -245,6 +245,13 @@ inline constexpr Energy<NumericType> operator*(
   return energy * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Energy>{14};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -0,0 +1,315 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_EXPRESSION_HPP
+#define PHQ_EXPRESSION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include "Field.hpp"
+#include "Unit.hpp"
+
+namespace PhQ {
+
+// Forward declaration for function PhQ::Lazy.
+template <typename NumericType>
+class Direction;
+
+// Forward declaration for function PhQ::Lazy.
+template <typename NumericType>
+class PlanarDirection;
+
+namespace Internal {
+
+/// \brief Properties of an operand of a lazy expression. An operand is either a single object whose
+/// components are stored contiguously, such as a PhQ::Vector, a PhQ::SymmetricDyad, a PhQ::Dyad,
+/// or a physical quantity such as PhQ::Velocity or PhQ::Stress, or a PhQ::Field of such physical
+/// quantities. Internal implementation detail not intended to be used outside of the PhQ::Lazy
+/// function.
+template <typename Type>
+struct LazyOperandTraits;
+
+template <template <typename> class TypeTemplate, typename NumericTypeParameter>
+struct LazyOperandTraits<TypeTemplate<NumericTypeParameter>> {
+  using Element = TypeTemplate<NumericTypeParameter>;
+  using NumericType = NumericTypeParameter;
+  static constexpr bool IsField{false};
+};
+
+template <template <typename> class QuantityTemplate, typename NumericTypeParameter>
+struct LazyOperandTraits<Field<QuantityTemplate<NumericTypeParameter>>> {
+  using Element = QuantityTemplate<NumericTypeParameter>;
+  using NumericType = NumericTypeParameter;
+  static constexpr bool IsField{true};
+};
+
+/// \brief Whether objects of a given type can be operands of a lazy expression. A lazy expression
+/// writes the components of its result directly, so objects whose components must satisfy an
+/// invariant that a linear combination does not preserve cannot be operands. This excludes
+/// PhQ::Direction and PhQ::PlanarDirection, whose magnitude must be one. Internal implementation
+/// detail not intended to be used outside of the PhQ::Lazy function.
+template <typename Element>
+inline constexpr bool IsLinearlyCombinable{true};
+
+template <typename NumericType>
+inline constexpr bool IsLinearlyCombinable<Direction<NumericType>>{false};
+
+template <typename NumericType>
+inline constexpr bool IsLinearlyCombinable<PlanarDirection<NumericType>>{false};
+
+/// \brief Leaf of a lazy expression. Refers to an operand without copying it, so the operand must
+/// outlive the expression. Internal implementation detail not intended to be used outside of the
+/// PhQ::Lazy function.
+template <typename Type>
+class LazyOperand {
+public:
+  using Element = typename LazyOperandTraits<Type>::Element;
+
+  using NumericType = typename LazyOperandTraits<Type>::NumericType;
+
+  static constexpr std::size_t NumberOfComponents{sizeof(Element) / sizeof(NumericType)};
+
+  static constexpr bool IsField{LazyOperandTraits<Type>::IsField};
+
+  explicit constexpr LazyOperand(const Type& operand) noexcept : operand(operand) {}
+
+  /// \brief Returns a given component of a given element of this operand. The element index is
+  /// ignored if this operand is a single object rather than a field.
+  [[nodiscard]] NumericType Component(const std::size_t component, const std::size_t index) const {
+    if constexpr (IsField) {
+      return operand.Components()[component][index];
+    } else {
+      static_cast<void>(index);
+      return Internal::Components<NumberOfComponents, NumericType>(&operand)[component];
+    }
+  }
+
+  /// \brief Returns the number of elements of this operand if it is a field, or zero otherwise.
+  [[nodiscard]] std::size_t Size() const noexcept {
+    if constexpr (IsField) {
+      return operand.Size();
+    } else {
+      return 0;
+    }
+  }
+
+private:
+  const Type& operand;
+};
+
+/// \brief Node of a lazy expression that combines the corresponding components of two
+/// subexpressions with a given operation. Both subexpressions must have the same element type, so
+/// physical quantities of different types cannot be added or subtracted. Internal implementation
+/// detail not intended to be used outside of the PhQ::Lazy function.
+template <typename Left, typename Right, typename Operation>
+class LazyBinary {
+public:
+  static_assert(std::is_same_v<typename Left::Element, typename Right::Element>,
+                "Only objects of the same type can be added or subtracted in a lazy expression.");
+
+  using Element = typename Left::Element;
+
+  using NumericType = typename Left::NumericType;
+
+  static constexpr std::size_t NumberOfComponents{Left::NumberOfComponents};
+
+  static constexpr bool IsField{Left::IsField || Right::IsField};
+
+  constexpr LazyBinary(const Left& left, const Right& right) noexcept : left(left), right(right) {}
+
+  [[nodiscard]] NumericType Component(const std::size_t component, const std::size_t index) const {
+    return Operation{}(left.Component(component, index), right.Component(component, index));
+  }
+
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return Left::IsField ? left.Size() : right.Size();
+  }
+
+private:
+  const Left left;
+
+  const Right right;
+};
+
+/// \brief Node of a lazy expression that combines each component of a subexpression with a given
+/// number through a given operation. Internal implementation detail not intended to be used
+/// outside of the PhQ::Lazy function.
+template <typename Operand, typename Operation>
+class LazyScaled {
+public:
+  using Element = typename Operand::Element;
+
+  using NumericType = typename Operand::NumericType;
+
+  static constexpr std::size_t NumberOfComponents{Operand::NumberOfComponents};
+
+  static constexpr bool IsField{Operand::IsField};
+
+  constexpr LazyScaled(const Operand& operand, const NumericType number) noexcept
+    : operand(operand), number(number) {}
+
+  [[nodiscard]] NumericType Component(const std::size_t component, const std::size_t index) const {
+    return Operation{}(operand.Component(component, index), number);
+  }
+
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return operand.Size();
+  }
+
+private:
+  const Operand operand;
+
+  const NumericType number;
+};
+
+/// \brief Whether a given type is a node of a lazy expression.
+template <typename Type>
+inline constexpr bool IsLazyExpression{false};
+
+template <typename Type>
+inline constexpr bool IsLazyExpression<LazyOperand<Type>>{true};
+
+template <typename Left, typename Right, typename Operation>
+inline constexpr bool IsLazyExpression<LazyBinary<Left, Right, Operation>>{true};
+
+template <typename Operand, typename Operation>
+inline constexpr bool IsLazyExpression<LazyScaled<Operand, Operation>>{true};
+
+}  // namespace Internal
+
+/// \brief Wraps a given object so that arithmetic on it builds a lazy expression instead of
+/// computing a temporary at each operator. The object can be a PhQ::Vector, a PhQ::SymmetricDyad, a
+/// PhQ::Dyad, a physical quantity such as PhQ::Velocity or PhQ::Stress, or a PhQ::Field of such
+/// physical quantities. PhQ::Direction and PhQ::PlanarDirection objects cannot be wrapped, since a
+/// linear combination of directions is generally not a direction. Lazy expressions support
+/// addition and subtraction of objects of the same type, negation, and multiplication and division
+/// by a number, so they keep the same dimensional typing as the eager operators. The whole
+/// expression is evaluated in a single pass by PhQ::Evaluate, with one loop per component when it
+/// contains fields. Since every operation is element-wise, the destination of the evaluation may
+/// also be one of the operands. The wrapped objects are referenced rather than copied, so they must
+/// outlive the expression. For example:
+/// \code
+/// PhQ::Field<PhQ::Velocity<>> result = PhQ::Evaluate(
+///     PhQ::Lazy(velocities_1) + PhQ::Lazy(velocities_2) - PhQ::Lazy(velocities_3) * 0.5);
+/// \endcode
+template <typename Type,
+          std::enable_if_t<
+              Internal::IsLinearlyCombinable<typename Internal::LazyOperandTraits<Type>::Element>,
+              bool> = true>
+[[nodiscard]] constexpr Internal::LazyOperand<Type> Lazy(const Type& operand) noexcept {
+  return Internal::LazyOperand<Type>{operand};
+}
+
+/// \brief Evaluates a given lazy expression that contains fields into a given field, which is
+/// resized to the size of the fields in the expression. Reusing the same destination field avoids
+/// allocating memory at each evaluation.
+template <typename Expression,
+          std::enable_if_t<Internal::IsLazyExpression<Expression>, bool> = true>
+void Evaluate(const Expression& expression, Field<typename Expression::Element>& destination) {
+  static_assert(Expression::IsField,
+                "Only lazy expressions that contain fields can be evaluated into a field.");
+  using NumericType = typename Expression::NumericType;
+  const std::size_t size{expression.Size()};
+  destination.Resize(size);
+  for (std::size_t component = 0; component < Expression::NumberOfComponents; ++component) {
+    NumericType* const values{destination.MutableComponents()[component].data()};
+    for (std::size_t index = 0; index < size; ++index) {
+      values[index] = expression.Component(component, index);
+    }
+  }
+}
+
+/// \brief Evaluates a given lazy expression. Returns a PhQ::Field if the expression contains any
+/// field, or a single object otherwise. Fields in the expression must all have the same size;
+/// single objects in an expression that contains fields are applied to every element.
+template <typename Expression,
+          std::enable_if_t<Internal::IsLazyExpression<Expression>, bool> = true>
+[[nodiscard]] auto Evaluate(const Expression& expression) {
+  using Element = typename Expression::Element;
+  using NumericType = typename Expression::NumericType;
+  if constexpr (Expression::IsField) {
+    Field<Element> result{expression.Size()};
+    Evaluate(expression, result);
+    return result;
+  } else {
+    Element result;
+    NumericType* const values{
+        Internal::Components<Expression::NumberOfComponents, NumericType>(&result)};
+    for (std::size_t component = 0; component < Expression::NumberOfComponents; ++component) {
+      values[component] = expression.Component(component, 0);
+    }
+    return result;
+  }
+}
+
+template <typename Left, typename Right,
+          std::enable_if_t<Internal::IsLazyExpression<Left> && Internal::IsLazyExpression<Right>,
+                           bool> = true>
+inline constexpr Internal::LazyBinary<Left, Right, std::plus<>> operator+(
+    const Left& left, const Right& right) noexcept {
+  return Internal::LazyBinary<Left, Right, std::plus<>>{left, right};
+}
+
+template <typename Left, typename Right,
+          std::enable_if_t<Internal::IsLazyExpression<Left> && Internal::IsLazyExpression<Right>,
+                           bool> = true>
+inline constexpr Internal::LazyBinary<Left, Right, std::minus<>> operator-(
+    const Left& left, const Right& right) noexcept {
+  return Internal::LazyBinary<Left, Right, std::minus<>>{left, right};
+}
+
+template <typename Expression,
+          std::enable_if_t<Internal::IsLazyExpression<Expression>, bool> = true>
+inline constexpr Internal::LazyScaled<Expression, std::multiplies<>> operator-(
+    const Expression& expression) noexcept {
+  return Internal::LazyScaled<Expression, std::multiplies<>>{
+      expression, static_cast<typename Expression::NumericType>(-1)};
+}
+
+template <typename Expression,
+          std::enable_if_t<Internal::IsLazyExpression<Expression>, bool> = true>
+inline constexpr Internal::LazyScaled<Expression, std::multiplies<>> operator*(
+    const Expression& expression, const typename Expression::NumericType number) noexcept {
+  return Internal::LazyScaled<Expression, std::multiplies<>>{expression, number};
+}
+
+template <typename Expression,
+          std::enable_if_t<Internal::IsLazyExpression<Expression>, bool> = true>
+inline constexpr Internal::LazyScaled<Expression, std::multiplies<>> operator*(
+    const typename Expression::NumericType number, const Expression& expression) noexcept {
+  return Internal::LazyScaled<Expression, std::multiplies<>>{expression, number};
+}
+
+template <typename Expression,
+          std::enable_if_t<Internal::IsLazyExpression<Expression>, bool> = true>
+inline constexpr Internal::LazyScaled<Expression, std::divides<>> operator/(
+    const Expression& expression, const typename Expression::NumericType number) noexcept {
+  return Internal::LazyScaled<Expression, std::divides<>>{expression, number};
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_EXPRESSION_HPP
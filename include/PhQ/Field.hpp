@@ -0,0 +1,599 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_FIELD_HPP
+#define PHQ_FIELD_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Base.hpp"
+#include "DimensionalAnalysis.hpp"
+#include "Direction.hpp"
+#include "SymmetricDyad.hpp"
+#include "Unit.hpp"
+#include "Vectorization.hpp"
+
+namespace PhQ {
+
+/// \brief Field of physical quantities stored as a structure of arrays. For example, a
+/// PhQ::Field<PhQ::Velocity<double>> stores the x, y, and z components of all of its velocities in
+/// three separate contiguous arrays rather than interleaving them as a std::vector of velocities
+/// would. This layout lets per-component loops such as additions, scalings, dot products,
+/// magnitudes, traces, and determinants operate on contiguous memory and be vectorized. Elements
+/// are accessed as the usual physical quantity classes, so unit type safety is preserved. The
+/// components are stored in the standard units of measure of the physical quantity.
+/// \tparam QuantityType Physical quantity type, such as PhQ::Velocity<double>,
+/// PhQ::Stress<float>, or PhQ::StaticQuantity for results that have no named physical quantity.
+template <typename QuantityType>
+class Field;
+
+namespace Internal {
+
+/// \brief Numeric type of the components of a given physical quantity class template
+/// specialization, such as double for PhQ::Velocity<double>. Internal implementation detail not
+/// intended to be used outside of the PhQ::Field class.
+template <typename Quantity>
+struct NamedFieldNumericType;
+
+template <template <typename> class QuantityTemplate, typename NumericType>
+struct NamedFieldNumericType<QuantityTemplate<NumericType>> {
+  using Type = NumericType;
+};
+
+/// \brief Numeric type of the components of a given physical quantity type that can be stored in a
+/// PhQ::Field, including PhQ::StaticQuantity. Internal implementation detail not intended to be
+/// used outside of the PhQ::Field class.
+template <typename Quantity>
+struct FieldNumericType {
+  using Type = typename NamedFieldNumericType<Quantity>::Type;
+};
+
+template <typename StaticDimensionsType, typename NumericType>
+struct FieldNumericType<StaticQuantity<StaticDimensionsType, NumericType>> {
+  using Type = NumericType;
+};
+
+/// \brief Scalar physical quantity type of the elements of a field of results whose physical
+/// dimension set is a given one. This is the named scalar physical quantity that represents the
+/// physical dimension set where one exists, or PhQ::StaticQuantity otherwise, including when the
+/// results are dimensionless, so that every field of results remains typed. Internal
+/// implementation detail not intended to be used outside of the PhQ::Field class.
+template <typename StaticDimensionsType, typename NumericType>
+using FieldScalarQuantity =
+    std::conditional_t<std::is_same_v<StaticDimensionsType, StaticDimensionless>,
+                       StaticQuantity<StaticDimensionless, NumericType>,
+                       PhQ::NamedQuantity<StaticDimensionsType, NumericType>>;
+
+/// \brief Physical quantity type of the elements of a field of the results of a given method of
+/// the physical quantity, given the type that the method returns. This is that type, or a
+/// dimensionless PhQ::StaticQuantity where the method returns a plain number, so that every field
+/// of results remains typed. Internal implementation detail not intended to be used outside of the
+/// PhQ::Field class.
+template <typename ResultType, typename NumericType>
+using FieldResultQuantity = std::conditional_t<std::is_arithmetic_v<ResultType>,
+                                               StaticQuantity<StaticDimensionless, NumericType>,
+                                               ResultType>;
+
+}  // namespace Internal
+
+template <typename QuantityType>
+class Field {
+public:
+  /// \brief Physical quantity type of the elements of this field.
+  using Quantity = QuantityType;
+
+  /// \brief Numeric type of the components of the elements of this field.
+  using NumericType = typename Internal::FieldNumericType<Quantity>::Type;
+
+  /// \brief Number of components of each element of this field, such as 3 for a vector or 6 for a
+  /// symmetric dyadic tensor.
+  static constexpr std::size_t NumberOfComponents{sizeof(Quantity) / sizeof(NumericType)};
+
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of a physical quantity must be a numeric "
+                "floating-point type: float, double, or long double.");
+
+  /// \brief Proxy to an element of a field. Converts to the physical quantity stored in the element
+  /// and assigns a physical quantity to the element.
+  class Reference {
+  public:
+    /// \brief Returns the physical quantity stored in the referenced element.
+    operator Quantity() const {
+      return field.Get(index);
+    }
+
+    /// \brief Stores a given physical quantity in the referenced element.
+    Reference& operator=(const Quantity& quantity) {
+      field.Set(index, quantity);
+      return *this;
+    }
+
+    /// \brief Stores the physical quantity of another element in the referenced element.
+    Reference& operator=(const Reference& other) {
+      field.Set(index, other.field.Get(other.index));
+      return *this;
+    }
+
+    /// \brief Equality operator. Compares the physical quantity stored in the referenced element
+    /// with a given physical quantity.
+    [[nodiscard]] friend bool operator==(const Reference& reference, const Quantity& quantity) {
+      return reference.field.Get(reference.index) == quantity;
+    }
+
+    /// \brief Inequality operator. Compares the physical quantity stored in the referenced element
+    /// with a given physical quantity.
+    [[nodiscard]] friend bool operator!=(const Reference& reference, const Quantity& quantity) {
+      return reference.field.Get(reference.index) != quantity;
+    }
+
+  private:
+    /// \brief Constructor. Constructs a proxy to a given element of a given field.
+    Reference(Field& field, const std::size_t index) : field(field), index(index) {}
+
+    /// \brief Field that contains the referenced element.
+    Field& field;
+
+    /// \brief Index of the referenced element in its field.
+    std::size_t index;
+
+    friend class Field;
+  };
+
+  /// \brief Default constructor. Constructs an empty field.
+  Field() = default;
+
+  /// \brief Constructor. Constructs a field with a given number of elements whose components are
+  /// all zero.
+  explicit Field(const std::size_t size) {
+    for (std::vector<NumericType>& component : components) {
+      component.resize(size);
+    }
+  }
+
+  /// \brief Constructor. Constructs a field with a given number of elements that are all equal to a
+  /// given physical quantity.
+  Field(const std::size_t size, const Quantity& quantity) {
+    Quantity copy{quantity};
+    const NumericType* const values{Internal::Components<NumberOfComponents, NumericType>(&copy)};
+    for (std::size_t index = 0; index < NumberOfComponents; ++index) {
+      components[index].assign(size, values[index]);
+    }
+  }
+
+  /// \brief Constructor. Constructs a field from a given collection of physical quantities.
+  explicit Field(const std::vector<Quantity>& quantities) : Field(quantities.size()) {
+    for (std::size_t index = 0; index < quantities.size(); ++index) {
+      Set(index, quantities[index]);
+    }
+  }
+
+  /// \brief Returns the number of elements in this field.
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return components[0].size();
+  }
+
+  /// \brief Changes the number of elements in this field. New elements have components that are
+  /// all zero.
+  void Resize(const std::size_t size) {
+    for (std::vector<NumericType>& component : components) {
+      component.resize(size);
+    }
+  }
+
+  /// \brief Appends a given physical quantity to the end of this field.
+  void PushBack(const Quantity& quantity) {
+    Quantity copy{quantity};
+    const NumericType* const values{Internal::Components<NumberOfComponents, NumericType>(&copy)};
+    for (std::size_t index = 0; index < NumberOfComponents; ++index) {
+      components[index].push_back(values[index]);
+    }
+  }
+
+  /// \brief Returns the physical quantity stored in the element at a given index.
+  [[nodiscard]] Quantity Get(const std::size_t index) const {
+    Quantity quantity;
+    NumericType* const values{Internal::Components<NumberOfComponents, NumericType>(&quantity)};
+    for (std::size_t component = 0; component < NumberOfComponents; ++component) {
+      values[component] = components[component][index];
+    }
+    return quantity;
+  }
+
+  /// \brief Stores a given physical quantity in the element at a given index.
+  void Set(const std::size_t index, const Quantity& quantity) {
+    Quantity copy{quantity};
+    const NumericType* const values{Internal::Components<NumberOfComponents, NumericType>(&copy)};
+    for (std::size_t component = 0; component < NumberOfComponents; ++component) {
+      components[component][index] = values[component];
+    }
+  }
+
+  /// \brief Returns the physical quantity stored in the element at a given index.
+  [[nodiscard]] Quantity operator[](const std::size_t index) const {
+    return Get(index);
+  }
+
+  /// \brief Returns a proxy to the element at a given index.
+  [[nodiscard]] Reference operator[](const std::size_t index) {
+    return Reference{*this, index};
+  }
+
+  /// \brief Returns the elements of this field as a collection of physical quantities.
+  [[nodiscard]] std::vector<Quantity> Quantities() const {
+    std::vector<Quantity> quantities;
+    quantities.reserve(Size());
+    for (std::size_t index = 0; index < Size(); ++index) {
+      quantities.push_back(Get(index));
+    }
+    return quantities;
+  }
+
+  /// \brief Returns the contiguous arrays of the components of the elements of this field,
+  /// expressed in the standard unit of measure of the physical quantity. The components are ordered
+  /// as in the underlying value type, such as x, y, z for a vector or xx, xy, xz, yy, yz, zz for a
+  /// symmetric dyadic tensor.
+  [[nodiscard]] const std::array<std::vector<NumericType>, NumberOfComponents>&
+  Components() const noexcept {
+    return components;
+  }
+
+  /// \brief Returns the contiguous arrays of the components of the elements of this field,
+  /// expressed in the standard unit of measure of the physical quantity. Modifying the arrays
+  /// directly bypasses unit type safety; the arrays must keep the same size.
+  [[nodiscard]] std::array<std::vector<NumericType>, NumberOfComponents>&
+  MutableComponents() noexcept {
+    return components;
+  }
+
+  /// \brief Adds another field element-wise to this one. Both fields must have the same size.
+  void operator+=(const Field& other) noexcept {
+    for (std::size_t component = 0; component < NumberOfComponents; ++component) {
+      NumericType* const values{components[component].data()};
+      const NumericType* const other_values{other.components[component].data()};
+      const std::size_t size{components[component].size()};
+      for (std::size_t index = 0; index < size; ++index) {
+        values[index] += other_values[index];
+      }
+    }
+  }
+
+  /// \brief Subtracts another field element-wise from this one. Both fields must have the same
+  /// size.
+  void operator-=(const Field& other) noexcept {
+    for (std::size_t component = 0; component < NumberOfComponents; ++component) {
+      NumericType* const values{components[component].data()};
+      const NumericType* const other_values{other.components[component].data()};
+      const std::size_t size{components[component].size()};
+      for (std::size_t index = 0; index < size; ++index) {
+        values[index] -= other_values[index];
+      }
+    }
+  }
+
+  /// \brief Multiplies each element of this field by a given number.
+  void operator*=(const NumericType number) noexcept {
+    for (std::vector<NumericType>& component : components) {
+      Internal::MultiplyInPlace(component.data(), component.size(), number);
+    }
+  }
+
+  /// \brief Divides each element of this field by a given number.
+  void operator/=(const NumericType number) noexcept {
+    for (std::vector<NumericType>& component : components) {
+      Internal::DivideInPlace(component.data(), component.size(), number);
+    }
+  }
+
+  /// \brief Returns the magnitudes of the elements of this field of planar vectors or vectors as a
+  /// field of the corresponding scalar physical quantity, such as a field of speeds for a field of
+  /// velocities.
+  [[nodiscard]] auto Magnitude() const {
+    static_assert(NumberOfComponents == 2 || NumberOfComponents == 3,
+                  "Magnitudes are only defined for fields of planar vectors or vectors.");
+    using MagnitudeQuantity = decltype(std::declval<const Quantity&>().Magnitude());
+    Field<MagnitudeQuantity> result{Size()};
+    NumericType* const magnitudes{result.MutableComponents()[0].data()};
+    const NumericType* const x{components[0].data()};
+    const NumericType* const y{components[1].data()};
+    if constexpr (NumberOfComponents == 2) {
+      for (std::size_t index = 0; index < Size(); ++index) {
+        magnitudes[index] = std::sqrt(x[index] * x[index] + y[index] * y[index]);
+      }
+    } else {
+      const NumericType* const z{components[2].data()};
+      for (std::size_t index = 0; index < Size(); ++index) {
+        magnitudes[index] =
+            std::sqrt(x[index] * x[index] + y[index] * y[index] + z[index] * z[index]);
+      }
+    }
+    return result;
+  }
+
+  /// \brief Returns the dot products of the elements of this field of planar vectors or vectors
+  /// with the elements of another field of the same dimensionality as a field of the scalar
+  /// physical quantity whose physical dimension set is the product of those of the two physical
+  /// quantities, such as a field of energies for forces and displacements. Where no named scalar
+  /// physical quantity has this physical dimension set, or where it is dimensionless, the field
+  /// holds PhQ::StaticQuantity elements. Both fields must have the same size.
+  template <typename OtherQuantity>
+  [[nodiscard]] auto Dot(const Field<OtherQuantity>& other) const {
+    static_assert(NumberOfComponents == 2 || NumberOfComponents == 3,
+                  "Dot products are only defined for fields of planar vectors or vectors.");
+    static_assert(Field<OtherQuantity>::NumberOfComponents == NumberOfComponents,
+                  "Dot products are only defined between fields of the same dimensionality.");
+    using DotQuantity = Internal::FieldScalarQuantity<
+        StaticDimensionsProduct<StaticDimensionsOf<Quantity>, StaticDimensionsOf<OtherQuantity>>,
+        NumericType>;
+    Field<DotQuantity> result{Size()};
+    NumericType* const dots{result.MutableComponents()[0].data()};
+    for (std::size_t component = 0; component < NumberOfComponents; ++component) {
+      const NumericType* const values{components[component].data()};
+      const NumericType* const other_values{other.Components()[component].data()};
+      for (std::size_t index = 0; index < Size(); ++index) {
+        dots[index] += values[index] * other_values[index];
+      }
+    }
+    return result;
+  }
+
+  /// \brief Returns the traces of the elements of this field of symmetric dyadic tensors or dyadic
+  /// tensors as a field of the corresponding scalar physical quantity, such as a field of scalar
+  /// stresses for a field of stresses.
+  [[nodiscard]] auto Trace() const {
+    static_assert(NumberOfComponents == 6 || NumberOfComponents == 9,
+                  "Traces are only defined for fields of symmetric dyadic tensors or dyadic "
+                  "tensors.");
+    constexpr std::array<std::size_t, 3> diagonal{
+        NumberOfComponents == 6 ? std::array<std::size_t, 3>{0, 3, 5} :
+                                  std::array<std::size_t, 3>{0, 4, 8}};
+    const NumericType* const xx{components[diagonal[0]].data()};
+    const NumericType* const yy{components[diagonal[1]].data()};
+    const NumericType* const zz{components[diagonal[2]].data()};
+    using TraceQuantity = decltype(std::declval<const Quantity&>().xx());
+    Field<TraceQuantity> result{Size()};
+    NumericType* const traces{result.MutableComponents()[0].data()};
+    for (std::size_t index = 0; index < Size(); ++index) {
+      traces[index] = xx[index] + yy[index] + zz[index];
+    }
+    return result;
+  }
+
+  /// \brief Returns the determinants of the elements of this field of symmetric dyadic tensors or
+  /// dyadic tensors as a field of the scalar physical quantity whose physical dimension set is the
+  /// cube of that of the physical quantity. Where no named scalar physical quantity has this
+  /// physical dimension set, or where it is dimensionless, the field holds PhQ::StaticQuantity
+  /// elements, such as cubed stresses for a field of stresses.
+  [[nodiscard]] auto Determinant() const {
+    static_assert(NumberOfComponents == 6 || NumberOfComponents == 9,
+                  "Determinants are only defined for fields of symmetric dyadic tensors or dyadic "
+                  "tensors.");
+    // Indices of the xx, xy, xz, yx, yy, yz, zx, zy, and zz components.
+    constexpr std::array<std::size_t, 9> indices{
+        NumberOfComponents == 6 ? std::array<std::size_t, 9>{0, 1, 2, 1, 3, 4, 2, 4, 5} :
+                                  std::array<std::size_t, 9>{0, 1, 2, 3, 4, 5, 6, 7, 8}};
+    const NumericType* const xx{components[indices[0]].data()};
+    const NumericType* const xy{components[indices[1]].data()};
+    const NumericType* const xz{components[indices[2]].data()};
+    const NumericType* const yx{components[indices[3]].data()};
+    const NumericType* const yy{components[indices[4]].data()};
+    const NumericType* const yz{components[indices[5]].data()};
+    const NumericType* const zx{components[indices[6]].data()};
+    const NumericType* const zy{components[indices[7]].data()};
+    const NumericType* const zz{components[indices[8]].data()};
+    using QuantityDimensions = StaticDimensionsOf<Quantity>;
+    using DeterminantQuantity = Internal::FieldScalarQuantity<
+        StaticDimensionsProduct<QuantityDimensions,
+                                StaticDimensionsProduct<QuantityDimensions, QuantityDimensions>>,
+        NumericType>;
+    Field<DeterminantQuantity> result{Size()};
+    NumericType* const determinants{result.MutableComponents()[0].data()};
+    for (std::size_t index = 0; index < Size(); ++index) {
+      determinants[index] = xx[index] * (yy[index] * zz[index] - yz[index] * zy[index])
+                            + xy[index] * (yz[index] * zx[index] - yx[index] * zz[index])
+                            + xz[index] * (yx[index] * zy[index] - yy[index] * zx[index]);
+    }
+    return result;
+  }
+
+  /// \brief Returns the eigenvalues of the elements of this field of symmetric dyadic tensors as
+  /// fields of the corresponding scalar physical quantity, such as fields of scalar stresses for a
+  /// field of stresses. The first, second, and third fields hold the largest, middle, and smallest
+  /// eigenvalue of each element. The eigenvalues are computed in closed form rather than
+  /// iteratively.
+  [[nodiscard]] auto Eigenvalues() const {
+    static_assert(NumberOfComponents == 6,
+                  "Eigenvalues are only defined for fields of symmetric dyadic tensors.");
+    using EigenvalueQuantity = decltype(std::declval<const Quantity&>().xx());
+    std::array<Field<EigenvalueQuantity>, 3> result{
+        Field<EigenvalueQuantity>{Size()}, Field<EigenvalueQuantity>{Size()},
+        Field<EigenvalueQuantity>{Size()}};
+    std::array<NumericType*, 3> outputs;
+    for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+      outputs[eigen_index] = result[eigen_index].MutableComponents()[0].data();
+    }
+    for (std::size_t index = 0; index < Size(); ++index) {
+      const std::array<NumericType, 3> eigenvalues{Element(index).Eigenvalues()};
+      for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+        outputs[eigen_index][index] = eigenvalues[eigen_index];
+      }
+    }
+    return result;
+  }
+
+  /// \brief Returns the principal directions of the elements of this field of symmetric dyadic
+  /// tensors. The first, second, and third fields hold the principal directions that correspond to
+  /// the largest, middle, and smallest eigenvalue of each element, as returned by Eigenvalues().
+  /// The principal directions of each element form a right-handed orthonormal basis. The
+  /// eigenvalues of each element are computed once and reused for its eigenvectors.
+  [[nodiscard]] std::array<Field<Direction<NumericType>>, 3> PrincipalDirections() const {
+    static_assert(NumberOfComponents == 6,
+                  "Principal directions are only defined for fields of symmetric dyadic tensors.");
+    std::array<Field<Direction<NumericType>>, 3> result{
+        Field<Direction<NumericType>>{Size()}, Field<Direction<NumericType>>{Size()},
+        Field<Direction<NumericType>>{Size()}};
+    for (std::size_t index = 0; index < Size(); ++index) {
+      const SymmetricDyad<NumericType> element{Element(index)};
+      const std::array<Vector<NumericType>, 3> eigenvectors{
+          element.Eigenvectors(element.Eigenvalues())};
+      for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+        std::array<std::vector<NumericType>, 3>& directions{
+            result[eigen_index].MutableComponents()};
+        directions[0][index] = eigenvectors[eigen_index].x();
+        directions[1][index] = eigenvectors[eigen_index].y();
+        directions[2][index] = eigenvectors[eigen_index].z();
+      }
+    }
+    return result;
+  }
+
+  /// \brief Returns the deviatoric parts of the elements of this field of stress or strain tensors.
+  [[nodiscard]] Field<Quantity> Deviatoric() const {
+    static_assert(NumberOfComponents == 6,
+                  "Deviatoric parts are only defined for fields of symmetric dyadic tensors.");
+    Field<Quantity> result{Size()};
+    Apply([](const Quantity& quantity) { return quantity.Deviatoric(); },
+          result.MutableComponents());
+    return result;
+  }
+
+  /// \brief Returns the hydrostatic parts of the elements of this field of stress or strain tensors
+  /// as a field of the corresponding scalar physical quantity, such as a field of scalar stresses
+  /// for a field of stresses.
+  [[nodiscard]] auto Hydrostatic() const {
+    static_assert(NumberOfComponents == 6,
+                  "Hydrostatic parts are only defined for fields of symmetric dyadic tensors.");
+    using HydrostaticQuantity = decltype(std::declval<const Quantity&>().Hydrostatic());
+    Field<HydrostaticQuantity> result{Size()};
+    Apply([](const Quantity& quantity) { return quantity.Hydrostatic(); },
+          result.MutableComponents());
+    return result;
+  }
+
+  /// \brief Returns the second invariants of the deviatoric parts of the elements of this field of
+  /// stress or strain tensors as a field of the type returned by the J2 method of the physical
+  /// quantity, such as PhQ::StaticQuantity elements whose physical dimension set is the square of
+  /// that of stress for a field of stresses. Where that method returns a plain number because the
+  /// invariant is dimensionless, the field holds dimensionless PhQ::StaticQuantity elements.
+  [[nodiscard]] auto J2() const {
+    static_assert(NumberOfComponents == 6,
+                  "Deviatoric invariants are only defined for fields of symmetric dyadic tensors.");
+    using J2Quantity = Internal::FieldResultQuantity<
+        decltype(std::declval<const Quantity&>().J2()), NumericType>;
+    Field<J2Quantity> result{Size()};
+    Apply([](const Quantity& quantity) { return quantity.J2(); }, result.MutableComponents());
+    return result;
+  }
+
+  /// \brief Returns the third invariants of the deviatoric parts of the elements of this field of
+  /// stress or strain tensors as a field of the type returned by the J3 method of the physical
+  /// quantity, such as PhQ::StaticQuantity elements whose physical dimension set is the cube of
+  /// that of stress for a field of stresses. Where that method returns a plain number because the
+  /// invariant is dimensionless, the field holds dimensionless PhQ::StaticQuantity elements.
+  [[nodiscard]] auto J3() const {
+    static_assert(NumberOfComponents == 6,
+                  "Deviatoric invariants are only defined for fields of symmetric dyadic tensors.");
+    using J3Quantity = Internal::FieldResultQuantity<
+        decltype(std::declval<const Quantity&>().J3()), NumericType>;
+    Field<J3Quantity> result{Size()};
+    Apply([](const Quantity& quantity) { return quantity.J3(); }, result.MutableComponents());
+    return result;
+  }
+
+  /// \brief Returns the von Mises equivalents of the elements of this field of stress or strain
+  /// tensors as a field of the corresponding scalar physical quantity.
+  [[nodiscard]] auto VonMises() const {
+    static_assert(NumberOfComponents == 6,
+                  "Von Mises equivalents are only defined for fields of symmetric dyadic tensors.");
+    using VonMisesQuantity = decltype(std::declval<const Quantity&>().VonMises());
+    Field<VonMisesQuantity> result{Size()};
+    Apply([](const Quantity& quantity) { return quantity.VonMises(); }, result.MutableComponents());
+    return result;
+  }
+
+  /// \brief Returns the Tresca equivalents of the elements of this field of stress tensors as a
+  /// field of the corresponding scalar physical quantity. Unlike the other invariants, these
+  /// require the principal values of each element, so this loop is not vectorized.
+  [[nodiscard]] auto Tresca() const {
+    static_assert(NumberOfComponents == 6,
+                  "Tresca equivalents are only defined for fields of symmetric dyadic tensors.");
+    using TrescaQuantity = decltype(std::declval<const Quantity&>().Tresca());
+    Field<TrescaQuantity> result{Size()};
+    Apply([](const Quantity& quantity) { return quantity.Tresca(); }, result.MutableComponents());
+    return result;
+  }
+
+private:
+  /// \brief Returns the symmetric dyadic tensor stored in the element at a given index of this
+  /// field of symmetric dyadic tensors, expressed in the standard unit of measure of the physical
+  /// quantity.
+  [[nodiscard]] SymmetricDyad<NumericType> Element(const std::size_t index) const {
+    return {components[0][index], components[1][index], components[2][index],
+            components[3][index], components[4][index], components[5][index]};
+  }
+
+  /// \brief Evaluates a given function on the physical quantity stored in each element of this
+  /// field and stores the components of each result in the given component arrays, which must
+  /// already have the size of this field. Each element is assembled from the component arrays
+  /// inside the loop, so when the function is inlined and has no branches, the loop over the
+  /// elements is vectorized.
+  template <typename Function, std::size_t NumberOfResultComponents>
+  void Apply(const Function& function,
+             std::array<std::vector<NumericType>, NumberOfResultComponents>& results) const {
+    using Result = std::decay_t<decltype(function(std::declval<const Quantity&>()))>;
+    std::array<const NumericType*, NumberOfComponents> inputs;
+    for (std::size_t component = 0; component < NumberOfComponents; ++component) {
+      inputs[component] = components[component].data();
+    }
+    std::array<NumericType*, NumberOfResultComponents> outputs;
+    for (std::size_t component = 0; component < NumberOfResultComponents; ++component) {
+      outputs[component] = results[component].data();
+    }
+    for (std::size_t index = 0; index < Size(); ++index) {
+      Quantity quantity;
+      NumericType* const values{Internal::Components<NumberOfComponents, NumericType>(&quantity)};
+      for (std::size_t component = 0; component < NumberOfComponents; ++component) {
+        values[component] = inputs[component][index];
+      }
+      Result result{function(quantity)};
+      const NumericType* const result_values{
+          Internal::Components<NumberOfResultComponents, NumericType>(&result)};
+      for (std::size_t component = 0; component < NumberOfResultComponents; ++component) {
+        outputs[component][index] = result_values[component];
+      }
+    }
+  }
+
+  /// \brief Contiguous arrays of the components of the elements of this field, expressed in the
+  /// standard unit of measure of the physical quantity.
+  std::array<std::vector<NumericType>, NumberOfComponents> components;
+};
+
+}  // namespace PhQ
+
+#endif  // PHQ_FIELD_HPP
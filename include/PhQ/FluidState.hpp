@@ -0,0 +1,558 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_FLUID_STATE_HPP
+#define PHQ_FLUID_STATE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "DynamicPressure.hpp"
+#include "DynamicViscosity.hpp"
+#include "Field.hpp"
+#include "HeatCapacityRatio.hpp"
+#include "KinematicViscosity.hpp"
+#include "Length.hpp"
+#include "MachNumber.hpp"
+#include "MassDensity.hpp"
+#include "PrandtlNumber.hpp"
+#include "ReynoldsNumber.hpp"
+#include "ScalarThermalConductivity.hpp"
+#include "SoundSpeed.hpp"
+#include "SpecificGasConstant.hpp"
+#include "SpecificIsobaricHeatCapacity.hpp"
+#include "Speed.hpp"
+#include "StaticPressure.hpp"
+#include "Temperature.hpp"
+#include "ThermalDiffusivity.hpp"
+#include "TotalPressure.hpp"
+#include "Unit/Diffusivity.hpp"
+#include "Unit/Pressure.hpp"
+#include "Unit/SpecificHeatCapacity.hpp"
+#include "Unit/Speed.hpp"
+#include "Velocity.hpp"
+
+namespace PhQ {
+
+/// \brief Thermodynamic and kinematic state of a fluid at a point, such as a cell of a
+/// computational fluid dynamics mesh. It holds the mass density, velocity, static pressure,
+/// temperature, dynamic viscosity, specific isobaric heat capacity, and scalar thermal conductivity
+/// of the fluid, and derives from them quantities such as the speed of sound, the Mach number, the
+/// dynamic and total pressures, and the Prandtl and Reynolds numbers. The fluid is assumed to be an
+/// ideal gas, so its specific gas constant is p / (rho * T). Derived quantities are computed on
+/// request, and the expensive subexpressions that several derived quantities share, namely the
+/// reciprocal of the mass density, the speed, the heat capacity ratio, and the speed of sound, are
+/// memoized in the fluid state. For example, requesting the speed of sound and then the Mach number
+/// computes only one square root for the speed of sound and one for the speed. A fluid state is
+/// immutable once constructed, so its memoized values never become stale. Since memoization writes
+/// to the fluid state from const methods, a single fluid state must not be queried concurrently
+/// from several threads. The static batched methods never memoize, so they may be called
+/// concurrently on the same fluid states. For many cells, the structure-of-arrays batched method
+/// that takes a PhQ::FluidState::Fields is faster still, since its loop is vectorized.
+template <typename NumericType = double>
+class FluidState {
+public:
+  /// \brief Fields of the mass densities, velocities, static pressures, temperatures, dynamic
+  /// viscosities, specific isobaric heat capacities, and scalar thermal conductivities of many
+  /// fluid states, such as the cells of a computational fluid dynamics mesh, stored as a structure
+  /// of arrays. All fields must have the same size.
+  struct Fields {
+    /// \brief Mass densities of the fluid states.
+    Field<PhQ::MassDensity<NumericType>> mass_densities;
+
+    /// \brief Velocities of the fluid states.
+    Field<PhQ::Velocity<NumericType>> velocities;
+
+    /// \brief Static pressures of the fluid states.
+    Field<PhQ::StaticPressure<NumericType>> static_pressures;
+
+    /// \brief Temperatures of the fluid states.
+    Field<PhQ::Temperature<NumericType>> temperatures;
+
+    /// \brief Dynamic viscosities of the fluid states.
+    Field<PhQ::DynamicViscosity<NumericType>> dynamic_viscosities;
+
+    /// \brief Specific isobaric heat capacities of the fluid states.
+    Field<PhQ::SpecificIsobaricHeatCapacity<NumericType>> specific_isobaric_heat_capacities;
+
+    /// \brief Scalar thermal conductivities of the fluid states.
+    Field<PhQ::ScalarThermalConductivity<NumericType>> scalar_thermal_conductivities;
+  };
+
+  /// \brief Fields of the quantities derived from many fluid states, stored as a structure of
+  /// arrays.
+  struct DerivedFields {
+    /// \brief Heat capacity ratios of the fluid states.
+    Field<PhQ::HeatCapacityRatio<NumericType>> heat_capacity_ratios;
+
+    /// \brief Speeds of sound of the fluid states.
+    Field<PhQ::SoundSpeed<NumericType>> sound_speeds;
+
+    /// \brief Mach numbers of the fluid states.
+    Field<PhQ::MachNumber<NumericType>> mach_numbers;
+
+    /// \brief Dynamic pressures of the fluid states.
+    Field<PhQ::DynamicPressure<NumericType>> dynamic_pressures;
+
+    /// \brief Total pressures of the fluid states.
+    Field<PhQ::TotalPressure<NumericType>> total_pressures;
+
+    /// \brief Prandtl numbers of the fluid states.
+    Field<PhQ::PrandtlNumber<NumericType>> prandtl_numbers;
+
+    /// \brief Reynolds numbers of the fluid states for the characteristic length.
+    Field<PhQ::ReynoldsNumber<NumericType>> reynolds_numbers;
+  };
+
+  /// \brief Default constructor. Constructs a fluid state with an uninitialized value.
+  FluidState() = default;
+
+  /// \brief Constructor. Constructs a fluid state from a given mass density, velocity, static
+  /// pressure, temperature, dynamic viscosity, specific isobaric heat capacity, and scalar thermal
+  /// conductivity.
+  constexpr FluidState(
+      const PhQ::MassDensity<NumericType>& mass_density, const PhQ::Velocity<NumericType>& velocity,
+      const PhQ::StaticPressure<NumericType>& static_pressure,
+      const PhQ::Temperature<NumericType>& temperature,
+      const PhQ::DynamicViscosity<NumericType>& dynamic_viscosity,
+      const PhQ::SpecificIsobaricHeatCapacity<NumericType>& specific_isobaric_heat_capacity,
+      const PhQ::ScalarThermalConductivity<NumericType>& scalar_thermal_conductivity)
+    : mass_density(mass_density), velocity(velocity), static_pressure(static_pressure),
+      temperature(temperature), dynamic_viscosity(dynamic_viscosity),
+      specific_isobaric_heat_capacity(specific_isobaric_heat_capacity),
+      scalar_thermal_conductivity(scalar_thermal_conductivity) {}
+
+  /// \brief Mass density of this fluid state.
+  [[nodiscard]] constexpr const PhQ::MassDensity<NumericType>& MassDensity() const noexcept {
+    return mass_density;
+  }
+
+  /// \brief Velocity of this fluid state.
+  [[nodiscard]] constexpr const PhQ::Velocity<NumericType>& Velocity() const noexcept {
+    return velocity;
+  }
+
+  /// \brief Static pressure of this fluid state.
+  [[nodiscard]] constexpr const PhQ::StaticPressure<NumericType>& StaticPressure() const noexcept {
+    return static_pressure;
+  }
+
+  /// \brief Temperature of this fluid state.
+  [[nodiscard]] constexpr const PhQ::Temperature<NumericType>& Temperature() const noexcept {
+    return temperature;
+  }
+
+  /// \brief Dynamic viscosity of this fluid state.
+  [[nodiscard]] constexpr const PhQ::DynamicViscosity<NumericType>&
+  DynamicViscosity() const noexcept {
+    return dynamic_viscosity;
+  }
+
+  /// \brief Specific isobaric heat capacity of this fluid state.
+  [[nodiscard]] constexpr const PhQ::SpecificIsobaricHeatCapacity<NumericType>&
+  SpecificIsobaricHeatCapacity() const noexcept {
+    return specific_isobaric_heat_capacity;
+  }
+
+  /// \brief Scalar thermal conductivity of this fluid state.
+  [[nodiscard]] constexpr const PhQ::ScalarThermalConductivity<NumericType>&
+  ScalarThermalConductivity() const noexcept {
+    return scalar_thermal_conductivity;
+  }
+
+  /// \brief Speed of this fluid state, which is the magnitude of its velocity. Memoized.
+  [[nodiscard]] PhQ::Speed<NumericType> Speed() const {
+    return PhQ::Speed<NumericType>{SpeedValue(), Standard<Unit::Speed>};
+  }
+
+  /// \brief Specific gas constant of this fluid state, which is p / (rho * T) for an ideal gas.
+  [[nodiscard]] PhQ::SpecificGasConstant<NumericType> SpecificGasConstant() const {
+    return PhQ::SpecificGasConstant<NumericType>{
+      SpecificGasConstantValue(), Standard<Unit::SpecificHeatCapacity>};
+  }
+
+  /// \brief Heat capacity ratio of this fluid state, which is cp / (cp - R) for an ideal gas.
+  /// Memoized.
+  [[nodiscard]] PhQ::HeatCapacityRatio<NumericType> HeatCapacityRatio() const {
+    return PhQ::HeatCapacityRatio<NumericType>{HeatCapacityRatioValue()};
+  }
+
+  /// \brief Speed of sound of this fluid state, which is sqrt(gamma * p / rho). Memoized.
+  [[nodiscard]] PhQ::SoundSpeed<NumericType> SoundSpeed() const {
+    return PhQ::SoundSpeed<NumericType>{SoundSpeedValue(), Standard<Unit::Speed>};
+  }
+
+  /// \brief Mach number of this fluid state, which is its speed divided by its speed of sound.
+  [[nodiscard]] PhQ::MachNumber<NumericType> MachNumber() const {
+    return PhQ::MachNumber<NumericType>{SpeedValue() / SoundSpeedValue()};
+  }
+
+  /// \brief Dynamic pressure of this fluid state, which is 0.5 * rho * |u|^2.
+  [[nodiscard]] PhQ::DynamicPressure<NumericType> DynamicPressure() const {
+    return PhQ::DynamicPressure<NumericType>{DynamicPressureValue(), Standard<Unit::Pressure>};
+  }
+
+  /// \brief Total pressure of this fluid state, which is the sum of its static pressure and its
+  /// dynamic pressure.
+  [[nodiscard]] PhQ::TotalPressure<NumericType> TotalPressure() const {
+    return PhQ::TotalPressure<NumericType>{
+      static_pressure.Value() + DynamicPressureValue(), Standard<Unit::Pressure>};
+  }
+
+  /// \brief Kinematic viscosity of this fluid state, which is mu / rho.
+  [[nodiscard]] PhQ::KinematicViscosity<NumericType> KinematicViscosity() const {
+    return PhQ::KinematicViscosity<NumericType>{
+      dynamic_viscosity.Value() * InverseMassDensityValue(), Standard<Unit::Diffusivity>};
+  }
+
+  /// \brief Thermal diffusivity of this fluid state, which is k / (rho * cp).
+  [[nodiscard]] PhQ::ThermalDiffusivity<NumericType> ThermalDiffusivity() const {
+    return PhQ::ThermalDiffusivity<NumericType>{
+      scalar_thermal_conductivity.Value() * InverseMassDensityValue()
+          / specific_isobaric_heat_capacity.Value(),
+      Standard<Unit::Diffusivity>};
+  }
+
+  /// \brief Prandtl number of this fluid state, which is cp * mu / k.
+  [[nodiscard]] PhQ::PrandtlNumber<NumericType> PrandtlNumber() const {
+    return PhQ::PrandtlNumber<NumericType>{
+      specific_isobaric_heat_capacity.Value() * dynamic_viscosity.Value()
+      / scalar_thermal_conductivity.Value()};
+  }
+
+  /// \brief Reynolds number of this fluid state for a given characteristic length, which is rho *
+  /// |u| * L / mu.
+  [[nodiscard]] PhQ::ReynoldsNumber<NumericType> ReynoldsNumber(
+      const Length<NumericType>& length) const {
+    return PhQ::ReynoldsNumber<NumericType>{
+      mass_density.Value() * SpeedValue() * length.Value() / dynamic_viscosity.Value()};
+  }
+
+  /// \brief Computes the heat capacity ratios of a given number of fluid states. Does not memoize.
+  static void HeatCapacityRatios(const FluidState<NumericType>* const fluid_states,
+                                 const std::size_t size,
+                                 PhQ::HeatCapacityRatio<NumericType>* const heat_capacity_ratios) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const FluidState<NumericType>& state{fluid_states[index]};
+      heat_capacity_ratios[index] = PhQ::HeatCapacityRatio<NumericType>{state.HeatCapacityRatioOf(
+          static_cast<NumericType>(1) / state.mass_density.Value())};
+    }
+  }
+
+  /// \brief Computes the speeds of sound of a given number of fluid states. Does not memoize.
+  static void SoundSpeeds(const FluidState<NumericType>* const fluid_states,
+                          const std::size_t size,
+                          PhQ::SoundSpeed<NumericType>* const sound_speeds) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const FluidState<NumericType>& state{fluid_states[index]};
+      sound_speeds[index] = PhQ::SoundSpeed<NumericType>{
+        state.SoundSpeedOf(static_cast<NumericType>(1) / state.mass_density.Value()),
+        Standard<Unit::Speed>};
+    }
+  }
+
+  /// \brief Computes the Mach numbers of a given number of fluid states. Does not memoize.
+  static void MachNumbers(const FluidState<NumericType>* const fluid_states,
+                          const std::size_t size,
+                          PhQ::MachNumber<NumericType>* const mach_numbers) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const FluidState<NumericType>& state{fluid_states[index]};
+      mach_numbers[index] = PhQ::MachNumber<NumericType>{
+        state.velocity.Value().Magnitude()
+        / state.SoundSpeedOf(static_cast<NumericType>(1) / state.mass_density.Value())};
+    }
+  }
+
+  /// \brief Computes the dynamic pressures of a given number of fluid states. Does not memoize.
+  static void DynamicPressures(const FluidState<NumericType>* const fluid_states,
+                               const std::size_t size,
+                               PhQ::DynamicPressure<NumericType>* const dynamic_pressures) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const FluidState<NumericType>& state{fluid_states[index]};
+      dynamic_pressures[index] = PhQ::DynamicPressure<NumericType>{
+        state.DynamicPressureOf(state.velocity.Value().Magnitude()), Standard<Unit::Pressure>};
+    }
+  }
+
+  /// \brief Computes the total pressures of a given number of fluid states. Does not memoize.
+  static void TotalPressures(const FluidState<NumericType>* const fluid_states,
+                             const std::size_t size,
+                             PhQ::TotalPressure<NumericType>* const total_pressures) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const FluidState<NumericType>& state{fluid_states[index]};
+      total_pressures[index] = PhQ::TotalPressure<NumericType>{
+        state.static_pressure.Value() + state.DynamicPressureOf(state.velocity.Value().Magnitude()),
+        Standard<Unit::Pressure>};
+    }
+  }
+
+  /// \brief Computes the Prandtl numbers of a given number of fluid states.
+  static void PrandtlNumbers(const FluidState<NumericType>* const fluid_states,
+                             const std::size_t size,
+                             PhQ::PrandtlNumber<NumericType>* const prandtl_numbers) {
+    for (std::size_t index = 0; index < size; ++index) {
+      prandtl_numbers[index] = fluid_states[index].PrandtlNumber();
+    }
+  }
+
+  /// \brief Computes the Reynolds numbers of a given number of fluid states for a given
+  /// characteristic length. Does not memoize.
+  static void ReynoldsNumbers(const FluidState<NumericType>* const fluid_states,
+                              const std::size_t size,
+                              PhQ::ReynoldsNumber<NumericType>* const reynolds_numbers,
+                              const Length<NumericType>& length) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const FluidState<NumericType>& state{fluid_states[index]};
+      reynolds_numbers[index] = PhQ::ReynoldsNumber<NumericType>{
+        state.mass_density.Value() * state.velocity.Value().Magnitude() * length.Value()
+        / state.dynamic_viscosity.Value()};
+    }
+  }
+
+  /// \brief Computes the heat capacity ratios, speeds of sound, Mach numbers, dynamic pressures,
+  /// total pressures, Prandtl numbers, and Reynolds numbers of many fluid states stored as a
+  /// structure of arrays, for a given characteristic length. The derived fields are resized to the
+  /// size of the given fields. The reciprocal of the mass density, the speed, and the speed of
+  /// sound of each fluid state are computed once and shared by the derived quantities. This gives
+  /// the same results as the methods of each fluid state, but runs as a single branch-free loop
+  /// over contiguous arrays that is vectorized, and writes nothing but the derived fields.
+  static void DerivedQuantities(
+      const Fields& fields, DerivedFields& derived, const Length<NumericType>& length) {
+    const std::size_t size{fields.mass_densities.Size()};
+    derived.heat_capacity_ratios.Resize(size);
+    derived.sound_speeds.Resize(size);
+    derived.mach_numbers.Resize(size);
+    derived.dynamic_pressures.Resize(size);
+    derived.total_pressures.Resize(size);
+    derived.prandtl_numbers.Resize(size);
+    derived.reynolds_numbers.Resize(size);
+
+    const NumericType* const mass_densities{fields.mass_densities.Components()[0].data()};
+    const NumericType* const velocities_x{fields.velocities.Components()[0].data()};
+    const NumericType* const velocities_y{fields.velocities.Components()[1].data()};
+    const NumericType* const velocities_z{fields.velocities.Components()[2].data()};
+    const NumericType* const static_pressures{fields.static_pressures.Components()[0].data()};
+    const NumericType* const temperatures{fields.temperatures.Components()[0].data()};
+    const NumericType* const dynamic_viscosities{
+        fields.dynamic_viscosities.Components()[0].data()};
+    const NumericType* const specific_isobaric_heat_capacities{
+        fields.specific_isobaric_heat_capacities.Components()[0].data()};
+    const NumericType* const scalar_thermal_conductivities{
+        fields.scalar_thermal_conductivities.Components()[0].data()};
+
+    NumericType* const heat_capacity_ratios{
+        derived.heat_capacity_ratios.MutableComponents()[0].data()};
+    NumericType* const sound_speeds{derived.sound_speeds.MutableComponents()[0].data()};
+    NumericType* const mach_numbers{derived.mach_numbers.MutableComponents()[0].data()};
+    NumericType* const dynamic_pressures{derived.dynamic_pressures.MutableComponents()[0].data()};
+    NumericType* const total_pressures{derived.total_pressures.MutableComponents()[0].data()};
+    NumericType* const prandtl_numbers{derived.prandtl_numbers.MutableComponents()[0].data()};
+    NumericType* const reynolds_numbers{derived.reynolds_numbers.MutableComponents()[0].data()};
+
+    const NumericType length_value{length.Value()};
+    for (std::size_t index = 0; index < size; ++index) {
+      const NumericType mass_density{mass_densities[index]};
+      const NumericType static_pressure{static_pressures[index]};
+      const NumericType dynamic_viscosity{dynamic_viscosities[index]};
+      const NumericType specific_isobaric_heat_capacity{specific_isobaric_heat_capacities[index]};
+      const NumericType inverse_mass_density{static_cast<NumericType>(1) / mass_density};
+      const NumericType speed{std::sqrt(
+          velocities_x[index] * velocities_x[index] + velocities_y[index] * velocities_y[index]
+          + velocities_z[index] * velocities_z[index])};
+      const NumericType heat_capacity_ratio{HeatCapacityRatioOf(
+          specific_isobaric_heat_capacity, static_pressure, inverse_mass_density,
+          temperatures[index])};
+      const NumericType sound_speed{
+          SoundSpeedOf(heat_capacity_ratio, static_pressure, inverse_mass_density)};
+      const NumericType dynamic_pressure{DynamicPressureOf(mass_density, speed)};
+      heat_capacity_ratios[index] = heat_capacity_ratio;
+      sound_speeds[index] = sound_speed;
+      mach_numbers[index] = speed / sound_speed;
+      dynamic_pressures[index] = dynamic_pressure;
+      total_pressures[index] = static_pressure + dynamic_pressure;
+      prandtl_numbers[index] = specific_isobaric_heat_capacity * dynamic_viscosity
+                               / scalar_thermal_conductivities[index];
+      reynolds_numbers[index] = mass_density * speed * length_value / dynamic_viscosity;
+    }
+  }
+
+private:
+  /// \brief Bit of the memoization flags that is set once the reciprocal of the mass density is
+  /// memoized.
+  static constexpr std::uint8_t MemoizedInverseMassDensity{1U << 0U};
+
+  /// \brief Bit of the memoization flags that is set once the speed is memoized.
+  static constexpr std::uint8_t MemoizedSpeed{1U << 1U};
+
+  /// \brief Bit of the memoization flags that is set once the heat capacity ratio is memoized.
+  static constexpr std::uint8_t MemoizedHeatCapacityRatio{1U << 2U};
+
+  /// \brief Bit of the memoization flags that is set once the speed of sound is memoized.
+  static constexpr std::uint8_t MemoizedSoundSpeed{1U << 3U};
+
+  /// \brief Returns the reciprocal of the mass density, memoizing it on first use.
+  [[nodiscard]] NumericType InverseMassDensityValue() const {
+    if ((memoized & MemoizedInverseMassDensity) == 0) {
+      inverse_mass_density = static_cast<NumericType>(1) / mass_density.Value();
+      memoized |= MemoizedInverseMassDensity;
+    }
+    return inverse_mass_density;
+  }
+
+  /// \brief Returns the speed, memoizing it on first use.
+  [[nodiscard]] NumericType SpeedValue() const {
+    if ((memoized & MemoizedSpeed) == 0) {
+      speed = velocity.Value().Magnitude();
+      memoized |= MemoizedSpeed;
+    }
+    return speed;
+  }
+
+  /// \brief Returns the specific gas constant of an ideal gas, p / (rho * T).
+  [[nodiscard]] NumericType SpecificGasConstantValue() const {
+    return SpecificGasConstantOf(
+        static_pressure.Value(), InverseMassDensityValue(), temperature.Value());
+  }
+
+  /// \brief Returns the heat capacity ratio of an ideal gas, cp / (cp - R), memoizing it on first
+  /// use.
+  [[nodiscard]] NumericType HeatCapacityRatioValue() const {
+    if ((memoized & MemoizedHeatCapacityRatio) == 0) {
+      heat_capacity_ratio = HeatCapacityRatioOf(InverseMassDensityValue());
+      memoized |= MemoizedHeatCapacityRatio;
+    }
+    return heat_capacity_ratio;
+  }
+
+  /// \brief Returns the speed of sound, sqrt(gamma * p / rho), memoizing it on first use.
+  [[nodiscard]] NumericType SoundSpeedValue() const {
+    if ((memoized & MemoizedSoundSpeed) == 0) {
+      sound_speed = SoundSpeedOf(
+          HeatCapacityRatioValue(), static_pressure.Value(), InverseMassDensityValue());
+      memoized |= MemoizedSoundSpeed;
+    }
+    return sound_speed;
+  }
+
+  /// \brief Returns the dynamic pressure, 0.5 * rho * |u|^2.
+  [[nodiscard]] NumericType DynamicPressureValue() const {
+    return DynamicPressureOf(SpeedValue());
+  }
+
+  /// \brief Returns the heat capacity ratio of this fluid state for a given reciprocal of its mass
+  /// density, without memoizing anything.
+  [[nodiscard]] NumericType HeatCapacityRatioOf(const NumericType inverse_mass_density) const {
+    return HeatCapacityRatioOf(specific_isobaric_heat_capacity.Value(), static_pressure.Value(),
+                               inverse_mass_density, temperature.Value());
+  }
+
+  /// \brief Returns the speed of sound of this fluid state for a given reciprocal of its mass
+  /// density, without memoizing anything.
+  [[nodiscard]] NumericType SoundSpeedOf(const NumericType inverse_mass_density) const {
+    return SoundSpeedOf(HeatCapacityRatioOf(inverse_mass_density), static_pressure.Value(),
+                        inverse_mass_density);
+  }
+
+  /// \brief Returns the dynamic pressure of this fluid state for a given speed, without memoizing
+  /// anything.
+  [[nodiscard]] NumericType DynamicPressureOf(const NumericType speed_value) const {
+    return DynamicPressureOf(mass_density.Value(), speed_value);
+  }
+
+  /// \brief Returns the specific gas constant of an ideal gas, p / (rho * T), from a given static
+  /// pressure, reciprocal of the mass density, and temperature.
+  [[nodiscard]] static constexpr NumericType SpecificGasConstantOf(
+      const NumericType static_pressure_value, const NumericType inverse_mass_density,
+      const NumericType temperature_value) noexcept {
+    return static_pressure_value * inverse_mass_density / temperature_value;
+  }
+
+  /// \brief Returns the heat capacity ratio of an ideal gas, cp / (cp - R), from a given specific
+  /// isobaric heat capacity, static pressure, reciprocal of the mass density, and temperature.
+  [[nodiscard]] static constexpr NumericType HeatCapacityRatioOf(
+      const NumericType specific_isobaric_heat_capacity_value,
+      const NumericType static_pressure_value, const NumericType inverse_mass_density,
+      const NumericType temperature_value) noexcept {
+    return specific_isobaric_heat_capacity_value
+           / (specific_isobaric_heat_capacity_value
+              - SpecificGasConstantOf(
+                  static_pressure_value, inverse_mass_density, temperature_value));
+  }
+
+  /// \brief Returns the speed of sound, sqrt(gamma * p / rho), from a given heat capacity ratio,
+  /// static pressure, and reciprocal of the mass density.
+  [[nodiscard]] static NumericType SoundSpeedOf(
+      const NumericType heat_capacity_ratio_value, const NumericType static_pressure_value,
+      const NumericType inverse_mass_density) {
+    return std::sqrt(heat_capacity_ratio_value * static_pressure_value * inverse_mass_density);
+  }
+
+  /// \brief Returns the dynamic pressure, 0.5 * rho * |u|^2, from a given mass density and speed.
+  [[nodiscard]] static constexpr NumericType DynamicPressureOf(
+      const NumericType mass_density_value, const NumericType speed_value) noexcept {
+    return static_cast<NumericType>(0.5) * mass_density_value * speed_value * speed_value;
+  }
+
+  /// \brief Mass density of this fluid state.
+  PhQ::MassDensity<NumericType> mass_density;
+
+  /// \brief Velocity of this fluid state.
+  PhQ::Velocity<NumericType> velocity;
+
+  /// \brief Static pressure of this fluid state.
+  PhQ::StaticPressure<NumericType> static_pressure;
+
+  /// \brief Temperature of this fluid state.
+  PhQ::Temperature<NumericType> temperature;
+
+  /// \brief Dynamic viscosity of this fluid state.
+  PhQ::DynamicViscosity<NumericType> dynamic_viscosity;
+
+  /// \brief Specific isobaric heat capacity of this fluid state.
+  PhQ::SpecificIsobaricHeatCapacity<NumericType> specific_isobaric_heat_capacity;
+
+  /// \brief Scalar thermal conductivity of this fluid state.
+  PhQ::ScalarThermalConductivity<NumericType> scalar_thermal_conductivity;
+
+  /// \brief Memoized reciprocal of the mass density of this fluid state.
+  mutable NumericType inverse_mass_density{};
+
+  /// \brief Memoized speed of this fluid state.
+  mutable NumericType speed{};
+
+  /// \brief Memoized heat capacity ratio of this fluid state.
+  mutable NumericType heat_capacity_ratio{};
+
+  /// \brief Memoized speed of sound of this fluid state.
+  mutable NumericType sound_speed{};
+
+  /// \brief Memoization flags of this fluid state. Each bit is set once the corresponding value is
+  /// memoized.
+  mutable std::uint8_t memoized{0};
+};
+
+}  // namespace PhQ
+
+#endif  // PHQ_FLUID_STATE_HPP
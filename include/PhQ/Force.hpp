@@ -278,6 +278,13 @@ template <typename NumericType>
 inline constexpr PlanarForce<NumericType>::PlanarForce(const Force<NumericType>& force)
   : PlanarForce(PlanarVector<NumericType>{force.Value()}) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Force>{15};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
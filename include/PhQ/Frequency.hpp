@@ -297,6 +297,13 @@ inline constexpr NumericType Time<NumericType>::operator*(
   return this->value * frequency.Value();
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Frequency>{16};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
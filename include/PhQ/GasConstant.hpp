@@ -278,6 +278,13 @@ inline constexpr IsochoricHeatCapacity<NumericType> IsobaricHeatCapacity<Numeric
   return IsochoricHeatCapacity<NumericType>{*this, gas_constant};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<GasConstant>{17};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -240,6 +240,13 @@ inline constexpr HeatCapacityRatio<NumericType> operator*(
   return HeatCapacityRatio<NumericType>{number * heat_capacity_ratio.Value()};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<HeatCapacityRatio>{18};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -203,6 +203,13 @@ inline constexpr IsentropicBulkModulus<NumericType> operator*(
   return isentropic_bulk_modulus * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<IsentropicBulkModulus>{20};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
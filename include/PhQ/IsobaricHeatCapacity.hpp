@@ -260,6 +260,13 @@ inline constexpr IsobaricHeatCapacity<NumericType> IsochoricHeatCapacity<Numeric
   return IsobaricHeatCapacity<NumericType>{heat_capacity_ratio, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<IsobaricHeatCapacity>{21};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -222,6 +222,13 @@ inline constexpr IsochoricHeatCapacity<NumericType> operator*(
   return isochoric_heat_capacity * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<IsochoricHeatCapacity>{22};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -190,6 +190,13 @@ inline constexpr IsothermalBulkModulus<NumericType> operator*(
   return isothermal_bulk_modulus * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<IsothermalBulkModulus>{23};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -233,6 +233,13 @@ inline constexpr KinematicViscosity<NumericType> operator*(
   return kinematic_viscosity * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<KinematicViscosity>{24};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -190,6 +190,13 @@ inline constexpr LameFirstModulus<NumericType> operator*(
   return lame_first_modulus * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<LameFirstModulus>{25};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
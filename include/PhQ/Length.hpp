@@ -308,6 +308,13 @@ inline constexpr Length<NumericType> operator*(
   return length * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Length>{26};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
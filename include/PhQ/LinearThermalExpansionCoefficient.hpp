@@ -238,6 +238,13 @@ inline constexpr ScalarStrain<NumericType> TemperatureDifference<NumericType>::o
   return ScalarStrain<NumericType>{linear_thermal_expansion_coefficient, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<LinearThermalExpansionCoefficient>{27};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -196,6 +196,13 @@ inline constexpr MachNumber<NumericType> Speed<NumericType>::operator/(
   return MachNumber<NumericType>{*this, sound_speed};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<MachNumber>{28};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -294,6 +294,13 @@ inline constexpr Mass<NumericType> operator*(
   return mass * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Mass>{29};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -330,6 +330,13 @@ inline constexpr VolumeRate<NumericType> MassRate<NumericType>::operator/(
   return VolumeRate<NumericType>{*this, mass_density};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<MassDensity>{30};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -269,6 +269,13 @@ inline constexpr Time<NumericType> Mass<NumericType>::operator/(
   return Time<NumericType>{*this, mass_rate};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<MassRate>{31};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -205,6 +205,13 @@ inline constexpr Memory<NumericType> operator*(
   return memory * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Memory>{32};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -247,6 +247,13 @@ inline constexpr Time<NumericType> Memory<NumericType>::operator/(
   return Time<NumericType>{*this, memory_rate};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<MemoryRate>{33};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
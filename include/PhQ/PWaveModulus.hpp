@@ -184,6 +184,13 @@ inline constexpr PWaveModulus<NumericType> operator*(
   return p_wave_modulus * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PWaveModulus>{34};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
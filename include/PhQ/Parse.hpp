@@ -0,0 +1,298 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_PARSE_HPP
+#define PHQ_PARSE_HPP
+
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Base.hpp"
+#include "Dyad.hpp"
+#include "PlanarVector.hpp"
+#include "SymmetricDyad.hpp"
+#include "Vector.hpp"
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Single-pass tokenizer over a string that is being parsed. Never copies the string, never
+/// allocates memory, and never throws exceptions. Internal implementation detail not intended to be
+/// used outside of the PhQ::Parse function.
+class Tokenizer {
+public:
+  /// \brief Constructs a tokenizer positioned at the start of a given string.
+  explicit constexpr Tokenizer(const std::string_view string) noexcept
+    : current(string.data()), last(string.data() + string.size()) {}
+
+  /// \brief Skips whitespace and then consumes a given character if it is the next one. Returns
+  /// whether the character was consumed.
+  bool Consume(const char character) noexcept {
+    SkipWhitespace();
+    if (current < last && *current == character) {
+      ++current;
+      return true;
+    }
+    return false;
+  }
+
+  /// \brief Skips whitespace and then parses a floating-point number. Returns whether a number was
+  /// parsed.
+  template <typename NumericType>
+  bool ConsumeNumber(NumericType& number) noexcept {
+    SkipWhitespace();
+    const char* const end{ParseFloatingPointNumber(current, last, number)};
+    if (end == nullptr) {
+      return false;
+    }
+    current = end;
+    return true;
+  }
+
+  /// \brief Skips whitespace and then parses a double-quoted string without escape sequences.
+  /// Returns the contents of the string between the quotes, or std::nullopt if there is no such
+  /// string.
+  std::optional<std::string_view> ConsumeQuotedString() noexcept {
+    if (!Consume('"')) {
+      return std::nullopt;
+    }
+    const char* const first{current};
+    while (current < last && *current != '"') {
+      ++current;
+    }
+    if (current == last) {
+      return std::nullopt;
+    }
+    return std::string_view{first, static_cast<std::size_t>(current++ - first)};
+  }
+
+  /// \brief Consumes and returns the remainder of the string without its surrounding whitespace.
+  std::string_view ConsumeRemainder() noexcept {
+    SkipWhitespace();
+    const char* end{last};
+    while (end > current && std::isspace(static_cast<unsigned char>(*(end - 1))) != 0) {
+      --end;
+    }
+    const std::string_view remainder{current, static_cast<std::size_t>(end - current)};
+    current = last;
+    return remainder;
+  }
+
+  /// \brief Skips whitespace and then returns whether the end of the string is reached.
+  bool AtEnd() noexcept {
+    SkipWhitespace();
+    return current == last;
+  }
+
+private:
+  /// \brief Advances past any whitespace.
+  void SkipWhitespace() noexcept {
+    while (current < last && std::isspace(static_cast<unsigned char>(*current)) != 0) {
+      ++current;
+    }
+  }
+
+  /// \brief Pointer to the next character to be parsed.
+  const char* current;
+
+  /// \brief Pointer past the last character of the string.
+  const char* last;
+};
+
+/// \brief Numeric type and component names of a vector or tensor value in the JSON messages of the
+/// Physical Quantities library. Internal implementation detail not intended to be used outside of
+/// the PhQ::Parse function.
+template <typename Value>
+struct ParseableValue;
+
+template <typename NumericType>
+struct ParseableValue<PlanarVector<NumericType>> {
+  using Numeric = NumericType;
+  static constexpr std::array<std::string_view, 2> Names{"x", "y"};
+};
+
+template <typename NumericType>
+struct ParseableValue<Vector<NumericType>> {
+  using Numeric = NumericType;
+  static constexpr std::array<std::string_view, 3> Names{"x", "y", "z"};
+};
+
+template <typename NumericType>
+struct ParseableValue<SymmetricDyad<NumericType>> {
+  using Numeric = NumericType;
+  static constexpr std::array<std::string_view, 6> Names{"xx", "xy", "xz", "yy", "yz", "zz"};
+};
+
+template <typename NumericType>
+struct ParseableValue<Dyad<NumericType>> {
+  using Numeric = NumericType;
+  static constexpr std::array<std::string_view, 9> Names{
+    "xx", "xy", "xz", "yx", "yy", "yz", "zx", "zy", "zz"};
+};
+
+/// \brief Parses the components of a vector or tensor value in the format of the Print member
+/// methods, such as "(1, 2, 3)" or "(1, 2, 3; 4, 5; 6)". Components may be separated either by
+/// commas or by semicolons. Internal implementation detail not intended to be used outside of the
+/// PhQ::Parse function.
+template <typename NumericType, std::size_t Size>
+bool ParsePrintedComponents(Tokenizer& tokenizer, std::array<NumericType, Size>& components) {
+  if (!tokenizer.Consume('(')) {
+    return false;
+  }
+  for (std::size_t index = 0; index < Size; ++index) {
+    if (index > 0 && !tokenizer.Consume(',') && !tokenizer.Consume(';')) {
+      return false;
+    }
+    if (!tokenizer.ConsumeNumber(components[index])) {
+      return false;
+    }
+  }
+  return tokenizer.Consume(')');
+}
+
+/// \brief Parses the components of a vector or tensor value in the format of the JSON member
+/// methods, such as {"x":1,"y":2,"z":3}. Components may appear in any order but must each appear
+/// exactly once. Internal implementation detail not intended to be used outside of the PhQ::Parse
+/// function.
+template <typename NumericType, std::size_t Size>
+bool ParseJSONComponents(Tokenizer& tokenizer, const std::array<std::string_view, Size>& names,
+                         std::array<NumericType, Size>& components) {
+  if (!tokenizer.Consume('{')) {
+    return false;
+  }
+  std::array<bool, Size> parsed{};
+  for (std::size_t count = 0; count < Size; ++count) {
+    if (count > 0 && !tokenizer.Consume(',')) {
+      return false;
+    }
+    const std::optional<std::string_view> name{tokenizer.ConsumeQuotedString()};
+    if (!name.has_value() || !tokenizer.Consume(':')) {
+      return false;
+    }
+    std::size_t index{0};
+    while (index < Size && names[index] != *name) {
+      ++index;
+    }
+    if (index == Size || parsed[index] || !tokenizer.ConsumeNumber(components[index])) {
+      return false;
+    }
+    parsed[index] = true;
+  }
+  return tokenizer.Consume('}');
+}
+
+/// \brief Parses a scalar, vector, or tensor value in either the format of the Print member methods
+/// or the format of the JSON member methods. Internal implementation detail not intended to be used
+/// outside of the PhQ::Parse function.
+template <typename Value>
+bool ParseValue(Tokenizer& tokenizer, const bool json, Value& value) {
+  if constexpr (std::is_floating_point_v<Value>) {
+    return tokenizer.ConsumeNumber(value);
+  } else {
+    constexpr std::array names{ParseableValue<Value>::Names};
+    std::array<typename ParseableValue<Value>::Numeric, names.size()> components{};
+    const bool parsed{json ? ParseJSONComponents(tokenizer, names, components) :
+                             ParsePrintedComponents(tokenizer, components)};
+    if (parsed) {
+      value = Value{components};
+    }
+    return parsed;
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Parses a string as a dimensional physical quantity of a given type. Accepts the formats
+/// produced by the Print and JSON member methods of dimensional scalar, planar vector, vector,
+/// symmetric dyadic tensor, and dyadic tensor physical quantities, in any of their units of
+/// measure. For example, "12.5 kN" and {"value":12.5,"unit":"kN"} both parse as a
+/// PhQ::ScalarForce, and "(1, 2, 3) m/s" and {"value":{"x":1,"y":2,"z":3},"unit":"m/s"} both parse
+/// as a PhQ::Velocity. Tokenizes the string in a single pass without copying it, without
+/// allocating memory, and without throwing exceptions. Returns a std::optional container that
+/// contains the resulting physical quantity if successful, or std::nullopt if the string could not
+/// be parsed as a physical quantity of the given type.
+/// \tparam Quantity Dimensional physical quantity type, such as PhQ::ScalarForce<double> or
+/// PhQ::Velocity<float>.
+template <typename Quantity>
+[[nodiscard]] inline std::optional<Quantity> Parse(const std::string_view string) {
+  using UnitType = std::decay_t<decltype(Quantity::Unit())>;
+  using Value = std::decay_t<decltype(std::declval<const Quantity&>().Value())>;
+
+  Internal::Tokenizer tokenizer{string};
+  Value value{};
+  std::optional<UnitType> unit;
+  if (tokenizer.Consume('{')) {
+    // JSON format: {"value":...,"unit":"..."}, with the two members in either order.
+    bool has_value{false};
+    for (std::size_t count = 0; count < 2; ++count) {
+      if (count > 0 && !tokenizer.Consume(',')) {
+        return std::nullopt;
+      }
+      const std::optional<std::string_view> name{tokenizer.ConsumeQuotedString()};
+      if (!name.has_value() || !tokenizer.Consume(':')) {
+        return std::nullopt;
+      }
+      if (*name == "value" && !has_value) {
+        if (!Internal::ParseValue(tokenizer, true, value)) {
+          return std::nullopt;
+        }
+        has_value = true;
+      } else if (*name == "unit" && !unit.has_value()) {
+        const std::optional<std::string_view> spelling{tokenizer.ConsumeQuotedString()};
+        if (!spelling.has_value()) {
+          return std::nullopt;
+        }
+        unit = ParseEnumeration<UnitType>(*spelling);
+        if (!unit.has_value()) {
+          return std::nullopt;
+        }
+      } else {
+        return std::nullopt;
+      }
+    }
+    if (!tokenizer.Consume('}') || !tokenizer.AtEnd()) {
+      return std::nullopt;
+    }
+  } else {
+    // Print format: the value followed by the unit of measure, such as "12.5 kN".
+    if (!Internal::ParseValue(tokenizer, false, value)) {
+      return std::nullopt;
+    }
+    unit = ParseEnumeration<UnitType>(tokenizer.ConsumeRemainder());
+    if (!unit.has_value()) {
+      return std::nullopt;
+    }
+  }
+  return Quantity{value, *unit};
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_PARSE_HPP
@@ -330,6 +330,13 @@ inline constexpr PlanarAcceleration<NumericType> PlanarVelocity<NumericType>::op
   return PlanarAcceleration<NumericType>{*this, time};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarAcceleration>{35};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -246,6 +246,25 @@ public:
     Set(value.x_y());
   }
 
+  /// \brief Normalizes the given number of planar vectors stored contiguously to unit planar
+  /// vectors, and stores them in the given array of planar directions. Each planar vector is
+  /// multiplied by the reciprocal of its magnitude rather than divided by its magnitude, and the
+  /// loop has no branches so that the compiler can vectorize it. Zero planar vectors are normalized
+  /// to the zero planar vector, as in Set().
+  static void Normalize(
+      const PlanarVector<NumericType>* const planar_vectors, const std::size_t size,
+      PlanarDirection<NumericType>* const planar_directions) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const PlanarVector<NumericType>& planar_vector{planar_vectors[index]};
+      const NumericType magnitude_squared{planar_vector.MagnitudeSquared()};
+      const NumericType inverse_magnitude{
+          magnitude_squared > static_cast<NumericType>(0)
+              ? static_cast<NumericType>(1) / std::sqrt(magnitude_squared)
+              : static_cast<NumericType>(0)};
+      planar_directions[index].value = planar_vector * inverse_magnitude;
+    }
+  }
+
   /// \brief Returns the square of the magnitude of this planar direction. This is guaranteed to be
   /// exactly 1 if the planar direction is not the zero planar vector, or 0 if the planar direction
   /// is the zero planar vector.
@@ -434,6 +453,13 @@ inline Angle<NumericType>::Angle(const PlanarDirection<NumericType>& planar_dire
                                  const PlanarDirection<NumericType>& planar_direction_2)
   : Angle(std::acos(planar_direction_1.Dot(planar_direction_2))) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarDirection>{36};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
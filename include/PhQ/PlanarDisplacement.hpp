@@ -312,6 +312,13 @@ inline Angle<NumericType>::Angle(const PlanarDisplacement<NumericType>& planar_d
                                  const PlanarDisplacement<NumericType>& planar_displacement_2)
   : Angle<NumericType>(planar_displacement_1.Value(), planar_displacement_2.Value()) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarDisplacement>{37};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
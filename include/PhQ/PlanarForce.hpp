@@ -273,6 +273,13 @@ inline constexpr PlanarForce<NumericType> ScalarForce<NumericType>::operator*(
   return PlanarForce<NumericType>{*this, planar_direction};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarForce>{38};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
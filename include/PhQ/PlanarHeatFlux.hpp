@@ -36,6 +36,7 @@
 #include "PlanarVector.hpp"
 #include "ScalarHeatFlux.hpp"
 #include "ScalarThermalConductivity.hpp"
+#include "SymmetricDyad.hpp"
 #include "ThermalConductivity.hpp"
 #include "Unit/EnergyFlux.hpp"
 
@@ -154,6 +155,88 @@ public:
       ConvertStatically<Unit::EnergyFlux, Unit, Standard<Unit::EnergyFlux>>(value)};
   }
 
+  /// \brief Computes the planar heat flux vectors resulting from a given number of planar
+  /// temperature gradient vectors using Fourier's law of heat conduction, where every point shares
+  /// the same scalar thermal conductivity. The scalar thermal conductivity is broadcast over the
+  /// contiguous arrays so that the loop vectorizes.
+  static void Conduction(
+      const ScalarThermalConductivity<NumericType>& scalar_thermal_conductivity,
+      const PlanarTemperatureGradient<NumericType>* const planar_temperature_gradients,
+      const std::size_t size, PlanarHeatFlux<NumericType>* const planar_heat_fluxes) {
+    const NumericType conductivity{-scalar_thermal_conductivity.Value()};
+    for (std::size_t index = 0; index < size; ++index) {
+      planar_heat_fluxes[index].value = conductivity * planar_temperature_gradients[index].Value();
+    }
+  }
+
+  /// \brief Computes the planar heat flux vectors resulting from a given number of planar
+  /// temperature gradient vectors using Fourier's law of heat conduction, where every point shares
+  /// the same thermal conductivity tensor. The planar components of the thermal conductivity tensor
+  /// are broadcast over the contiguous arrays so that the loop vectorizes.
+  static void Conduction(
+      const ThermalConductivity<NumericType>& thermal_conductivity,
+      const PlanarTemperatureGradient<NumericType>* const planar_temperature_gradients,
+      const std::size_t size, PlanarHeatFlux<NumericType>* const planar_heat_fluxes) {
+    const NumericType xx{-thermal_conductivity.Value().xx()};
+    const NumericType xy{-thermal_conductivity.Value().xy()};
+    const NumericType yy{-thermal_conductivity.Value().yy()};
+    for (std::size_t index = 0; index < size; ++index) {
+      const PlanarVector<NumericType>& gradient{planar_temperature_gradients[index].Value()};
+      planar_heat_fluxes[index].value = PlanarVector<NumericType>{
+        xx * gradient.x() + xy * gradient.y(), xy * gradient.x() + yy * gradient.y()};
+    }
+  }
+
+  /// \brief Computes the planar heat flux vectors resulting from a given number of planar
+  /// temperature gradient vectors using Fourier's law of heat conduction, where the scalar thermal
+  /// conductivity at each point is looked up by its material index in a table of scalar thermal
+  /// conductivities. The material indices are scanned for contiguous runs of points with the same
+  /// material, and each run is computed with its scalar thermal conductivity broadcast over the
+  /// run, so that the table is read once per run rather than gathered once per point. Every
+  /// material index must be a valid index into the table.
+  static void Conduction(
+      const ScalarThermalConductivity<NumericType>* const scalar_thermal_conductivities,
+      const std::size_t* const material_indices,
+      const PlanarTemperatureGradient<NumericType>* const planar_temperature_gradients,
+      const std::size_t size, PlanarHeatFlux<NumericType>* const planar_heat_fluxes) {
+    std::size_t begin{0};
+    while (begin < size) {
+      const std::size_t material_index{material_indices[begin]};
+      std::size_t end{begin + 1};
+      while (end < size && material_indices[end] == material_index) {
+        ++end;
+      }
+      Conduction(scalar_thermal_conductivities[material_index],
+                 planar_temperature_gradients + begin, end - begin, planar_heat_fluxes + begin);
+      begin = end;
+    }
+  }
+
+  /// \brief Computes the planar heat flux vectors resulting from a given number of planar
+  /// temperature gradient vectors using Fourier's law of heat conduction, where the thermal
+  /// conductivity tensor at each point is looked up by its material index in a table of thermal
+  /// conductivity tensors. The material indices are scanned for contiguous runs of points with the
+  /// same material, and each run is computed with its thermal conductivity tensor broadcast over
+  /// the run, so that the table is read once per run rather than gathered once per point. Every
+  /// material index must be a valid index into the table.
+  static void Conduction(
+      const ThermalConductivity<NumericType>* const thermal_conductivities,
+      const std::size_t* const material_indices,
+      const PlanarTemperatureGradient<NumericType>* const planar_temperature_gradients,
+      const std::size_t size, PlanarHeatFlux<NumericType>* const planar_heat_fluxes) {
+    std::size_t begin{0};
+    while (begin < size) {
+      const std::size_t material_index{material_indices[begin]};
+      std::size_t end{begin + 1};
+      while (end < size && material_indices[end] == material_index) {
+        ++end;
+      }
+      Conduction(thermal_conductivities[material_index], planar_temperature_gradients + begin,
+                 end - begin, planar_heat_fluxes + begin);
+      begin = end;
+    }
+  }
+
   /// \brief Returns the x Cartesian component of this planar heat flux vector.
   [[nodiscard]] constexpr ScalarHeatFlux<NumericType> x() const noexcept {
     return ScalarHeatFlux<NumericType>{this->value.x()};
@@ -292,6 +375,13 @@ inline constexpr PlanarHeatFlux<NumericType> ScalarHeatFlux<NumericType>::operat
   return PlanarHeatFlux<NumericType>{*this, planar_direction};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarHeatFlux>{39};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -314,6 +314,13 @@ inline constexpr PlanarPosition<NumericType> Length<NumericType>::operator*(
   return PlanarPosition<NumericType>{*this, planar_direction};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarPosition>{40};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -294,6 +294,13 @@ operator*(const PlanarDirection<NumericType>& planar_direction) const {
   return PlanarTemperatureGradient<NumericType>{*this, planar_direction};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarTemperatureGradient>{41};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -302,6 +302,13 @@ inline constexpr PlanarTraction<NumericType> PlanarForce<NumericType>::operator/
   return PlanarTraction<NumericType>{*this, area};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarTraction>{42};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -240,22 +240,69 @@ public:
 
   /// \brief Prints this two-dimensional planar vector as a string.
   [[nodiscard]] std::string Print() const {
-    return "(" + PhQ::Print(x_y_[0]) + ", " + PhQ::Print(x_y_[1]) + ")";
+    std::string buffer;
+    AppendPrint(buffer);
+    return buffer;
+  }
+
+  /// \brief Prints this two-dimensional planar vector and appends it to the given string.
+  void AppendPrint(std::string& buffer) const {
+    buffer.push_back('(');
+    PhQ::AppendPrint(buffer, x_y_[0]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, x_y_[1]);
+    buffer.push_back(')');
   }
 
   /// \brief Serializes this two-dimensional planar vector as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return "{\"x\":" + PhQ::Print(x_y_[0]) + ",\"y\":" + PhQ::Print(x_y_[1]) + "}";
+    std::string buffer;
+    AppendJSON(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as a JSON message and appends it to the
+  /// given string.
+  void AppendJSON(std::string& buffer) const {
+    buffer.append("{\"x\":");
+    PhQ::AppendPrint(buffer, x_y_[0]);
+    buffer.append(",\"y\":");
+    PhQ::AppendPrint(buffer, x_y_[1]);
+    buffer.push_back('}');
   }
 
   /// \brief Serializes this two-dimensional planar vector as an XML message.
   [[nodiscard]] std::string XML() const {
-    return "<x>" + PhQ::Print(x_y_[0]) + "</x><y>" + PhQ::Print(x_y_[1]) + "</y>";
+    std::string buffer;
+    AppendXML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as an XML message and appends it to the
+  /// given string.
+  void AppendXML(std::string& buffer) const {
+    buffer.append("<x>");
+    PhQ::AppendPrint(buffer, x_y_[0]);
+    buffer.append("</x><y>");
+    PhQ::AppendPrint(buffer, x_y_[1]);
+    buffer.append("</y>");
   }
 
   /// \brief Serializes this two-dimensional planar vector as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return "{x:" + PhQ::Print(x_y_[0]) + ",y:" + PhQ::Print(x_y_[1]) + "}";
+    std::string buffer;
+    AppendYAML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as a YAML message and appends it to the
+  /// given string.
+  void AppendYAML(std::string& buffer) const {
+    buffer.append("{x:");
+    PhQ::AppendPrint(buffer, x_y_[0]);
+    buffer.append(",y:");
+    PhQ::AppendPrint(buffer, x_y_[1]);
+    buffer.push_back('}');
   }
 
   /// \brief Adds another two-dimensional planar vector to this one.
@@ -347,20 +394,23 @@ inline constexpr PlanarVector<NumericType> operator-(
   return PlanarVector<NumericType>{left.x() - right.x(), left.y() - right.y()};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr PlanarVector<NumericType> operator*(
     const PlanarVector<NumericType>& planar_vector, const OtherNumericType number) {
   return PlanarVector<NumericType>{planar_vector.x() * static_cast<NumericType>(number),
                                    planar_vector.y() * static_cast<NumericType>(number)};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr PlanarVector<NumericType> operator*(
     const OtherNumericType number, const PlanarVector<NumericType>& planar_vector) {
   return PlanarVector<NumericType>{planar_vector * number};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr PlanarVector<NumericType> operator/(
     const PlanarVector<NumericType>& planar_vector, const OtherNumericType number) {
   return PlanarVector<NumericType>{planar_vector.x() / static_cast<NumericType>(number),
@@ -344,6 +344,13 @@ inline constexpr PlanarVelocity<NumericType> PlanarDisplacement<NumericType>::op
   return PlanarVelocity<NumericType>{*this, time};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PlanarVelocity>{43};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -168,6 +168,13 @@ inline constexpr PoissonRatio<NumericType> operator*(
   return PoissonRatio<NumericType>{number * poisson_ratio.Value()};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PoissonRatio>{44};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
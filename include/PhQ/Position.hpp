@@ -310,6 +310,13 @@ template <typename NumericType>
 inline constexpr PlanarPosition<NumericType>::PlanarPosition(const Position<NumericType>& position)
   : PlanarPosition(PlanarVector<NumericType>{position.Value()}) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Position>{45};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -272,6 +272,13 @@ inline constexpr Time<NumericType> Energy<NumericType>::operator/(
   return Time<NumericType>{*this, power};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Power>{46};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -257,6 +257,13 @@ inline constexpr KinematicViscosity<NumericType>::KinematicViscosity(
     const ThermalDiffusivity<NumericType>& thermal_diffusivity)
   : KinematicViscosity<NumericType>(prandtl_number.Value() * thermal_diffusivity.Value()) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<PrandtlNumber>{47};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
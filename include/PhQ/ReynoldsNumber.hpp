@@ -280,6 +280,13 @@ inline constexpr DynamicViscosity<NumericType>::DynamicViscosity(
   : DynamicViscosity<NumericType>(
         mass_density.Value() * speed.Value() * length.Value() / reynolds_number.Value()) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ReynoldsNumber>{48};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
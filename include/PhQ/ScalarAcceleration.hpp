@@ -290,6 +290,13 @@ inline constexpr Time<NumericType> Speed<NumericType>::operator/(
   return Time<NumericType>{*this, scalar_acceleration};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarAcceleration>{49};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -280,6 +280,13 @@ inline constexpr Time<NumericType> AngularSpeed<NumericType>::operator/(
   return Time<NumericType>{*this, scalar_angular_acceleration};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarAngularAcceleration>{50};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -213,6 +213,13 @@ inline constexpr ScalarDisplacementGradient<NumericType> operator*(
   return ScalarDisplacementGradient<NumericType>{number * scalar_displacement_gradient.Value()};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarDisplacementGradient>{51};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
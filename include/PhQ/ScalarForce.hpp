@@ -228,6 +228,13 @@ inline constexpr ScalarForce<NumericType> operator*(
   return scalar_force * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarForce>{52};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
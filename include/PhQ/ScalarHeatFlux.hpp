@@ -215,6 +215,13 @@ inline constexpr ScalarHeatFlux<NumericType> operator*(
   return scalar_heat_flux * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarHeatFlux>{53};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
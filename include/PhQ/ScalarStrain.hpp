@@ -208,6 +208,13 @@ inline constexpr ScalarStrain<NumericType> operator*(
   return ScalarStrain<NumericType>{number * scalar_strain.Value()};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarStrain>{54};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
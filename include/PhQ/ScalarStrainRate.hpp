@@ -246,6 +246,13 @@ inline constexpr ScalarStrainRate<NumericType> Frequency<NumericType>::operator*
   return ScalarStrainRate<NumericType>{scalar_strain, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarStrainRate>{55};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -189,6 +189,13 @@ inline constexpr ScalarStress<NumericType> operator*(
   return scalar_stress * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarStress>{56};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
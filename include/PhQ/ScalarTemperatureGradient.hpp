@@ -253,6 +253,13 @@ operator/(const Length<NumericType>& length) const {
   return ScalarTemperatureGradient<NumericType>{*this, length};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarTemperatureGradient>{57};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -239,6 +239,13 @@ inline constexpr ScalarThermalConductivity<NumericType> operator*(
   return thermal_conductivity_scalar * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarThermalConductivity>{58};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -239,6 +239,13 @@ inline constexpr ScalarForce<NumericType> Area<NumericType>::operator*(
   return ScalarForce<NumericType>{scalar_traction, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarTraction>{59};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -253,6 +253,13 @@ inline constexpr ScalarVelocityGradient<NumericType> Frequency<NumericType>::ope
   return ScalarVelocityGradient<NumericType>{scalar_displacement_gradient, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ScalarVelocityGradient>{60};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
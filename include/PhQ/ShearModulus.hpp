@@ -186,6 +186,13 @@ inline constexpr ShearModulus<NumericType> operator*(
   return shear_modulus * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ShearModulus>{61};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
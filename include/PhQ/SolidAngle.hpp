@@ -180,6 +180,13 @@ inline constexpr SolidAngle<NumericType> operator*(
   return solid_angle * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SolidAngle>{62};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -271,6 +271,13 @@ constexpr IsentropicBulkModulus<NumericType>::IsentropicBulkModulus(
     const MassDensity<NumericType>& mass_density, const SoundSpeed<NumericType>& sound_speed)
   : IsentropicBulkModulus<NumericType>(mass_density.Value() * std::pow(sound_speed.Value(), 2)) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SoundSpeed>{63};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
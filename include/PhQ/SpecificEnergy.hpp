@@ -245,6 +245,13 @@ inline constexpr SpecificEnergy<NumericType> Energy<NumericType>::operator/(
   return SpecificEnergy<NumericType>{*this, mass};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SpecificEnergy>{64};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -328,6 +328,13 @@ inline constexpr Mass<NumericType> GasConstant<NumericType>::operator/(
   return Mass<NumericType>{*this, specific_gas_constant};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SpecificGasConstant>{65};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
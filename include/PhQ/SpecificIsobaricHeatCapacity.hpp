@@ -348,6 +348,13 @@ inline constexpr Mass<NumericType> IsobaricHeatCapacity<NumericType>::operator/(
   return Mass<NumericType>{*this, specific_isobaric_heat_capacity};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SpecificIsobaricHeatCapacity>{66};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -273,6 +273,13 @@ inline constexpr Mass<NumericType> IsochoricHeatCapacity<NumericType>::operator/
   return Mass<NumericType>{*this, specific_isochoric_heat_capacity};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SpecificIsochoricHeatCapacity>{67};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
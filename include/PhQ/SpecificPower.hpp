@@ -300,6 +300,13 @@ inline constexpr Time<NumericType> SpecificEnergy<NumericType>::operator/(
   return Time<NumericType>{*this, specific_power};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SpecificPower>{68};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
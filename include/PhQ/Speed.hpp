@@ -372,6 +372,13 @@ inline constexpr Speed<NumericType> Frequency<NumericType>::operator*(
   return Speed<NumericType>{length, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Speed>{69};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
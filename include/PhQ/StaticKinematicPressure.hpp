@@ -233,6 +233,13 @@ inline constexpr StaticKinematicPressure<NumericType> StaticPressure<NumericType
   return StaticKinematicPressure<NumericType>{*this, mass_density};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<StaticKinematicPressure>{70};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -261,6 +261,13 @@ inline constexpr StaticPressure<NumericType> ScalarForce<NumericType>::operator/
   return StaticPressure<NumericType>{*this, area};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<StaticPressure>{71};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -26,13 +26,16 @@
 #define PHQ_STRAIN_HPP
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <ostream>
 
 #include "DimensionlessSymmetricDyad.hpp"
+#include "Direction.hpp"
 #include "ScalarStrain.hpp"
 #include "SymmetricDyad.hpp"
+#include "Vector.hpp"
 
 namespace PhQ {
 
@@ -182,6 +185,52 @@ public:
     return ScalarStrain<NumericType>{this->value.zz()};
   }
 
+  /// \brief Returns the deviatoric part of this strain tensor, which is this strain tensor minus
+  /// its hydrostatic part.
+  [[nodiscard]] constexpr Strain<NumericType> Deviatoric() const {
+    return Strain<NumericType>{this->value.Deviatoric()};
+  }
+
+  /// \brief Returns the hydrostatic strain of this strain tensor, which is the mean of its normal
+  /// strains, or one third of its trace.
+  [[nodiscard]] constexpr ScalarStrain<NumericType> Hydrostatic() const {
+    return ScalarStrain<NumericType>{this->value.Trace() / static_cast<NumericType>(3)};
+  }
+
+  /// \brief Returns the second invariant of the deviatoric part of this strain tensor.
+  [[nodiscard]] constexpr NumericType J2() const noexcept {
+    return this->value.J2();
+  }
+
+  /// \brief Returns the third invariant of the deviatoric part of this strain tensor.
+  [[nodiscard]] constexpr NumericType J3() const noexcept {
+    return this->value.J3();
+  }
+
+  /// \brief Computes the von Mises equivalent strain of this strain tensor. This is
+  /// sqrt(2 / 3 * e : e), or equivalently sqrt(4 / 3 * J2), where e is the deviatoric part.
+  [[nodiscard]] constexpr ScalarStrain<NumericType> VonMises() const {
+    return ScalarStrain<NumericType>{
+        std::sqrt(static_cast<NumericType>(4) / static_cast<NumericType>(3) * this->value.J2())};
+  }
+
+  /// \brief Returns the principal strains of this strain tensor, sorted in decreasing order. These
+  /// are the eigenvalues of this strain tensor.
+  [[nodiscard]] std::array<ScalarStrain<NumericType>, 3> PrincipalStrains() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return {ScalarStrain<NumericType>{eigenvalues[0]}, ScalarStrain<NumericType>{eigenvalues[1]},
+            ScalarStrain<NumericType>{eigenvalues[2]}};
+  }
+
+  /// \brief Returns the principal directions of this strain tensor, sorted in the same order as the
+  /// principal strains returned by PrincipalStrains(). These are the eigenvectors of this strain
+  /// tensor and form a right-handed orthonormal basis.
+  [[nodiscard]] std::array<Direction<NumericType>, 3> PrincipalDirections() const {
+    const std::array<Vector<NumericType>, 3> eigenvectors{this->value.Eigenvectors()};
+    return {Direction<NumericType>{eigenvectors[0]}, Direction<NumericType>{eigenvectors[1]},
+            Direction<NumericType>{eigenvectors[2]}};
+  }
+
   constexpr Strain<NumericType> operator+(const Strain<NumericType>& strain) const {
     return Strain<NumericType>{this->value + strain.value};
   }
@@ -267,6 +316,13 @@ inline constexpr Strain<NumericType> operator*(
   return strain * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Strain>{72};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -316,6 +316,13 @@ inline constexpr StrainRate<NumericType> Frequency<NumericType>::operator*(
   return StrainRate<NumericType>{strain, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<StrainRate>{73};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
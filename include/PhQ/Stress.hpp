@@ -31,6 +31,7 @@
 #include <functional>
 #include <ostream>
 
+#include "DimensionalAnalysis.hpp"
 #include "DimensionalSymmetricDyad.hpp"
 #include "Direction.hpp"
 #include "PlanarDirection.hpp"
@@ -40,9 +41,26 @@
 #include "SymmetricDyad.hpp"
 #include "Traction.hpp"
 #include "Unit/Pressure.hpp"
+#include "Vector.hpp"
 
 namespace PhQ {
 
+namespace Internal {
+
+/// \brief Physical dimension set of the second invariant of the deviatoric part of a stress tensor,
+/// which is the square of that of stress. No named scalar physical quantity has it. Internal
+/// implementation detail not intended to be used outside of the PhQ::Stress class.
+using StressJ2Dimensions = PhQ::StaticDimensionsProduct<StaticDimensionsOf<ScalarStress<>>,
+                                                        StaticDimensionsOf<ScalarStress<>>>;
+
+/// \brief Physical dimension set of the third invariant of the deviatoric part of a stress tensor,
+/// which is the cube of that of stress. No named scalar physical quantity has it. Internal
+/// implementation detail not intended to be used outside of the PhQ::Stress class.
+using StressJ3Dimensions =
+    PhQ::StaticDimensionsProduct<StressJ2Dimensions, StaticDimensionsOf<ScalarStress<>>>;
+
+}  // namespace Internal
+
 /// \brief Three-dimensional Euclidean Cauchy stress symmetric dyadic tensor. Contains six
 /// components in Cartesian coordinates: xx, xy = yx, xz = zx, yy, yz = zy, and zz. For the scalar
 /// components or resultants of a Cauchy stress tensor, see PhQ::ScalarStress.
@@ -193,17 +211,60 @@ public:
     return PhQ::Traction<NumericType>{*this, direction};
   }
 
+  /// \brief Returns the deviatoric part of this stress tensor, which is this stress tensor minus
+  /// its hydrostatic part.
+  [[nodiscard]] constexpr Stress<NumericType> Deviatoric() const {
+    return Stress<NumericType>{this->value.Deviatoric()};
+  }
+
+  /// \brief Returns the hydrostatic stress of this stress tensor, which is the mean of its normal
+  /// stresses, or one third of its trace. Since pressure is compressive, this is the negative of
+  /// the pressure.
+  [[nodiscard]] constexpr ScalarStress<NumericType> Hydrostatic() const {
+    return ScalarStress<NumericType>{this->value.Trace() / static_cast<NumericType>(3)};
+  }
+
+  /// \brief Returns the second invariant of the deviatoric part of this stress tensor. Its physical
+  /// dimension set is the square of that of stress.
+  [[nodiscard]] constexpr NamedQuantity<Internal::StressJ2Dimensions, NumericType> J2() const {
+    return NamedQuantity<Internal::StressJ2Dimensions, NumericType>{this->value.J2()};
+  }
+
+  /// \brief Returns the third invariant of the deviatoric part of this stress tensor. Its physical
+  /// dimension set is the cube of that of stress.
+  [[nodiscard]] constexpr NamedQuantity<Internal::StressJ3Dimensions, NumericType> J3() const {
+    return NamedQuantity<Internal::StressJ3Dimensions, NumericType>{this->value.J3()};
+  }
+
   /// \brief Computes the von Mises stress of this stress tensor using the von Mises yield
-  /// criterion.
+  /// criterion. This is sqrt(3 * J2).
   [[nodiscard]] constexpr ScalarStress<NumericType> VonMises() const {
-    return ScalarStress<NumericType>{std::sqrt(
-        0.5
-        * (std::pow(this->value.xx() - this->value.yy(), 2)
-           + std::pow(this->value.yy() - this->value.zz(), 2)
-           + std::pow(this->value.zz() - this->value.xx(), 2)
-           + 6.0
-                 * (std::pow(this->value.xy(), 2) + std::pow(this->value.xz(), 2)
-                    + std::pow(this->value.yz(), 2))))};
+    return ScalarStress<NumericType>{std::sqrt(static_cast<NumericType>(3) * this->value.J2())};
+  }
+
+  /// \brief Computes the Tresca stress of this stress tensor using the Tresca yield criterion. This
+  /// is the difference between the largest and smallest principal stresses, or twice the maximum
+  /// shear stress.
+  [[nodiscard]] ScalarStress<NumericType> Tresca() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return ScalarStress<NumericType>{eigenvalues[0] - eigenvalues[2]};
+  }
+
+  /// \brief Returns the principal stresses of this stress tensor, sorted in decreasing order. These
+  /// are the eigenvalues of this stress tensor.
+  [[nodiscard]] std::array<ScalarStress<NumericType>, 3> PrincipalStresses() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return {ScalarStress<NumericType>{eigenvalues[0]}, ScalarStress<NumericType>{eigenvalues[1]},
+            ScalarStress<NumericType>{eigenvalues[2]}};
+  }
+
+  /// \brief Returns the principal directions of this stress tensor, sorted in the same order as the
+  /// principal stresses returned by PrincipalStresses(). These are the eigenvectors of this stress
+  /// tensor and form a right-handed orthonormal basis.
+  [[nodiscard]] std::array<Direction<NumericType>, 3> PrincipalDirections() const {
+    const std::array<Vector<NumericType>, 3> eigenvectors{this->value.Eigenvectors()};
+    return {Direction<NumericType>{eigenvectors[0]}, Direction<NumericType>{eigenvectors[1]},
+            Direction<NumericType>{eigenvectors[2]}};
   }
 
   constexpr Stress<NumericType> operator+(const Stress<NumericType>& stress) const {
@@ -308,6 +369,13 @@ inline constexpr PhQ::Stress<NumericType> StaticPressure<NumericType>::Stress()
   return PhQ::Stress<NumericType>{*this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Stress>{74};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -184,6 +184,13 @@ inline constexpr SubstanceAmount<NumericType> operator*(
   return substance_amount * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<SubstanceAmount>{75};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -25,9 +25,13 @@
 #ifndef PHQ_SYMMETRIC_DYAD_HPP
 #define PHQ_SYMMETRIC_DYAD_HPP
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <functional>
+#include <initializer_list>
+#include <limits>
 #include <optional>
 #include <ostream>
 #include <string>
@@ -39,6 +43,63 @@
 
 namespace PhQ {
 
+namespace Internal {
+
+/// \brief Default relative tolerance below which a three-dimensional dyadic tensor is considered
+/// singular when it is inverted or used to solve a linear system. Internal implementation detail
+/// not intended to be used outside of the Physical Quantities library's own functions and classes.
+template <typename NumericType>
+inline constexpr NumericType SingularityTolerance{
+    static_cast<NumericType>(1024) * std::numeric_limits<NumericType>::epsilon()};
+
+/// \brief Returns whether a three-dimensional dyadic tensor with the given components is far enough
+/// from singular to be inverted. By Hadamard's inequality, the magnitude of the determinant never
+/// exceeds the product of the magnitudes of the rows, and their ratio is a scale-invariant measure
+/// of conditioning that is one for orthogonal rows and zero for linearly dependent rows. The tensor
+/// is considered singular if this ratio does not exceed the given tolerance. The components are
+/// first scaled by the largest of their magnitudes so that the squared determinant and the product
+/// of the squared magnitudes of the rows neither overflow nor underflow. Internal implementation
+/// detail not intended to be used outside of the Physical Quantities library's own functions and
+/// classes.
+template <typename NumericType>
+inline constexpr bool IsWellConditioned(
+    const NumericType xx, const NumericType xy, const NumericType xz, const NumericType yx,
+    const NumericType yy, const NumericType yz, const NumericType zx, const NumericType zy,
+    const NumericType zz, const NumericType tolerance) noexcept {
+  NumericType largest_component{static_cast<NumericType>(0)};
+  for (const NumericType component : {xx, xy, xz, yx, yy, yz, zx, zy, zz}) {
+    const NumericType magnitude{component < static_cast<NumericType>(0) ? -component : component};
+    largest_component = magnitude > largest_component ? magnitude : largest_component;
+  }
+  if (!(largest_component > static_cast<NumericType>(0))) {
+    return false;
+  }
+  const NumericType scale{static_cast<NumericType>(1) / largest_component};
+  const NumericType scaled_xx{xx * scale};
+  const NumericType scaled_xy{xy * scale};
+  const NumericType scaled_xz{xz * scale};
+  const NumericType scaled_yx{yx * scale};
+  const NumericType scaled_yy{yy * scale};
+  const NumericType scaled_yz{yz * scale};
+  const NumericType scaled_zx{zx * scale};
+  const NumericType scaled_zy{zy * scale};
+  const NumericType scaled_zz{zz * scale};
+  const NumericType determinant{
+      scaled_xx * (scaled_yy * scaled_zz - scaled_yz * scaled_zy)
+      + scaled_xy * (scaled_yz * scaled_zx - scaled_yx * scaled_zz)
+      + scaled_xz * (scaled_yx * scaled_zy - scaled_yy * scaled_zx)};
+  const NumericType row_x_squared{
+      scaled_xx * scaled_xx + scaled_xy * scaled_xy + scaled_xz * scaled_xz};
+  const NumericType row_y_squared{
+      scaled_yx * scaled_yx + scaled_yy * scaled_yy + scaled_yz * scaled_yz};
+  const NumericType row_z_squared{
+      scaled_zx * scaled_zx + scaled_zy * scaled_zy + scaled_zz * scaled_zz};
+  return determinant * determinant
+         > tolerance * tolerance * row_x_squared * row_y_squared * row_z_squared;
+}
+
+}  // namespace Internal
+
 /// \brief Symmetric three-dimensional Euclidean dyadic tensor. Contains six components in Cartesian
 /// coordinates: xx, xy = yx, xz = zx, yy, yz = zy, and zz. For the general case of a
 /// three-dimensional Euclidean dyadic tensor which may be symmetric or asymmetric, see PhQ::Dyad.
@@ -349,41 +410,194 @@ public:
     return Cofactors();
   }
 
+  /// \brief Returns the deviatoric part of this three-dimensional symmetric dyadic tensor, which is
+  /// this tensor minus one third of its trace times the identity tensor.
+  [[nodiscard]] constexpr SymmetricDyad<NumericType> Deviatoric() const {
+    const NumericType mean{Trace() / static_cast<NumericType>(3)};
+    return SymmetricDyad<NumericType>{xx() - mean, xy(), xz(), yy() - mean, yz(), zz() - mean};
+  }
+
+  /// \brief Returns the second invariant of the deviatoric part of this three-dimensional symmetric
+  /// dyadic tensor, J2 = (s : s) / 2, where s is the deviatoric part. It is computed directly from
+  /// the differences of the diagonal components without forming the deviatoric part.
+  [[nodiscard]] constexpr NumericType J2() const noexcept {
+    const NumericType xx_minus_yy{xx() - yy()};
+    const NumericType yy_minus_zz{yy() - zz()};
+    const NumericType zz_minus_xx{zz() - xx()};
+    return (xx_minus_yy * xx_minus_yy + yy_minus_zz * yy_minus_zz + zz_minus_xx * zz_minus_xx)
+               / static_cast<NumericType>(6)
+           + xy() * xy() + xz() * xz() + yz() * yz();
+  }
+
+  /// \brief Returns the third invariant of the deviatoric part of this three-dimensional symmetric
+  /// dyadic tensor, J3 = det(s), where s is the deviatoric part.
+  [[nodiscard]] constexpr NumericType J3() const noexcept {
+    const NumericType mean{Trace() / static_cast<NumericType>(3)};
+    const NumericType deviatoric_xx{xx() - mean};
+    const NumericType deviatoric_yy{yy() - mean};
+    const NumericType deviatoric_zz{zz() - mean};
+    return deviatoric_xx * (deviatoric_yy * deviatoric_zz - yz() * yz())
+           + xy() * (yz() * xz() - xy() * deviatoric_zz)
+           + xz() * (xy() * yz() - deviatoric_yy * xz());
+  }
+
   /// \brief Returns the inverse of this three-dimensional symmetric dyadic tensor if it exists, or
   /// std::nullopt otherwise.
   [[nodiscard]] std::optional<SymmetricDyad<NumericType>> Inverse() const;
 
+  /// \brief Returns the inverse of this three-dimensional symmetric dyadic tensor if it is far
+  /// enough from singular, or std::nullopt otherwise. This tensor is considered singular if the
+  /// magnitude of its determinant does not exceed the given tolerance times the product of the
+  /// magnitudes of its rows.
+  [[nodiscard]] std::optional<SymmetricDyad<NumericType>> Inverse(
+      const NumericType tolerance) const;
+
+  /// \brief Returns the solution x of the linear system A * x = b, where A is this
+  /// three-dimensional symmetric dyadic tensor and b is the given vector, if this tensor is far
+  /// enough from singular, or std::nullopt otherwise. The solution is computed with Cramer's rule
+  /// without forming the inverse. This tensor is considered singular if the magnitude of its
+  /// determinant does not exceed the given tolerance times the product of the magnitudes of its
+  /// rows.
+  [[nodiscard]] std::optional<Vector<NumericType>> Solve(
+      const Vector<NumericType>& vector,
+      const NumericType tolerance = Internal::SingularityTolerance<NumericType>) const;
+
+  /// \brief Computes the inverses of the given number of three-dimensional symmetric dyadic tensors
+  /// stored contiguously, and stores them in the given array of inverses. Also stores whether each
+  /// tensor is far enough from singular to be inverted in the given array of flags; the inverse of
+  /// each singular tensor is set to zero. Tensors are considered singular as in Inverse(tolerance).
+  static void Inverse(const SymmetricDyad<NumericType>* const symmetric_dyads,
+                      const std::size_t size, SymmetricDyad<NumericType>* const inverses,
+                      bool* const invertible,
+                      const NumericType tolerance = Internal::SingularityTolerance<NumericType>);
+
+  /// \brief Solves the given number of linear systems A * x = b, where the three-dimensional
+  /// symmetric dyadic tensors A and the vectors b are stored contiguously, and stores the solutions
+  /// x in the given array of solutions. Also stores whether each tensor is far enough from singular
+  /// for its system to be solved in the given array of flags; the solution of each singular system
+  /// is set to zero. Tensors are considered singular as in Solve(vector, tolerance).
+  static void Solve(const SymmetricDyad<NumericType>* const symmetric_dyads,
+                    const Vector<NumericType>* const vectors, const std::size_t size,
+                    Vector<NumericType>* const solutions, bool* const solved,
+                    const NumericType tolerance = Internal::SingularityTolerance<NumericType>);
+
+  /// \brief Returns the eigenvalues of this three-dimensional symmetric dyadic tensor sorted in
+  /// decreasing order. The eigenvalues are computed in closed form from the characteristic
+  /// equation rather than iteratively.
+  [[nodiscard]] std::array<NumericType, 3> Eigenvalues() const;
+
+  /// \brief Returns the eigenvectors of this three-dimensional symmetric dyadic tensor. The
+  /// eigenvectors are unit vectors that form a right-handed orthonormal basis and are sorted in the
+  /// same order as the eigenvalues returned by Eigenvalues().
+  [[nodiscard]] std::array<Vector<NumericType>, 3> Eigenvectors() const {
+    return Eigenvectors(Eigenvalues());
+  }
+
+  /// \brief Returns the eigenvectors of this three-dimensional symmetric dyadic tensor that
+  /// correspond to the given eigenvalues, which must be the ones returned by Eigenvalues(). This
+  /// avoids computing the eigenvalues again when both the eigenvalues and the eigenvectors are
+  /// needed.
+  [[nodiscard]] std::array<Vector<NumericType>, 3> Eigenvectors(
+      const std::array<NumericType, 3>& eigenvalues) const;
+
   /// \brief Prints this three-dimensional symmetric dyadic tensor as a string.
   [[nodiscard]] std::string Print() const {
-    return "(" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + ", " + PhQ::Print(xx_xy_xz_yy_yz_zz_[1]) + ", "
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[2]) + "; " + PhQ::Print(xx_xy_xz_yy_yz_zz_[3]) + ", "
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[4]) + "; " + PhQ::Print(xx_xy_xz_yy_yz_zz_[5]) + ")";
+    std::string buffer;
+    AppendPrint(buffer);
+    return buffer;
+  }
+
+  /// \brief Prints this three-dimensional symmetric dyadic tensor and appends it to the given
+  /// string.
+  void AppendPrint(std::string& buffer) const {
+    buffer.push_back('(');
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[0]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[1]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[2]);
+    buffer.append("; ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[3]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[4]);
+    buffer.append("; ");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[5]);
+    buffer.push_back(')');
   }
 
   /// \brief Serializes this three-dimensional symmetric dyadic tensor as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return "{\"xx\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + ",\"xy\":"
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[1]) + ",\"xz\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[2])
-           + ",\"yy\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[3])
-           + ",\"yz\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[4])
-           + ",\"zz\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[5]) + "}";
+    std::string buffer;
+    AppendJSON(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as a JSON message and appends
+  /// it to the given string.
+  void AppendJSON(std::string& buffer) const {
+    buffer.append("{\"xx\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[0]);
+    buffer.append(",\"xy\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[1]);
+    buffer.append(",\"xz\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[2]);
+    buffer.append(",\"yy\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[3]);
+    buffer.append(",\"yz\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[4]);
+    buffer.append(",\"zz\":");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[5]);
+    buffer.push_back('}');
   }
 
   /// \brief Serializes this three-dimensional symmetric dyadic tensor as an XML message.
   [[nodiscard]] std::string XML() const {
-    return "<xx>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + "</xx><xy>"
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[1]) + "</xy><xz>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[2])
-           + "</xz><yy>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[3]) + "</yy><yz>"
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[4]) + "</yz><zz>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[5])
-           + "</zz>";
+    std::string buffer;
+    AppendXML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as an XML message and appends
+  /// it to the given string.
+  void AppendXML(std::string& buffer) const {
+    buffer.append("<xx>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[0]);
+    buffer.append("</xx><xy>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[1]);
+    buffer.append("</xy><xz>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[2]);
+    buffer.append("</xz><yy>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[3]);
+    buffer.append("</yy><yz>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[4]);
+    buffer.append("</yz><zz>");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[5]);
+    buffer.append("</zz>");
   }
 
   /// \brief Serializes this three-dimensional symmetric dyadic tensor as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return "{xx:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + ",xy:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[1])
-           + ",xz:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[2]) + ",yy:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[3])
-           + ",yz:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[4]) + ",zz:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[5])
-           + "}";
+    std::string buffer;
+    AppendYAML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as a YAML message and appends
+  /// it to the given string.
+  void AppendYAML(std::string& buffer) const {
+    buffer.append("{xx:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[0]);
+    buffer.append(",xy:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[1]);
+    buffer.append(",xz:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[2]);
+    buffer.append(",yy:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[3]);
+    buffer.append(",yz:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[4]);
+    buffer.append(",zz:");
+    PhQ::AppendPrint(buffer, xx_xy_xz_yy_yz_zz_[5]);
+    buffer.push_back('}');
   }
 
   /// \brief Adds another three-dimensional symmetric dyadic tensor to this one.
@@ -433,6 +647,16 @@ public:
   }
 
 private:
+  /// \brief Returns whether this three-dimensional symmetric dyadic tensor, whose determinant is
+  /// given, is far enough from singular to be inverted with the given tolerance. The determinant
+  /// must also be nonzero, since it divides the adjugate.
+  [[nodiscard]] constexpr bool IsWellConditioned(
+      const NumericType determinant, const NumericType tolerance) const noexcept {
+    return determinant != static_cast<NumericType>(0)
+           && Internal::IsWellConditioned(
+               xx(), xy(), xz(), xy(), yy(), yz(), xz(), yz(), zz(), tolerance);
+  }
+
   /// \brief Cartesian components of this three-dimensional symmetric dyadic tensor.
   std::array<NumericType, 6> xx_xy_xz_yy_yz_zz_;
 };
@@ -521,7 +745,8 @@ inline constexpr SymmetricDyad<NumericType> operator-(
     left.yy() - right.yy(), left.yz() - right.yz(), left.zz() - right.zz()};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr SymmetricDyad<NumericType> operator*(
     const SymmetricDyad<NumericType>& symmetric_dyad, const OtherNumericType number) {
   return SymmetricDyad<NumericType>{
@@ -533,7 +758,8 @@ inline constexpr SymmetricDyad<NumericType> operator*(
     symmetric_dyad.zz() * static_cast<NumericType>(number)};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr SymmetricDyad<NumericType> operator*(
     const OtherNumericType number, const SymmetricDyad<NumericType>& symmetric_dyad) {
   return SymmetricDyad<NumericType>{symmetric_dyad * number};
@@ -568,7 +794,8 @@ template <typename NumericType>
 inline constexpr Dyad<NumericType> operator*(
     const SymmetricDyad<NumericType>& symmetric_dyad, const Dyad<NumericType>& dyad);
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr SymmetricDyad<NumericType> operator/(
     const SymmetricDyad<NumericType>& symmetric_dyad, const OtherNumericType number) {
   return SymmetricDyad<NumericType>{
@@ -580,6 +807,201 @@ inline constexpr SymmetricDyad<NumericType> operator/(
     symmetric_dyad.zz() / static_cast<NumericType>(number)};
 }
 
+namespace Internal {
+
+/// \brief Returns a unit eigenvector of the given three-dimensional symmetric dyadic tensor for the
+/// given eigenvalue, which must have a multiplicity of one. The rows of the tensor minus the
+/// eigenvalue times the identity span the plane orthogonal to the eigenvector, so the eigenvector
+/// is the cross product of two of these rows. The pair whose cross product has the largest
+/// magnitude is used since it is the least sensitive to rounding errors.
+template <typename NumericType>
+inline Vector<NumericType> SymmetricDyadEigenvector(
+    const SymmetricDyad<NumericType>& symmetric_dyad, const NumericType eigenvalue) {
+  const Vector<NumericType> row_x{
+      symmetric_dyad.xx() - eigenvalue, symmetric_dyad.xy(), symmetric_dyad.xz()};
+  const Vector<NumericType> row_y{
+      symmetric_dyad.xy(), symmetric_dyad.yy() - eigenvalue, symmetric_dyad.yz()};
+  const Vector<NumericType> row_z{
+      symmetric_dyad.xz(), symmetric_dyad.yz(), symmetric_dyad.zz() - eigenvalue};
+  const Vector<NumericType> cross_xy{row_x.Cross(row_y)};
+  const Vector<NumericType> cross_xz{row_x.Cross(row_z)};
+  const Vector<NumericType> cross_yz{row_y.Cross(row_z)};
+  const NumericType magnitude_squared_xy{cross_xy.MagnitudeSquared()};
+  const NumericType magnitude_squared_xz{cross_xz.MagnitudeSquared()};
+  const NumericType magnitude_squared_yz{cross_yz.MagnitudeSquared()};
+  if (magnitude_squared_xy >= magnitude_squared_xz && magnitude_squared_xy >= magnitude_squared_yz
+      && magnitude_squared_xy > static_cast<NumericType>(0)) {
+    return cross_xy / std::sqrt(magnitude_squared_xy);
+  }
+  if (magnitude_squared_xz >= magnitude_squared_yz
+      && magnitude_squared_xz > static_cast<NumericType>(0)) {
+    return cross_xz / std::sqrt(magnitude_squared_xz);
+  }
+  if (magnitude_squared_yz > static_cast<NumericType>(0)) {
+    return cross_yz / std::sqrt(magnitude_squared_yz);
+  }
+  // All rows are zero, so the tensor is the eigenvalue times the identity and every vector is an
+  // eigenvector.
+  return {static_cast<NumericType>(1), static_cast<NumericType>(0), static_cast<NumericType>(0)};
+}
+
+/// \brief Returns two unit vectors that, together with the given unit vector, form a right-handed
+/// orthonormal basis.
+template <typename NumericType>
+inline std::array<Vector<NumericType>, 2> OrthogonalBasis(const Vector<NumericType>& unit_vector) {
+  const Vector<NumericType> first{
+      std::abs(unit_vector.x()) > std::abs(unit_vector.y()) ?
+          Vector<NumericType>{-unit_vector.z(), static_cast<NumericType>(0), unit_vector.x()}
+              / std::sqrt(unit_vector.x() * unit_vector.x() + unit_vector.z() * unit_vector.z()) :
+          Vector<NumericType>{static_cast<NumericType>(0), unit_vector.z(), -unit_vector.y()}
+              / std::sqrt(unit_vector.y() * unit_vector.y() + unit_vector.z() * unit_vector.z())};
+  return {first, unit_vector.Cross(first)};
+}
+
+/// \brief Returns the two eigenvalues of the given three-dimensional symmetric dyadic tensor other
+/// than the one of the given unit eigenvector, sorted in decreasing order. These are the
+/// eigenvalues of the two-dimensional tensor obtained by restricting the tensor to the plane
+/// orthogonal to the given eigenvector. Unlike the trigonometric solution of the characteristic
+/// equation, this remains accurate when these two eigenvalues are nearly equal.
+template <typename NumericType>
+inline std::array<NumericType, 2> SymmetricDyadProjectedEigenvalues(
+    const SymmetricDyad<NumericType>& symmetric_dyad, const Vector<NumericType>& eigenvector) {
+  const std::array<Vector<NumericType>, 2> basis{OrthogonalBasis(eigenvector)};
+  const NumericType first_first{basis[0].Dot(symmetric_dyad * basis[0])};
+  const NumericType first_second{basis[0].Dot(symmetric_dyad * basis[1])};
+  const NumericType second_second{basis[1].Dot(symmetric_dyad * basis[1])};
+  const NumericType center{static_cast<NumericType>(0.5) * (first_first + second_second)};
+  const NumericType half_difference{static_cast<NumericType>(0.5) * (first_first - second_second)};
+  const NumericType radius{
+      std::sqrt(half_difference * half_difference + first_second * first_second)};
+  return {center + radius, center - radius};
+}
+
+/// \brief Returns the eigenvalues of the three-dimensional symmetric dyadic tensor with the given
+/// xx, xy, xz, yy, yz, and zz Cartesian components, sorted in decreasing order. Uses the
+/// trigonometric solution of the characteristic cubic equation. The tensor is first scaled by its
+/// largest component to avoid overflow and underflow. When two eigenvalues are nearly equal, the
+/// trigonometric solution loses about half of its significant digits in these two eigenvalues, so
+/// they are instead computed from the tensor restricted to the plane orthogonal to the eigenvector
+/// of the remaining eigenvalue.
+template <typename NumericType>
+inline std::array<NumericType, 3> SymmetricDyadEigenvalues(
+    const NumericType xx, const NumericType xy, const NumericType xz, const NumericType yy,
+    const NumericType yz, const NumericType zz) {
+  const NumericType largest_component{std::max(
+      std::max(std::max(std::abs(xx), std::abs(xy)), std::max(std::abs(xz), std::abs(yy))),
+      std::max(std::abs(yz), std::abs(zz)))};
+  const NumericType scale{
+      largest_component > static_cast<NumericType>(0) ?
+          static_cast<NumericType>(1) / largest_component :
+          static_cast<NumericType>(1)};
+
+  // Split the scaled tensor into its mean and deviatoric parts. The eigenvalues of the tensor are
+  // the mean plus the eigenvalues of the deviatoric part.
+  const NumericType mean{(xx + yy + zz) * scale / static_cast<NumericType>(3)};
+  const SymmetricDyad<NumericType> deviatoric{
+      xx * scale - mean, xy * scale, xz * scale, yy * scale - mean, yz * scale, zz * scale - mean};
+
+  // The eigenvalues of the deviatoric part are 2 * p * cos(angle + 2 * k * pi / 3) for k = 0, 1, 2,
+  // where p = sqrt(J2 / 3), cos(3 * angle) = det(deviatoric / p) / 2, and J2 is the second
+  // invariant of the deviatoric part.
+  const NumericType p{std::sqrt(
+      (deviatoric.xx() * deviatoric.xx() + deviatoric.yy() * deviatoric.yy()
+       + deviatoric.zz() * deviatoric.zz()
+       + static_cast<NumericType>(2)
+             * (deviatoric.xy() * deviatoric.xy() + deviatoric.xz() * deviatoric.xz()
+                + deviatoric.yz() * deviatoric.yz()))
+      / static_cast<NumericType>(6))};
+  const NumericType inverse_p{
+      p > static_cast<NumericType>(0) ? static_cast<NumericType>(1) / p :
+                                        static_cast<NumericType>(0)};
+  const NumericType cosine{std::clamp(
+      static_cast<NumericType>(0.5) * deviatoric.Determinant() * inverse_p * inverse_p * inverse_p,
+      static_cast<NumericType>(-1), static_cast<NumericType>(1))};
+  const NumericType angle{std::acos(cosine) / static_cast<NumericType>(3)};
+  const NumericType largest{static_cast<NumericType>(2) * p * std::cos(angle)};
+  const NumericType smallest{
+      static_cast<NumericType>(2) * p
+      * std::cos(
+          angle + static_cast<NumericType>(2) * Pi<NumericType> / static_cast<NumericType>(3))};
+
+  // Near cos(3 * angle) = 1, the two smallest eigenvalues are nearly equal, and near
+  // cos(3 * angle) = -1, the two largest eigenvalues are nearly equal. The remaining eigenvalue is
+  // still accurate in both cases.
+  constexpr NumericType threshold{static_cast<NumericType>(1) - static_cast<NumericType>(1) / 64};
+  if (cosine > threshold) {
+    const std::array<NumericType, 2> others{SymmetricDyadProjectedEigenvalues(
+        deviatoric, SymmetricDyadEigenvector(deviatoric, largest))};
+    return {(mean + largest) * largest_component, (mean + others[0]) * largest_component,
+            (mean + others[1]) * largest_component};
+  }
+  if (cosine < -threshold) {
+    const std::array<NumericType, 2> others{SymmetricDyadProjectedEigenvalues(
+        deviatoric, SymmetricDyadEigenvector(deviatoric, smallest))};
+    return {(mean + others[0]) * largest_component, (mean + others[1]) * largest_component,
+            (mean + smallest) * largest_component};
+  }
+
+  // The eigenvalues of the deviatoric part sum to zero.
+  return {(mean + largest) * largest_component, (mean - largest - smallest) * largest_component,
+          (mean + smallest) * largest_component};
+}
+
+/// \brief Returns a unit eigenvector of the given three-dimensional symmetric dyadic tensor for the
+/// given eigenvalue that is orthogonal to the given unit eigenvector. This remains accurate when
+/// the eigenvalue is repeated, because it only solves the two-dimensional eigenvalue problem of the
+/// tensor restricted to the plane orthogonal to the given eigenvector.
+template <typename NumericType>
+inline Vector<NumericType> SymmetricDyadOrthogonalEigenvector(
+    const SymmetricDyad<NumericType>& symmetric_dyad, const Vector<NumericType>& eigenvector,
+    const NumericType eigenvalue) {
+  const std::array<Vector<NumericType>, 2> basis{OrthogonalBasis(eigenvector)};
+
+  // Components of the tensor minus the eigenvalue times the identity in this basis.
+  NumericType first_first{basis[0].Dot(symmetric_dyad * basis[0]) - eigenvalue};
+  NumericType first_second{basis[0].Dot(symmetric_dyad * basis[1])};
+  NumericType second_second{basis[1].Dot(symmetric_dyad * basis[1]) - eigenvalue};
+
+  // Find the null vector of this two-dimensional symmetric tensor by normalizing its row with the
+  // largest component. If the tensor is zero, any vector in the plane is an eigenvector.
+  const NumericType absolute_first_first{std::abs(first_first)};
+  const NumericType absolute_first_second{std::abs(first_second)};
+  const NumericType absolute_second_second{std::abs(second_second)};
+  if (absolute_first_first >= absolute_second_second) {
+    if (std::max(absolute_first_first, absolute_first_second) > static_cast<NumericType>(0)) {
+      if (absolute_first_first >= absolute_first_second) {
+        first_second /= first_first;
+        first_first = static_cast<NumericType>(1)
+                      / std::sqrt(static_cast<NumericType>(1) + first_second * first_second);
+        first_second *= first_first;
+      } else {
+        first_first /= first_second;
+        first_second = static_cast<NumericType>(1)
+                       / std::sqrt(static_cast<NumericType>(1) + first_first * first_first);
+        first_first *= first_second;
+      }
+      return basis[0] * first_second - basis[1] * first_first;
+    }
+  } else if (std::max(absolute_second_second, absolute_first_second)
+             > static_cast<NumericType>(0)) {
+    if (absolute_second_second >= absolute_first_second) {
+      first_second /= second_second;
+      second_second = static_cast<NumericType>(1)
+                      / std::sqrt(static_cast<NumericType>(1) + first_second * first_second);
+      first_second *= second_second;
+    } else {
+      second_second /= first_second;
+      first_second = static_cast<NumericType>(1)
+                     / std::sqrt(static_cast<NumericType>(1) + second_second * second_second);
+      second_second *= first_second;
+    }
+    return basis[0] * second_second - basis[1] * first_second;
+  }
+  return basis[0];
+}
+
+}  // namespace Internal
+
 template <typename NumericType>
 inline std::optional<SymmetricDyad<NumericType>> SymmetricDyad<NumericType>::Inverse() const {
   const NumericType determinant_{Determinant()};
@@ -589,6 +1011,101 @@ inline std::optional<SymmetricDyad<NumericType>> SymmetricDyad<NumericType>::Inv
   return std::nullopt;
 }
 
+template <typename NumericType>
+inline std::optional<SymmetricDyad<NumericType>> SymmetricDyad<NumericType>::Inverse(
+    const NumericType tolerance) const {
+  const NumericType determinant_{Determinant()};
+  if (IsWellConditioned(determinant_, tolerance)) {
+    return std::optional<SymmetricDyad<NumericType>>{Adjugate() / determinant_};
+  }
+  return std::nullopt;
+}
+
+template <typename NumericType>
+inline std::optional<Vector<NumericType>> SymmetricDyad<NumericType>::Solve(
+    const Vector<NumericType>& vector, const NumericType tolerance) const {
+  const NumericType determinant_{Determinant()};
+  if (IsWellConditioned(determinant_, tolerance)) {
+    return std::optional<Vector<NumericType>>{Adjugate() * vector / determinant_};
+  }
+  return std::nullopt;
+}
+
+template <typename NumericType>
+inline void SymmetricDyad<NumericType>::Inverse(
+    const SymmetricDyad<NumericType>* const symmetric_dyads, const std::size_t size,
+    SymmetricDyad<NumericType>* const inverses, bool* const invertible,
+    const NumericType tolerance) {
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType determinant_{symmetric_dyads[index].Determinant()};
+    const bool is_invertible{symmetric_dyads[index].IsWellConditioned(determinant_, tolerance)};
+    invertible[index] = is_invertible;
+    inverses[index] = is_invertible ? symmetric_dyads[index].Adjugate() / determinant_
+                                    : SymmetricDyad<NumericType>::Zero();
+  }
+}
+
+template <typename NumericType>
+inline void SymmetricDyad<NumericType>::Solve(
+    const SymmetricDyad<NumericType>* const symmetric_dyads,
+    const Vector<NumericType>* const vectors, const std::size_t size,
+    Vector<NumericType>* const solutions, bool* const solved, const NumericType tolerance) {
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType determinant_{symmetric_dyads[index].Determinant()};
+    const bool is_solvable{symmetric_dyads[index].IsWellConditioned(determinant_, tolerance)};
+    solved[index] = is_solvable;
+    solutions[index] = is_solvable
+                           ? symmetric_dyads[index].Adjugate() * vectors[index] / determinant_
+                           : Vector<NumericType>::Zero();
+  }
+}
+
+template <typename NumericType>
+inline std::array<NumericType, 3> SymmetricDyad<NumericType>::Eigenvalues() const {
+  return Internal::SymmetricDyadEigenvalues(xx(), xy(), xz(), yy(), yz(), zz());
+}
+
+template <typename NumericType>
+inline std::array<Vector<NumericType>, 3> SymmetricDyad<NumericType>::Eigenvectors(
+    const std::array<NumericType, 3>& eigenvalues) const {
+  // Work on the tensor scaled by its largest component, as in the computation of the eigenvalues.
+  const NumericType largest_component{std::max(
+      std::max(std::max(std::abs(xx()), std::abs(xy())), std::max(std::abs(xz()), std::abs(yy()))),
+      std::max(std::abs(yz()), std::abs(zz())))};
+  if (largest_component == static_cast<NumericType>(0)) {
+    return {
+        Vector<NumericType>{static_cast<NumericType>(1), static_cast<NumericType>(0),
+                            static_cast<NumericType>(0)},
+        Vector<NumericType>{static_cast<NumericType>(0), static_cast<NumericType>(1),
+                            static_cast<NumericType>(0)},
+        Vector<NumericType>{static_cast<NumericType>(0), static_cast<NumericType>(0),
+                            static_cast<NumericType>(1)}
+    };
+  }
+  const SymmetricDyad<NumericType> scaled{*this / largest_component};
+  const std::array<NumericType, 3> scaled_eigenvalues{
+      eigenvalues[0] / largest_component, eigenvalues[1] / largest_component,
+      eigenvalues[2] / largest_component};
+
+  // Start from whichever of the largest and smallest eigenvalues is farther from the middle one,
+  // since it has a multiplicity of one unless all three eigenvalues are equal. Then compute the
+  // middle eigenvector in the plane orthogonal to it, and complete the right-handed basis with a
+  // cross product.
+  if (scaled_eigenvalues[0] - scaled_eigenvalues[1]
+      >= scaled_eigenvalues[1] - scaled_eigenvalues[2]) {
+    const Vector<NumericType> largest{
+        Internal::SymmetricDyadEigenvector(scaled, scaled_eigenvalues[0])};
+    const Vector<NumericType> middle{
+        Internal::SymmetricDyadOrthogonalEigenvector(scaled, largest, scaled_eigenvalues[1])};
+    return {largest, middle, largest.Cross(middle)};
+  }
+  const Vector<NumericType> smallest{
+      Internal::SymmetricDyadEigenvector(scaled, scaled_eigenvalues[2])};
+  const Vector<NumericType> middle{
+      Internal::SymmetricDyadOrthogonalEigenvector(scaled, smallest, scaled_eigenvalues[1])};
+  return {middle.Cross(smallest), middle, smallest};
+}
+
 template <typename NumericType>
 inline std::ostream& operator<<(std::ostream& stream, const SymmetricDyad<NumericType>& symmetric) {
   stream << symmetric.Print();
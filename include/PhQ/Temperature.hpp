@@ -216,6 +216,13 @@ inline constexpr Temperature<NumericType> TemperatureDifference<NumericType>::op
   return Temperature<NumericType>{this->value - temperature.Value()};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Temperature>{76};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -241,6 +241,13 @@ inline constexpr TemperatureDifference<NumericType> operator*(
   return temperature_difference * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<TemperatureDifference>{77};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -293,6 +293,13 @@ inline constexpr PlanarTemperatureGradient<NumericType>::PlanarTemperatureGradie
     const TemperatureGradient<NumericType>& temperature_gradient)
   : PlanarTemperatureGradient(PlanarVector<NumericType>{temperature_gradient.Value()}) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<TemperatureGradient>{78};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -267,6 +267,13 @@ inline constexpr ThermalConductivity<NumericType> operator*(
   return thermal_conductivity * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ThermalConductivity>{79};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
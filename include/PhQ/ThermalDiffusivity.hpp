@@ -238,6 +238,13 @@ inline constexpr SpecificIsobaricHeatCapacity<NumericType>::SpecificIsobaricHeat
         scalar_thermal_conductivity.Value()
         / (mass_density.Value() * thermal_diffusivity.Value())) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<ThermalDiffusivity>{80};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -400,6 +400,13 @@ inline constexpr Time<NumericType> operator*(
   return time * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Time>{81};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
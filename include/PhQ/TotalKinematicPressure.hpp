@@ -254,6 +254,13 @@ inline constexpr TotalKinematicPressure<NumericType> TotalPressure<NumericType>:
   return TotalKinematicPressure<NumericType>{*this, mass_density};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<TotalKinematicPressure>{82};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -239,6 +239,13 @@ inline constexpr TotalPressure<NumericType> DynamicPressure<NumericType>::operat
   return TotalPressure<NumericType>{static_pressure, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<TotalPressure>{83};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
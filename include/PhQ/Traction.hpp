@@ -301,6 +301,13 @@ template <typename NumericType>
 inline constexpr PlanarTraction<NumericType>::PlanarTraction(const Traction<NumericType>& traction)
   : PlanarTraction(PlanarVector<NumericType>{traction.Value()}) {}
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Traction>{84};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -261,6 +261,13 @@ inline constexpr Length<NumericType> Energy<NumericType>::operator/(
   return Length<NumericType>{*this, transport_energy_consumption};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<TransportEnergyConsumption>{85};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -25,8 +25,11 @@
 #ifndef PHQ_UNIT_HPP
 #define PHQ_UNIT_HPP
 
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "Dimensions.hpp"
@@ -35,6 +38,7 @@
 #include "SymmetricDyad.hpp"
 #include "UnitSystem.hpp"
 #include "Vector.hpp"
+#include "Vectorization.hpp"
 
 namespace PhQ {
 
@@ -48,23 +52,166 @@ inline constexpr Dimensions RelatedDimensions;
 
 namespace Internal {
 
-/// \brief Abstract class for converting a value expressed in a unit of measure to or from the
-/// standard unit of measure of that type. Internal implementation detail not intended to be used
+/// \brief Conversion of a value from a unit of measure to the standard unit of measure of its
+/// type, or from the standard unit of measure to a unit of measure of that type, expressed as the
+/// sequence of arithmetic operations value ↦ (value + addend) × factor + offset, or the same with a
+/// division by the factor instead of a multiplication. Each operation is rounded separately, in
+/// this order, and operations whose operand is an identity element are skipped. Each unit of
+/// measure declares its conversion steps to and from the standard unit of measure explicitly in its
+/// PhQ::Internal::Conversion specialization. Internal implementation detail not intended to be used
+/// outside of the PhQ::ConvertInPlace and PhQ::Convert functions.
+template <typename NumericType>
+class ConversionStep {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::ConversionStep must be a numeric "
+                "floating-point type: float, double, or long double.");
+
+public:
+  /// \brief Constructor. Constructs a conversion step from a given addend, factor, and offset, and
+  /// whether the factor divides rather than multiplies.
+  constexpr ConversionStep(const NumericType addend, const NumericType factor, const bool divides,
+                           const NumericType offset) noexcept
+    : addend(addend), factor(factor), divides(divides), offset(offset) {}
+
+  /// \brief Statically creates a conversion step that leaves values unchanged.
+  [[nodiscard]] static constexpr ConversionStep<NumericType> Identity() noexcept {
+    return {static_cast<NumericType>(0), static_cast<NumericType>(1), false,
+            static_cast<NumericType>(0)};
+  }
+
+  /// \brief Statically creates a conversion step that adds a given offset to values.
+  [[nodiscard]] static constexpr ConversionStep<NumericType> Addition(
+      const NumericType offset) noexcept {
+    return {static_cast<NumericType>(0), static_cast<NumericType>(1), false, offset};
+  }
+
+  /// \brief Statically creates a conversion step that multiplies values by a given factor.
+  [[nodiscard]] static constexpr ConversionStep<NumericType> Multiplication(
+      const NumericType factor) noexcept {
+    return {static_cast<NumericType>(0), factor, false, static_cast<NumericType>(0)};
+  }
+
+  /// \brief Statically creates a conversion step that divides values by a given divisor.
+  [[nodiscard]] static constexpr ConversionStep<NumericType> Division(
+      const NumericType divisor) noexcept {
+    return {static_cast<NumericType>(0), divisor, true, static_cast<NumericType>(0)};
+  }
+
+  /// \brief Term added to values before they are multiplied or divided by the factor.
+  [[nodiscard]] constexpr NumericType Addend() const noexcept {
+    return addend;
+  }
+
+  /// \brief Factor by which values are multiplied or divided.
+  [[nodiscard]] constexpr NumericType Factor() const noexcept {
+    return factor;
+  }
+
+  /// \brief Whether values are divided by the factor rather than multiplied by it.
+  [[nodiscard]] constexpr bool Divides() const noexcept {
+    return divides;
+  }
+
+  /// \brief Term added to values after they are multiplied or divided by the factor.
+  [[nodiscard]] constexpr NumericType Offset() const noexcept {
+    return offset;
+  }
+
+  /// \brief Whether this conversion step leaves values unchanged.
+  [[nodiscard]] constexpr bool IsIdentity() const noexcept {
+    return addend == static_cast<NumericType>(0) && factor == static_cast<NumericType>(1)
+           && offset == static_cast<NumericType>(0);
+  }
+
+  /// \brief Applies this conversion step to a given value. Usable at compile time.
+  [[nodiscard]] constexpr NumericType Evaluate(NumericType value) const noexcept {
+    if (addend != static_cast<NumericType>(0)) {
+      value += addend;
+    }
+    if (divides) {
+      value /= factor;
+    } else if (factor != static_cast<NumericType>(1)) {
+      value *= factor;
+    }
+    if (offset != static_cast<NumericType>(0)) {
+      value += offset;
+    }
+    return value;
+  }
+
+  /// \brief Applies this conversion step to a sequence of values in-place. Long sequences are
+  /// processed by explicitly vectorized kernels for the widest instruction set supported by the
+  /// processor. The results are bitwise identical to those of PhQ::ConversionStep::Evaluate.
+  void Apply(NumericType* const values, const std::size_t size) const noexcept {
+    constexpr NumericType one{static_cast<NumericType>(1)};
+    if (addend != static_cast<NumericType>(0)) {
+      MultiplyAddInPlace(values, size, one, addend);
+    }
+    if (divides) {
+      DivideInPlace(values, size, factor);
+      if (offset != static_cast<NumericType>(0)) {
+        MultiplyAddInPlace(values, size, one, offset);
+      }
+    } else if (offset != static_cast<NumericType>(0)) {
+      MultiplyAddInPlace(values, size, factor, offset);
+    } else if (factor != one) {
+      MultiplyInPlace(values, size, factor);
+    }
+  }
+
+private:
+  /// \brief Term added to values before they are multiplied or divided by the factor.
+  NumericType addend;
+
+  /// \brief Factor by which values are multiplied or divided.
+  NumericType factor;
+
+  /// \brief Whether values are divided by the factor rather than multiplied by it.
+  bool divides;
+
+  /// \brief Term added to values after they are multiplied or divided by the factor.
+  NumericType offset;
+};
+
+/// \brief Class for converting a value expressed in a unit of measure to or from the standard unit
+/// of measure of that type. Each unit of measure explicitly declares its conversion steps to and
+/// from the standard unit of measure by specializing PhQ::Internal::Conversion::FromStandardStep
+/// and PhQ::Internal::Conversion::ToStandardStep. These declarations are the single source of truth
+/// for the conversions: both the scalar conversions below and the dense tables of conversion steps
+/// used at runtime are derived from them. Internal implementation detail not intended to be used
 /// outside of the PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
 template <typename Unit, Unit UnitValue>
 class Conversion {
 public:
+  /// \brief Conversion step from the standard unit of measure of a given unit type to any given
+  /// unit of measure of that type. Specialized for each unit of measure. Internal implementation
+  /// detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+  /// PhQ::ConvertStatically functions.
+  template <typename NumericType>
+  static inline constexpr ConversionStep<NumericType> FromStandardStep() noexcept;
+
+  /// \brief Conversion step from any given unit of measure of a given unit type to the standard
+  /// unit of measure of that type. Specialized for each unit of measure. Internal implementation
+  /// detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+  /// PhQ::ConvertStatically functions.
+  template <typename NumericType>
+  static inline constexpr ConversionStep<NumericType> ToStandardStep() noexcept;
+
   /// \brief Converts a value expressed in the standard unit of measure of a given unit type to any
   /// given unit of measure of that type. Internal implementation detail not intended to be used
   /// outside of the PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
   template <typename NumericType>
-  static inline constexpr void FromStandard(NumericType& value) noexcept;
+  static inline constexpr void FromStandard(NumericType& value) noexcept {
+    value = FromStandardStep<NumericType>().Evaluate(value);
+  }
 
   /// \brief Converts a value expressed in any given unit of measure of a given unit type to the
   /// standard unit of measure of that type. Internal implementation detail not intended to be used
   /// outside of the PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
   template <typename NumericType>
-  static inline constexpr void ToStandard(NumericType& value) noexcept;
+  static inline constexpr void ToStandard(NumericType& value) noexcept {
+    value = ToStandardStep<NumericType>().Evaluate(value);
+  }
 };
 
 /// \brief Abstract class for converting a sequence of values expressed in a unit of measure to or
@@ -104,21 +251,175 @@ public:
   }
 };
 
-/// \brief Abstract map of functions for converting a sequence of values expressed in the standard
-/// unit of measure of a given type to any given unit of measure of that type. Internal
-/// implementation detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert,
-/// and PhQ::ConvertStatically functions.
+/// \brief Number of units of measure of a given type. Units of measure are enumerated
+/// contiguously starting from zero, so this is also one past the largest enumeration value.
+/// Internal implementation detail not intended to be used outside of the PhQ::ConvertInPlace and
+/// PhQ::Convert functions.
+template <typename Unit>
+inline constexpr std::size_t NumberOfUnits;
+
+/// \brief Returns whether the number of units of measure of a given type is consistent with the
+/// spellings of that type: every enumeration value below PhQ::Internal::NumberOfUnits has a
+/// spelling, and the enumeration value equal to it has none. Each unit of measure header checks
+/// this with a static assertion so that a unit of measure appended to its enumeration cannot
+/// silently be left out of the tables of conversions. Internal implementation detail not intended
+/// to be used outside of the definitions of units of measure.
+template <typename Unit>
+[[nodiscard]] constexpr bool IsNumberOfUnitsConsistent() noexcept {
+  for (std::size_t index = 0; index < NumberOfUnits<Unit>; ++index) {
+    if (!Spellings<Unit>.Contains(static_cast<Unit>(index))) {
+      return false;
+    }
+  }
+  return !Spellings<Unit>.Contains(static_cast<Unit>(NumberOfUnits<Unit>));
+}
+
+/// \brief Conversion of values from one unit of measure to another of the same type: the
+/// conversion step from the original unit of measure to the standard unit of measure followed by
+/// the conversion step from the standard unit of measure to the new unit of measure. This is
+/// exactly the sequence of operations performed by PhQ::ConvertStatically, so the results are
+/// bitwise identical. Internal implementation detail not intended to be used outside of the
+/// PhQ::ConvertInPlace and PhQ::Convert functions and the PhQ::UnitConversion class.
+template <typename NumericType>
+class LinearConversion {
+public:
+  /// \brief Constructor. Constructs a linear conversion from a given conversion step to the
+  /// standard unit of measure and a given conversion step from the standard unit of measure.
+  constexpr LinearConversion(const ConversionStep<NumericType>& to_standard,
+                             const ConversionStep<NumericType>& from_standard) noexcept
+    : to_standard(to_standard), from_standard(from_standard) {}
+
+  /// \brief Conversion step from the original unit of measure to the standard unit of measure.
+  [[nodiscard]] constexpr const ConversionStep<NumericType>& ToStandard() const noexcept {
+    return to_standard;
+  }
+
+  /// \brief Conversion step from the standard unit of measure to the new unit of measure.
+  [[nodiscard]] constexpr const ConversionStep<NumericType>& FromStandard() const noexcept {
+    return from_standard;
+  }
+
+  /// \brief Applies this linear conversion to a sequence of values in-place in a single pass. When
+  /// both conversion steps have an effect, the values are converted one block at a time, and each
+  /// block remains in the processor's cache between the two steps.
+  void Apply(NumericType* const values, const std::size_t size) const noexcept {
+    if (from_standard.IsIdentity()) {
+      to_standard.Apply(values, size);
+    } else if (to_standard.IsIdentity()) {
+      from_standard.Apply(values, size);
+    } else {
+      for (std::size_t index = 0; index < size; index += BlockSize) {
+        const std::size_t block_size{std::min(BlockSize, size - index)};
+        to_standard.Apply(values + index, block_size);
+        from_standard.Apply(values + index, block_size);
+      }
+    }
+  }
+
+private:
+  /// \brief Number of values converted at a time when both conversion steps have an effect.
+  static constexpr std::size_t BlockSize{1024};
+
+  /// \brief Conversion step from the original unit of measure to the standard unit of measure.
+  ConversionStep<NumericType> to_standard;
+
+  /// \brief Conversion step from the standard unit of measure to the new unit of measure.
+  ConversionStep<NumericType> from_standard;
+};
+
+/// \brief Builds the table of conversion steps from the standard unit of measure of a given type
+/// to each unit of measure of that type. Internal implementation detail not intended to be used
+/// outside of the PhQ::Internal::TableOfConversionsFromStandard table.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+[[nodiscard]] inline constexpr std::array<ConversionStep<NumericType>, sizeof...(Indices)>
+MakeTableOfConversionsFromStandard(std::index_sequence<Indices...> /*indices*/) noexcept {
+  return {
+    Conversion<Unit, static_cast<Unit>(Indices)>::template FromStandardStep<NumericType>()...};
+}
+
+/// \brief Builds the table of conversion steps from each unit of measure of a given type to the
+/// standard unit of measure of that type. Internal implementation detail not intended to be used
+/// outside of the PhQ::Internal::TableOfConversionsToStandard table.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+[[nodiscard]] inline constexpr std::array<ConversionStep<NumericType>, sizeof...(Indices)>
+MakeTableOfConversionsToStandard(std::index_sequence<Indices...> /*indices*/) noexcept {
+  return {
+    Conversion<Unit, static_cast<Unit>(Indices)>::template ToStandardStep<NumericType>()...};
+}
+
+/// \brief Dense table of conversion steps from the standard unit of measure of a given type to each
+/// unit of measure of that type, indexed by the unit enumeration value. The table is built at
+/// compile time from the conversion steps declared by the PhQ::Internal::Conversion specializations
+/// and requires no static initialization. Internal implementation detail not intended to be used
+/// outside of the PhQ::ConvertInPlace and PhQ::Convert functions.
+template <typename Unit, typename NumericType>
+inline constexpr std::array<ConversionStep<NumericType>, NumberOfUnits<Unit>>
+    TableOfConversionsFromStandard{MakeTableOfConversionsFromStandard<Unit, NumericType>(
+        std::make_index_sequence<NumberOfUnits<Unit>>())};
+
+/// \brief Dense table of conversion steps from each unit of measure of a given type to the standard
+/// unit of measure of that type, indexed by the unit enumeration value. The table is built at
+/// compile time from the conversion steps declared by the PhQ::Internal::Conversion specializations
+/// and requires no static initialization. Internal implementation detail not intended to be used
+/// outside of the PhQ::ConvertInPlace and PhQ::Convert functions.
 template <typename Unit, typename NumericType>
-inline const std::map<Unit, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard;
+inline constexpr std::array<ConversionStep<NumericType>, NumberOfUnits<Unit>>
+    TableOfConversionsToStandard{MakeTableOfConversionsToStandard<Unit, NumericType>(
+        std::make_index_sequence<NumberOfUnits<Unit>>())};
+
+/// \brief Returns the linear conversion from a given unit of measure to a new unit of measure of
+/// the same type, which consists of the conversion step from the original unit of measure to the
+/// standard unit of measure followed by the conversion step from the standard unit of measure to
+/// the new unit of measure. Converting a unit of measure to itself leaves values unchanged.
+/// Internal implementation detail not intended to be used outside of the PhQ::ConvertInPlace and
+/// PhQ::Convert functions and the PhQ::UnitConversion class.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline LinearConversion<NumericType> MakeLinearConversion(
+    const Unit original_unit, const Unit new_unit) noexcept {
+  if (original_unit == new_unit) {
+    return {ConversionStep<NumericType>::Identity(), ConversionStep<NumericType>::Identity()};
+  }
+  return {TableOfConversionsToStandard<Unit, NumericType>[static_cast<std::size_t>(original_unit)],
+          TableOfConversionsFromStandard<Unit, NumericType>[static_cast<std::size_t>(new_unit)]};
+}
 
-/// \brief Abstract map of functions for converting a sequence of values expressed in any given unit
-/// of measure of a given type to the standard unit of measure of that type. Internal implementation
-/// detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
-/// PhQ::ConvertStatically functions.
+/// \brief Converts a sequence of values expressed in a given unit of measure to a new unit of
+/// measure. The conversion is performed in-place in a single pass over the values. Internal
+/// implementation detail not intended to be used outside of the PhQ::ConvertInPlace and
+/// PhQ::Convert functions.
 template <typename Unit, typename NumericType>
-inline const std::map<Unit, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard;
+inline void ConvertInPlace(NumericType* const values, const std::size_t size,
+                           const Unit original_unit, const Unit new_unit) noexcept {
+  if (original_unit != new_unit) {
+    MakeLinearConversion<Unit, NumericType>(original_unit, new_unit).Apply(values, size);
+  }
+}
+
+/// \brief Returns a pointer to the first component of a contiguous sequence of objects, each of
+/// which stores exactly a given number of components and nothing else, so that the components of
+/// all the objects can be swept as one flat sequence. Internal implementation detail not intended
+/// to be used outside of the PhQ::ConvertInPlace functions and the PhQ::UnitConversion class.
+template <std::size_t NumberOfComponents, typename NumericType, typename Type>
+[[nodiscard]] inline NumericType* Components(Type* const objects) noexcept {
+  static_assert(std::is_standard_layout_v<Type>
+                    && sizeof(Type) == NumberOfComponents * sizeof(NumericType),
+                "The objects whose components are swept as one flat sequence must store exactly "
+                "their components and nothing else.");
+  return reinterpret_cast<NumericType*>(objects);
+}
+
+/// \brief Returns a pointer to the first component of a contiguous sequence of constant objects,
+/// each of which stores exactly a given number of components and nothing else. Internal
+/// implementation detail not intended to be used outside of the Physical Quantities library's own
+/// functions and classes.
+template <std::size_t NumberOfComponents, typename NumericType, typename Type>
+[[nodiscard]] inline const NumericType* Components(const Type* const objects) noexcept {
+  static_assert(std::is_standard_layout_v<Type>
+                    && sizeof(Type) == NumberOfComponents * sizeof(NumericType),
+                "The objects whose components are swept as one flat sequence must store exactly "
+                "their components and nothing else.");
+  return reinterpret_cast<const NumericType*>(objects);
+}
 
 }  // namespace Internal
 
@@ -129,12 +430,7 @@ inline void ConvertInPlace(NumericType& value, const Unit original_unit, const U
   static_assert(std::is_floating_point<NumericType>::value,
                 "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
                 "floating-point type: float, double, or long double.");
-  if (original_unit != Standard<Unit>) {
-    Internal::MapOfConversionsToStandard<Unit, NumericType>.find(original_unit)->second(&value, 1);
-  }
-  if (new_unit != Standard<Unit>) {
-    Internal::MapOfConversionsFromStandard<Unit, NumericType>.find(new_unit)->second(&value, 1);
-  }
+  Internal::ConvertInPlace(&value, 1, original_unit, new_unit);
 }
 
 /// \brief Converts an array of values expressed in a given unit of measure to a new unit of
@@ -145,13 +441,7 @@ inline void ConvertInPlace(
   static_assert(std::is_floating_point<NumericType>::value,
                 "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
                 "floating-point type: float, double, or long double.");
-  if (original_unit != Standard<Unit>) {
-    Internal::MapOfConversionsToStandard<Unit, NumericType>.find(original_unit)->second(values.data(), Size);
-  }
-  if (new_unit != Standard<Unit>) {
-    Internal::MapOfConversionsFromStandard<Unit, NumericType>.find(new_unit)->second(
-        values.data(), Size);
-  }
+  Internal::ConvertInPlace(values.data(), Size, original_unit, new_unit);
 }
 
 /// \brief Converts a vector of values expressed in a given unit of measure to a new unit of
@@ -162,13 +452,7 @@ inline void ConvertInPlace(
   static_assert(std::is_floating_point<NumericType>::value,
                 "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
                 "floating-point type: float, double, or long double.");
-  if (original_unit != Standard<Unit>) {
-    Internal::MapOfConversionsToStandard<Unit, NumericType>.find(original_unit)->second(values.data(), values.size());
-  }
-  if (new_unit != Standard<Unit>) {
-    Internal::MapOfConversionsFromStandard<Unit, NumericType>.find(new_unit)->second(
-        values.data(), values.size());
-  }
+  Internal::ConvertInPlace(values.data(), values.size(), original_unit, new_unit);
 }
 
 /// \brief Converts a two-dimensional Euclidean planar vector in the XY plane expressed in a given
@@ -204,6 +488,132 @@ inline void ConvertInPlace(Dyad<NumericType>& dyad, const Unit original_unit, co
       dyad.Mutable_xx_xy_xz_yx_yy_yz_zx_zy_zz(), original_unit, new_unit);
 }
 
+/// \brief Converts a contiguous sequence of two-dimensional Euclidean planar vectors in the XY
+/// plane expressed in a given unit of measure to a new unit of measure. The conversion factor is
+/// resolved once, and then the components of all the objects are converted in-place in a single
+/// pass as one flat sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(PlanarVector<NumericType>* const planar_vectors, const std::size_t size,
+                           const Unit original_unit, const Unit new_unit) {
+  Internal::ConvertInPlace(Internal::Components<2, NumericType>(planar_vectors), 2 * size,
+                           original_unit, new_unit);
+}
+
+/// \brief Converts a vector of two-dimensional Euclidean planar vectors in the XY plane expressed
+/// in a given unit of measure to a new unit of measure. The conversion factor is resolved once, and
+/// then the components of all the objects are converted in-place in a single pass as one flat
+/// sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(std::vector<PlanarVector<NumericType>>& planar_vectors,
+                           const Unit original_unit, const Unit new_unit) {
+  ConvertInPlace<Unit, NumericType>(
+      planar_vectors.data(), planar_vectors.size(), original_unit, new_unit);
+}
+
+/// \brief Converts a contiguous sequence of three-dimensional Euclidean vectors expressed in a
+/// given unit of measure to a new unit of measure. The conversion factor is resolved once, and then
+/// the components of all the objects are converted in-place in a single pass as one flat sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(Vector<NumericType>* const vectors, const std::size_t size,
+                           const Unit original_unit, const Unit new_unit) {
+  Internal::ConvertInPlace(Internal::Components<3, NumericType>(vectors), 3 * size,
+                           original_unit, new_unit);
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean vectors expressed in a given unit of
+/// measure to a new unit of measure. The conversion factor is resolved once, and then the
+/// components of all the objects are converted in-place in a single pass as one flat sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(
+    std::vector<Vector<NumericType>>& vectors, const Unit original_unit, const Unit new_unit) {
+  ConvertInPlace<Unit, NumericType>(vectors.data(), vectors.size(), original_unit, new_unit);
+}
+
+/// \brief Converts a contiguous sequence of three-dimensional Euclidean symmetric dyadic tensors
+/// expressed in a given unit of measure to a new unit of measure. The conversion factor is resolved
+/// once, and then the components of all the objects are converted in-place in a single pass as one
+/// flat sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(
+    SymmetricDyad<NumericType>* const symmetric_dyads, const std::size_t size,
+    const Unit original_unit, const Unit new_unit) {
+  Internal::ConvertInPlace(Internal::Components<6, NumericType>(symmetric_dyads), 6 * size,
+                           original_unit, new_unit);
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean symmetric dyadic tensors expressed in a
+/// given unit of measure to a new unit of measure. The conversion factor is resolved once, and then
+/// the components of all the objects are converted in-place in a single pass as one flat sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(std::vector<SymmetricDyad<NumericType>>& symmetric_dyads,
+                           const Unit original_unit, const Unit new_unit) {
+  ConvertInPlace<Unit, NumericType>(
+      symmetric_dyads.data(), symmetric_dyads.size(), original_unit, new_unit);
+}
+
+/// \brief Converts a contiguous sequence of three-dimensional Euclidean dyadic tensors expressed in
+/// a given unit of measure to a new unit of measure. The conversion factor is resolved once, and
+/// then the components of all the objects are converted in-place in a single pass as one flat
+/// sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(Dyad<NumericType>* const dyads, const std::size_t size,
+                           const Unit original_unit, const Unit new_unit) {
+  Internal::ConvertInPlace(Internal::Components<9, NumericType>(dyads), 9 * size,
+                           original_unit, new_unit);
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean dyadic tensors expressed in a given unit
+/// of measure to a new unit of measure. The conversion factor is resolved once, and then the
+/// components of all the objects are converted in-place in a single pass as one flat sequence.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(
+    std::vector<Dyad<NumericType>>& dyads, const Unit original_unit, const Unit new_unit) {
+  ConvertInPlace<Unit, NumericType>(dyads.data(), dyads.size(), original_unit, new_unit);
+}
+
+/// \brief Converts a field stored as a structure of arrays, in which each component is its own
+/// contiguous sequence of a given size, from a given unit of measure to a new unit of measure. The
+/// conversion factor is resolved once and then applied in-place to each component in turn. For
+/// example, the three components of a velocity field stored as three separate sequences of values:
+/// \code
+/// PhQ::ConvertInPlace<PhQ::Unit::Speed, 3, double>(
+///     {x.data(), y.data(), z.data()}, x.size(), PhQ::Unit::Speed::MetrePerSecond,
+///     PhQ::Unit::Speed::KilometrePerHour);
+/// \endcode
+template <typename Unit, std::size_t NumberOfComponents, typename NumericType>
+inline void ConvertInPlace(const std::array<NumericType*, NumberOfComponents>& components,
+                           const std::size_t size, const Unit original_unit, const Unit new_unit) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
+                "floating-point type: float, double, or long double.");
+  if (original_unit != new_unit) {
+    const Internal::LinearConversion<NumericType> linear_conversion{
+      Internal::MakeLinearConversion<Unit, NumericType>(original_unit, new_unit)};
+    for (NumericType* const component : components) {
+      linear_conversion.Apply(component, size);
+    }
+  }
+}
+
+/// \brief Converts a field stored as a structure of arrays, in which each component is its own
+/// vector of values, from a given unit of measure to a new unit of measure. The conversion factor
+/// is resolved once and then applied in-place to each component in turn. The components may differ
+/// in size.
+template <typename Unit, std::size_t NumberOfComponents, typename NumericType>
+inline void ConvertInPlace(std::array<std::vector<NumericType>, NumberOfComponents>& components,
+                           const Unit original_unit, const Unit new_unit) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
+                "floating-point type: float, double, or long double.");
+  if (original_unit != new_unit) {
+    const Internal::LinearConversion<NumericType> linear_conversion{
+      Internal::MakeLinearConversion<Unit, NumericType>(original_unit, new_unit)};
+    for (std::vector<NumericType>& component : components) {
+      linear_conversion.Apply(component.data(), component.size());
+    }
+  }
+}
+
 /// \brief Converts a value expressed in a given unit of measure to a new unit of measure. Returns
 /// the converted value. The original value remains unchanged.
 template <typename Unit, typename NumericType>
@@ -271,6 +681,176 @@ template <typename Unit, typename NumericType>
     Convert<Unit, 9, NumericType>(dyad.xx_xy_xz_yx_yy_yz_zx_zy_zz(), original_unit, new_unit)};
 }
 
+/// \brief Converts a vector of two-dimensional Euclidean planar vectors in the XY plane expressed
+/// in a given unit of measure to a new unit of measure. Returns the converted objects. The original
+/// objects remain unchanged.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<PlanarVector<NumericType>> Convert(
+    const std::vector<PlanarVector<NumericType>>& planar_vectors, const Unit original_unit,
+    const Unit new_unit) {
+  std::vector<PlanarVector<NumericType>> result{planar_vectors};
+  ConvertInPlace<Unit, NumericType>(result, original_unit, new_unit);
+  return result;
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean vectors expressed in a given unit of
+/// measure to a new unit of measure. Returns the converted objects. The original objects remain
+/// unchanged.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<Vector<NumericType>> Convert(
+    const std::vector<Vector<NumericType>>& vectors, const Unit original_unit,
+    const Unit new_unit) {
+  std::vector<Vector<NumericType>> result{vectors};
+  ConvertInPlace<Unit, NumericType>(result, original_unit, new_unit);
+  return result;
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean symmetric dyadic tensors expressed in a
+/// given unit of measure to a new unit of measure. Returns the converted objects. The original
+/// objects remain unchanged.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<SymmetricDyad<NumericType>> Convert(
+    const std::vector<SymmetricDyad<NumericType>>& symmetric_dyads, const Unit original_unit,
+    const Unit new_unit) {
+  std::vector<SymmetricDyad<NumericType>> result{symmetric_dyads};
+  ConvertInPlace<Unit, NumericType>(result, original_unit, new_unit);
+  return result;
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean dyadic tensors expressed in a given unit
+/// of measure to a new unit of measure. Returns the converted objects. The original objects remain
+/// unchanged.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<Dyad<NumericType>> Convert(
+    const std::vector<Dyad<NumericType>>& dyads, const Unit original_unit, const Unit new_unit) {
+  std::vector<Dyad<NumericType>> result{dyads};
+  ConvertInPlace<Unit, NumericType>(result, original_unit, new_unit);
+  return result;
+}
+
+/// \brief Precomputed conversion between two units of measure of the same type. Resolves the
+/// conversion steps to and from the standard unit of measure once at construction; each subsequent
+/// conversion of a sequence of values is then a single streaming pass. This is useful when many
+/// sequences of values are converted between the same pair of units of measure. For example:
+/// \code
+/// const PhQ::UnitConversion<PhQ::Unit::Length> conversion{
+///     PhQ::Unit::Length::Foot, PhQ::Unit::Length::Millimetre};
+/// conversion.ConvertInPlace(values);
+/// \endcode
+/// \tparam Unit Unit of measure enumeration type.
+/// \tparam NumericType Floating-point numeric type: float, double, or long double. Defaults to
+/// double if unspecified.
+template <typename Unit, typename NumericType = double>
+class UnitConversion {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::UnitConversion must be a numeric "
+                "floating-point type: float, double, or long double.");
+
+public:
+  /// \brief Constructor. Constructs a conversion from a given original unit of measure to a given
+  /// new unit of measure.
+  UnitConversion(const Unit original_unit, const Unit new_unit)
+    : original_unit(original_unit), new_unit(new_unit),
+      linear_conversion(
+          Internal::MakeLinearConversion<Unit, NumericType>(original_unit, new_unit)) {}
+
+  /// \brief Original unit of measure of this conversion.
+  [[nodiscard]] constexpr Unit OriginalUnit() const noexcept {
+    return original_unit;
+  }
+
+  /// \brief New unit of measure of this conversion.
+  [[nodiscard]] constexpr Unit NewUnit() const noexcept {
+    return new_unit;
+  }
+
+  /// \brief Converts a value expressed in the original unit of measure to the new unit of measure.
+  /// Returns the converted value.
+  [[nodiscard]] NumericType Convert(const NumericType value) const noexcept {
+    NumericType result{value};
+    ConvertInPlace(result);
+    return result;
+  }
+
+  /// \brief Converts a value expressed in the original unit of measure to the new unit of measure.
+  /// The conversion is performed in-place.
+  void ConvertInPlace(NumericType& value) const noexcept {
+    ConvertInPlace(&value, 1);
+  }
+
+  /// \brief Converts a sequence of values expressed in the original unit of measure to the new unit
+  /// of measure. The conversion is performed in-place in a single pass over the values.
+  void ConvertInPlace(NumericType* const values, const std::size_t size) const noexcept {
+    if (original_unit != new_unit) {
+      linear_conversion.Apply(values, size);
+    }
+  }
+
+  /// \brief Converts an array of values expressed in the original unit of measure to the new unit
+  /// of measure. The conversion is performed in-place in a single pass over the values.
+  template <std::size_t Size>
+  void ConvertInPlace(std::array<NumericType, Size>& values) const noexcept {
+    ConvertInPlace(values.data(), Size);
+  }
+
+  /// \brief Converts a vector of values expressed in the original unit of measure to the new unit
+  /// of measure. The conversion is performed in-place in a single pass over the values.
+  void ConvertInPlace(std::vector<NumericType>& values) const noexcept {
+    ConvertInPlace(values.data(), values.size());
+  }
+
+  /// \brief Converts a vector of two-dimensional Euclidean planar vectors in the XY plane expressed
+  /// in the original unit of measure to the new unit of measure. The conversion is performed
+  /// in-place in a single pass over the components of all the objects.
+  void ConvertInPlace(std::vector<PlanarVector<NumericType>>& planar_vectors) const noexcept {
+    ConvertInPlace(
+        Internal::Components<2, NumericType>(planar_vectors.data()), 2 * planar_vectors.size());
+  }
+
+  /// \brief Converts a vector of three-dimensional Euclidean vectors expressed in the original unit
+  /// of measure to the new unit of measure. The conversion is performed in-place in a single pass
+  /// over the components of all the objects.
+  void ConvertInPlace(std::vector<Vector<NumericType>>& vectors) const noexcept {
+    ConvertInPlace(Internal::Components<3, NumericType>(vectors.data()), 3 * vectors.size());
+  }
+
+  /// \brief Converts a vector of three-dimensional Euclidean symmetric dyadic tensors expressed in
+  /// the original unit of measure to the new unit of measure. The conversion is performed in-place
+  /// in a single pass over the components of all the objects.
+  void ConvertInPlace(std::vector<SymmetricDyad<NumericType>>& symmetric_dyads) const noexcept {
+    ConvertInPlace(
+        Internal::Components<6, NumericType>(symmetric_dyads.data()), 6 * symmetric_dyads.size());
+  }
+
+  /// \brief Converts a vector of three-dimensional Euclidean dyadic tensors expressed in the
+  /// original unit of measure to the new unit of measure. The conversion is performed in-place in a
+  /// single pass over the components of all the objects.
+  void ConvertInPlace(std::vector<Dyad<NumericType>>& dyads) const noexcept {
+    ConvertInPlace(Internal::Components<9, NumericType>(dyads.data()), 9 * dyads.size());
+  }
+
+  /// \brief Converts a field stored as a structure of arrays, in which each component is its own
+  /// contiguous sequence of a given size, from the original unit of measure to the new unit of
+  /// measure. The conversion is performed in-place.
+  template <std::size_t NumberOfComponents>
+  void ConvertInPlace(const std::array<NumericType*, NumberOfComponents>& components,
+                      const std::size_t size) const noexcept {
+    for (NumericType* const component : components) {
+      ConvertInPlace(component, size);
+    }
+  }
+
+private:
+  /// \brief Original unit of measure of this conversion.
+  Unit original_unit;
+
+  /// \brief New unit of measure of this conversion.
+  Unit new_unit;
+
+  /// \brief Composite linear conversion from the original unit of measure to the new one.
+  Internal::LinearConversion<NumericType> linear_conversion;
+};
+
 /// \brief Converts a value expressed in a given unit of measure to a new unit of measure. Returns
 /// the converted value. The original value remains unchanged. This function can be evaluated at
 /// compile time.
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -191,6 +189,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Acceleration u
 
 namespace Internal {
 
+/// \brief Number of acceleration units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Acceleration>{39};
+
 template <>
 inline const std::map<UnitSystem, Unit::Acceleration> ConsistentUnits<Unit::Acceleration>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Acceleration::MetrePerSquareSecond     },
@@ -253,7 +255,7 @@ inline const std::map<Unit::Acceleration, std::string_view> Abbreviations<Unit::
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Acceleration> Spellings<Unit::Acceleration>{
+inline constexpr auto Spellings<Unit::Acceleration>{MakeSpellingTable<Unit::Acceleration>({
     {"m/s^2",             Unit::Acceleration::MetrePerSquareSecond       },
     {"m/s2",              Unit::Acceleration::MetrePerSquareSecond       },
     {"m/s/s",             Unit::Acceleration::MetrePerSquareSecond       },
@@ -417,811 +419,655 @@ inline const std::unordered_map<std::string_view, Unit::Acceleration> Spellings<
     {"uin/hr^2",          Unit::Acceleration::MicroinchPerSquareHour     },
     {"uin/hr2",           Unit::Acceleration::MicroinchPerSquareHour     },
     {"uin/hr/hr",         Unit::Acceleration::MicroinchPerSquareHour     },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareSecond>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Acceleration>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareSecond>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MetrePerSquareHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KnotPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KnotPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KnotPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KnotPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilePerSquareHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3.6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3.6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(12960.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000.0L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::YardPerSquareHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::FootPerSquareHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.1L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(36000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.1L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.1L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(36000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(129600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.1L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.1L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(129600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.1L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(100.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::InchPerSquareHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.01L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(100.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(360000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.01L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.01L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(360000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1296000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.01L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.01L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1296000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.01L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.001L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(12960000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.001L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.000001L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(12960000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.000001L) / static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(12960000.0L) / static_cast<NumericType>(0.0000000254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Acceleration,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Acceleration, NumericType>{
-      {Unit::Acceleration::MetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MetrePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MetrePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MetrePerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::NauticalMilePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::NauticalMilePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::KnotPerHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KnotPerHour>::FromStandard<NumericType>},
-      {Unit::Acceleration::MilePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MilePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MilePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilePerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::KilometrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::KilometrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::KilometrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::YardPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::YardPerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::YardPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::YardPerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::YardPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::YardPerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::FootPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::FootPerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::FootPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::FootPerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::FootPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::FootPerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::DecimetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::DecimetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::DecimetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::InchPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::InchPerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::InchPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::InchPerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::InchPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::InchPerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::CentimetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::CentimetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::CentimetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MillimetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MillimetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MillimetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MilliinchPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MilliinchPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MilliinchPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MicrometrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MicrometrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MicrometrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareHour>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MicroinchPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareSecond>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MicroinchPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareMinute>::
-           FromStandard<NumericType>                        },
-      {Unit::Acceleration::MicroinchPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareHour>::
-           FromStandard<NumericType>                        },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Acceleration,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Acceleration, NumericType>{
-      {Unit::Acceleration::MetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MetrePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MetrePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MetrePerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::NauticalMilePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::NauticalMilePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::NauticalMilePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::KnotPerHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KnotPerHour>::ToStandard<NumericType>},
-      {Unit::Acceleration::MilePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MilePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MilePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilePerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::KilometrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::KilometrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::KilometrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::KilometrePerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::YardPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::YardPerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::YardPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::YardPerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::YardPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::YardPerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::FootPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::FootPerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::FootPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::FootPerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::FootPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::FootPerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::DecimetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::DecimetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::DecimetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::DecimetrePerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::InchPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::InchPerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::InchPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::InchPerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::InchPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::InchPerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::CentimetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::CentimetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::CentimetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::CentimetrePerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MillimetrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MillimetrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MillimetrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MillimetrePerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MilliinchPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MilliinchPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MilliinchPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MilliinchPerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MicrometrePerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MicrometrePerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MicrometrePerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicrometrePerSquareHour>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MicroinchPerSquareSecond,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareSecond>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MicroinchPerSquareMinute,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareMinute>::
-           ToStandard<NumericType>                        },
-      {Unit::Acceleration::MicroinchPerSquareHour,
-       Conversions<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareHour>::
-           ToStandard<NumericType>                        },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(12960000.0L));
+}
 
 }  // namespace Internal
 
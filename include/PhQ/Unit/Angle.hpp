@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -84,6 +82,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Angle unit) {
 
 namespace Internal {
 
+/// \brief Number of angle units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Angle>{5};
+
 template <>
 inline const std::map<UnitSystem, Unit::Angle> ConsistentUnits<Unit::Angle>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Angle::Radian},
@@ -107,7 +109,7 @@ inline const std::map<Unit::Angle, std::string_view> Abbreviations<Unit::Angle>{
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Angle> Spellings<Unit::Angle>{
+inline constexpr auto Spellings<Unit::Angle>{MakeSpellingTable<Unit::Angle>({
     {"rad",         Unit::Angle::Radian    },
     {"radian",      Unit::Angle::Radian    },
     {"radians",     Unit::Angle::Radian    },
@@ -129,106 +131,90 @@ inline const std::unordered_map<std::string_view, Unit::Angle> Spellings<Unit::A
     {"rev",         Unit::Angle::Revolution},
     {"revolution",  Unit::Angle::Revolution},
     {"revolutions", Unit::Angle::Revolution},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Radian>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Angle>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Radian>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Radian>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Degree>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(180.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Radian>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Degree>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(180.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Degree>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(180.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Arcminute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10800.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Degree>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(180.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Arcminute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(10800.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Arcminute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(10800.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Arcsecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(648000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Arcminute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(10800.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Arcsecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(648000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Arcsecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(648000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Revolution>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.5L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Arcsecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(648000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Angle, Unit::Angle::Revolution>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(2.0L) * Pi<NumericType>;
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Revolution>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.5L) / Pi<NumericType>);
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Angle, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Angle, NumericType>{
-      {Unit::Angle::Radian,
-       Conversions<Unit::Angle, Unit::Angle::Radian>::FromStandard<NumericType>    },
-      {Unit::Angle::Degree,
-       Conversions<Unit::Angle, Unit::Angle::Degree>::FromStandard<NumericType>    },
-      {Unit::Angle::Arcminute,
-       Conversions<Unit::Angle, Unit::Angle::Arcminute>::FromStandard<NumericType> },
-      {Unit::Angle::Arcsecond,
-       Conversions<Unit::Angle, Unit::Angle::Arcsecond>::FromStandard<NumericType> },
-      {Unit::Angle::Revolution,
-       Conversions<Unit::Angle, Unit::Angle::Revolution>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::Angle, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::Angle, NumericType>{
-          {Unit::Angle::Radian,
-           Conversions<Unit::Angle, Unit::Angle::Radian>::ToStandard<NumericType>    },
-          {Unit::Angle::Degree,
-           Conversions<Unit::Angle, Unit::Angle::Degree>::ToStandard<NumericType>    },
-          {Unit::Angle::Arcminute,
-           Conversions<Unit::Angle, Unit::Angle::Arcminute>::ToStandard<NumericType> },
-          {Unit::Angle::Arcsecond,
-           Conversions<Unit::Angle, Unit::Angle::Arcsecond>::ToStandard<NumericType> },
-          {Unit::Angle::Revolution,
-           Conversions<Unit::Angle, Unit::Angle::Revolution>::ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Angle, Unit::Angle::Revolution>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(2.0L) * Pi<NumericType>);
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -119,6 +117,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::AngularAcceler
 
 namespace Internal {
 
+/// \brief Number of angular acceleration units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::AngularAcceleration>{15};
+
 template <>
 inline const std::map<UnitSystem, Unit::AngularAcceleration>
     ConsistentUnits<Unit::AngularAcceleration>{
@@ -155,8 +157,9 @@ inline const std::map<Unit::AngularAcceleration, std::string_view>
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::AngularAcceleration> Spellings<
-    Unit::AngularAcceleration>{
+inline constexpr auto Spellings<
+    Unit::AngularAcceleration>{MakeSpellingTable<
+    Unit::AngularAcceleration>({
     {"rad/s^2",        Unit::AngularAcceleration::RadianPerSquareSecond    },
     {"rad/s2",         Unit::AngularAcceleration::RadianPerSquareSecond    },
     {"rad/s/s",        Unit::AngularAcceleration::RadianPerSquareSecond    },
@@ -211,350 +214,277 @@ inline const std::unordered_map<std::string_view, Unit::AngularAcceleration> Spe
     {"rev/hr^2",       Unit::AngularAcceleration::RevolutionPerSquareHour  },
     {"rev/hr2",        Unit::AngularAcceleration::RevolutionPerSquareHour  },
     {"rev/hr/hr",      Unit::AngularAcceleration::RevolutionPerSquareHour  },
-};
+})};
 
 // clang-format on
 
+static_assert(IsNumberOfUnitsConsistent<Unit::AngularAcceleration>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
+
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareSecond>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareSecond>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(12960000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(12960000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(180.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(180.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(180.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(180.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(648000.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(648000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(648000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(648000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(2332800000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(2332800000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(2332800000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(2332800000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10800.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(10800.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(10800.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(10800.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(38880000.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(38880000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(38880000.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(38880000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(139968000000.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(139968000000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(139968000000.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(139968000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(648000.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(648000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(648000.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(648000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(2332800000.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(2332800000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(2332800000.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(2332800000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8398080000000.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8398080000000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(8398080000000.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(8398080000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.5L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.5L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(2.0L) * Pi<NumericType>;
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(2.0L) * Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1800.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1800.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(1800.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(1800.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(6480000.0L) / Pi<NumericType>;
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(6480000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(6480000.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(6480000.0L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::AngularAcceleration,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::AngularAcceleration, NumericType>{
-      {Unit::AngularAcceleration::RadianPerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareSecond>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::RadianPerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareMinute>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::RadianPerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareHour>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::DegreePerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareSecond>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::DegreePerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareMinute>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::DegreePerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareHour>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::ArcminutePerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareSecond>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::ArcminutePerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareMinute>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::ArcminutePerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareHour>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::ArcsecondPerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareSecond>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::ArcsecondPerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareMinute>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::ArcsecondPerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareHour>::
-           FromStandard<NumericType>},
-      {Unit::AngularAcceleration::RevolutionPerSquareSecond,
-       Conversions<Unit::AngularAcceleration,
-       Unit::AngularAcceleration::RevolutionPerSquareSecond>::
-           FromStandard<NumericType>                                             },
-      {Unit::AngularAcceleration::RevolutionPerSquareMinute,
-       Conversions<Unit::AngularAcceleration,
-       Unit::AngularAcceleration::RevolutionPerSquareMinute>::
-           FromStandard<NumericType>                                             },
-      {Unit::AngularAcceleration::RevolutionPerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareHour>::
-           FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::AngularAcceleration,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::AngularAcceleration, NumericType>{
-      {Unit::AngularAcceleration::RadianPerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareSecond>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::RadianPerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareMinute>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::RadianPerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RadianPerSquareHour>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::DegreePerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareSecond>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::DegreePerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareMinute>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::DegreePerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::DegreePerSquareHour>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::ArcminutePerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareSecond>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::ArcminutePerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareMinute>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::ArcminutePerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcminutePerSquareHour>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::ArcsecondPerSquareSecond,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareSecond>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::ArcsecondPerSquareMinute,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareMinute>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::ArcsecondPerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::ArcsecondPerSquareHour>::
-           ToStandard<NumericType>      },
-      {Unit::AngularAcceleration::RevolutionPerSquareSecond,
-       Conversions<Unit::AngularAcceleration,
-       Unit::AngularAcceleration::RevolutionPerSquareSecond>::ToStandard<NumericType>},
-      {Unit::AngularAcceleration::RevolutionPerSquareMinute,
-       Conversions<Unit::AngularAcceleration,
-       Unit::AngularAcceleration::RevolutionPerSquareMinute>::ToStandard<NumericType>},
-      {Unit::AngularAcceleration::RevolutionPerSquareHour,
-       Conversions<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSquareHour>::
-           ToStandard<NumericType>      },
-};
-
 }  // namespace Internal
 
 }  // namespace PhQ
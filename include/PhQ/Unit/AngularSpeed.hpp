@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -119,6 +117,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::AngularSpeed u
 
 namespace Internal {
 
+/// \brief Number of angular speed units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::AngularSpeed>{15};
+
 template <>
 inline const std::map<UnitSystem, Unit::AngularSpeed> ConsistentUnits<Unit::AngularSpeed>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::AngularSpeed::RadianPerSecond},
@@ -152,7 +154,7 @@ inline const std::map<Unit::AngularSpeed, std::string_view> Abbreviations<Unit::
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::AngularSpeed> Spellings<Unit::AngularSpeed>{
+inline constexpr auto Spellings<Unit::AngularSpeed>{MakeSpellingTable<Unit::AngularSpeed>({
     {"rad/s",      Unit::AngularSpeed::RadianPerSecond    },
     {"rad/min",    Unit::AngularSpeed::RadianPerMinute    },
     {"rad/hr",     Unit::AngularSpeed::RadianPerHour      },
@@ -171,315 +173,252 @@ inline const std::unordered_map<std::string_view, Unit::AngularSpeed> Spellings<
     {"rev/s",      Unit::AngularSpeed::RevolutionPerSecond},
     {"rev/min",    Unit::AngularSpeed::RevolutionPerMinute},
     {"rev/hr",     Unit::AngularSpeed::RevolutionPerHour  },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerSecond>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::AngularSpeed>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerSecond>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(180.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(180.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(180.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10800.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(180.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(10800.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(10800.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(648000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(10800.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(648000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(648000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10800.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(648000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(10800.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(10800.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(648000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(10800.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(648000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(648000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(38880000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(648000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(38880000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(38880000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(648000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(38880000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(648000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(648000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(38880000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(648000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(38880000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(38880000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(2332800000.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(38880000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(2332800000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(2332800000.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.5L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(2332800000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(2.0L) * Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.5L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(30.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(2.0L) * Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(30.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(30.0L) / Pi<NumericType>);
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1800.0L) / Pi<NumericType>;
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(30.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= Pi<NumericType> / static_cast<NumericType>(1800.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1800.0L) / Pi<NumericType>);
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::AngularSpeed, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::AngularSpeed, NumericType>{
-          {Unit::AngularSpeed::RadianPerSecond,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerSecond>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::RadianPerMinute,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerMinute>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::RadianPerHour,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerHour>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::DegreePerSecond,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerSecond>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::DegreePerMinute,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerMinute>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::DegreePerHour,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerHour>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::ArcminutePerSecond,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerSecond>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::ArcminutePerMinute,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerMinute>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::ArcminutePerHour,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerHour>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::ArcsecondPerSecond,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerSecond>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::ArcsecondPerMinute,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerMinute>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::ArcsecondPerHour,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerHour>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::RevolutionPerSecond,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerSecond>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::RevolutionPerMinute,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerMinute>::
-               FromStandard<NumericType>},
-          {Unit::AngularSpeed::RevolutionPerHour,
-           Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerHour>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::AngularSpeed,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::AngularSpeed, NumericType>{
-      {Unit::AngularSpeed::RadianPerSecond,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerSecond>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::RadianPerMinute,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerMinute>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::RadianPerHour,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RadianPerHour>::ToStandard<NumericType>},
-      {Unit::AngularSpeed::DegreePerSecond,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerSecond>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::DegreePerMinute,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerMinute>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::DegreePerHour,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::DegreePerHour>::ToStandard<NumericType>},
-      {Unit::AngularSpeed::ArcminutePerSecond,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerSecond>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::ArcminutePerMinute,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerMinute>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::ArcminutePerHour,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcminutePerHour>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::ArcsecondPerSecond,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerSecond>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::ArcsecondPerMinute,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerMinute>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::ArcsecondPerHour,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::ArcsecondPerHour>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::RevolutionPerSecond,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerSecond>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::RevolutionPerMinute,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerMinute>::
-           ToStandard<NumericType>                          },
-      {Unit::AngularSpeed::RevolutionPerHour,
-       Conversions<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerHour>::
-           ToStandard<NumericType>                          },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> / static_cast<NumericType>(1800.0L));
+}
 
 }  // namespace Internal
 
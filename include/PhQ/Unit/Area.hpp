@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -118,6 +116,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Area unit) {
 
 namespace Internal {
 
+/// \brief Number of area units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Area>{15};
+
 template <>
 inline const std::map<UnitSystem, Unit::Area> ConsistentUnits<Unit::Area>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Area::SquareMetre     },
@@ -156,7 +158,7 @@ inline const std::map<Unit::Area, std::string_view> Abbreviations<Unit::Area>{
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Area> Spellings<Unit::Area>{
+inline constexpr auto Spellings<Unit::Area>{MakeSpellingTable<Unit::Area>({
     {"m^2",         Unit::Area::SquareMetre       },
     {"m2",          Unit::Area::SquareMetre       },
     {"nmi^2",       Unit::Area::SquareNauticalMile},
@@ -197,284 +199,240 @@ inline const std::unordered_map<std::string_view, Unit::Area> Spellings<Unit::Ar
     {"μin2",        Unit::Area::SquareMicroinch   },
     {"uin^2",       Unit::Area::SquareMicroinch   },
     {"uin2",        Unit::Area::SquareMicroinch   },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMetre>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Area>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMetre>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareNauticalMile>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareNauticalMile>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Area, Unit::Area::SquareNauticalMile>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMile>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Area, Unit::Area::SquareNauticalMile>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMile>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMile>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareKilometre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMile>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareKilometre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareKilometre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::Hectare>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareKilometre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::Hectare>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::Hectare>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::Acre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(640.0L)
-           / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::Hectare>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::Acre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-           / static_cast<NumericType>(640.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::Acre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(640.0L)
+      / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareYard>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::Acre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      / static_cast<NumericType>(640.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareYard>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareYard>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareFoot>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareYard>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareFoot>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareFoot>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareDecimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(100.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareFoot>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareDecimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.01L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareDecimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(100.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareInch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareDecimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.01L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareInch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareInch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareCentimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareInch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareCentimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareCentimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMillimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareCentimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMillimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMillimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMilliinch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMillimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMilliinch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMilliinch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMicrometre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMilliinch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMicrometre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMicrometre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMicroinch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMicrometre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMicroinch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMicroinch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Area, std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Area, NumericType>{
-      {Unit::Area::SquareMetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMetre>::FromStandard<NumericType>       },
-      {Unit::Area::SquareNauticalMile,
-       Conversions<Unit::Area,                                 Unit::Area::SquareNauticalMile>::FromStandard<NumericType>},
-      {Unit::Area::SquareMile,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMile>::FromStandard<NumericType>        },
-      {Unit::Area::SquareKilometre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareKilometre>::FromStandard<NumericType>   },
-      {Unit::Area::Hectare,
-       Conversions<Unit::Area,                                 Unit::Area::Hectare>::FromStandard<NumericType>           },
-      {Unit::Area::Acre,               Conversions<Unit::Area, Unit::Area::Acre>::FromStandard<NumericType>              },
-      {Unit::Area::SquareYard,
-       Conversions<Unit::Area,                                 Unit::Area::SquareYard>::FromStandard<NumericType>        },
-      {Unit::Area::SquareFoot,
-       Conversions<Unit::Area,                                 Unit::Area::SquareFoot>::FromStandard<NumericType>        },
-      {Unit::Area::SquareDecimetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareDecimetre>::FromStandard<NumericType>   },
-      {Unit::Area::SquareInch,
-       Conversions<Unit::Area,                                 Unit::Area::SquareInch>::FromStandard<NumericType>        },
-      {Unit::Area::SquareCentimetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareCentimetre>::FromStandard<NumericType>  },
-      {Unit::Area::SquareMillimetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMillimetre>::FromStandard<NumericType>  },
-      {Unit::Area::SquareMilliinch,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMilliinch>::FromStandard<NumericType>   },
-      {Unit::Area::SquareMicrometre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMicrometre>::FromStandard<NumericType>  },
-      {Unit::Area::SquareMicroinch,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMicroinch>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Area, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Area, NumericType>{
-      {Unit::Area::SquareMetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMetre>::ToStandard<NumericType>       },
-      {Unit::Area::SquareNauticalMile,
-       Conversions<Unit::Area,                                 Unit::Area::SquareNauticalMile>::ToStandard<NumericType>},
-      {Unit::Area::SquareMile,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMile>::ToStandard<NumericType>        },
-      {Unit::Area::SquareKilometre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareKilometre>::ToStandard<NumericType>   },
-      {Unit::Area::Hectare,            Conversions<Unit::Area, Unit::Area::Hectare>::ToStandard<NumericType>           },
-      {Unit::Area::Acre,               Conversions<Unit::Area, Unit::Area::Acre>::ToStandard<NumericType>              },
-      {Unit::Area::SquareYard,
-       Conversions<Unit::Area,                                 Unit::Area::SquareYard>::ToStandard<NumericType>        },
-      {Unit::Area::SquareFoot,
-       Conversions<Unit::Area,                                 Unit::Area::SquareFoot>::ToStandard<NumericType>        },
-      {Unit::Area::SquareDecimetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareDecimetre>::ToStandard<NumericType>   },
-      {Unit::Area::SquareInch,
-       Conversions<Unit::Area,                                 Unit::Area::SquareInch>::ToStandard<NumericType>        },
-      {Unit::Area::SquareCentimetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareCentimetre>::ToStandard<NumericType>  },
-      {Unit::Area::SquareMillimetre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMillimetre>::ToStandard<NumericType>  },
-      {Unit::Area::SquareMilliinch,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMilliinch>::ToStandard<NumericType>   },
-      {Unit::Area::SquareMicrometre,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMicrometre>::ToStandard<NumericType>  },
-      {Unit::Area::SquareMicroinch,
-       Conversions<Unit::Area,                                 Unit::Area::SquareMicroinch>::ToStandard<NumericType>   },
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Area, Unit::Area::SquareMicroinch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L));
+}
 
 }  // namespace Internal
 
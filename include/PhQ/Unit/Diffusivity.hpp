@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -119,6 +117,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Diffusivity un
 
 namespace Internal {
 
+/// \brief Number of diffusivity units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Diffusivity>{15};
+
 template <>
 inline const std::map<UnitSystem, Unit::Diffusivity> ConsistentUnits<Unit::Diffusivity>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Diffusivity::SquareMetrePerSecond     },
@@ -157,7 +159,7 @@ inline const std::map<Unit::Diffusivity, std::string_view> Abbreviations<Unit::D
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Diffusivity> Spellings<Unit::Diffusivity>{
+inline constexpr auto Spellings<Unit::Diffusivity>{MakeSpellingTable<Unit::Diffusivity>({
     {"m^2/s",         Unit::Diffusivity::SquareMetrePerSecond       },
     {"m2/s",          Unit::Diffusivity::SquareMetrePerSecond       },
     {"nmi^2/s",       Unit::Diffusivity::SquareNauticalMilePerSecond},
@@ -196,319 +198,257 @@ inline const std::unordered_map<std::string_view, Unit::Diffusivity> Spellings<U
     {"μin2/s",        Unit::Diffusivity::SquareMicroinchPerSecond   },
     {"uin^2/s",       Unit::Diffusivity::SquareMicroinchPerSecond   },
     {"uin2/s",        Unit::Diffusivity::SquareMicroinchPerSecond   },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMetrePerSecond>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Diffusivity>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMetrePerSecond>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareNauticalMilePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMetrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareNauticalMilePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareNauticalMilePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareNauticalMilePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareKilometrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareKilometrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareKilometrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::HectarePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareKilometrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::HectarePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::HectarePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::AcrePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(640.0L)
-           / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::HectarePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::AcrePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-           / static_cast<NumericType>(640.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::AcrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(640.0L)
+      / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareYardPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::AcrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      / static_cast<NumericType>(640.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareYardPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareYardPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareFootPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareYardPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareFootPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareFootPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareDecimetrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(100.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareFootPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareDecimetrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.01L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareDecimetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(100.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareInchPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareDecimetrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.01L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareInchPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareInchPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareCentimetrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareInchPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareCentimetrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareCentimetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMillimetrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareCentimetrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMillimetrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMillimetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilliinchPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMillimetrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilliinchPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilliinchPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicrometrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMilliinchPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicrometrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicrometrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicroinchPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicrometrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicroinchPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicroinchPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Diffusivity,
-                      std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Diffusivity, NumericType>{
-      {Unit::Diffusivity::SquareMetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareNauticalMilePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareNauticalMilePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMilePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMilePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareKilometrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareKilometrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::HectarePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::HectarePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::AcrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::AcrePerSecond>::FromStandard<NumericType>},
-      {Unit::Diffusivity::SquareYardPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareYardPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareFootPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareFootPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareDecimetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareDecimetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareInchPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareInchPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareCentimetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareCentimetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMillimetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMillimetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMilliinchPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMilliinchPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMicrometrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMicrometrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMicroinchPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMicroinchPerSecond>::
-           FromStandard<NumericType>                         },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Diffusivity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Diffusivity, NumericType>{
-      {Unit::Diffusivity::SquareMetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMetrePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareNauticalMilePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareNauticalMilePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMilePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMilePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareKilometrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareKilometrePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::HectarePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::HectarePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::AcrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::AcrePerSecond>::ToStandard<NumericType>},
-      {Unit::Diffusivity::SquareYardPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareYardPerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareFootPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareFootPerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareDecimetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareDecimetrePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareInchPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareInchPerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareCentimetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareCentimetrePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMillimetrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMillimetrePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMilliinchPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMilliinchPerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMicrometrePerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMicrometrePerSecond>::
-           ToStandard<NumericType>                         },
-      {Unit::Diffusivity::SquareMicroinchPerSecond,
-       Conversions<Unit::Diffusivity, Unit::Diffusivity::SquareMicroinchPerSecond>::
-           ToStandard<NumericType>                         },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicroinchPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -95,6 +93,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::DynamicViscosi
 
 namespace Internal {
 
+/// \brief Number of dynamic viscosity units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::DynamicViscosity>{7};
+
 template <>
 inline const std::map<UnitSystem, Unit::DynamicViscosity> ConsistentUnits<Unit::DynamicViscosity>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::DynamicViscosity::PascalSecond            },
@@ -125,8 +127,9 @@ inline const std::map<Unit::DynamicViscosity, std::string_view>
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::DynamicViscosity> Spellings<
-    Unit::DynamicViscosity>{
+inline constexpr auto Spellings<
+    Unit::DynamicViscosity>{MakeSpellingTable<
+    Unit::DynamicViscosity>({
     {"Pa·s",       Unit::DynamicViscosity::PascalSecond            },
     {"Pa*s",       Unit::DynamicViscosity::PascalSecond            },
     {"N·s/m^2",    Unit::DynamicViscosity::PascalSecond            },
@@ -145,8 +148,8 @@ inline const std::unordered_map<std::string_view, Unit::DynamicViscosity> Spelli
     {"MPa·s",      Unit::DynamicViscosity::MegapascalSecond        },
     {"MPa*s",      Unit::DynamicViscosity::MegapascalSecond        },
     {"N·s/mm^2",   Unit::DynamicViscosity::MegapascalSecond        },
-    {"N·s/mm^2",   Unit::DynamicViscosity::MegapascalSecond        },
-    {"N*s/mm2",    Unit::DynamicViscosity::MegapascalSecond        },
+    {"N·s/mm2",    Unit::DynamicViscosity::MegapascalSecond        },
+    {"N*s/mm^2",   Unit::DynamicViscosity::MegapascalSecond        },
     {"N*s/mm2",    Unit::DynamicViscosity::MegapascalSecond        },
     {"MN·s/m^2",   Unit::DynamicViscosity::MegapascalSecond        },
     {"MN·s/m2",    Unit::DynamicViscosity::MegapascalSecond        },
@@ -183,164 +186,130 @@ inline const std::unordered_map<std::string_view, Unit::DynamicViscosity> Spelli
     {"lb*s/in2",   Unit::DynamicViscosity::PoundSecondPerSquareInch},
     {"psi·s",      Unit::DynamicViscosity::PoundSecondPerSquareInch},
     {"psi*s",      Unit::DynamicViscosity::PoundSecondPerSquareInch},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PascalSecond>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::DynamicViscosity>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PascalSecond>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PascalSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::KilopascalSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PascalSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::KilopascalSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::KilopascalSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::MegapascalSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::KilopascalSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::MegapascalSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::MegapascalSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::GigapascalSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::MegapascalSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::GigapascalSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::GigapascalSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::Poise>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::GigapascalSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::Poise>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.1L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::Poise>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareFoot>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::Poise>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.1L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareFoot>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareFoot>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareInch>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareFoot>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareInch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareInch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::DynamicViscosity, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::DynamicViscosity, NumericType>{
-          {Unit::DynamicViscosity::PascalSecond,
-           Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::PascalSecond>::
-               FromStandard<NumericType>},
-          {Unit::DynamicViscosity::KilopascalSecond,
-           Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::KilopascalSecond>::
-               FromStandard<NumericType>},
-          {Unit::DynamicViscosity::MegapascalSecond,
-           Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::MegapascalSecond>::
-               FromStandard<NumericType>},
-          {Unit::DynamicViscosity::GigapascalSecond,
-           Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::GigapascalSecond>::
-               FromStandard<NumericType>},
-          {Unit::DynamicViscosity::Poise,
-           Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::Poise>::
-               FromStandard<NumericType>},
-          {Unit::DynamicViscosity::PoundSecondPerSquareFoot,
-           Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareFoot>::
-               FromStandard<NumericType>},
-          {Unit::DynamicViscosity::PoundSecondPerSquareInch,
-           Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareInch>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::DynamicViscosity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::DynamicViscosity, NumericType>{
-      {Unit::DynamicViscosity::PascalSecond,
-       Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::PascalSecond>::
-           ToStandard<NumericType>                      },
-      {Unit::DynamicViscosity::KilopascalSecond,
-       Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::KilopascalSecond>::
-           ToStandard<NumericType>                      },
-      {Unit::DynamicViscosity::MegapascalSecond,
-       Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::MegapascalSecond>::
-           ToStandard<NumericType>                      },
-      {Unit::DynamicViscosity::GigapascalSecond,
-       Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::GigapascalSecond>::
-           ToStandard<NumericType>                      },
-      {Unit::DynamicViscosity::Poise,
-       Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::Poise>::ToStandard<NumericType>},
-      {Unit::DynamicViscosity::PoundSecondPerSquareFoot,
-       Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareFoot>::
-           ToStandard<NumericType>                      },
-      {Unit::DynamicViscosity::PoundSecondPerSquareInch,
-       Conversions<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareInch>::
-           ToStandard<NumericType>                      },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareInch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -149,6 +147,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ElectricCharge
 
 namespace Internal {
 
+/// \brief Number of electric charge units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ElectricCharge>{25};
+
 template <>
 inline const std::map<UnitSystem, Unit::ElectricCharge> ConsistentUnits<Unit::ElectricCharge>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::ElectricCharge::Coulomb},
@@ -192,8 +194,9 @@ inline const std::map<Unit::ElectricCharge, std::string_view> Abbreviations<Unit
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::ElectricCharge> Spellings<
-    Unit::ElectricCharge>{
+inline constexpr auto Spellings<
+    Unit::ElectricCharge>{MakeSpellingTable<
+    Unit::ElectricCharge>({
     {"C",      Unit::ElectricCharge::Coulomb          },
     {"kC",     Unit::ElectricCharge::Kilocoulomb      },
     {"MC",     Unit::ElectricCharge::Megacoulomb      },
@@ -240,515 +243,385 @@ inline const std::unordered_map<std::string_view, Unit::ElectricCharge> Spelling
     {"nA*min", Unit::ElectricCharge::NanoampereMinute },
     {"nA·hr",  Unit::ElectricCharge::NanoampereHour   },
     {"nA*hr",  Unit::ElectricCharge::NanoampereHour   },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Coulomb>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::ElectricCharge>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Coulomb>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Coulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Kilocoulomb>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Coulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Kilocoulomb>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Kilocoulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Megacoulomb>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Kilocoulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Megacoulomb>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Megacoulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Gigacoulomb>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Megacoulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Gigacoulomb>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Gigacoulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Teracoulomb>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Gigacoulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Teracoulomb>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Teracoulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Millicoulomb>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Teracoulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Millicoulomb>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Millicoulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Microcoulomb>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Millicoulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Microcoulomb>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Microcoulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Nanocoulomb>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Microcoulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Nanocoulomb>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Nanocoulomb>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::ElementaryCharge>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634E-19L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::Nanocoulomb>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::ElementaryCharge>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634E-19L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::ElementaryCharge>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634E-19L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::ElementaryCharge>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634E-19L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::AmpereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.06L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.06L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.06L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3.6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.06L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3.6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3.6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(6.0E-5L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3.6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(6.0E-5L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(6.0E-5L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3.6E-3L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(6.0E-5L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3.6E-3L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3.6E-3L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(6.0E-8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3.6E-3L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(6.0E-8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(6.0E-8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereHour>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3.6E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(6.0E-8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3.6E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3.6E-6L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::ElectricCharge,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::ElectricCharge, NumericType>{
-      {Unit::ElectricCharge::Coulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Coulomb>::FromStandard<NumericType>},
-      {Unit::ElectricCharge::Kilocoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Kilocoulomb>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::Megacoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Megacoulomb>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::Gigacoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Gigacoulomb>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::Teracoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Teracoulomb>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::Millicoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Millicoulomb>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::Microcoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Microcoulomb>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::Nanocoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Nanocoulomb>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::ElementaryCharge,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::ElementaryCharge>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::AmpereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::AmpereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::AmpereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::AmpereHour>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::KiloampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::KiloampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereHour>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::MegaampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::MegaampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereHour>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::GigaampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::GigaampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereHour>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::TeraampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::TeraampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereHour>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::MilliampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::MilliampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereHour>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::MicroampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::MicroampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereHour>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::NanoampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereMinute>::
-           FromStandard<NumericType>                      },
-      {Unit::ElectricCharge::NanoampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereHour>::
-           FromStandard<NumericType>                      },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ElectricCharge,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ElectricCharge, NumericType>{
-      {Unit::ElectricCharge::Coulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Coulomb>::ToStandard<NumericType>},
-      {Unit::ElectricCharge::Kilocoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Kilocoulomb>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::Megacoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Megacoulomb>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::Gigacoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Gigacoulomb>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::Teracoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Teracoulomb>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::Millicoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Millicoulomb>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::Microcoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Microcoulomb>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::Nanocoulomb,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Nanocoulomb>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::ElementaryCharge,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::ElementaryCharge>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::AmpereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::AmpereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::AmpereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::AmpereHour>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::KiloampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::KiloampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::KiloampereHour>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::MegaampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::MegaampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MegaampereHour>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::GigaampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::GigaampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::GigaampereHour>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::TeraampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::TeraampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::TeraampereHour>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::MilliampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::MilliampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MilliampereHour>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::MicroampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::MicroampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::MicroampereHour>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::NanoampereMinute,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCharge::NanoampereHour,
-       Conversions<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereHour>::
-           ToStandard<NumericType>                      },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3.6E-6L));
+}
 
 }  // namespace Internal
 
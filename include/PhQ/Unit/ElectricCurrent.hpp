@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -107,6 +105,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ElectricCurren
 
 namespace Internal {
 
+/// \brief Number of electric current units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ElectricCurrent>{11};
+
 template <>
 inline const std::map<UnitSystem, Unit::ElectricCurrent> ConsistentUnits<Unit::ElectricCurrent>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::ElectricCurrent::Ampere},
@@ -137,8 +139,7 @@ inline const std::map<Unit::ElectricCurrent, std::string_view> Abbreviations<Uni
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::ElectricCurrent>
-    Spellings<Unit::ElectricCurrent>{
+inline constexpr auto Spellings<Unit::ElectricCurrent>{MakeSpellingTable<Unit::ElectricCurrent>({
         {"A",     Unit::ElectricCurrent::Ampere                   },
         {"kA",    Unit::ElectricCurrent::Kiloampere               },
         {"MA",    Unit::ElectricCurrent::Megaampere               },
@@ -151,242 +152,176 @@ inline const std::unordered_map<std::string_view, Unit::ElectricCurrent>
         {"e/s",   Unit::ElectricCurrent::ElementaryChargePerSecond},
         {"e/min", Unit::ElectricCurrent::ElementaryChargePerMinute},
         {"e/hr",  Unit::ElectricCurrent::ElementaryChargePerHour  },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Ampere>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::ElectricCurrent>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Ampere>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Ampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Kiloampere>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Ampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Kiloampere>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Kiloampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Megaampere>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Kiloampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Megaampere>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Megaampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Gigaampere>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Megaampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Gigaampere>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Gigaampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Teraampere>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Gigaampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Teraampere>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Teraampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Milliampere>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Teraampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Milliampere>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Milliampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Microampere>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Milliampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Microampere>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Microampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Nanoampere>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Microampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Nanoampere>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Nanoampere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634E-19L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::Nanoampere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634E-19L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634E-19L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.602176634E-19L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634E-19L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634E-19L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.602176634E-19L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.602176634E-19L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.602176634E-19L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634E-19L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.602176634E-19L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::ElectricCurrent, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::ElectricCurrent, NumericType>{
-          {Unit::ElectricCurrent::Ampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Ampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::Kiloampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Kiloampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::Megaampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Megaampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::Gigaampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Gigaampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::Teraampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Teraampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::Milliampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Milliampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::Microampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Microampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::Nanoampere,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Nanoampere>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::ElementaryChargePerSecond,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerSecond>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::ElementaryChargePerMinute,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerMinute>::
-               FromStandard<NumericType>},
-          {Unit::ElectricCurrent::ElementaryChargePerHour,
-           Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerHour>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ElectricCurrent,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ElectricCurrent, NumericType>{
-      {Unit::ElectricCurrent::Ampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Ampere>::ToStandard<NumericType>},
-      {Unit::ElectricCurrent::Kiloampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Kiloampere>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::Megaampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Megaampere>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::Gigaampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Gigaampere>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::Teraampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Teraampere>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::Milliampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Milliampere>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::Microampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Microampere>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::Nanoampere,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::Nanoampere>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::ElementaryChargePerSecond,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerSecond>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::ElementaryChargePerMinute,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerMinute>::
-           ToStandard<NumericType>                      },
-      {Unit::ElectricCurrent::ElementaryChargePerHour,
-       Conversions<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerHour>::
-           ToStandard<NumericType>                      },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.602176634E-19L) / static_cast<NumericType>(3600.0L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -169,6 +167,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Energy unit) {
 
 namespace Internal {
 
+/// \brief Number of energy units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Energy>{32};
+
 template <>
 inline const std::map<UnitSystem, Unit::Energy> ConsistentUnits<Unit::Energy>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Energy::Joule    },
@@ -224,7 +226,7 @@ inline const std::map<Unit::Energy, std::string_view> Abbreviations<Unit::Energy
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Energy> Spellings<Unit::Energy>{
+inline constexpr auto Spellings<Unit::Energy>{MakeSpellingTable<Unit::Energy>({
     {"J",          Unit::Energy::Joule             },
     {"N·m",        Unit::Energy::Joule             },
     {"N*m",        Unit::Energy::Joule             },
@@ -292,599 +294,472 @@ inline const std::unordered_map<std::string_view, Unit::Energy> Spellings<Unit::
     {"GeV",        Unit::Energy::Gigaelectronvolt  },
     {"BTU",        Unit::Energy::BritishThermalUnit},
     {"btu",        Unit::Energy::BritishThermalUnit},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Joule>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Energy>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Joule>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Joule>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Millijoule>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Joule>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Millijoule>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Millijoule>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Microjoule>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Millijoule>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Microjoule>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Microjoule>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Nanojoule>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Microjoule>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Nanojoule>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Nanojoule>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Kilojoule>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Nanojoule>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Kilojoule>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Kilojoule>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Megajoule>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Kilojoule>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Megajoule>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Megajoule>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Gigajoule>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Megajoule>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Gigajoule>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Gigajoule>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::WattMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Gigajoule>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::WattMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::WattMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::WattHour>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::WattMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::WattHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::WattHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::KilowattMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::WattHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::KilowattMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::KilowattMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::KilowattHour>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::KilowattMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::KilowattHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::KilowattHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::MegawattMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::KilowattHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::MegawattMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::MegawattMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::MegawattHour>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::MegawattMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::MegawattHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::MegawattHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::GigawattMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::MegawattHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::GigawattMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::GigawattMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::GigawattHour>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::GigawattMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::GigawattHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::GigawattHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::FootPound>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
-            * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::GigawattHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::FootPound>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::FootPound>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::InchPound>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
-            * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::FootPound>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::InchPound>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::InchPound>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Calorie>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(4.184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::InchPound>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Calorie>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(4.184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Calorie>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(4.184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Millicalorie>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.004184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Calorie>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(4.184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Millicalorie>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.004184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Millicalorie>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.004184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Microcalorie>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.000004184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Millicalorie>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.004184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Microcalorie>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000004184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Microcalorie>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.000004184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Nanocalorie>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.000000004184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Microcalorie>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000004184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Nanocalorie>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000004184L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Nanocalorie>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.000000004184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Kilocalorie>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(4184.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Nanocalorie>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000004184L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Kilocalorie>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(4184.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Kilocalorie>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(4184.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Megacalorie>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(4184000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Kilocalorie>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(4184.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Megacalorie>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(4184000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Megacalorie>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(4184000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Gigacalorie>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(4184000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Megacalorie>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(4184000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Gigacalorie>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(4184000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Gigacalorie>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(4184000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Electronvolt>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634e-19L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Gigacalorie>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(4184000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Electronvolt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634e-19L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Electronvolt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634e-19L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Millielectronvolt>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634e-22L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Energy, Unit::Energy::Electronvolt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634e-19L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Millielectronvolt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634e-22L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Millielectronvolt>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634e-22L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Microelectronvolt>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634e-25L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Millielectronvolt>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634e-22L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Microelectronvolt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634e-25L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Microelectronvolt>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634e-25L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Nanoelectronvolt>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634e-28L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Microelectronvolt>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634e-25L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Nanoelectronvolt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634e-28L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Nanoelectronvolt>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634e-28L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Kiloelectronvolt>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634e-16L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Nanoelectronvolt>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634e-28L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Kiloelectronvolt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634e-16L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Kiloelectronvolt>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634e-16L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Megaelectronvolt>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634e-13L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Kiloelectronvolt>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634e-16L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Megaelectronvolt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634e-13L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Megaelectronvolt>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634e-13L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Gigaelectronvolt>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.602176634e-10L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Megaelectronvolt>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634e-13L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::Gigaelectronvolt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.602176634e-10L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Gigaelectronvolt>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.602176634e-10L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::BritishThermalUnit>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L)
-           / (static_cast<NumericType>(4.1868L) * static_cast<NumericType>(453.59237L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::Gigaelectronvolt>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.602176634e-10L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Energy, Unit::Energy::BritishThermalUnit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(4.1868L) * static_cast<NumericType>(453.59237L)
-           / static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::BritishThermalUnit>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.8L)
+      / (static_cast<NumericType>(4.1868L) * static_cast<NumericType>(453.59237L)));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Energy,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Energy, NumericType>{
-      {Unit::Energy::Joule,
-       Conversions<Unit::Energy, Unit::Energy::Joule>::FromStandard<NumericType>             },
-      {Unit::Energy::Millijoule,
-       Conversions<Unit::Energy, Unit::Energy::Millijoule>::FromStandard<NumericType>        },
-      {Unit::Energy::Microjoule,
-       Conversions<Unit::Energy, Unit::Energy::Microjoule>::FromStandard<NumericType>        },
-      {Unit::Energy::Nanojoule,
-       Conversions<Unit::Energy, Unit::Energy::Nanojoule>::FromStandard<NumericType>         },
-      {Unit::Energy::Kilojoule,
-       Conversions<Unit::Energy, Unit::Energy::Kilojoule>::FromStandard<NumericType>         },
-      {Unit::Energy::Megajoule,
-       Conversions<Unit::Energy, Unit::Energy::Megajoule>::FromStandard<NumericType>         },
-      {Unit::Energy::Gigajoule,
-       Conversions<Unit::Energy, Unit::Energy::Gigajoule>::FromStandard<NumericType>         },
-      {Unit::Energy::WattMinute,
-       Conversions<Unit::Energy, Unit::Energy::WattMinute>::FromStandard<NumericType>        },
-      {Unit::Energy::WattHour,
-       Conversions<Unit::Energy, Unit::Energy::WattHour>::FromStandard<NumericType>          },
-      {Unit::Energy::KilowattMinute,
-       Conversions<Unit::Energy, Unit::Energy::KilowattMinute>::FromStandard<NumericType>    },
-      {Unit::Energy::KilowattHour,
-       Conversions<Unit::Energy, Unit::Energy::KilowattHour>::FromStandard<NumericType>      },
-      {Unit::Energy::MegawattMinute,
-       Conversions<Unit::Energy, Unit::Energy::MegawattMinute>::FromStandard<NumericType>    },
-      {Unit::Energy::MegawattHour,
-       Conversions<Unit::Energy, Unit::Energy::MegawattHour>::FromStandard<NumericType>      },
-      {Unit::Energy::GigawattMinute,
-       Conversions<Unit::Energy, Unit::Energy::GigawattMinute>::FromStandard<NumericType>    },
-      {Unit::Energy::GigawattHour,
-       Conversions<Unit::Energy, Unit::Energy::GigawattHour>::FromStandard<NumericType>      },
-      {Unit::Energy::FootPound,
-       Conversions<Unit::Energy, Unit::Energy::FootPound>::FromStandard<NumericType>         },
-      {Unit::Energy::InchPound,
-       Conversions<Unit::Energy, Unit::Energy::InchPound>::FromStandard<NumericType>         },
-      {Unit::Energy::Calorie,
-       Conversions<Unit::Energy, Unit::Energy::Calorie>::FromStandard<NumericType>           },
-      {Unit::Energy::Millicalorie,
-       Conversions<Unit::Energy, Unit::Energy::Millicalorie>::FromStandard<NumericType>      },
-      {Unit::Energy::Microcalorie,
-       Conversions<Unit::Energy, Unit::Energy::Microcalorie>::FromStandard<NumericType>      },
-      {Unit::Energy::Nanocalorie,
-       Conversions<Unit::Energy, Unit::Energy::Nanocalorie>::FromStandard<NumericType>       },
-      {Unit::Energy::Kilocalorie,
-       Conversions<Unit::Energy, Unit::Energy::Kilocalorie>::FromStandard<NumericType>       },
-      {Unit::Energy::Megacalorie,
-       Conversions<Unit::Energy, Unit::Energy::Megacalorie>::FromStandard<NumericType>       },
-      {Unit::Energy::Gigacalorie,
-       Conversions<Unit::Energy, Unit::Energy::Gigacalorie>::FromStandard<NumericType>       },
-      {Unit::Energy::Electronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Electronvolt>::FromStandard<NumericType>      },
-      {Unit::Energy::Millielectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Millielectronvolt>::FromStandard<NumericType> },
-      {Unit::Energy::Microelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Microelectronvolt>::FromStandard<NumericType> },
-      {Unit::Energy::Nanoelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Nanoelectronvolt>::FromStandard<NumericType>  },
-      {Unit::Energy::Kiloelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Kiloelectronvolt>::FromStandard<NumericType>  },
-      {Unit::Energy::Megaelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Megaelectronvolt>::FromStandard<NumericType>  },
-      {Unit::Energy::Gigaelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Gigaelectronvolt>::FromStandard<NumericType>  },
-      {Unit::Energy::BritishThermalUnit,
-       Conversions<Unit::Energy, Unit::Energy::BritishThermalUnit>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Energy,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Energy, NumericType>{
-      {Unit::Energy::Joule,
-       Conversions<Unit::Energy, Unit::Energy::Joule>::ToStandard<NumericType>             },
-      {Unit::Energy::Millijoule,
-       Conversions<Unit::Energy, Unit::Energy::Millijoule>::ToStandard<NumericType>        },
-      {Unit::Energy::Microjoule,
-       Conversions<Unit::Energy, Unit::Energy::Microjoule>::ToStandard<NumericType>        },
-      {Unit::Energy::Nanojoule,
-       Conversions<Unit::Energy, Unit::Energy::Nanojoule>::ToStandard<NumericType>         },
-      {Unit::Energy::Kilojoule,
-       Conversions<Unit::Energy, Unit::Energy::Kilojoule>::ToStandard<NumericType>         },
-      {Unit::Energy::Megajoule,
-       Conversions<Unit::Energy, Unit::Energy::Megajoule>::ToStandard<NumericType>         },
-      {Unit::Energy::Gigajoule,
-       Conversions<Unit::Energy, Unit::Energy::Gigajoule>::ToStandard<NumericType>         },
-      {Unit::Energy::WattMinute,
-       Conversions<Unit::Energy, Unit::Energy::WattMinute>::ToStandard<NumericType>        },
-      {Unit::Energy::WattHour,
-       Conversions<Unit::Energy, Unit::Energy::WattHour>::ToStandard<NumericType>          },
-      {Unit::Energy::KilowattMinute,
-       Conversions<Unit::Energy, Unit::Energy::KilowattMinute>::ToStandard<NumericType>    },
-      {Unit::Energy::KilowattHour,
-       Conversions<Unit::Energy, Unit::Energy::KilowattHour>::ToStandard<NumericType>      },
-      {Unit::Energy::MegawattMinute,
-       Conversions<Unit::Energy, Unit::Energy::MegawattMinute>::ToStandard<NumericType>    },
-      {Unit::Energy::MegawattHour,
-       Conversions<Unit::Energy, Unit::Energy::MegawattHour>::ToStandard<NumericType>      },
-      {Unit::Energy::GigawattMinute,
-       Conversions<Unit::Energy, Unit::Energy::GigawattMinute>::ToStandard<NumericType>    },
-      {Unit::Energy::GigawattHour,
-       Conversions<Unit::Energy, Unit::Energy::GigawattHour>::ToStandard<NumericType>      },
-      {Unit::Energy::FootPound,
-       Conversions<Unit::Energy, Unit::Energy::FootPound>::ToStandard<NumericType>         },
-      {Unit::Energy::InchPound,
-       Conversions<Unit::Energy, Unit::Energy::InchPound>::ToStandard<NumericType>         },
-      {Unit::Energy::Calorie,
-       Conversions<Unit::Energy, Unit::Energy::Calorie>::ToStandard<NumericType>           },
-      {Unit::Energy::Millicalorie,
-       Conversions<Unit::Energy, Unit::Energy::Millicalorie>::ToStandard<NumericType>      },
-      {Unit::Energy::Microcalorie,
-       Conversions<Unit::Energy, Unit::Energy::Microcalorie>::ToStandard<NumericType>      },
-      {Unit::Energy::Nanocalorie,
-       Conversions<Unit::Energy, Unit::Energy::Nanocalorie>::ToStandard<NumericType>       },
-      {Unit::Energy::Kilocalorie,
-       Conversions<Unit::Energy, Unit::Energy::Kilocalorie>::ToStandard<NumericType>       },
-      {Unit::Energy::Megacalorie,
-       Conversions<Unit::Energy, Unit::Energy::Megacalorie>::ToStandard<NumericType>       },
-      {Unit::Energy::Gigacalorie,
-       Conversions<Unit::Energy, Unit::Energy::Gigacalorie>::ToStandard<NumericType>       },
-      {Unit::Energy::Electronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Electronvolt>::ToStandard<NumericType>      },
-      {Unit::Energy::Millielectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Millielectronvolt>::ToStandard<NumericType> },
-      {Unit::Energy::Microelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Microelectronvolt>::ToStandard<NumericType> },
-      {Unit::Energy::Nanoelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Nanoelectronvolt>::ToStandard<NumericType>  },
-      {Unit::Energy::Kiloelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Kiloelectronvolt>::ToStandard<NumericType>  },
-      {Unit::Energy::Megaelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Megaelectronvolt>::ToStandard<NumericType>  },
-      {Unit::Energy::Gigaelectronvolt,
-       Conversions<Unit::Energy, Unit::Energy::Gigaelectronvolt>::ToStandard<NumericType>  },
-      {Unit::Energy::BritishThermalUnit,
-       Conversions<Unit::Energy, Unit::Energy::BritishThermalUnit>::ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Energy, Unit::Energy::BritishThermalUnit>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(4.1868L) * static_cast<NumericType>(453.59237L)
+      / static_cast<NumericType>(1.8L));
+}
 
 }  // namespace Internal
 
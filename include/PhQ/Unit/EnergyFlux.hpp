@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -86,6 +84,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::EnergyFlux uni
 
 namespace Internal {
 
+/// \brief Number of energy flux units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::EnergyFlux>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::EnergyFlux> ConsistentUnits<Unit::EnergyFlux>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::EnergyFlux::WattPerSquareMetre             },
@@ -113,7 +115,7 @@ inline const std::map<Unit::EnergyFlux, std::string_view> Abbreviations<Unit::En
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::EnergyFlux> Spellings<Unit::EnergyFlux>{
+inline constexpr auto Spellings<Unit::EnergyFlux>{MakeSpellingTable<Unit::EnergyFlux>({
     {"W/m^2",           Unit::EnergyFlux::WattPerSquareMetre             },
     {"W/m2",            Unit::EnergyFlux::WattPerSquareMetre             },
     {"J/(m^2·s)",       Unit::EnergyFlux::WattPerSquareMetre             },
@@ -169,105 +171,82 @@ inline const std::unordered_map<std::string_view, Unit::EnergyFlux> Spellings<Un
     {"lbf/in/s",        Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
     {"slinch/s^3",      Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
     {"slinch/s3",       Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::EnergyFlux, Unit::EnergyFlux::WattPerSquareMetre>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::EnergyFlux>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::EnergyFlux, Unit::EnergyFlux::WattPerSquareMetre>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::WattPerSquareMetre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::EnergyFlux, Unit::EnergyFlux::NanowattPerSquareMillimetre>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::WattPerSquareMetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::EnergyFlux, Unit::EnergyFlux::NanowattPerSquareMillimetre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::NanowattPerSquareMillimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::EnergyFlux, Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::NanowattPerSquareMillimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::EnergyFlux, Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::EnergyFlux, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::EnergyFlux, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::EnergyFlux, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::EnergyFlux, NumericType>{
-          {Unit::EnergyFlux::WattPerSquareMetre,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::WattPerSquareMetre>::
-               FromStandard<NumericType>},
-          {Unit::EnergyFlux::NanowattPerSquareMillimetre,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::NanowattPerSquareMillimetre>::
-               FromStandard<NumericType>},
-          {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::
-               FromStandard<NumericType>},
-          {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::EnergyFlux, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::EnergyFlux, NumericType>{
-          {Unit::EnergyFlux::WattPerSquareMetre,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::WattPerSquareMetre>::
-               ToStandard<NumericType>},
-          {Unit::EnergyFlux::NanowattPerSquareMillimetre,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::NanowattPerSquareMillimetre>::
-               ToStandard<NumericType>},
-          {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::
-               ToStandard<NumericType>},
-          {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond,
-           Conversions<Unit::EnergyFlux, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::
-               ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::EnergyFlux, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / static_cast<NumericType>(0.0254L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -100,6 +98,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Force unit) {
 
 namespace Internal {
 
+/// \brief Number of force units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Force>{9};
+
 template <>
 inline const std::map<UnitSystem, Unit::Force> ConsistentUnits<Unit::Force>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Force::Newton     },
@@ -130,7 +132,7 @@ inline const std::map<Unit::Force, std::string_view> Abbreviations<Unit::Force>{
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Force> Spellings<Unit::Force>{
+inline constexpr auto Spellings<Unit::Force>{MakeSpellingTable<Unit::Force>({
     {"N",        Unit::Force::Newton     },
     {"J/m",      Unit::Force::Newton     },
     {"kJ/km",    Unit::Force::Newton     },
@@ -153,173 +155,140 @@ inline const std::unordered_map<std::string_view, Unit::Force> Spellings<Unit::F
     {"dyn",      Unit::Force::Dyne       },
     {"lbf",      Unit::Force::Pound      },
     {"lb",       Unit::Force::Pound      },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Newton>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Force>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Newton>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Newton>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Kilonewton>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Newton>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Kilonewton>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Kilonewton>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Meganewton>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Kilonewton>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Meganewton>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Meganewton>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Giganewton>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Meganewton>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Giganewton>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Giganewton>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Millinewton>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Giganewton>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Millinewton>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Millinewton>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Micronewton>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Millinewton>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Micronewton>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Micronewton>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Nanonewton>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Micronewton>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Nanonewton>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Nanonewton>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Dyne>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(100000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Nanonewton>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Dyne>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.00001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Dyne>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(100000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Pound>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Dyne>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.00001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Force, Unit::Force::Pound>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Pound>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Force, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Force, NumericType>{
-      {Unit::Force::Newton,
-       Conversions<Unit::Force,                           Unit::Force::Newton>::FromStandard<NumericType>     },
-      {Unit::Force::Kilonewton,
-       Conversions<Unit::Force,                           Unit::Force::Kilonewton>::FromStandard<NumericType> },
-      {Unit::Force::Meganewton,
-       Conversions<Unit::Force,                           Unit::Force::Meganewton>::FromStandard<NumericType> },
-      {Unit::Force::Giganewton,
-       Conversions<Unit::Force,                           Unit::Force::Giganewton>::FromStandard<NumericType> },
-      {Unit::Force::Millinewton,
-       Conversions<Unit::Force,                           Unit::Force::Millinewton>::FromStandard<NumericType>},
-      {Unit::Force::Micronewton,
-       Conversions<Unit::Force,                           Unit::Force::Micronewton>::FromStandard<NumericType>},
-      {Unit::Force::Nanonewton,
-       Conversions<Unit::Force,                           Unit::Force::Nanonewton>::FromStandard<NumericType> },
-      {Unit::Force::Dyne,        Conversions<Unit::Force, Unit::Force::Dyne>::FromStandard<NumericType>       },
-      {Unit::Force::Pound,       Conversions<Unit::Force, Unit::Force::Pound>::FromStandard<NumericType>      },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Force,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Force, NumericType>{
-      {Unit::Force::Newton,      Conversions<Unit::Force, Unit::Force::Newton>::ToStandard<NumericType>     },
-      {Unit::Force::Kilonewton,
-       Conversions<Unit::Force,                           Unit::Force::Kilonewton>::ToStandard<NumericType> },
-      {Unit::Force::Meganewton,
-       Conversions<Unit::Force,                           Unit::Force::Meganewton>::ToStandard<NumericType> },
-      {Unit::Force::Giganewton,
-       Conversions<Unit::Force,                           Unit::Force::Giganewton>::ToStandard<NumericType> },
-      {Unit::Force::Millinewton,
-       Conversions<Unit::Force,                           Unit::Force::Millinewton>::ToStandard<NumericType>},
-      {Unit::Force::Micronewton,
-       Conversions<Unit::Force,                           Unit::Force::Micronewton>::ToStandard<NumericType>},
-      {Unit::Force::Nanonewton,
-       Conversions<Unit::Force,                           Unit::Force::Nanonewton>::ToStandard<NumericType> },
-      {Unit::Force::Dyne,        Conversions<Unit::Force, Unit::Force::Dyne>::ToStandard<NumericType>       },
-      {Unit::Force::Pound,       Conversions<Unit::Force, Unit::Force::Pound>::ToStandard<NumericType>      },
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Force, Unit::Force::Pound>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -91,6 +89,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Frequency unit
 
 namespace Internal {
 
+/// \brief Number of frequency units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Frequency>{6};
+
 template <>
 inline const std::map<UnitSystem, Unit::Frequency> ConsistentUnits<Unit::Frequency>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Frequency::Hertz},
@@ -113,7 +115,7 @@ inline const std::map<Unit::Frequency, std::string_view> Abbreviations<Unit::Fre
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Frequency> Spellings<Unit::Frequency>{
+inline constexpr auto Spellings<Unit::Frequency>{MakeSpellingTable<Unit::Frequency>({
   {"Hz",    Unit::Frequency::Hertz    },
   {"/s",    Unit::Frequency::Hertz    },
   {"1/s",   Unit::Frequency::Hertz    },
@@ -124,123 +126,94 @@ inline const std::unordered_map<std::string_view, Unit::Frequency> Spellings<Uni
   {"1/min", Unit::Frequency::PerMinute},
   {"/hr",   Unit::Frequency::PerHour  },
   {"1/hr",  Unit::Frequency::PerHour  },
-};
+})};
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Hertz>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Frequency>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Hertz>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Frequency, Unit::Frequency::Hertz>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Kilohertz>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Frequency, Unit::Frequency::Hertz>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Kilohertz>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::Kilohertz>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Megahertz>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::Kilohertz>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Megahertz>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::Megahertz>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Gigahertz>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::Megahertz>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::Gigahertz>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::Gigahertz>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::PerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::Gigahertz>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::PerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::PerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::PerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Frequency, Unit::Frequency::PerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::PerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Frequency, Unit::Frequency::PerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::Frequency, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::Frequency, NumericType>{
-          {Unit::Frequency::Hertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Hertz>::FromStandard<NumericType>    },
-          {Unit::Frequency::Kilohertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Kilohertz>::FromStandard<NumericType>},
-          {Unit::Frequency::Megahertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Megahertz>::FromStandard<NumericType>},
-          {Unit::Frequency::Gigahertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Gigahertz>::FromStandard<NumericType>},
-          {Unit::Frequency::PerMinute,
-           Conversions<Unit::Frequency, Unit::Frequency::PerMinute>::FromStandard<NumericType>},
-          {Unit::Frequency::PerHour,
-           Conversions<Unit::Frequency, Unit::Frequency::PerHour>::FromStandard<NumericType>  },
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::Frequency, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::Frequency, NumericType>{
-          {Unit::Frequency::Hertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Hertz>::ToStandard<NumericType>    },
-          {Unit::Frequency::Kilohertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Kilohertz>::ToStandard<NumericType>},
-          {Unit::Frequency::Megahertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Megahertz>::ToStandard<NumericType>},
-          {Unit::Frequency::Gigahertz,
-           Conversions<Unit::Frequency, Unit::Frequency::Gigahertz>::ToStandard<NumericType>},
-          {Unit::Frequency::PerMinute,
-           Conversions<Unit::Frequency, Unit::Frequency::PerMinute>::ToStandard<NumericType>},
-          {Unit::Frequency::PerHour,
-           Conversions<Unit::Frequency, Unit::Frequency::PerHour>::ToStandard<NumericType>  },
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Frequency, Unit::Frequency::PerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -86,6 +84,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::HeatCapacity u
 
 namespace Internal {
 
+/// \brief Number of heat capacity units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::HeatCapacity>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::HeatCapacity> ConsistentUnits<Unit::HeatCapacity>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::HeatCapacity::JoulePerKelvin     },
@@ -113,7 +115,7 @@ inline const std::map<Unit::HeatCapacity, std::string_view> Abbreviations<Unit::
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::HeatCapacity> Spellings<Unit::HeatCapacity>{
+inline constexpr auto Spellings<Unit::HeatCapacity>{MakeSpellingTable<Unit::HeatCapacity>({
     {"J/K",            Unit::HeatCapacity::JoulePerKelvin     },
     {"N·m/K",          Unit::HeatCapacity::JoulePerKelvin     },
     {"N*m/K",          Unit::HeatCapacity::JoulePerKelvin     },
@@ -154,101 +156,79 @@ inline const std::unordered_map<std::string_view, Unit::HeatCapacity> Spellings<
     {"in·lb/R",        Unit::HeatCapacity::InchPoundPerRankine},
     {"in*lb/°R",       Unit::HeatCapacity::InchPoundPerRankine},
     {"in*lb/R",        Unit::HeatCapacity::InchPoundPerRankine},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::JoulePerKelvin>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::HeatCapacity>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::JoulePerKelvin>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::JoulePerKelvin>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::NanojoulePerKelvin>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::JoulePerKelvin>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::NanojoulePerKelvin>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::NanojoulePerKelvin>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::FootPoundPerRankine>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::NanojoulePerKelvin>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::FootPoundPerRankine>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::FootPoundPerRankine>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::InchPoundPerRankine>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::FootPoundPerRankine>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::HeatCapacity, Unit::HeatCapacity::InchPoundPerRankine>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::InchPoundPerRankine>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::HeatCapacity, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::HeatCapacity, NumericType>{
-          {Unit::HeatCapacity::JoulePerKelvin,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::JoulePerKelvin>::
-               FromStandard<NumericType>},
-          {Unit::HeatCapacity::NanojoulePerKelvin,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::NanojoulePerKelvin>::
-               FromStandard<NumericType>},
-          {Unit::HeatCapacity::FootPoundPerRankine,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::FootPoundPerRankine>::
-               FromStandard<NumericType>},
-          {Unit::HeatCapacity::InchPoundPerRankine,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::InchPoundPerRankine>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::HeatCapacity, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::HeatCapacity, NumericType>{
-          {Unit::HeatCapacity::JoulePerKelvin,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::JoulePerKelvin>::
-               ToStandard<NumericType>},
-          {Unit::HeatCapacity::NanojoulePerKelvin,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::NanojoulePerKelvin>::
-               ToStandard<NumericType>},
-          {Unit::HeatCapacity::FootPoundPerRankine,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::FootPoundPerRankine>::
-               ToStandard<NumericType>},
-          {Unit::HeatCapacity::InchPoundPerRankine,
-           Conversions<Unit::HeatCapacity, Unit::HeatCapacity::InchPoundPerRankine>::
-               ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::HeatCapacity, Unit::HeatCapacity::InchPoundPerRankine>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -112,6 +110,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Length unit) {
 
 namespace Internal {
 
+/// \brief Number of length units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Length>{13};
+
 template <>
 inline const std::map<UnitSystem, Unit::Length> ConsistentUnits<Unit::Length>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Length::Metre     },
@@ -148,7 +150,7 @@ inline const std::map<Unit::Length, std::string_view> Abbreviations<Unit::Length
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Length> Spellings<Unit::Length>{
+inline constexpr auto Spellings<Unit::Length>{MakeSpellingTable<Unit::Length>({
     {"m",              Unit::Length::Metre       },
     {"meter",          Unit::Length::Metre       },
     {"meters",         Unit::Length::Metre       },
@@ -211,247 +213,194 @@ inline const std::unordered_map<std::string_view, Unit::Length> Spellings<Unit::
     {"uin",            Unit::Length::Microinch   },
     {"microinch",      Unit::Length::Microinch   },
     {"microinches",    Unit::Length::Microinch   },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Metre>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Length>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Metre>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Metre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::NauticalMile>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Metre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::NauticalMile>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::NauticalMile>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Mile>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::NauticalMile>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Mile>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Mile>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Kilometre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Mile>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Kilometre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Kilometre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Yard>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Kilometre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Yard>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Yard>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Foot>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Yard>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Foot>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Foot>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Decimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Foot>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Decimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.1L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Decimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Inch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Decimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.1L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Inch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Inch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Centimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(100.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Inch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Centimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.01L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Centimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(100.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Millimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Centimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.01L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Millimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Millimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Milliinch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Millimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Milliinch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Milliinch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Micrometre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Milliinch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Micrometre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Micrometre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Microinch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Micrometre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Length, Unit::Length::Microinch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Microinch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0000000254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::Length, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::Length, NumericType>{
-          {Unit::Length::Metre,
-           Conversions<Unit::Length, Unit::Length::Metre>::FromStandard<NumericType>       },
-          {Unit::Length::NauticalMile,
-           Conversions<Unit::Length, Unit::Length::NauticalMile>::FromStandard<NumericType>},
-          {Unit::Length::Mile,
-           Conversions<Unit::Length, Unit::Length::Mile>::FromStandard<NumericType>        },
-          {Unit::Length::Kilometre,
-           Conversions<Unit::Length, Unit::Length::Kilometre>::FromStandard<NumericType>   },
-          {Unit::Length::Yard,
-           Conversions<Unit::Length, Unit::Length::Yard>::FromStandard<NumericType>        },
-          {Unit::Length::Foot,
-           Conversions<Unit::Length, Unit::Length::Foot>::FromStandard<NumericType>        },
-          {Unit::Length::Decimetre,
-           Conversions<Unit::Length, Unit::Length::Decimetre>::FromStandard<NumericType>   },
-          {Unit::Length::Inch,
-           Conversions<Unit::Length, Unit::Length::Inch>::FromStandard<NumericType>        },
-          {Unit::Length::Centimetre,
-           Conversions<Unit::Length, Unit::Length::Centimetre>::FromStandard<NumericType>  },
-          {Unit::Length::Millimetre,
-           Conversions<Unit::Length, Unit::Length::Millimetre>::FromStandard<NumericType>  },
-          {Unit::Length::Milliinch,
-           Conversions<Unit::Length, Unit::Length::Milliinch>::FromStandard<NumericType>   },
-          {Unit::Length::Micrometre,
-           Conversions<Unit::Length, Unit::Length::Micrometre>::FromStandard<NumericType>  },
-          {Unit::Length::Microinch,
-           Conversions<Unit::Length, Unit::Length::Microinch>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Length,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Length, NumericType>{
-      {Unit::Length::Metre,
-       Conversions<Unit::Length,                             Unit::Length::Metre>::ToStandard<NumericType>       },
-      {Unit::Length::NauticalMile,
-       Conversions<Unit::Length,                             Unit::Length::NauticalMile>::ToStandard<NumericType>},
-      {Unit::Length::Mile,         Conversions<Unit::Length, Unit::Length::Mile>::ToStandard<NumericType>        },
-      {Unit::Length::Kilometre,
-       Conversions<Unit::Length,                             Unit::Length::Kilometre>::ToStandard<NumericType>   },
-      {Unit::Length::Yard,         Conversions<Unit::Length, Unit::Length::Yard>::ToStandard<NumericType>        },
-      {Unit::Length::Foot,         Conversions<Unit::Length, Unit::Length::Foot>::ToStandard<NumericType>        },
-      {Unit::Length::Decimetre,
-       Conversions<Unit::Length,                             Unit::Length::Decimetre>::ToStandard<NumericType>   },
-      {Unit::Length::Inch,         Conversions<Unit::Length, Unit::Length::Inch>::ToStandard<NumericType>        },
-      {Unit::Length::Centimetre,
-       Conversions<Unit::Length,                             Unit::Length::Centimetre>::ToStandard<NumericType>  },
-      {Unit::Length::Millimetre,
-       Conversions<Unit::Length,                             Unit::Length::Millimetre>::ToStandard<NumericType>  },
-      {Unit::Length::Milliinch,
-       Conversions<Unit::Length,                             Unit::Length::Milliinch>::ToStandard<NumericType>   },
-      {Unit::Length::Micrometre,
-       Conversions<Unit::Length,                             Unit::Length::Micrometre>::ToStandard<NumericType>  },
-      {Unit::Length::Microinch,
-       Conversions<Unit::Length,                             Unit::Length::Microinch>::ToStandard<NumericType>   },
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Length, Unit::Length::Microinch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0000000254L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -88,6 +86,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Mass unit) {
 
 namespace Internal {
 
+/// \brief Number of mass units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Mass>{5};
+
 template <>
 inline const std::map<UnitSystem, Unit::Mass> ConsistentUnits<Unit::Mass>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Mass::Kilogram},
@@ -114,108 +116,95 @@ inline const std::map<Unit::Mass, std::string_view> Abbreviations<Unit::Mass>{
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Mass> Spellings<Unit::Mass>{
+inline constexpr auto Spellings<Unit::Mass>{MakeSpellingTable<Unit::Mass>({
   {"kg",     Unit::Mass::Kilogram},
   {"g",      Unit::Mass::Gram    },
   {"slug",   Unit::Mass::Slug    },
   {"slinch", Unit::Mass::Slinch  },
   {"lbm",    Unit::Mass::Pound   },
   {"lb",     Unit::Mass::Pound   },
-};
+})};
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Kilogram>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Mass>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Kilogram>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Kilogram>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Gram>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Kilogram>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Gram>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Gram>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Slug>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Gram>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Slug>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Slug>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Slinch>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Slug>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Slinch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Slinch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Pound>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Slinch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Mass, Unit::Mass::Pound>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Pound>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.45359237L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Mass, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Mass, NumericType>{
-      {Unit::Mass::Kilogram,
-       Conversions<Unit::Mass,                       Unit::Mass::Kilogram>::FromStandard<NumericType>},
-      {Unit::Mass::Gram,     Conversions<Unit::Mass, Unit::Mass::Gram>::FromStandard<NumericType>    },
-      {Unit::Mass::Slug,     Conversions<Unit::Mass, Unit::Mass::Slug>::FromStandard<NumericType>    },
-      {Unit::Mass::Slinch,   Conversions<Unit::Mass, Unit::Mass::Slinch>::FromStandard<NumericType>  },
-      {Unit::Mass::Pound,    Conversions<Unit::Mass, Unit::Mass::Pound>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::Mass, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::Mass, NumericType>{
-          {Unit::Mass::Kilogram,
-           Conversions<Unit::Mass,                       Unit::Mass::Kilogram>::ToStandard<NumericType>},
-          {Unit::Mass::Gram,     Conversions<Unit::Mass, Unit::Mass::Gram>::ToStandard<NumericType>    },
-          {Unit::Mass::Slug,     Conversions<Unit::Mass, Unit::Mass::Slug>::ToStandard<NumericType>    },
-          {Unit::Mass::Slinch,
-           Conversions<Unit::Mass,                       Unit::Mass::Slinch>::ToStandard<NumericType>  },
-          {Unit::Mass::Pound,    Conversions<Unit::Mass, Unit::Mass::Pound>::ToStandard<NumericType>   },
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Mass, Unit::Mass::Pound>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.45359237L));
+}
 
 }  // namespace Internal
 
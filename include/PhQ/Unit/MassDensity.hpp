@@ -28,11 +28,9 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -93,6 +91,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::MassDensity un
 
 namespace Internal {
 
+/// \brief Number of mass density units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::MassDensity>{6};
+
 template <>
 inline const std::map<UnitSystem, Unit::MassDensity> ConsistentUnits<Unit::MassDensity>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::MassDensity::KilogramPerCubicMetre },
@@ -120,7 +122,7 @@ inline const std::map<Unit::MassDensity, std::string_view> Abbreviations<Unit::M
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::MassDensity> Spellings<Unit::MassDensity>{
+inline constexpr auto Spellings<Unit::MassDensity>{MakeSpellingTable<Unit::MassDensity>({
   {"kg/m^3",          Unit::MassDensity::KilogramPerCubicMetre },
   {"kg/m3",           Unit::MassDensity::KilogramPerCubicMetre },
   {"kg/m/m/m",        Unit::MassDensity::KilogramPerCubicMetre },
@@ -145,143 +147,119 @@ inline const std::unordered_map<std::string_view, Unit::MassDensity> Spellings<U
   {"lb/in^3",         Unit::MassDensity::PoundPerCubicInch     },
   {"lb/in3",          Unit::MassDensity::PoundPerCubicInch     },
   {"lb/in/in/in",     Unit::MassDensity::PoundPerCubicInch     },
-};
+})};
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::KilogramPerCubicMetre>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::MassDensity>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::KilogramPerCubicMetre>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::KilogramPerCubicMetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::GramPerCubicMillimetre>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::KilogramPerCubicMetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::GramPerCubicMillimetre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::GramPerCubicMillimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::SlugPerCubicFoot>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::GramPerCubicMillimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::SlugPerCubicFoot>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / std::pow(static_cast<NumericType>(0.3048L), 4);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::SlugPerCubicFoot>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::SlinchPerCubicInch>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::SlugPerCubicFoot>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+         * static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::SlinchPerCubicInch>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / std::pow(static_cast<NumericType>(0.0254L), 4);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::SlinchPerCubicInch>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicFoot>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L) / static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::SlinchPerCubicInch>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+         * static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicFoot>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) / std::pow(static_cast<NumericType>(0.3048L), 3);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicFoot>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L) / static_cast<NumericType>(0.45359237L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicInch>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L) / static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicFoot>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+         * static_cast<NumericType>(0.3048L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicInch>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) / std::pow(static_cast<NumericType>(0.0254L), 3);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicInch>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L) / static_cast<NumericType>(0.45359237L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::MassDensity, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::MassDensity, NumericType>{
-          {Unit::MassDensity::KilogramPerCubicMetre,
-           Conversions<Unit::MassDensity, Unit::MassDensity::KilogramPerCubicMetre>::
-               FromStandard<NumericType>},
-          {Unit::MassDensity::GramPerCubicMillimetre,
-           Conversions<Unit::MassDensity, Unit::MassDensity::GramPerCubicMillimetre>::
-               FromStandard<NumericType>},
-          {Unit::MassDensity::SlugPerCubicFoot,
-           Conversions<Unit::MassDensity, Unit::MassDensity::SlugPerCubicFoot>::
-               FromStandard<NumericType>},
-          {Unit::MassDensity::SlinchPerCubicInch,
-           Conversions<Unit::MassDensity, Unit::MassDensity::SlinchPerCubicInch>::
-               FromStandard<NumericType>},
-          {Unit::MassDensity::PoundPerCubicFoot,
-           Conversions<Unit::MassDensity, Unit::MassDensity::PoundPerCubicFoot>::
-               FromStandard<NumericType>},
-          {Unit::MassDensity::PoundPerCubicInch,
-           Conversions<Unit::MassDensity, Unit::MassDensity::PoundPerCubicInch>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::MassDensity, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::MassDensity, NumericType>{
-          {Unit::MassDensity::KilogramPerCubicMetre,
-           Conversions<Unit::MassDensity, Unit::MassDensity::KilogramPerCubicMetre>::
-               ToStandard<NumericType>},
-          {Unit::MassDensity::GramPerCubicMillimetre,
-           Conversions<Unit::MassDensity, Unit::MassDensity::GramPerCubicMillimetre>::
-               ToStandard<NumericType>},
-          {Unit::MassDensity::SlugPerCubicFoot,
-           Conversions<Unit::MassDensity, Unit::MassDensity::SlugPerCubicFoot>::
-               ToStandard<NumericType>},
-          {Unit::MassDensity::SlinchPerCubicInch,
-           Conversions<Unit::MassDensity, Unit::MassDensity::SlinchPerCubicInch>::
-               ToStandard<NumericType>},
-          {Unit::MassDensity::PoundPerCubicFoot,
-           Conversions<Unit::MassDensity, Unit::MassDensity::PoundPerCubicFoot>::
-               ToStandard<NumericType>},
-          {Unit::MassDensity::PoundPerCubicInch,
-           Conversions<Unit::MassDensity, Unit::MassDensity::PoundPerCubicInch>::
-               ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicInch>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+         * static_cast<NumericType>(0.0254L)));
+}
 
 }  // namespace Internal
 
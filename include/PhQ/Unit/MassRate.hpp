@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -118,6 +116,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::MassRate unit)
 
 namespace Internal {
 
+/// \brief Number of time rate of mass units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::MassRate>{15};
+
 template <>
 inline const std::map<UnitSystem, Unit::MassRate> ConsistentUnits<Unit::MassRate>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::MassRate::KilogramPerSecond},
@@ -154,7 +156,7 @@ inline const std::map<Unit::MassRate, std::string_view> Abbreviations<Unit::Mass
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::MassRate> Spellings<Unit::MassRate>{
+inline constexpr auto Spellings<Unit::MassRate>{MakeSpellingTable<Unit::MassRate>({
   {"kg/s",       Unit::MassRate::KilogramPerSecond},
   {"g/s",        Unit::MassRate::GramPerSecond    },
   {"slug/s",     Unit::MassRate::SlugPerSecond    },
@@ -173,297 +175,248 @@ inline const std::unordered_map<std::string_view, Unit::MassRate> Spellings<Unit
   {"slinch/hr",  Unit::MassRate::SlinchPerHour    },
   {"lbm/hr",     Unit::MassRate::PoundPerHour     },
   {"lb/hr",      Unit::MassRate::PoundPerHour     },
-};
+})};
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::MassRate>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::GramPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::GramPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::GramPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlugPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::GramPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlugPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlugPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlugPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::PoundPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::PoundPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::PoundPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.45359237L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::PoundPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.45359237L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::GramPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::GramPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::GramPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlugPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) * static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::GramPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlugPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(60.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlugPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) * static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) * static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlugPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(60.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(60.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) * static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::PoundPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(60.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::PoundPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::PoundPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.45359237L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::KilogramPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::PoundPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::KilogramPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::KilogramPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::GramPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::KilogramPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::GramPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::GramPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlugPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) * static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::GramPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlugPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(3600.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlugPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) * static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlinchPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) * static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlugPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(3600.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::SlinchPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(3600.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlinchPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) * static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::PoundPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.45359237L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::SlinchPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(3600.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::PoundPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::PoundPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.45359237L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::MassRate,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::MassRate, NumericType>{
-      {Unit::MassRate::KilogramPerSecond,
-       Conversions<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::FromStandard<NumericType>},
-      {Unit::MassRate::GramPerSecond,
-       Conversions<Unit::MassRate, Unit::MassRate::GramPerSecond>::FromStandard<NumericType>    },
-      {Unit::MassRate::SlugPerSecond,
-       Conversions<Unit::MassRate, Unit::MassRate::SlugPerSecond>::FromStandard<NumericType>    },
-      {Unit::MassRate::SlinchPerSecond,
-       Conversions<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::FromStandard<NumericType>  },
-      {Unit::MassRate::PoundPerSecond,
-       Conversions<Unit::MassRate, Unit::MassRate::PoundPerSecond>::FromStandard<NumericType>   },
-      {Unit::MassRate::KilogramPerMinute,
-       Conversions<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::FromStandard<NumericType>},
-      {Unit::MassRate::GramPerMinute,
-       Conversions<Unit::MassRate, Unit::MassRate::GramPerMinute>::FromStandard<NumericType>    },
-      {Unit::MassRate::SlugPerMinute,
-       Conversions<Unit::MassRate, Unit::MassRate::SlugPerMinute>::FromStandard<NumericType>    },
-      {Unit::MassRate::SlinchPerMinute,
-       Conversions<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::FromStandard<NumericType>  },
-      {Unit::MassRate::PoundPerMinute,
-       Conversions<Unit::MassRate, Unit::MassRate::PoundPerMinute>::FromStandard<NumericType>   },
-      {Unit::MassRate::KilogramPerHour,
-       Conversions<Unit::MassRate, Unit::MassRate::KilogramPerHour>::FromStandard<NumericType>  },
-      {Unit::MassRate::GramPerHour,
-       Conversions<Unit::MassRate, Unit::MassRate::GramPerHour>::FromStandard<NumericType>      },
-      {Unit::MassRate::SlugPerHour,
-       Conversions<Unit::MassRate, Unit::MassRate::SlugPerHour>::FromStandard<NumericType>      },
-      {Unit::MassRate::SlinchPerHour,
-       Conversions<Unit::MassRate, Unit::MassRate::SlinchPerHour>::FromStandard<NumericType>    },
-      {Unit::MassRate::PoundPerHour,
-       Conversions<Unit::MassRate, Unit::MassRate::PoundPerHour>::FromStandard<NumericType>     },
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::MassRate, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::MassRate, NumericType>{
-          {Unit::MassRate::KilogramPerSecond,
-           Conversions<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::ToStandard<NumericType>},
-          {Unit::MassRate::GramPerSecond,
-           Conversions<Unit::MassRate, Unit::MassRate::GramPerSecond>::ToStandard<NumericType>    },
-          {Unit::MassRate::SlugPerSecond,
-           Conversions<Unit::MassRate, Unit::MassRate::SlugPerSecond>::ToStandard<NumericType>    },
-          {Unit::MassRate::SlinchPerSecond,
-           Conversions<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::ToStandard<NumericType>  },
-          {Unit::MassRate::PoundPerSecond,
-           Conversions<Unit::MassRate, Unit::MassRate::PoundPerSecond>::ToStandard<NumericType>   },
-          {Unit::MassRate::KilogramPerMinute,
-           Conversions<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::ToStandard<NumericType>},
-          {Unit::MassRate::GramPerMinute,
-           Conversions<Unit::MassRate, Unit::MassRate::GramPerMinute>::ToStandard<NumericType>    },
-          {Unit::MassRate::SlugPerMinute,
-           Conversions<Unit::MassRate, Unit::MassRate::SlugPerMinute>::ToStandard<NumericType>    },
-          {Unit::MassRate::SlinchPerMinute,
-           Conversions<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::ToStandard<NumericType>  },
-          {Unit::MassRate::PoundPerMinute,
-           Conversions<Unit::MassRate, Unit::MassRate::PoundPerMinute>::ToStandard<NumericType>   },
-          {Unit::MassRate::KilogramPerHour,
-           Conversions<Unit::MassRate, Unit::MassRate::KilogramPerHour>::ToStandard<NumericType>  },
-          {Unit::MassRate::GramPerHour,
-           Conversions<Unit::MassRate, Unit::MassRate::GramPerHour>::ToStandard<NumericType>      },
-          {Unit::MassRate::SlugPerHour,
-           Conversions<Unit::MassRate, Unit::MassRate::SlugPerHour>::ToStandard<NumericType>      },
-          {Unit::MassRate::SlinchPerHour,
-           Conversions<Unit::MassRate, Unit::MassRate::SlinchPerHour>::ToStandard<NumericType>    },
-          {Unit::MassRate::PoundPerHour,
-           Conversions<Unit::MassRate, Unit::MassRate::PoundPerHour>::ToStandard<NumericType>     },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MassRate, Unit::MassRate::PoundPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) / static_cast<NumericType>(3600.0L));
+}
 
 }  // namespace Internal
 
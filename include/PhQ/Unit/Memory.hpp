@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -135,6 +133,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Memory unit) {
 
 namespace Internal {
 
+/// \brief Number of computer memory units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Memory>{22};
+
 template <>
 inline const std::map<UnitSystem, Unit::Memory> ConsistentUnits<Unit::Memory>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Memory::Bit},
@@ -173,7 +175,7 @@ inline const std::map<Unit::Memory, std::string_view> Abbreviations<Unit::Memory
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Memory> Spellings<Unit::Memory>{
+inline constexpr auto Spellings<Unit::Memory>{MakeSpellingTable<Unit::Memory>({
   {"b",         Unit::Memory::Bit     },
   {"bit",       Unit::Memory::Bit     },
   {"bits",      Unit::Memory::Bit     },
@@ -240,428 +242,356 @@ inline const std::unordered_map<std::string_view, Unit::Memory> Spellings<Unit::
   {"PiB",       Unit::Memory::Pebibyte},
   {"pebibyte",  Unit::Memory::Pebibyte},
   {"pebibytes", Unit::Memory::Pebibyte},
-};
+})};
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Bit>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Memory>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Bit>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Bit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Byte>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.125L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Bit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Byte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Byte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.125L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kilobit>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Byte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kilobit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kilobit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kibibit>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kilobit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kibibit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kibibit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kilobyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kibibit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kilobyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kilobyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kibibyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kilobyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Kibibyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kibibyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Megabit>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Kibibyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Megabit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Megabit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Mebibit>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Megabit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Mebibit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Mebibit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Megabyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Mebibit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Megabyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Megabyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Mebibyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Megabyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Mebibyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Mebibyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gigabit>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Mebibyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gigabit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gigabit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gibibit>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gigabit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gibibit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gibibit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gigabyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8.0E9L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gibibit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gigabyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E9L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gigabyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gibibyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gigabyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Gibibyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gibibyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Terabit>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-12L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Gibibyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Terabit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E12L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Terabit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Tebibit>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Terabit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Tebibit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Tebibit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Terabyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8.0E12L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Tebibit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Terabyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E12L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Terabyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Tebibyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Terabyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Tebibyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Tebibyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Petabit>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-15L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Tebibyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Petabit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E15L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Petabit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Pebibit>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Petabit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Pebibit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Pebibit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Petabyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8.0E15L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Pebibit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Petabyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E15L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Petabyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Pebibyte>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Petabyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Memory, Unit::Memory::Pebibyte>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Pebibyte>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Memory,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Memory, NumericType>{
-      {Unit::Memory::Bit,      Conversions<Unit::Memory, Unit::Memory::Bit>::FromStandard<NumericType>     },
-      {Unit::Memory::Byte,
-       Conversions<Unit::Memory,                         Unit::Memory::Byte>::FromStandard<NumericType>    },
-      {Unit::Memory::Kilobit,
-       Conversions<Unit::Memory,                         Unit::Memory::Kilobit>::FromStandard<NumericType> },
-      {Unit::Memory::Kibibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Kibibit>::FromStandard<NumericType> },
-      {Unit::Memory::Kilobyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Kilobyte>::FromStandard<NumericType>},
-      {Unit::Memory::Kibibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Kibibyte>::FromStandard<NumericType>},
-      {Unit::Memory::Megabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Megabit>::FromStandard<NumericType> },
-      {Unit::Memory::Mebibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Mebibit>::FromStandard<NumericType> },
-      {Unit::Memory::Megabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Megabyte>::FromStandard<NumericType>},
-      {Unit::Memory::Mebibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Mebibyte>::FromStandard<NumericType>},
-      {Unit::Memory::Gigabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Gigabit>::FromStandard<NumericType> },
-      {Unit::Memory::Gibibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Gibibit>::FromStandard<NumericType> },
-      {Unit::Memory::Gigabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Gigabyte>::FromStandard<NumericType>},
-      {Unit::Memory::Gibibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Gibibyte>::FromStandard<NumericType>},
-      {Unit::Memory::Terabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Terabit>::FromStandard<NumericType> },
-      {Unit::Memory::Tebibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Tebibit>::FromStandard<NumericType> },
-      {Unit::Memory::Terabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Terabyte>::FromStandard<NumericType>},
-      {Unit::Memory::Tebibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Tebibyte>::FromStandard<NumericType>},
-      {Unit::Memory::Petabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Petabit>::FromStandard<NumericType> },
-      {Unit::Memory::Pebibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Pebibit>::FromStandard<NumericType> },
-      {Unit::Memory::Petabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Petabyte>::FromStandard<NumericType>},
-      {Unit::Memory::Pebibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Pebibyte>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Memory,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Memory, NumericType>{
-      {Unit::Memory::Bit,      Conversions<Unit::Memory, Unit::Memory::Bit>::ToStandard<NumericType>     },
-      {Unit::Memory::Byte,     Conversions<Unit::Memory, Unit::Memory::Byte>::ToStandard<NumericType>    },
-      {Unit::Memory::Kilobit,
-       Conversions<Unit::Memory,                         Unit::Memory::Kilobit>::ToStandard<NumericType> },
-      {Unit::Memory::Kibibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Kibibit>::ToStandard<NumericType> },
-      {Unit::Memory::Kilobyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Kilobyte>::ToStandard<NumericType>},
-      {Unit::Memory::Kibibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Kibibyte>::ToStandard<NumericType>},
-      {Unit::Memory::Megabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Megabit>::ToStandard<NumericType> },
-      {Unit::Memory::Mebibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Mebibit>::ToStandard<NumericType> },
-      {Unit::Memory::Megabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Megabyte>::ToStandard<NumericType>},
-      {Unit::Memory::Mebibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Mebibyte>::ToStandard<NumericType>},
-      {Unit::Memory::Gigabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Gigabit>::ToStandard<NumericType> },
-      {Unit::Memory::Gibibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Gibibit>::ToStandard<NumericType> },
-      {Unit::Memory::Gigabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Gigabyte>::ToStandard<NumericType>},
-      {Unit::Memory::Gibibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Gibibyte>::ToStandard<NumericType>},
-      {Unit::Memory::Terabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Terabit>::ToStandard<NumericType> },
-      {Unit::Memory::Tebibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Tebibit>::ToStandard<NumericType> },
-      {Unit::Memory::Terabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Terabyte>::ToStandard<NumericType>},
-      {Unit::Memory::Tebibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Tebibyte>::ToStandard<NumericType>},
-      {Unit::Memory::Petabit,
-       Conversions<Unit::Memory,                         Unit::Memory::Petabit>::ToStandard<NumericType> },
-      {Unit::Memory::Pebibit,
-       Conversions<Unit::Memory,                         Unit::Memory::Pebibit>::ToStandard<NumericType> },
-      {Unit::Memory::Petabyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Petabyte>::ToStandard<NumericType>},
-      {Unit::Memory::Pebibyte,
-       Conversions<Unit::Memory,                         Unit::Memory::Pebibyte>::ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Memory, Unit::Memory::Pebibyte>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+}
 
 }  // namespace Internal
 
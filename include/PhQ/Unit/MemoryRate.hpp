@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -272,6 +270,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::MemoryRate uni
 
 namespace Internal {
 
+/// \brief Number of computer memory rate units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::MemoryRate>{66};
+
 template <>
 inline const std::map<UnitSystem, Unit::MemoryRate> ConsistentUnits<Unit::MemoryRate>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::MemoryRate::BitPerSecond},
@@ -354,7 +356,7 @@ inline const std::map<Unit::MemoryRate, std::string_view> Abbreviations<Unit::Me
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::MemoryRate> Spellings<Unit::MemoryRate>{
+inline constexpr auto Spellings<Unit::MemoryRate>{MakeSpellingTable<Unit::MemoryRate>({
   {"b/s",     Unit::MemoryRate::BitPerSecond     },
   {"B/s",     Unit::MemoryRate::BytePerSecond    },
   {"kb/s",    Unit::MemoryRate::KilobitPerSecond },
@@ -421,1331 +423,1124 @@ inline const std::unordered_map<std::string_view, Unit::MemoryRate> Spellings<Un
   {"PB/hr",   Unit::MemoryRate::PetabytePerHour  },
   {"Pib/hr",  Unit::MemoryRate::PebibitPerHour   },
   {"PiB/hr",  Unit::MemoryRate::PebibytePerHour  },
-};
+})};
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerSecond>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::MemoryRate>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerSecond>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.125L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.125L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(8.0E15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(8.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(8.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(8.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(8.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(8000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(8000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8000.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000000.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(8000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000000.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(8000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8000000.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / (static_cast<NumericType>(8.0E9L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E9L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / (static_cast<NumericType>(8.0E9L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0E9L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E12L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E12L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(8.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E12L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(8.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0E12L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E15L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E15L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(8.0E15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E15L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(8.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0E15L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::BytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1024.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1024.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KilobytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8000.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::KibibytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000000.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8000000.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MegabytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8000000.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::MebibytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / (static_cast<NumericType>(8.0E9L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E9L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / (static_cast<NumericType>(8.0E9L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GigabytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0E9L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::GibibytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E12L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E12L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8.0E12L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E12L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8.0E12L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TerabytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0E12L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::TebibytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E15L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E15L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8.0E15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibitPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0E15L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(8.0E15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-              * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PetabytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0E15L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
-           / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+         * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::MemoryRate,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::MemoryRate, NumericType>{
-      {Unit::MemoryRate::BitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BitPerSecond>::FromStandard<NumericType>   },
-      {Unit::MemoryRate::BytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BytePerSecond>::FromStandard<NumericType>  },
-      {Unit::MemoryRate::KilobitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::KibibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::KilobytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::KibibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MegabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MebibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MegabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MebibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GigabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GibibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GigabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GibibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TerabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TebibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TerabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TebibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PetabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PebibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibitPerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PetabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PebibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibytePerSecond>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::BitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BitPerMinute>::FromStandard<NumericType>   },
-      {Unit::MemoryRate::BytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BytePerMinute>::FromStandard<NumericType>  },
-      {Unit::MemoryRate::KilobitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::KibibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::KilobytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::KibibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MegabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MebibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MegabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::MebibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GigabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GibibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GigabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::GibibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TerabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TebibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TerabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::TebibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PetabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PebibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibitPerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PetabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::PebibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibytePerMinute>::
-           FromStandard<NumericType>                          },
-      {Unit::MemoryRate::BitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BitPerHour>::FromStandard<NumericType>     },
-      {Unit::MemoryRate::BytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BytePerHour>::FromStandard<NumericType>    },
-      {Unit::MemoryRate::KilobitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::KibibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::KilobytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::KibibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::MegabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::MebibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::MegabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::MebibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::GigabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::GibibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::GigabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::GibibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::TerabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::TebibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::TerabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::TebibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::PetabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::PebibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibitPerHour>::FromStandard<NumericType> },
-      {Unit::MemoryRate::PetabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabytePerHour>::FromStandard<NumericType>},
-      {Unit::MemoryRate::PebibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibytePerHour>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::MemoryRate,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::MemoryRate, NumericType>{
-      {Unit::MemoryRate::BitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BitPerSecond>::ToStandard<NumericType>     },
-      {Unit::MemoryRate::BytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BytePerSecond>::ToStandard<NumericType>    },
-      {Unit::MemoryRate::KilobitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::KibibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::KilobytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::KibibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::MegabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::MebibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::MegabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::MebibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::GigabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::GibibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::GigabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::GibibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::TerabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::TebibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::TerabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::TebibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::PetabitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::PebibitPerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibitPerSecond>::ToStandard<NumericType> },
-      {Unit::MemoryRate::PetabytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::PebibytePerSecond,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibytePerSecond>::ToStandard<NumericType>},
-      {Unit::MemoryRate::BitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BitPerMinute>::ToStandard<NumericType>     },
-      {Unit::MemoryRate::BytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BytePerMinute>::ToStandard<NumericType>    },
-      {Unit::MemoryRate::KilobitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::KibibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::KilobytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::KibibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::MegabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::MebibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::MegabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::MebibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::GigabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::GibibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::GigabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::GibibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::TerabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::TebibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::TerabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::TebibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::PetabitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::PebibitPerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibitPerMinute>::ToStandard<NumericType> },
-      {Unit::MemoryRate::PetabytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::PebibytePerMinute,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibytePerMinute>::ToStandard<NumericType>},
-      {Unit::MemoryRate::BitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BitPerHour>::ToStandard<NumericType>       },
-      {Unit::MemoryRate::BytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::BytePerHour>::ToStandard<NumericType>      },
-      {Unit::MemoryRate::KilobitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::KibibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::KilobytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KilobytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::KibibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::KibibytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::MegabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::MebibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::MegabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MegabytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::MebibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::MebibytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::GigabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::GibibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::GigabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GigabytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::GibibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::GibibytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::TerabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::TebibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::TerabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TerabytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::TebibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::TebibytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::PetabitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::PebibitPerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibitPerHour>::ToStandard<NumericType>   },
-      {Unit::MemoryRate::PetabytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PetabytePerHour>::ToStandard<NumericType>  },
-      {Unit::MemoryRate::PebibytePerHour,
-       Conversions<Unit::MemoryRate, Unit::MemoryRate::PebibytePerHour>::ToStandard<NumericType>  },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::MemoryRate, Unit::MemoryRate::PebibytePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(8.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L)
+      / static_cast<NumericType>(3600.0L));
+}
 
 }  // namespace Internal
 
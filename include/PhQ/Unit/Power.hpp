@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -100,6 +98,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Power unit) {
 
 namespace Internal {
 
+/// \brief Number of power units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Power>{9};
+
 template <>
 inline const std::map<UnitSystem, Unit::Power> ConsistentUnits<Unit::Power>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Power::Watt              },
@@ -132,7 +134,7 @@ inline const std::map<Unit::Power, std::string_view> Abbreviations<Unit::Power>{
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Power> Spellings<Unit::Power>{
+inline constexpr auto Spellings<Unit::Power>{MakeSpellingTable<Unit::Power>({
     {"W",          Unit::Power::Watt              },
     {"J/s",        Unit::Power::Watt              },
     {"N·m/s",      Unit::Power::Watt              },
@@ -171,180 +173,146 @@ inline const std::unordered_map<std::string_view, Unit::Power> Spellings<Unit::P
     {"in*lbf/s",   Unit::Power::InchPoundPerSecond},
     {"in·lb/s",    Unit::Power::InchPoundPerSecond},
     {"in*lb/s",    Unit::Power::InchPoundPerSecond},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Watt>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Power>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Watt>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Watt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Milliwatt>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Watt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Milliwatt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Milliwatt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Microwatt>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Milliwatt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Microwatt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Microwatt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Nanowatt>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Microwatt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Nanowatt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Nanowatt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Kilowatt>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Nanowatt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Kilowatt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Kilowatt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Megawatt>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Kilowatt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Megawatt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Megawatt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Gigawatt>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Megawatt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::Gigawatt>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Gigawatt>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::FootPoundPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
-            * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Power, Unit::Power::Gigawatt>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::FootPoundPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Power, Unit::Power::FootPoundPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::InchPoundPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
-            * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Power, Unit::Power::FootPoundPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Power, Unit::Power::InchPoundPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
-           * static_cast<NumericType>(9.80665L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Power, Unit::Power::InchPoundPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Power, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Power, NumericType>{
-      {Unit::Power::Watt,               Conversions<Unit::Power, Unit::Power::Watt>::FromStandard<NumericType>              },
-      {Unit::Power::Milliwatt,
-       Conversions<Unit::Power,                                  Unit::Power::Milliwatt>::FromStandard<NumericType>         },
-      {Unit::Power::Microwatt,
-       Conversions<Unit::Power,                                  Unit::Power::Microwatt>::FromStandard<NumericType>         },
-      {Unit::Power::Nanowatt,
-       Conversions<Unit::Power,                                  Unit::Power::Nanowatt>::FromStandard<NumericType>          },
-      {Unit::Power::Kilowatt,
-       Conversions<Unit::Power,                                  Unit::Power::Kilowatt>::FromStandard<NumericType>          },
-      {Unit::Power::Megawatt,
-       Conversions<Unit::Power,                                  Unit::Power::Megawatt>::FromStandard<NumericType>          },
-      {Unit::Power::Gigawatt,
-       Conversions<Unit::Power,                                  Unit::Power::Gigawatt>::FromStandard<NumericType>          },
-      {Unit::Power::FootPoundPerSecond,
-       Conversions<Unit::Power,                                  Unit::Power::FootPoundPerSecond>::FromStandard<NumericType>},
-      {Unit::Power::InchPoundPerSecond,
-       Conversions<Unit::Power,                                  Unit::Power::InchPoundPerSecond>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::Power, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::Power, NumericType>{
-          {Unit::Power::Watt,               Conversions<Unit::Power, Unit::Power::Watt>::ToStandard<NumericType>              },
-          {Unit::Power::Milliwatt,
-           Conversions<Unit::Power,                                  Unit::Power::Milliwatt>::ToStandard<NumericType>         },
-          {Unit::Power::Microwatt,
-           Conversions<Unit::Power,                                  Unit::Power::Microwatt>::ToStandard<NumericType>         },
-          {Unit::Power::Nanowatt,
-           Conversions<Unit::Power,                                  Unit::Power::Nanowatt>::ToStandard<NumericType>          },
-          {Unit::Power::Kilowatt,
-           Conversions<Unit::Power,                                  Unit::Power::Kilowatt>::ToStandard<NumericType>          },
-          {Unit::Power::Megawatt,
-           Conversions<Unit::Power,                                  Unit::Power::Megawatt>::ToStandard<NumericType>          },
-          {Unit::Power::Gigawatt,
-           Conversions<Unit::Power,                                  Unit::Power::Gigawatt>::ToStandard<NumericType>          },
-          {Unit::Power::FootPoundPerSecond,
-           Conversions<Unit::Power,                                  Unit::Power::FootPoundPerSecond>::ToStandard<NumericType>},
-          {Unit::Power::InchPoundPerSecond,
-           Conversions<Unit::Power,                                  Unit::Power::InchPoundPerSecond>::ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Power, Unit::Power::InchPoundPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.45359237L)
+      * static_cast<NumericType>(9.80665L));
+}
 
 }  // namespace Internal
 
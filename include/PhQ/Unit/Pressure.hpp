@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -97,6 +95,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Pressure unit)
 
 namespace Internal {
 
+/// \brief Number of pressure units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Pressure>{8};
+
 template <>
 inline const std::map<UnitSystem, Unit::Pressure> ConsistentUnits<Unit::Pressure>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Pressure::Pascal            },
@@ -126,7 +128,7 @@ inline const std::map<Unit::Pressure, std::string_view> Abbreviations<Unit::Pres
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Pressure> Spellings<Unit::Pressure>{
+inline constexpr auto Spellings<Unit::Pressure>{MakeSpellingTable<Unit::Pressure>({
     {"Pa",         Unit::Pressure::Pascal            },
     {"N/m^2",      Unit::Pressure::Pascal            },
     {"N/m2",       Unit::Pressure::Pascal            },
@@ -162,165 +164,132 @@ inline const std::unordered_map<std::string_view, Unit::Pressure> Spellings<Unit
     {"lb/in^2",    Unit::Pressure::PoundPerSquareInch},
     {"lb/in2",     Unit::Pressure::PoundPerSquareInch},
     {"psi",        Unit::Pressure::PoundPerSquareInch},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Pascal>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Pressure>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Pascal>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Pressure, Unit::Pressure::Pascal>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Kilopascal>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Pressure, Unit::Pressure::Pascal>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Kilopascal>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Kilopascal>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Megapascal>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Kilopascal>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Megapascal>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Megapascal>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Gigapascal>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Megapascal>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Gigapascal>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Gigapascal>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Bar>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.00001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Gigapascal>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Bar>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(100000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Pressure, Unit::Pressure::Bar>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.00001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Atmosphere>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(101325.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Pressure, Unit::Pressure::Bar>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(100000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::Atmosphere>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(101325.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Atmosphere>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(101325.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareFoot>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::Atmosphere>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(101325.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareFoot>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareFoot>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareInch>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareFoot>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareInch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareInch>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      / (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Pressure,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Pressure, NumericType>{
-      {Unit::Pressure::Pascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Pascal>::FromStandard<NumericType>            },
-      {Unit::Pressure::Kilopascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Kilopascal>::FromStandard<NumericType>        },
-      {Unit::Pressure::Megapascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Megapascal>::FromStandard<NumericType>        },
-      {Unit::Pressure::Gigapascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Gigapascal>::FromStandard<NumericType>        },
-      {Unit::Pressure::Bar,
-       Conversions<Unit::Pressure, Unit::Pressure::Bar>::FromStandard<NumericType>               },
-      {Unit::Pressure::Atmosphere,
-       Conversions<Unit::Pressure, Unit::Pressure::Atmosphere>::FromStandard<NumericType>        },
-      {Unit::Pressure::PoundPerSquareFoot,
-       Conversions<Unit::Pressure, Unit::Pressure::PoundPerSquareFoot>::FromStandard<NumericType>},
-      {Unit::Pressure::PoundPerSquareInch,
-       Conversions<Unit::Pressure, Unit::Pressure::PoundPerSquareInch>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Pressure,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Pressure, NumericType>{
-      {Unit::Pressure::Pascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Pascal>::ToStandard<NumericType>            },
-      {Unit::Pressure::Kilopascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Kilopascal>::ToStandard<NumericType>        },
-      {Unit::Pressure::Megapascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Megapascal>::ToStandard<NumericType>        },
-      {Unit::Pressure::Gigapascal,
-       Conversions<Unit::Pressure, Unit::Pressure::Gigapascal>::ToStandard<NumericType>        },
-      {Unit::Pressure::Bar,
-       Conversions<Unit::Pressure, Unit::Pressure::Bar>::ToStandard<NumericType>               },
-      {Unit::Pressure::Atmosphere,
-       Conversions<Unit::Pressure, Unit::Pressure::Atmosphere>::ToStandard<NumericType>        },
-      {Unit::Pressure::PoundPerSquareFoot,
-       Conversions<Unit::Pressure, Unit::Pressure::PoundPerSquareFoot>::ToStandard<NumericType>},
-      {Unit::Pressure::PoundPerSquareInch,
-       Conversions<Unit::Pressure, Unit::Pressure::PoundPerSquareInch>::ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareInch>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)));
+}
 
 }  // namespace Internal
 
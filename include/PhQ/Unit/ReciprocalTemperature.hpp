@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -86,6 +84,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ReciprocalTemp
 
 namespace Internal {
 
+/// \brief Number of reciprocal temperature units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ReciprocalTemperature>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::ReciprocalTemperature>
     ConsistentUnits<Unit::ReciprocalTemperature>{
@@ -111,8 +113,8 @@ inline const std::map<Unit::ReciprocalTemperature, std::string_view>
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::ReciprocalTemperature>
-    Spellings<Unit::ReciprocalTemperature>{
+inline constexpr auto Spellings<Unit::ReciprocalTemperature>{
+    MakeSpellingTable<Unit::ReciprocalTemperature>({
         {"1/K",    Unit::ReciprocalTemperature::PerKelvin    },
         {"1/°K",   Unit::ReciprocalTemperature::PerKelvin    },
         {"1/degK", Unit::ReciprocalTemperature::PerKelvin    },
@@ -137,101 +139,76 @@ inline const std::unordered_map<std::string_view, Unit::ReciprocalTemperature>
         {"/°F",    Unit::ReciprocalTemperature::PerFahrenheit},
         {"/F",     Unit::ReciprocalTemperature::PerFahrenheit},
         {"/degF",  Unit::ReciprocalTemperature::PerFahrenheit},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerKelvin>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::ReciprocalTemperature>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerKelvin>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerKelvin>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerCelsius>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerKelvin>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerCelsius>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerCelsius>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerRankine>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerCelsius>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerRankine>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerRankine>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerFahrenheit>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerRankine>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerFahrenheit>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerFahrenheit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.8L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::ReciprocalTemperature,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::ReciprocalTemperature, NumericType>{
-      {Unit::ReciprocalTemperature::PerKelvin,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerKelvin>::
-           FromStandard<NumericType>},
-      {Unit::ReciprocalTemperature::PerCelsius,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerCelsius>::
-           FromStandard<NumericType>},
-      {Unit::ReciprocalTemperature::PerRankine,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerRankine>::
-           FromStandard<NumericType>},
-      {Unit::ReciprocalTemperature::PerFahrenheit,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerFahrenheit>::
-           FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ReciprocalTemperature,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ReciprocalTemperature, NumericType>{
-      {Unit::ReciprocalTemperature::PerKelvin,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerKelvin>::
-           ToStandard<NumericType>},
-      {Unit::ReciprocalTemperature::PerCelsius,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerCelsius>::
-           ToStandard<NumericType>},
-      {Unit::ReciprocalTemperature::PerRankine,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerRankine>::
-           ToStandard<NumericType>},
-      {Unit::ReciprocalTemperature::PerFahrenheit,
-       Conversions<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerFahrenheit>::
-           ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ReciprocalTemperature, Unit::ReciprocalTemperature::PerFahrenheit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.8L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -83,6 +81,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SolidAngle uni
 
 namespace Internal {
 
+/// \brief Number of solid angle units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SolidAngle>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::SolidAngle> ConsistentUnits<Unit::SolidAngle>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::SolidAngle::Steradian},
@@ -105,7 +107,7 @@ inline const std::map<Unit::SolidAngle, std::string_view> Abbreviations<Unit::So
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SolidAngle> Spellings<Unit::SolidAngle>{
+inline constexpr auto Spellings<Unit::SolidAngle>{MakeSpellingTable<Unit::SolidAngle>({
     {"sr",           Unit::SolidAngle::Steradian      },
     {"rad^2",        Unit::SolidAngle::SquareDegree   },
     {"rad2",         Unit::SolidAngle::SquareDegree   },
@@ -143,95 +145,80 @@ inline const std::unordered_map<std::string_view, Unit::SolidAngle> Spellings<Un
     {"arcsecond2",   Unit::SolidAngle::SquareArcsecond},
     {"arcseconds^2", Unit::SolidAngle::SquareArcsecond},
     {"arcseconds2",  Unit::SolidAngle::SquareArcsecond},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::Steradian>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::SolidAngle>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::Steradian>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::Steradian>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(180.0L) * static_cast<NumericType>(180.0L)
-           / (Pi<NumericType> * Pi<NumericType>);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::Steradian>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> * Pi<NumericType>
-           / (static_cast<NumericType>(180.0L) * static_cast<NumericType>(180.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(180.0L) * static_cast<NumericType>(180.0L)
+      / (Pi<NumericType> * Pi<NumericType>));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcminute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10800.0L) * static_cast<NumericType>(10800.0L)
-           / (Pi<NumericType> * Pi<NumericType>);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> * Pi<NumericType>
+      / (static_cast<NumericType>(180.0L) * static_cast<NumericType>(180.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcminute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> * Pi<NumericType>
-           / (static_cast<NumericType>(10800.0L) * static_cast<NumericType>(10800.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcminute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(10800.0L) * static_cast<NumericType>(10800.0L)
+      / (Pi<NumericType> * Pi<NumericType>));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcsecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(648000.0L) * static_cast<NumericType>(648000.0L)
-           / (Pi<NumericType> * Pi<NumericType>);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcminute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> * Pi<NumericType>
+      / (static_cast<NumericType>(10800.0L) * static_cast<NumericType>(10800.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcsecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= Pi<NumericType> * Pi<NumericType>
-           / (static_cast<NumericType>(648000.0L) * static_cast<NumericType>(648000.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcsecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(648000.0L) * static_cast<NumericType>(648000.0L)
+      / (Pi<NumericType> * Pi<NumericType>));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::SolidAngle,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::SolidAngle, NumericType>{
-      {Unit::SolidAngle::Steradian,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::Steradian>::FromStandard<NumericType>      },
-      {Unit::SolidAngle::SquareDegree,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::FromStandard<NumericType>   },
-      {Unit::SolidAngle::SquareArcminute,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareArcminute>::FromStandard<NumericType>},
-      {Unit::SolidAngle::SquareArcsecond,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareArcsecond>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SolidAngle,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SolidAngle, NumericType>{
-      {Unit::SolidAngle::Steradian,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::Steradian>::ToStandard<NumericType>      },
-      {Unit::SolidAngle::SquareDegree,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::ToStandard<NumericType>   },
-      {Unit::SolidAngle::SquareArcminute,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareArcminute>::ToStandard<NumericType>},
-      {Unit::SolidAngle::SquareArcsecond,
-       Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareArcsecond>::ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcsecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      Pi<NumericType> * Pi<NumericType>
+      / (static_cast<NumericType>(648000.0L) * static_cast<NumericType>(648000.0L)));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -86,6 +84,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SpecificEnergy
 
 namespace Internal {
 
+/// \brief Number of mass-specific energy units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SpecificEnergy>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::SpecificEnergy> ConsistentUnits<Unit::SpecificEnergy>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificEnergy::JoulePerKilogram  },
@@ -113,8 +115,9 @@ inline const std::map<Unit::SpecificEnergy, std::string_view> Abbreviations<Unit
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SpecificEnergy> Spellings<
-    Unit::SpecificEnergy>{
+inline constexpr auto Spellings<
+    Unit::SpecificEnergy>{MakeSpellingTable<
+    Unit::SpecificEnergy>({
     {"J/kg",          Unit::SpecificEnergy::JoulePerKilogram  },
     {"N·m/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
     {"N*m/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
@@ -153,97 +156,80 @@ inline const std::unordered_map<std::string_view, Unit::SpecificEnergy> Spelling
     {"lb*in/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
     {"in^2/s^2",      Unit::SpecificEnergy::InchPoundPerSlinch},
     {"in2/s2",        Unit::SpecificEnergy::InchPoundPerSlinch},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::JoulePerKilogram>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::SpecificEnergy>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::JoulePerKilogram>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::JoulePerKilogram>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::NanojoulePerGram>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::JoulePerKilogram>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::NanojoulePerGram>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::NanojoulePerGram>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::FootPoundPerSlug>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::NanojoulePerGram>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::FootPoundPerSlug>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::FootPoundPerSlug>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::InchPoundPerSlinch>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::FootPoundPerSlug>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::InchPoundPerSlinch>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::InchPoundPerSlinch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::SpecificEnergy, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::SpecificEnergy, NumericType>{
-          {Unit::SpecificEnergy::JoulePerKilogram,
-           Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::JoulePerKilogram>::
-               FromStandard<NumericType>},
-          {Unit::SpecificEnergy::NanojoulePerGram,
-           Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::NanojoulePerGram>::
-               FromStandard<NumericType>},
-          {Unit::SpecificEnergy::FootPoundPerSlug,
-           Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::FootPoundPerSlug>::
-               FromStandard<NumericType>},
-          {Unit::SpecificEnergy::InchPoundPerSlinch,
-           Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::InchPoundPerSlinch>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SpecificEnergy,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SpecificEnergy, NumericType>{
-      {Unit::SpecificEnergy::JoulePerKilogram,
-       Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::JoulePerKilogram>::
-           ToStandard<NumericType>},
-      {Unit::SpecificEnergy::NanojoulePerGram,
-       Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::NanojoulePerGram>::
-           ToStandard<NumericType>},
-      {Unit::SpecificEnergy::FootPoundPerSlug,
-       Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::FootPoundPerSlug>::
-           ToStandard<NumericType>},
-      {Unit::SpecificEnergy::InchPoundPerSlinch,
-       Conversions<Unit::SpecificEnergy, Unit::SpecificEnergy::InchPoundPerSlinch>::
-           ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::InchPoundPerSlinch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -87,6 +85,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SpecificHeatCa
 
 namespace Internal {
 
+/// \brief Number of mass-specific heat capacity units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SpecificHeatCapacity>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::SpecificHeatCapacity> ConsistentUnits<
     Unit::SpecificHeatCapacity>{
@@ -117,8 +119,9 @@ inline const std::map<Unit::SpecificHeatCapacity, std::string_view>
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SpecificHeatCapacity> Spellings<
-    Unit::SpecificHeatCapacity>{
+inline constexpr auto Spellings<
+    Unit::SpecificHeatCapacity>{MakeSpellingTable<
+    Unit::SpecificHeatCapacity>({
     {"J/kg/K",             Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
     {"J/(kg·K)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
     {"J/(kg*K)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
@@ -421,116 +424,85 @@ inline const std::unordered_map<std::string_view, Unit::SpecificHeatCapacity> Sp
     {"in2/s2/F",           Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
     {"in2/(s2·F)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
     {"in2/(s2*F)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-};
+})};
 
 // clang-format on
 
+static_assert(IsNumberOfUnitsConsistent<Unit::SpecificHeatCapacity>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
+
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::SpecificHeatCapacity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::SpecificHeatCapacity, NumericType>{
-      {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>::
-           FromStandard<NumericType>},
-      {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>::
-           FromStandard<NumericType>},
-      {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>::
-           FromStandard<NumericType>},
-      {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>::
-           FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SpecificHeatCapacity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SpecificHeatCapacity, NumericType>{
-      {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>::ToStandard<NumericType>},
-      {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>::ToStandard<NumericType>},
-      {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>::
-           ToStandard<NumericType>                                                    },
-      {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine,
-       Conversions<Unit::SpecificHeatCapacity,
-       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>::
-           ToStandard<NumericType>                                                    },
-};
-
 }  // namespace Internal
 
 }  // namespace PhQ
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -86,6 +84,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SpecificPower
 
 namespace Internal {
 
+/// \brief Number of mass-specific power units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SpecificPower>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::SpecificPower> ConsistentUnits<Unit::SpecificPower>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificPower::WattPerKilogram            },
@@ -113,8 +115,9 @@ inline const std::map<Unit::SpecificPower, std::string_view> Abbreviations<Unit:
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SpecificPower> Spellings<
-    Unit::SpecificPower>{
+inline constexpr auto Spellings<
+    Unit::SpecificPower>{MakeSpellingTable<
+    Unit::SpecificPower>({
     {"W/kg",              Unit::SpecificPower::WattPerKilogram            },
     {"N·m/kg/s",          Unit::SpecificPower::WattPerKilogram            },
     {"N*m/kg/s",          Unit::SpecificPower::WattPerKilogram            },
@@ -237,101 +240,76 @@ inline const std::unordered_map<std::string_view, Unit::SpecificPower> Spellings
     {"lb*in/(s*slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
     {"in^2/s^3",          Unit::SpecificPower::InchPoundPerSlinchPerSecond},
     {"in2/s3",            Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificPower, Unit::SpecificPower::WattPerKilogram>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::SpecificPower>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificPower, Unit::SpecificPower::WattPerKilogram>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::WattPerKilogram>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificPower, Unit::SpecificPower::NanowattPerGram>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::WattPerKilogram>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SpecificPower, Unit::SpecificPower::NanowattPerGram>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::NanowattPerGram>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::SpecificPower, Unit::SpecificPower::FootPoundPerSlugPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::NanowattPerGram>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::SpecificPower, Unit::SpecificPower::FootPoundPerSlugPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::FootPoundPerSlugPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::SpecificPower, Unit::SpecificPower::InchPoundPerSlinchPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::FootPoundPerSlugPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::SpecificPower, Unit::SpecificPower::InchPoundPerSlinchPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::InchPoundPerSlinchPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::SpecificPower, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::SpecificPower, NumericType>{
-          {Unit::SpecificPower::WattPerKilogram,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::WattPerKilogram>::
-               FromStandard<NumericType>},
-          {Unit::SpecificPower::NanowattPerGram,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::NanowattPerGram>::
-               FromStandard<NumericType>},
-          {Unit::SpecificPower::FootPoundPerSlugPerSecond,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::FootPoundPerSlugPerSecond>::
-               FromStandard<NumericType>},
-          {Unit::SpecificPower::InchPoundPerSlinchPerSecond,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::InchPoundPerSlinchPerSecond>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::SpecificPower, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::SpecificPower, NumericType>{
-          {Unit::SpecificPower::WattPerKilogram,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::WattPerKilogram>::
-               ToStandard<NumericType>},
-          {Unit::SpecificPower::NanowattPerGram,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::NanowattPerGram>::
-               ToStandard<NumericType>},
-          {Unit::SpecificPower::FootPoundPerSlugPerSecond,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::FootPoundPerSlugPerSecond>::
-               ToStandard<NumericType>},
-          {Unit::SpecificPower::InchPoundPerSlinchPerSecond,
-           Conversions<Unit::SpecificPower, Unit::SpecificPower::InchPoundPerSlinchPerSecond>::
-               ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SpecificPower, Unit::SpecificPower::InchPoundPerSlinchPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
+}
 
 }  // namespace Internal
 
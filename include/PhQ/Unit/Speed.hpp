@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -190,6 +188,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Speed unit) {
 
 namespace Internal {
 
+/// \brief Number of speed units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Speed>{39};
+
 template <>
 inline const std::map<UnitSystem, Unit::Speed> ConsistentUnits<Unit::Speed>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Speed::MetrePerSecond     },
@@ -252,7 +254,7 @@ inline const std::map<Unit::Speed, std::string_view> Abbreviations<Unit::Speed>{
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Speed> Spellings<Unit::Speed>{
+inline constexpr auto Spellings<Unit::Speed>{MakeSpellingTable<Unit::Speed>({
     {"m/s",           Unit::Speed::MetrePerSecond       },
     {"m/min",         Unit::Speed::MetrePerMinute       },
     {"m/hr",          Unit::Speed::MetrePerHour         },
@@ -310,716 +312,588 @@ inline const std::unordered_map<std::string_view, Unit::Speed> Spellings<Unit::S
     {"uin/s",         Unit::Speed::MicroinchPerSecond   },
     {"uin/min",       Unit::Speed::MicroinchPerMinute   },
     {"uin/hr",        Unit::Speed::MicroinchPerHour     },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MetrePerSecond>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Speed>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MetrePerSecond>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MetrePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MetrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MetrePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MetrePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MetrePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MetrePerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MetrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MetrePerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::NauticalMilePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MetrePerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::NauticalMilePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::NauticalMilePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::NauticalMilePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::NauticalMilePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::NauticalMilePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::NauticalMilePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::Knot>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::NauticalMilePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::Knot>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::Knot>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::Knot>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MilePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MilePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MilePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MilePerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MilePerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::KilometrePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::MilePerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::KilometrePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::KilometrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::KilometrePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.06L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::KilometrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::KilometrePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::KilometrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.06L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::KilometrePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3.6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::KilometrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::KilometrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::KilometrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3.6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::YardPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::KilometrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1000.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::YardPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::YardPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::YardPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::YardPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::YardPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::YardPerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::YardPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::YardPerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::YardPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::YardPerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::FootPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::YardPerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::FootPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::FootPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::FootPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::FootPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::FootPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::FootPerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::FootPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::FootPerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::FootPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::FootPerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::DecimetrePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(10.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::FootPerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::DecimetrePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.1L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::DecimetrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(10.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::DecimetrePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::DecimetrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.1L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::DecimetrePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::DecimetrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::DecimetrePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(36000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::DecimetrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::DecimetrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(36000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::DecimetrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(36000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::InchPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::DecimetrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(36000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::InchPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::InchPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::InchPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::InchPerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::InchPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::InchPerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::InchPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::InchPerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::InchPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::InchPerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::CentimetrePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(100.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Speed, Unit::Speed::InchPerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::CentimetrePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.01L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::CentimetrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(100.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::CentimetrePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(6000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::CentimetrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.01L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::CentimetrePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(6000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::CentimetrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(6000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::CentimetrePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(360000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::CentimetrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(6000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::CentimetrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(360000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::CentimetrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(360000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MillimetrePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::CentimetrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(360000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MillimetrePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MillimetrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MillimetrePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MillimetrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MillimetrePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MillimetrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MillimetrePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MillimetrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MillimetrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MillimetrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilliinchPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MillimetrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilliinchPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MilliinchPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilliinchPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MilliinchPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilliinchPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MilliinchPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilliinchPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MilliinchPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MilliinchPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MilliinchPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicrometrePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MilliinchPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicrometrePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicrometrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicrometrePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicrometrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicrometrePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicrometrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicrometrePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicrometrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicrometrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicrometrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicroinchPerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicrometrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicroinchPerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicroinchPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicroinchPerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicroinchPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicroinchPerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicroinchPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicroinchPerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicroinchPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicroinchPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicroinchPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.0000000254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Speed, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Speed, NumericType>{
-      {Unit::Speed::MetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MetrePerSecond>::FromStandard<NumericType>       },
-      {Unit::Speed::MetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MetrePerMinute>::FromStandard<NumericType>       },
-      {Unit::Speed::MetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MetrePerHour>::FromStandard<NumericType>         },
-      {Unit::Speed::NauticalMilePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerSecond>::FromStandard<NumericType>},
-      {Unit::Speed::NauticalMilePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerMinute>::FromStandard<NumericType>},
-      {Unit::Speed::Knot,                  Conversions<Unit::Speed, Unit::Speed::Knot>::FromStandard<NumericType>                 },
-      {Unit::Speed::MilePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilePerSecond>::FromStandard<NumericType>        },
-      {Unit::Speed::MilePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilePerMinute>::FromStandard<NumericType>        },
-      {Unit::Speed::MilePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilePerHour>::FromStandard<NumericType>          },
-      {Unit::Speed::KilometrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerSecond>::FromStandard<NumericType>   },
-      {Unit::Speed::KilometrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerMinute>::FromStandard<NumericType>   },
-      {Unit::Speed::KilometrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerHour>::FromStandard<NumericType>     },
-      {Unit::Speed::YardPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::YardPerSecond>::FromStandard<NumericType>        },
-      {Unit::Speed::YardPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::YardPerMinute>::FromStandard<NumericType>        },
-      {Unit::Speed::YardPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::YardPerHour>::FromStandard<NumericType>          },
-      {Unit::Speed::FootPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::FootPerSecond>::FromStandard<NumericType>        },
-      {Unit::Speed::FootPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::FootPerMinute>::FromStandard<NumericType>        },
-      {Unit::Speed::FootPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::FootPerHour>::FromStandard<NumericType>          },
-      {Unit::Speed::DecimetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerSecond>::FromStandard<NumericType>   },
-      {Unit::Speed::DecimetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerMinute>::FromStandard<NumericType>   },
-      {Unit::Speed::DecimetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerHour>::FromStandard<NumericType>     },
-      {Unit::Speed::InchPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::InchPerSecond>::FromStandard<NumericType>        },
-      {Unit::Speed::InchPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::InchPerMinute>::FromStandard<NumericType>        },
-      {Unit::Speed::InchPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::InchPerHour>::FromStandard<NumericType>          },
-      {Unit::Speed::CentimetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerSecond>::FromStandard<NumericType>  },
-      {Unit::Speed::CentimetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerMinute>::FromStandard<NumericType>  },
-      {Unit::Speed::CentimetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerHour>::FromStandard<NumericType>    },
-      {Unit::Speed::MillimetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerSecond>::FromStandard<NumericType>  },
-      {Unit::Speed::MillimetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerMinute>::FromStandard<NumericType>  },
-      {Unit::Speed::MillimetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerHour>::FromStandard<NumericType>    },
-      {Unit::Speed::MilliinchPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerSecond>::FromStandard<NumericType>   },
-      {Unit::Speed::MilliinchPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerMinute>::FromStandard<NumericType>   },
-      {Unit::Speed::MilliinchPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerHour>::FromStandard<NumericType>     },
-      {Unit::Speed::MicrometrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerSecond>::FromStandard<NumericType>  },
-      {Unit::Speed::MicrometrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerMinute>::FromStandard<NumericType>  },
-      {Unit::Speed::MicrometrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerHour>::FromStandard<NumericType>    },
-      {Unit::Speed::MicroinchPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerSecond>::FromStandard<NumericType>   },
-      {Unit::Speed::MicroinchPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerMinute>::FromStandard<NumericType>   },
-      {Unit::Speed::MicroinchPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerHour>::FromStandard<NumericType>     },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Speed,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Speed, NumericType>{
-      {Unit::Speed::MetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MetrePerSecond>::ToStandard<NumericType>       },
-      {Unit::Speed::MetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MetrePerMinute>::ToStandard<NumericType>       },
-      {Unit::Speed::MetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MetrePerHour>::ToStandard<NumericType>         },
-      {Unit::Speed::NauticalMilePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerSecond>::ToStandard<NumericType>},
-      {Unit::Speed::NauticalMilePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerMinute>::ToStandard<NumericType>},
-      {Unit::Speed::Knot,                  Conversions<Unit::Speed, Unit::Speed::Knot>::ToStandard<NumericType>                 },
-      {Unit::Speed::MilePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilePerSecond>::ToStandard<NumericType>        },
-      {Unit::Speed::MilePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilePerMinute>::ToStandard<NumericType>        },
-      {Unit::Speed::MilePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilePerHour>::ToStandard<NumericType>          },
-      {Unit::Speed::KilometrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerSecond>::ToStandard<NumericType>   },
-      {Unit::Speed::KilometrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerMinute>::ToStandard<NumericType>   },
-      {Unit::Speed::KilometrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerHour>::ToStandard<NumericType>     },
-      {Unit::Speed::YardPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::YardPerSecond>::ToStandard<NumericType>        },
-      {Unit::Speed::YardPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::YardPerMinute>::ToStandard<NumericType>        },
-      {Unit::Speed::YardPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::YardPerHour>::ToStandard<NumericType>          },
-      {Unit::Speed::FootPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::FootPerSecond>::ToStandard<NumericType>        },
-      {Unit::Speed::FootPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::FootPerMinute>::ToStandard<NumericType>        },
-      {Unit::Speed::FootPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::FootPerHour>::ToStandard<NumericType>          },
-      {Unit::Speed::DecimetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerSecond>::ToStandard<NumericType>   },
-      {Unit::Speed::DecimetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerMinute>::ToStandard<NumericType>   },
-      {Unit::Speed::DecimetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerHour>::ToStandard<NumericType>     },
-      {Unit::Speed::InchPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::InchPerSecond>::ToStandard<NumericType>        },
-      {Unit::Speed::InchPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::InchPerMinute>::ToStandard<NumericType>        },
-      {Unit::Speed::InchPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::InchPerHour>::ToStandard<NumericType>          },
-      {Unit::Speed::CentimetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerSecond>::ToStandard<NumericType>  },
-      {Unit::Speed::CentimetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerMinute>::ToStandard<NumericType>  },
-      {Unit::Speed::CentimetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerHour>::ToStandard<NumericType>    },
-      {Unit::Speed::MillimetrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerSecond>::ToStandard<NumericType>  },
-      {Unit::Speed::MillimetrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerMinute>::ToStandard<NumericType>  },
-      {Unit::Speed::MillimetrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerHour>::ToStandard<NumericType>    },
-      {Unit::Speed::MilliinchPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerSecond>::ToStandard<NumericType>   },
-      {Unit::Speed::MilliinchPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerMinute>::ToStandard<NumericType>   },
-      {Unit::Speed::MilliinchPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerHour>::ToStandard<NumericType>     },
-      {Unit::Speed::MicrometrePerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerSecond>::ToStandard<NumericType>  },
-      {Unit::Speed::MicrometrePerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerMinute>::ToStandard<NumericType>  },
-      {Unit::Speed::MicrometrePerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerHour>::ToStandard<NumericType>    },
-      {Unit::Speed::MicroinchPerSecond,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerSecond>::ToStandard<NumericType>   },
-      {Unit::Speed::MicroinchPerMinute,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerMinute>::ToStandard<NumericType>   },
-      {Unit::Speed::MicroinchPerHour,
-       Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerHour>::ToStandard<NumericType>     },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Speed, Unit::Speed::MicroinchPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L));
+}
 
 }  // namespace Internal
 
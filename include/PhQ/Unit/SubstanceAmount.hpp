@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -89,6 +87,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SubstanceAmoun
 
 namespace Internal {
 
+/// \brief Number of amount of substance units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SubstanceAmount>{5};
+
 template <>
 inline const std::map<UnitSystem, Unit::SubstanceAmount> ConsistentUnits<Unit::SubstanceAmount>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::SubstanceAmount::Mole},
@@ -111,121 +113,86 @@ inline const std::map<Unit::SubstanceAmount, std::string_view> Abbreviations<Uni
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SubstanceAmount>
-    Spellings<Unit::SubstanceAmount>{
+inline constexpr auto Spellings<Unit::SubstanceAmount>{MakeSpellingTable<Unit::SubstanceAmount>({
       {"mol",       Unit::SubstanceAmount::Mole     },
       {"kmol",      Unit::SubstanceAmount::Kilomole },
       {"Mmol",      Unit::SubstanceAmount::Megamole },
       {"Gmol",      Unit::SubstanceAmount::Gigamole },
       {"particles", Unit::SubstanceAmount::Particles},
-};
+})};
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Mole>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::SubstanceAmount>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Mole>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Mole>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Kilomole>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Mole>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Kilomole>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Kilomole>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Megamole>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Kilomole>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Megamole>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Megamole>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Gigamole>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Megamole>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Gigamole>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Gigamole>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Particles>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(6.02214076E23L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Gigamole>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Particles>::
-    ToStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(6.02214076E23L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Particles>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(6.02214076E23L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::SubstanceAmount, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::SubstanceAmount, NumericType>{
-          {Unit::SubstanceAmount::Mole,
-           Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Mole>::
-               FromStandard<NumericType>},
-          {Unit::SubstanceAmount::Kilomole,
-           Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Kilomole>::
-               FromStandard<NumericType>},
-          {Unit::SubstanceAmount::Megamole,
-           Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Megamole>::
-               FromStandard<NumericType>},
-          {Unit::SubstanceAmount::Gigamole,
-           Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Gigamole>::
-               FromStandard<NumericType>},
-          {Unit::SubstanceAmount::Particles,
-           Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Particles>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SubstanceAmount,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SubstanceAmount, NumericType>{
-      {Unit::SubstanceAmount::Mole,
-       Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Mole>::ToStandard<NumericType>},
-      {Unit::SubstanceAmount::Kilomole,
-       Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Kilomole>::
-           ToStandard<NumericType>                    },
-      {Unit::SubstanceAmount::Megamole,
-       Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Megamole>::
-           ToStandard<NumericType>                    },
-      {Unit::SubstanceAmount::Gigamole,
-       Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Gigamole>::
-           ToStandard<NumericType>                    },
-      {Unit::SubstanceAmount::Particles,
-       Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Particles>::
-           ToStandard<NumericType>                    },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Particles>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(6.02214076E23L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -87,6 +85,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Temperature un
 
 namespace Internal {
 
+/// \brief Number of temperature units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Temperature>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::Temperature> ConsistentUnits<Unit::Temperature>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Temperature::Kelvin },
@@ -109,7 +111,7 @@ inline const std::map<Unit::Temperature, std::string_view> Abbreviations<Unit::T
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Temperature> Spellings<Unit::Temperature>{
+inline constexpr auto Spellings<Unit::Temperature>{MakeSpellingTable<Unit::Temperature>({
     {"K",    Unit::Temperature::Kelvin    },
     {"°K",   Unit::Temperature::Kelvin    },
     {"degK", Unit::Temperature::Kelvin    },
@@ -122,90 +124,70 @@ inline const std::unordered_map<std::string_view, Unit::Temperature> Spellings<U
     {"°F",   Unit::Temperature::Fahrenheit},
     {"F",    Unit::Temperature::Fahrenheit},
     {"degF", Unit::Temperature::Fahrenheit},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Kelvin>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Temperature>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Kelvin>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Kelvin>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Celsius>::FromStandard(
-    NumericType& value) noexcept {
-  value -= static_cast<NumericType>(273.15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Kelvin>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Celsius>::ToStandard(
-    NumericType& value) noexcept {
-  value += static_cast<NumericType>(273.15L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Celsius>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Addition(static_cast<NumericType>(-273.15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Rankine>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Celsius>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Addition(static_cast<NumericType>(273.15L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Rankine>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Rankine>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Fahrenheit>::FromStandard(
-    NumericType& value) noexcept {
-  value = static_cast<NumericType>(1.8L) * value - static_cast<NumericType>(459.67L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Rankine>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Fahrenheit>::ToStandard(
-    NumericType& value) noexcept {
-  value = (value + static_cast<NumericType>(459.67L)) / static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Fahrenheit>::FromStandardStep() noexcept {
+  return {static_cast<NumericType>(0), static_cast<NumericType>(1.8L), false,
+          static_cast<NumericType>(-459.67L)};
 }
 
+template <>
 template <typename NumericType>
-inline const std::
-    map<Unit::Temperature, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::Temperature, NumericType>{
-          {Unit::Temperature::Kelvin,
-           Conversions<Unit::Temperature, Unit::Temperature::Kelvin>::FromStandard<NumericType> },
-          {Unit::Temperature::Celsius,
-           Conversions<Unit::Temperature, Unit::Temperature::Celsius>::FromStandard<NumericType>},
-          {Unit::Temperature::Rankine,
-           Conversions<Unit::Temperature, Unit::Temperature::Rankine>::FromStandard<NumericType>},
-          {Unit::Temperature::Fahrenheit,
-           Conversions<Unit::Temperature, Unit::Temperature::Fahrenheit>::
-               FromStandard<NumericType>               },
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::Temperature, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::Temperature, NumericType>{
-          {Unit::Temperature::Kelvin,
-           Conversions<Unit::Temperature, Unit::Temperature::Kelvin>::ToStandard<NumericType>    },
-          {Unit::Temperature::Celsius,
-           Conversions<Unit::Temperature, Unit::Temperature::Celsius>::ToStandard<NumericType>   },
-          {Unit::Temperature::Rankine,
-           Conversions<Unit::Temperature, Unit::Temperature::Rankine>::ToStandard<NumericType>   },
-          {Unit::Temperature::Fahrenheit,
-           Conversions<Unit::Temperature, Unit::Temperature::Fahrenheit>::ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Temperature, Unit::Temperature::Fahrenheit>::ToStandardStep() noexcept {
+  return {static_cast<NumericType>(459.67L), static_cast<NumericType>(1.8L), true,
+          static_cast<NumericType>(0)};
+}
 
 }  // namespace Internal
 
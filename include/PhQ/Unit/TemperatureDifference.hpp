@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -88,6 +86,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::TemperatureDif
 
 namespace Internal {
 
+/// \brief Number of temperature difference units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::TemperatureDifference>{4};
+
 template <>
 inline const std::map<UnitSystem, Unit::TemperatureDifference>
     ConsistentUnits<Unit::TemperatureDifference>{
@@ -113,8 +115,8 @@ inline const std::map<Unit::TemperatureDifference, std::string_view>
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::TemperatureDifference>
-    Spellings<Unit::TemperatureDifference>{
+inline constexpr auto Spellings<Unit::TemperatureDifference>{
+    MakeSpellingTable<Unit::TemperatureDifference>({
         {"K",    Unit::TemperatureDifference::Kelvin    },
         {"°K",   Unit::TemperatureDifference::Kelvin    },
         {"degK", Unit::TemperatureDifference::Kelvin    },
@@ -127,99 +129,76 @@ inline const std::unordered_map<std::string_view, Unit::TemperatureDifference>
         {"°F",   Unit::TemperatureDifference::Fahrenheit},
         {"F",    Unit::TemperatureDifference::Fahrenheit},
         {"degF", Unit::TemperatureDifference::Fahrenheit},
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Kelvin>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::TemperatureDifference>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Kelvin>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Kelvin>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Celsius>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Kelvin>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Celsius>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Celsius>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Rankine>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Celsius>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Rankine>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Rankine>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Fahrenheit>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Rankine>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Fahrenheit>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.8L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Fahrenheit>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.8L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::TemperatureDifference,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::TemperatureDifference, NumericType>{
-      {Unit::TemperatureDifference::Kelvin,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Kelvin>::
-           FromStandard<NumericType>},
-      {Unit::TemperatureDifference::Celsius,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Celsius>::
-           FromStandard<NumericType>},
-      {Unit::TemperatureDifference::Rankine,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Rankine>::
-           FromStandard<NumericType>},
-      {Unit::TemperatureDifference::Fahrenheit,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Fahrenheit>::
-           FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::TemperatureDifference,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::TemperatureDifference, NumericType>{
-      {Unit::TemperatureDifference::Kelvin,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Kelvin>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureDifference::Celsius,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Celsius>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureDifference::Rankine,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Rankine>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureDifference::Fahrenheit,
-       Conversions<Unit::TemperatureDifference, Unit::TemperatureDifference::Fahrenheit>::
-           ToStandard<NumericType>},
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Fahrenheit>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.8L));
+}
 
 }  // namespace Internal
 
@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -98,6 +96,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::TemperatureGra
 
 namespace Internal {
 
+/// \brief Number of temperature gradient units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::TemperatureGradient>{8};
+
 template <>
 inline const std::map<UnitSystem, Unit::TemperatureGradient>
     ConsistentUnits<Unit::TemperatureGradient>{
@@ -132,8 +134,8 @@ inline const std::map<Unit::TemperatureGradient, std::string_view>
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::TemperatureGradient>
-    Spellings<Unit::TemperatureGradient>{
+inline constexpr auto Spellings<Unit::TemperatureGradient>{
+    MakeSpellingTable<Unit::TemperatureGradient>({
         {"K/m",     Unit::TemperatureGradient::KelvinPerMetre      },
         {"°K/m",    Unit::TemperatureGradient::KelvinPerMetre      },
         {"degK/m",  Unit::TemperatureGradient::KelvinPerMetre      },
@@ -158,190 +160,149 @@ inline const std::unordered_map<std::string_view, Unit::TemperatureGradient>
         {"°F/in",   Unit::TemperatureGradient::FahrenheitPerInch   },
         {"F/in",    Unit::TemperatureGradient::FahrenheitPerInch   },
         {"degF/in", Unit::TemperatureGradient::FahrenheitPerInch   },
-};
+})};
 
 // clang-format on
 
+static_assert(IsNumberOfUnitsConsistent<Unit::TemperatureGradient>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
+
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMetre>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMetre>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMillimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMillimetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMillimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMillimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMetre>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMetre>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMillimetre>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMillimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMillimetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerFoot>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerFoot>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerFoot>::ToStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerFoot>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerInch>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerInch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerInch>::ToStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerInch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerFoot>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerFoot>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerFoot>::ToStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerFoot>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerInch>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerInch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerInch>::ToStandard(
-    NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerInch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L));
 }
 
-template <typename NumericType>
-inline const std::
-    map<Unit::TemperatureGradient, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsFromStandard<Unit::TemperatureGradient, NumericType>{
-          {Unit::TemperatureGradient::KelvinPerMetre,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMetre>::
-               FromStandard<NumericType>},
-          {Unit::TemperatureGradient::KelvinPerMillimetre,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMillimetre>::
-               FromStandard<NumericType>},
-          {Unit::TemperatureGradient::CelsiusPerMetre,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMetre>::
-               FromStandard<NumericType>},
-          {Unit::TemperatureGradient::CelsiusPerMillimetre,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMillimetre>::
-               FromStandard<NumericType>},
-          {Unit::TemperatureGradient::RankinePerFoot,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerFoot>::
-               FromStandard<NumericType>},
-          {Unit::TemperatureGradient::RankinePerInch,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerInch>::
-               FromStandard<NumericType>},
-          {Unit::TemperatureGradient::FahrenheitPerFoot,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerFoot>::
-               FromStandard<NumericType>},
-          {Unit::TemperatureGradient::FahrenheitPerInch,
-           Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerInch>::
-               FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::TemperatureGradient,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::TemperatureGradient, NumericType>{
-      {Unit::TemperatureGradient::KelvinPerMetre,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMetre>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureGradient::KelvinPerMillimetre,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::KelvinPerMillimetre>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureGradient::CelsiusPerMetre,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMetre>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureGradient::CelsiusPerMillimetre,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::CelsiusPerMillimetre>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureGradient::RankinePerFoot,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerFoot>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureGradient::RankinePerInch,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::RankinePerInch>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureGradient::FahrenheitPerFoot,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerFoot>::
-           ToStandard<NumericType>},
-      {Unit::TemperatureGradient::FahrenheitPerInch,
-       Conversions<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerInch>::
-           ToStandard<NumericType>},
-};
-
 }  // namespace Internal
 
 }  // namespace PhQ
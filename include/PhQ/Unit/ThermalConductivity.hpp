@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -83,6 +81,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ThermalConduct
 
 namespace Internal {
 
+/// \brief Number of thermal conductivity units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ThermalConductivity>{3};
+
 template <>
 inline const std::map<UnitSystem, Unit::ThermalConductivity>
     ConsistentUnits<Unit::ThermalConductivity>{
@@ -112,8 +114,9 @@ inline const std::map<Unit::ThermalConductivity, std::string_view>
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::ThermalConductivity> Spellings<
-    Unit::ThermalConductivity>{
+inline constexpr auto Spellings<
+    Unit::ThermalConductivity>{MakeSpellingTable<
+    Unit::ThermalConductivity>({
     {"W/m/K",           Unit::ThermalConductivity::WattPerMetrePerKelvin         },
     {"W/m/°K",          Unit::ThermalConductivity::WattPerMetrePerKelvin         },
     {"W/m/degK",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
@@ -234,88 +237,65 @@ inline const std::unordered_map<std::string_view, Unit::ThermalConductivity> Spe
     {"lb/(s*°F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
     {"lb/(s*F)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
     {"lb/(s*degF)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-};
+})};
 
 // clang-format on
 
+static_assert(IsNumberOfUnitsConsistent<Unit::ThermalConductivity>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
+
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::WattPerMetrePerKelvin>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
-Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::WattPerMetrePerKelvin>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::WattPerMetrePerKelvin>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::PoundPerSecondPerRankine>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-            * static_cast<NumericType>(1.8L));
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      * static_cast<NumericType>(1.8L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::PoundPerSecondPerRankine>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           * static_cast<NumericType>(1.8L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
+      * static_cast<NumericType>(1.8L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::ThermalConductivity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::ThermalConductivity, NumericType>{
-      {Unit::ThermalConductivity::WattPerMetrePerKelvin,
-       Conversions<Unit::ThermalConductivity, Unit::ThermalConductivity::WattPerMetrePerKelvin>::
-           FromStandard<NumericType>},
-      {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin,
-       Conversions<Unit::ThermalConductivity,
-       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>::
-           FromStandard<NumericType>                                             },
-      {Unit::ThermalConductivity::PoundPerSecondPerRankine,
-       Conversions<Unit::ThermalConductivity, Unit::ThermalConductivity::PoundPerSecondPerRankine>::
-           FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ThermalConductivity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ThermalConductivity, NumericType>{
-      {Unit::ThermalConductivity::WattPerMetrePerKelvin,
-       Conversions<Unit::ThermalConductivity, Unit::ThermalConductivity::WattPerMetrePerKelvin>::
-           ToStandard<NumericType>},
-      {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin,
-       Conversions<Unit::ThermalConductivity,
-       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>::
-           ToStandard<NumericType>                                             },
-      {Unit::ThermalConductivity::PoundPerSecondPerRankine,
-       Conversions<Unit::ThermalConductivity, Unit::ThermalConductivity::PoundPerSecondPerRankine>::
-           ToStandard<NumericType>},
-};
-
 }  // namespace Internal
 
 }  // namespace PhQ
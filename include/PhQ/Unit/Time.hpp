@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -91,6 +89,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Time unit) {
 
 namespace Internal {
 
+/// \brief Number of time units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Time>{6};
+
 template <>
 inline const std::map<UnitSystem, Unit::Time> ConsistentUnits<Unit::Time>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Time::Second},
@@ -115,7 +117,7 @@ inline const std::map<Unit::Time, std::string_view> Abbreviations<Unit::Time>{
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Time> Spellings<Unit::Time>{
+inline constexpr auto Spellings<Unit::Time>{MakeSpellingTable<Unit::Time>({
     {"s",            Unit::Time::Second     },
     {"second",       Unit::Time::Second     },
     {"seconds",      Unit::Time::Second     },
@@ -137,120 +139,96 @@ inline const std::unordered_map<std::string_view, Unit::Time> Spellings<Unit::Ti
     {"hrs",          Unit::Time::Hour       },
     {"hour",         Unit::Time::Hour       },
     {"hours",        Unit::Time::Hour       },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Second>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Time>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Second>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Second>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Nanosecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Second>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Nanosecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Nanosecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Microsecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Nanosecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Microsecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Microsecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Millisecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Microsecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Millisecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Millisecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Minute>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Millisecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Minute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Minute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Hour>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Minute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Time, Unit::Time::Hour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Hour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Time, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Time, NumericType>{
-      {Unit::Time::Second,      Conversions<Unit::Time, Unit::Time::Second>::FromStandard<NumericType>     },
-      {Unit::Time::Nanosecond,
-       Conversions<Unit::Time,                          Unit::Time::Nanosecond>::FromStandard<NumericType> },
-      {Unit::Time::Microsecond,
-       Conversions<Unit::Time,                          Unit::Time::Microsecond>::FromStandard<NumericType>},
-      {Unit::Time::Millisecond,
-       Conversions<Unit::Time,                          Unit::Time::Millisecond>::FromStandard<NumericType>},
-      {Unit::Time::Minute,      Conversions<Unit::Time, Unit::Time::Minute>::FromStandard<NumericType>     },
-      {Unit::Time::Hour,        Conversions<Unit::Time, Unit::Time::Hour>::FromStandard<NumericType>       },
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::Time, std::function<void(NumericType* const values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::Time, NumericType>{
-          {Unit::Time::Second,
-           Conversions<Unit::Time,                          Unit::Time::Second>::ToStandard<NumericType>     },
-          {Unit::Time::Nanosecond,
-           Conversions<Unit::Time,                          Unit::Time::Nanosecond>::ToStandard<NumericType> },
-          {Unit::Time::Microsecond,
-           Conversions<Unit::Time,                          Unit::Time::Microsecond>::ToStandard<NumericType>},
-          {Unit::Time::Millisecond,
-           Conversions<Unit::Time,                          Unit::Time::Millisecond>::ToStandard<NumericType>},
-          {Unit::Time::Minute,
-           Conversions<Unit::Time,                          Unit::Time::Minute>::ToStandard<NumericType>     },
-          {Unit::Time::Hour,        Conversions<Unit::Time, Unit::Time::Hour>::ToStandard<NumericType>       },
-};
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Time, Unit::Time::Hour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
+}
 
 }  // namespace Internal
 
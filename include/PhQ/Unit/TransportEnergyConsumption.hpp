@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -131,6 +129,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::TransportEnerg
 
 namespace Internal {
 
+/// \brief Number of transport energy consumption units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::TransportEnergyConsumption>{19};
+
 template <>
 inline const std::map<UnitSystem, Unit::TransportEnergyConsumption>
     ConsistentUnits<Unit::TransportEnergyConsumption>{
@@ -178,8 +180,8 @@ inline const std::map<Unit::TransportEnergyConsumption, std::string_view>
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::TransportEnergyConsumption>
-    Spellings<Unit::TransportEnergyConsumption>{
+inline constexpr auto Spellings<Unit::TransportEnergyConsumption>{
+    MakeSpellingTable<Unit::TransportEnergyConsumption>({
         {"J/m",       Unit::TransportEnergyConsumption::JoulePerMetre             },
         {"J/mi",      Unit::TransportEnergyConsumption::JoulePerMile              },
         {"J/km",      Unit::TransportEnergyConsumption::JoulePerKilometre         },
@@ -213,453 +215,331 @@ inline const std::unordered_map<std::string_view, Unit::TransportEnergyConsumpti
         {"ft·lb/ft",  Unit::TransportEnergyConsumption::FootPoundPerFoot          },
         {"in·lbf/in", Unit::TransportEnergyConsumption::InchPoundPerInch          },
         {"in·lb/in",  Unit::TransportEnergyConsumption::InchPoundPerInch          },
-};
+})};
 
 // clang-format on
 
+static_assert(IsNumberOfUnitsConsistent<Unit::TransportEnergyConsumption>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
+
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::JoulePerMetre>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::JoulePerMetre>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::JoulePerMile>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::JoulePerMile>::
-    ToStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1609.344L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::JoulePerKilometre>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::JoulePerKilometre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.000001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.000001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::KilojoulePerMile>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.609344L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.609344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::KilojoulePerMile>::
-    ToStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1.609344L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(1.609344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattMinutePerMile>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60.0L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattMinutePerMile>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1609.344L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattHourPerMile>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattHourPerMile>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1609.344L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::WattMinutePerKilometre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.06L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::WattMinutePerKilometre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(0.06L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::WattMinutePerKilometre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.06L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::WattMinutePerKilometre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.06L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::WattHourPerKilometre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3.6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::WattHourPerKilometre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3.6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::WattHourPerKilometre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3.6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::WattHourPerKilometre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3.6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattMinutePerMetre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattMinutePerMetre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattHourPerMetre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::WattHourPerMetre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattMinutePerMile>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattMinutePerMile>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattMinutePerMile>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000.0L) / static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattMinutePerMile>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60000.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattHourPerMile>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattHourPerMile>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattHourPerMile>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000.0L) / static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattHourPerMile>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600000.0L) / static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattHourPerMetre>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattHourPerMetre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::TransportEnergyConsumption,
-                                 Unit::TransportEnergyConsumption::KilowattHourPerMetre>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::TransportEnergyConsumption,
+           Unit::TransportEnergyConsumption::KilowattHourPerMetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::FootPoundPerFoot>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::FootPoundPerFoot>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L);
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::InchPoundPerInch>::
-    FromStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L);
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void
+inline constexpr ConversionStep<NumericType>
 Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::InchPoundPerInch>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L);
-}
-
-template <typename NumericType>
-inline const std::map<Unit::TransportEnergyConsumption,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::TransportEnergyConsumption, NumericType>{
-      {Unit::TransportEnergyConsumption::JoulePerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::JoulePerMetre>::FromStandard<NumericType>    },
-      {Unit::TransportEnergyConsumption::JoulePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::JoulePerMile>::FromStandard<NumericType>     },
-      {Unit::TransportEnergyConsumption::JoulePerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::JoulePerKilometre>::FromStandard<NumericType>},
-      {Unit::TransportEnergyConsumption::NanojoulePerMillimetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::KilojoulePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilojoulePerMile>::FromStandard<NumericType> },
-      {Unit::TransportEnergyConsumption::WattMinutePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattMinutePerMile>::FromStandard<NumericType>},
-      {Unit::TransportEnergyConsumption::WattHourPerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattHourPerMile>::FromStandard<NumericType>  },
-      {Unit::TransportEnergyConsumption::WattMinutePerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattMinutePerKilometre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::WattHourPerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattHourPerKilometre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::WattMinutePerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattMinutePerMetre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::WattHourPerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattHourPerMetre>::FromStandard<NumericType> },
-      {Unit::TransportEnergyConsumption::KilowattMinutePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattMinutePerMile>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::KilowattHourPerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattHourPerMile>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::KilowattMinutePerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::KilowattHourPerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::KilowattMinutePerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::KilowattHourPerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattHourPerMetre>::
-           FromStandard<NumericType>                                                  },
-      {Unit::TransportEnergyConsumption::FootPoundPerFoot,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::FootPoundPerFoot>::FromStandard<NumericType> },
-      {Unit::TransportEnergyConsumption::InchPoundPerInch,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::InchPoundPerInch>::FromStandard<NumericType> },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::TransportEnergyConsumption,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::TransportEnergyConsumption, NumericType>{
-      {Unit::TransportEnergyConsumption::JoulePerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::JoulePerMetre>::ToStandard<NumericType>      },
-      {Unit::TransportEnergyConsumption::JoulePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::JoulePerMile>::ToStandard<NumericType>       },
-      {Unit::TransportEnergyConsumption::JoulePerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::JoulePerKilometre>::ToStandard<NumericType>  },
-      {Unit::TransportEnergyConsumption::NanojoulePerMillimetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::KilojoulePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilojoulePerMile>::ToStandard<NumericType>   },
-      {Unit::TransportEnergyConsumption::WattMinutePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattMinutePerMile>::ToStandard<NumericType>  },
-      {Unit::TransportEnergyConsumption::WattHourPerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattHourPerMile>::ToStandard<NumericType>    },
-      {Unit::TransportEnergyConsumption::WattMinutePerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattMinutePerKilometre>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::WattHourPerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattHourPerKilometre>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::WattMinutePerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattMinutePerMetre>::ToStandard<NumericType> },
-      {Unit::TransportEnergyConsumption::WattHourPerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::WattHourPerMetre>::ToStandard<NumericType>   },
-      {Unit::TransportEnergyConsumption::KilowattMinutePerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattMinutePerMile>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::KilowattHourPerMile,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattHourPerMile>::ToStandard<NumericType>},
-      {Unit::TransportEnergyConsumption::KilowattMinutePerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::KilowattHourPerKilometre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::KilowattMinutePerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::KilowattHourPerMetre,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::KilowattHourPerMetre>::
-           ToStandard<NumericType>                                                    },
-      {Unit::TransportEnergyConsumption::FootPoundPerFoot,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::FootPoundPerFoot>::ToStandard<NumericType>   },
-      {Unit::TransportEnergyConsumption::InchPoundPerInch,
-       Conversions<Unit::TransportEnergyConsumption,
-       Unit::TransportEnergyConsumption::InchPoundPerInch>::ToStandard<NumericType>   },
-};
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L));
+}
 
 }  // namespace Internal
 
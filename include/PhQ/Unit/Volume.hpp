@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -118,6 +116,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Volume unit) {
 
 namespace Internal {
 
+/// \brief Number of volume units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Volume>{15};
+
 template <>
 inline const std::map<UnitSystem, Unit::Volume> ConsistentUnits<Unit::Volume>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::Volume::CubicMetre     },
@@ -156,7 +158,7 @@ inline const std::map<Unit::Volume, std::string_view> Abbreviations<Unit::Volume
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Volume> Spellings<Unit::Volume>{
+inline constexpr auto Spellings<Unit::Volume>{MakeSpellingTable<Unit::Volume>({
     {"m^3",         Unit::Volume::CubicMetre       },
     {"m3",          Unit::Volume::CubicMetre       },
     {"nmi^3",       Unit::Volume::CubicNauticalMile},
@@ -195,300 +197,250 @@ inline const std::unordered_map<std::string_view, Unit::Volume> Spellings<Unit::
     {"μin3",        Unit::Volume::CubicMicroinch   },
     {"uin^3",       Unit::Volume::CubicMicroinch   },
     {"uin3",        Unit::Volume::CubicMicroinch   },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMetre>::FromStandard(
-    NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::Volume>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMetre>::ToStandard(
-    NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicMetre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicNauticalMile>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-           * static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicMetre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicNauticalMile>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-           * static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicNauticalMile>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+      * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMile>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-           * static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicNauticalMile>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+      * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMile>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-           * static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicMile>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicKilometre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicMile>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicKilometre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicKilometre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicYard>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-           * static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicKilometre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicYard>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-           * static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicYard>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+      * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicFoot>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicYard>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+      * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicFoot>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicFoot>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicDecimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicFoot>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicDecimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicDecimetre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::Litre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicDecimetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::Litre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::Litre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicInch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::Litre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicInch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicInch>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicCentimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::CubicInch>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicCentimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicCentimetre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::Millilitre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicCentimetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::Millilitre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::Millilitre>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMillimetre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType> Conversion<Unit::Volume, Unit::Volume::Millilitre>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMillimetre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMillimetre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMilliinch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-           * static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMillimetre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMilliinch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-           * static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMilliinch>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+      * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMicrometre>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E18L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMilliinch>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+      * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMicrometre>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-18L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMicrometre>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E18L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMicroinch>::FromStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-           * static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMicrometre>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-18L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMicroinch>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-           * static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMicroinch>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+      * static_cast<NumericType>(0.0000000254L));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::Volume, std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Volume, NumericType>{
-      {Unit::Volume::CubicMetre,
-       Conversions<Unit::Volume, Unit::Volume::CubicMetre>::FromStandard<NumericType>       },
-      {Unit::Volume::CubicNauticalMile,
-       Conversions<Unit::Volume, Unit::Volume::CubicNauticalMile>::FromStandard<NumericType>},
-      {Unit::Volume::CubicMile,
-       Conversions<Unit::Volume, Unit::Volume::CubicMile>::FromStandard<NumericType>        },
-      {Unit::Volume::CubicKilometre,
-       Conversions<Unit::Volume, Unit::Volume::CubicKilometre>::FromStandard<NumericType>   },
-      {Unit::Volume::CubicYard,
-       Conversions<Unit::Volume, Unit::Volume::CubicYard>::FromStandard<NumericType>        },
-      {Unit::Volume::CubicFoot,
-       Conversions<Unit::Volume, Unit::Volume::CubicFoot>::FromStandard<NumericType>        },
-      {Unit::Volume::CubicDecimetre,
-       Conversions<Unit::Volume, Unit::Volume::CubicDecimetre>::FromStandard<NumericType>   },
-      {Unit::Volume::Litre,
-       Conversions<Unit::Volume, Unit::Volume::Litre>::FromStandard<NumericType>            },
-      {Unit::Volume::CubicInch,
-       Conversions<Unit::Volume, Unit::Volume::CubicInch>::FromStandard<NumericType>        },
-      {Unit::Volume::CubicCentimetre,
-       Conversions<Unit::Volume, Unit::Volume::CubicCentimetre>::FromStandard<NumericType>  },
-      {Unit::Volume::Millilitre,
-       Conversions<Unit::Volume, Unit::Volume::Millilitre>::FromStandard<NumericType>       },
-      {Unit::Volume::CubicMillimetre,
-       Conversions<Unit::Volume, Unit::Volume::CubicMillimetre>::FromStandard<NumericType>  },
-      {Unit::Volume::CubicMilliinch,
-       Conversions<Unit::Volume, Unit::Volume::CubicMilliinch>::FromStandard<NumericType>   },
-      {Unit::Volume::CubicMicrometre,
-       Conversions<Unit::Volume, Unit::Volume::CubicMicrometre>::FromStandard<NumericType>  },
-      {Unit::Volume::CubicMicroinch,
-       Conversions<Unit::Volume, Unit::Volume::CubicMicroinch>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::
-    map<Unit::Volume, std::function<void(NumericType* values, const std::size_t size)>>
-        MapOfConversionsToStandard<Unit::Volume, NumericType>{
-          {Unit::Volume::CubicMetre,
-           Conversions<Unit::Volume, Unit::Volume::CubicMetre>::ToStandard<NumericType>       },
-          {Unit::Volume::CubicNauticalMile,
-           Conversions<Unit::Volume, Unit::Volume::CubicNauticalMile>::ToStandard<NumericType>},
-          {Unit::Volume::CubicMile,
-           Conversions<Unit::Volume, Unit::Volume::CubicMile>::ToStandard<NumericType>        },
-          {Unit::Volume::CubicKilometre,
-           Conversions<Unit::Volume, Unit::Volume::CubicKilometre>::ToStandard<NumericType>   },
-          {Unit::Volume::CubicYard,
-           Conversions<Unit::Volume, Unit::Volume::CubicYard>::ToStandard<NumericType>        },
-          {Unit::Volume::CubicFoot,
-           Conversions<Unit::Volume, Unit::Volume::CubicFoot>::ToStandard<NumericType>        },
-          {Unit::Volume::CubicDecimetre,
-           Conversions<Unit::Volume, Unit::Volume::CubicDecimetre>::ToStandard<NumericType>   },
-          {Unit::Volume::Litre,
-           Conversions<Unit::Volume, Unit::Volume::Litre>::ToStandard<NumericType>            },
-          {Unit::Volume::CubicInch,
-           Conversions<Unit::Volume, Unit::Volume::CubicInch>::ToStandard<NumericType>        },
-          {Unit::Volume::CubicCentimetre,
-           Conversions<Unit::Volume, Unit::Volume::CubicCentimetre>::ToStandard<NumericType>  },
-          {Unit::Volume::Millilitre,
-           Conversions<Unit::Volume, Unit::Volume::Millilitre>::ToStandard<NumericType>       },
-          {Unit::Volume::CubicMillimetre,
-           Conversions<Unit::Volume, Unit::Volume::CubicMillimetre>::ToStandard<NumericType>  },
-          {Unit::Volume::CubicMilliinch,
-           Conversions<Unit::Volume, Unit::Volume::CubicMilliinch>::ToStandard<NumericType>   },
-          {Unit::Volume::CubicMicrometre,
-           Conversions<Unit::Volume, Unit::Volume::CubicMicrometre>::ToStandard<NumericType>  },
-          {Unit::Volume::CubicMicroinch,
-           Conversions<Unit::Volume, Unit::Volume::CubicMicroinch>::ToStandard<NumericType>   },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::Volume, Unit::Volume::CubicMicroinch>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+      * static_cast<NumericType>(0.0000000254L));
+}
 
 }  // namespace Internal
 
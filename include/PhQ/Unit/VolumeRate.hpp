@@ -27,11 +27,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -209,6 +207,10 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::VolumeRate uni
 
 namespace Internal {
 
+/// \brief Number of time-rate of volume units.
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::VolumeRate>{45};
+
 template <>
 inline const std::map<UnitSystem, Unit::VolumeRate> ConsistentUnits<Unit::VolumeRate>{
   {UnitSystem::MetreKilogramSecondKelvin,  Unit::VolumeRate::CubicMetrePerSecond     },
@@ -277,7 +279,7 @@ inline const std::map<Unit::VolumeRate, std::string_view> Abbreviations<Unit::Vo
 };
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::VolumeRate> Spellings<Unit::VolumeRate>{
+inline constexpr auto Spellings<Unit::VolumeRate>{MakeSpellingTable<Unit::VolumeRate>({
     {"m^3/s",           Unit::VolumeRate::CubicMetrePerSecond       },
     {"m3/s",            Unit::VolumeRate::CubicMetrePerSecond       },
     {"m^3/min",         Unit::VolumeRate::CubicMetrePerMinute       },
@@ -392,961 +394,797 @@ inline const std::unordered_map<std::string_view, Unit::VolumeRate> Spellings<Un
     {"μin3/hr",         Unit::VolumeRate::CubicMicroinchPerHour     },
     {"uin^3/hr",        Unit::VolumeRate::CubicMicroinchPerHour     },
     {"uin3/hr",         Unit::VolumeRate::CubicMicroinchPerHour     },
-};
+})};
 
 // clang-format on
 
-template <>
-template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerSecond>::
-    FromStandard(NumericType& /*value*/) noexcept {}
+static_assert(IsNumberOfUnitsConsistent<Unit::VolumeRate>(),
+              "PhQ::Internal::NumberOfUnits does not match the unit enumeration.");
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerSecond>::
-    ToStandard(NumericType& /*value*/) noexcept {}
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
+}
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Identity();
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value /= static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value /= static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-            * static_cast<NumericType>(1852.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-           * static_cast<NumericType>(1852.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+      * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-              * static_cast<NumericType>(1852.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+      * static_cast<NumericType>(1852.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-           * static_cast<NumericType>(1852.0L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+         * static_cast<NumericType>(1852.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-              * static_cast<NumericType>(1852.0L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+      * static_cast<NumericType>(1852.0L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
-           * static_cast<NumericType>(1852.0L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+         * static_cast<NumericType>(1852.0L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-            * static_cast<NumericType>(1609.344L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerHour>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1852.0L) * static_cast<NumericType>(1852.0L)
+      * static_cast<NumericType>(1852.0L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-           * static_cast<NumericType>(1609.344L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-              * static_cast<NumericType>(1609.344L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      * static_cast<NumericType>(1609.344L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-           * static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+         * static_cast<NumericType>(1609.344L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-              * static_cast<NumericType>(1609.344L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      * static_cast<NumericType>(1609.344L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
-           * static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+         * static_cast<NumericType>(1609.344L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1609.344L) * static_cast<NumericType>(1609.344L)
+      * static_cast<NumericType>(1609.344L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-            * static_cast<NumericType>(0.9144L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E9L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-           * static_cast<NumericType>(0.9144L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+      * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-              * static_cast<NumericType>(0.9144L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+      * static_cast<NumericType>(0.9144L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-           * static_cast<NumericType>(0.9144L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+         * static_cast<NumericType>(0.9144L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-              * static_cast<NumericType>(0.9144L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+      * static_cast<NumericType>(0.9144L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
-           * static_cast<NumericType>(0.9144L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+         * static_cast<NumericType>(0.9144L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-            * static_cast<NumericType>(0.3048L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.9144L) * static_cast<NumericType>(0.9144L)
+      * static_cast<NumericType>(0.9144L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-              * static_cast<NumericType>(0.3048L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+         * static_cast<NumericType>(0.3048L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-              * static_cast<NumericType>(0.3048L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
-           * static_cast<NumericType>(0.3048L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+         * static_cast<NumericType>(0.3048L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+      * static_cast<NumericType>(0.3048L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.001L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerSecond>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1000.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.001L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerSecond>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1000.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerMinute>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerMinute>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) / static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::FromStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.001L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.001L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.001L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) / static_cast<NumericType>(0.001L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-            * static_cast<NumericType>(0.0254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.001L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-              * static_cast<NumericType>(0.0254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+         * static_cast<NumericType>(0.0254L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-              * static_cast<NumericType>(0.0254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
-           * static_cast<NumericType>(0.0254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+         * static_cast<NumericType>(0.0254L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+      * static_cast<NumericType>(0.0254L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerSecond>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerMinute>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E6L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerHour>::ToStandard(
-    NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E6L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-6L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E9L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-9L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-9L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E9L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-            * static_cast<NumericType>(0.0000254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-9L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-           * static_cast<NumericType>(0.0000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+      * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-              * static_cast<NumericType>(0.0000254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+      * static_cast<NumericType>(0.0000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-           * static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+         * static_cast<NumericType>(0.0000254L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-              * static_cast<NumericType>(0.0000254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+      * static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
-           * static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+         * static_cast<NumericType>(0.0000254L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E18L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000254L) * static_cast<NumericType>(0.0000254L)
+      * static_cast<NumericType>(0.0000254L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-18L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E18L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E18L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerSecond>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(static_cast<NumericType>(1.0E-18L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-18L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L) * static_cast<NumericType>(1.0E18L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E18L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerMinute>::
+    ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-18L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(1.0E-18L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerHour>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L) * static_cast<NumericType>(1.0E18L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerSecond>::
-    FromStandard(NumericType& value) noexcept {
-  value /= (static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-            * static_cast<NumericType>(0.0000000254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(1.0E-18L) / static_cast<NumericType>(3600.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerSecond>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-           * static_cast<NumericType>(0.0000000254L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerSecond>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Division(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+      * static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerMinute>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(60.0L)
-           / (static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-              * static_cast<NumericType>(0.0000000254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerSecond>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+      * static_cast<NumericType>(0.0000000254L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerMinute>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-           * static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(60.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerMinute>::
+    FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(60.0L)
+      / (static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+         * static_cast<NumericType>(0.0000000254L)));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerHour>::
-    FromStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(3600.0L)
-           / (static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-              * static_cast<NumericType>(0.0000000254L));
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerMinute>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+      * static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(60.0L));
 }
 
 template <>
 template <typename NumericType>
-inline constexpr void Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerHour>::
-    ToStandard(NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
-           * static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L);
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerHour>::FromStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(3600.0L)
+      / (static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+         * static_cast<NumericType>(0.0000000254L)));
 }
 
+template <>
 template <typename NumericType>
-inline const std::map<Unit::VolumeRate,
-                      std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::VolumeRate, NumericType>{
-      {Unit::VolumeRate::CubicMetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicNauticalMilePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicNauticalMilePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicNauticalMilePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMilePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMilePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMilePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicKilometrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicKilometrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicKilometrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicYardPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicYardPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicYardPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicFootPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicFootPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicFootPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicDecimetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicDecimetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicDecimetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::LitrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerSecond>::FromStandard<NumericType>},
-      {Unit::VolumeRate::LitrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerMinute>::FromStandard<NumericType>},
-      {Unit::VolumeRate::LitrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::FromStandard<NumericType>  },
-      {Unit::VolumeRate::CubicInchPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicInchPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicInchPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicCentimetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicCentimetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicCentimetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::MillilitrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::MillilitrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::MillilitrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMillimetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMillimetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMillimetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMilliinchPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMilliinchPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMilliinchPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMicrometrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMicrometrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMicrometrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerHour>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMicroinchPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerSecond>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMicroinchPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerMinute>::
-           FromStandard<NumericType>                         },
-      {Unit::VolumeRate::CubicMicroinchPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerHour>::
-           FromStandard<NumericType>                         },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::VolumeRate,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::VolumeRate, NumericType>{
-      {Unit::VolumeRate::CubicMetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMetrePerHour>::ToStandard<NumericType>},
-      {Unit::VolumeRate::CubicNauticalMilePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicNauticalMilePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicNauticalMilePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicNauticalMilePerHour>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMilePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMilePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMilePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilePerHour>::ToStandard<NumericType> },
-      {Unit::VolumeRate::CubicKilometrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicKilometrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicKilometrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicKilometrePerHour>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicYardPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicYardPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicYardPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicYardPerHour>::ToStandard<NumericType> },
-      {Unit::VolumeRate::CubicFootPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicFootPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicFootPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicFootPerHour>::ToStandard<NumericType> },
-      {Unit::VolumeRate::CubicDecimetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicDecimetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicDecimetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicDecimetrePerHour>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::LitrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerSecond>::ToStandard<NumericType>   },
-      {Unit::VolumeRate::LitrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerMinute>::ToStandard<NumericType>   },
-      {Unit::VolumeRate::LitrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::ToStandard<NumericType>     },
-      {Unit::VolumeRate::CubicInchPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicInchPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicInchPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicInchPerHour>::ToStandard<NumericType> },
-      {Unit::VolumeRate::CubicCentimetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicCentimetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicCentimetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicCentimetrePerHour>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::MillilitrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::MillilitrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::MillilitrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::MillilitrePerHour>::ToStandard<NumericType>},
-      {Unit::VolumeRate::CubicMillimetrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMillimetrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMillimetrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMillimetrePerHour>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMilliinchPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMilliinchPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMilliinchPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMilliinchPerHour>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMicrometrePerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMicrometrePerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMicrometrePerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicrometrePerHour>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMicroinchPerSecond,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerSecond>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMicroinchPerMinute,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerMinute>::
-           ToStandard<NumericType>                            },
-      {Unit::VolumeRate::CubicMicroinchPerHour,
-       Conversions<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerHour>::
-           ToStandard<NumericType>                            },
-};
+inline constexpr ConversionStep<NumericType>
+Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerHour>::ToStandardStep() noexcept {
+  return ConversionStep<NumericType>::Multiplication(
+      static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L)
+      * static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L));
+}
 
 }  // namespace Internal
 
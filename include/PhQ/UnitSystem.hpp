@@ -30,7 +30,6 @@
 #include <optional>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
 
 #include "Base.hpp"
 
@@ -85,7 +84,7 @@ inline const std::map<UnitSystem, std::string_view> Abbreviations<UnitSystem>{
 };
 
 template <>
-inline const std::unordered_map<std::string_view, UnitSystem> Spellings<UnitSystem>{
+inline constexpr auto Spellings<UnitSystem>{MakeSpellingTable<UnitSystem>({
     {"m·kg·s·K",       UnitSystem::MetreKilogramSecondKelvin },
     {"m-kg-s-K",       UnitSystem::MetreKilogramSecondKelvin },
     {"m*kg*s*K",       UnitSystem::MetreKilogramSecondKelvin },
@@ -202,7 +201,7 @@ inline const std::unordered_map<std::string_view, UnitSystem> Spellings<UnitSyst
     {"in lb",          UnitSystem::InchPoundSecondRankine    },
     {"in, lb",         UnitSystem::InchPoundSecondRankine    },
     {"in",             UnitSystem::InchPoundSecondRankine    },
-};
+})};
 
 // clang-format on
 
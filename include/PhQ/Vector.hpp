@@ -254,26 +254,77 @@ public:
 
   /// \brief Prints this three-dimensional vector as a string.
   [[nodiscard]] std::string Print() const {
-    return "(" + PhQ::Print(x_y_z_[0]) + ", " + PhQ::Print(x_y_z_[1]) + ", " + PhQ::Print(x_y_z_[2])
-           + ")";
+    std::string buffer;
+    AppendPrint(buffer);
+    return buffer;
+  }
+
+  /// \brief Prints this three-dimensional vector and appends it to the given string.
+  void AppendPrint(std::string& buffer) const {
+    buffer.push_back('(');
+    PhQ::AppendPrint(buffer, x_y_z_[0]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, x_y_z_[1]);
+    buffer.append(", ");
+    PhQ::AppendPrint(buffer, x_y_z_[2]);
+    buffer.push_back(')');
   }
 
   /// \brief Serializes this three-dimensional vector as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return "{\"x\":" + PhQ::Print(x_y_z_[0]) + ",\"y\":" + PhQ::Print(x_y_z_[1])
-           + ",\"z\":" + PhQ::Print(x_y_z_[2]) + "}";
+    std::string buffer;
+    AppendJSON(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional vector as a JSON message and appends it to the given
+  /// string.
+  void AppendJSON(std::string& buffer) const {
+    buffer.append("{\"x\":");
+    PhQ::AppendPrint(buffer, x_y_z_[0]);
+    buffer.append(",\"y\":");
+    PhQ::AppendPrint(buffer, x_y_z_[1]);
+    buffer.append(",\"z\":");
+    PhQ::AppendPrint(buffer, x_y_z_[2]);
+    buffer.push_back('}');
   }
 
   /// \brief Serializes this three-dimensional vector as an XML message.
   [[nodiscard]] std::string XML() const {
-    return "<x>" + PhQ::Print(x_y_z_[0]) + "</x><y>" + PhQ::Print(x_y_z_[1]) + "</y><z>"
-           + PhQ::Print(x_y_z_[2]) + "</z>";
+    std::string buffer;
+    AppendXML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional vector as an XML message and appends it to the given
+  /// string.
+  void AppendXML(std::string& buffer) const {
+    buffer.append("<x>");
+    PhQ::AppendPrint(buffer, x_y_z_[0]);
+    buffer.append("</x><y>");
+    PhQ::AppendPrint(buffer, x_y_z_[1]);
+    buffer.append("</y><z>");
+    PhQ::AppendPrint(buffer, x_y_z_[2]);
+    buffer.append("</z>");
   }
 
   /// \brief Serializes this three-dimensional vector as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return "{x:" + PhQ::Print(x_y_z_[0]) + ",y:" + PhQ::Print(x_y_z_[1])
-           + ",z:" + PhQ::Print(x_y_z_[2]) + "}";
+    std::string buffer;
+    AppendYAML(buffer);
+    return buffer;
+  }
+
+  /// \brief Serializes this three-dimensional vector as a YAML message and appends it to the given
+  /// string.
+  void AppendYAML(std::string& buffer) const {
+    buffer.append("{x:");
+    PhQ::AppendPrint(buffer, x_y_z_[0]);
+    buffer.append(",y:");
+    PhQ::AppendPrint(buffer, x_y_z_[1]);
+    buffer.append(",z:");
+    PhQ::AppendPrint(buffer, x_y_z_[2]);
+    buffer.push_back('}');
   }
 
   /// \brief Adds another three-dimensional vector to this one.
@@ -375,7 +426,8 @@ inline constexpr Vector<NumericType> operator-(
   return Vector<NumericType>{left.x() - right.x(), left.y() - right.y(), left.z() - right.z()};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr Vector<NumericType> operator*(
     const Vector<NumericType>& vector, const OtherNumericType number) {
   return Vector<NumericType>{
@@ -383,13 +435,15 @@ inline constexpr Vector<NumericType> operator*(
     vector.z() * static_cast<NumericType>(number)};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr Vector<NumericType> operator*(
     const OtherNumericType number, const Vector<NumericType>& vector) {
   return Vector<NumericType>{vector * number};
 }
 
-template <typename NumericType, typename OtherNumericType>
+template <typename NumericType, typename OtherNumericType,
+          std::enable_if_t<std::is_arithmetic_v<OtherNumericType>, bool> = true>
 inline constexpr Vector<NumericType> operator/(
     const Vector<NumericType>& vector, const OtherNumericType number) {
   return Vector<NumericType>{
@@ -258,6 +258,13 @@ inline constexpr VectorArea<NumericType> Area<NumericType>::operator*(
   return VectorArea<NumericType>{*this, direction};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<VectorArea>{86};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
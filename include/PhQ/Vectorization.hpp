@@ -0,0 +1,507 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_VECTORIZATION_HPP
+#define PHQ_VECTORIZATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PHQ_VECTORIZATION_X86_64
+#include <immintrin.h>
+#endif
+
+namespace PhQ::Internal {
+
+/// \brief Instruction sets for which the bulk arithmetic kernels of the Physical Quantities library
+/// are explicitly vectorized. The enumeration values are ordered from narrowest to widest.
+/// Internal implementation detail not intended to be used outside of the Physical Quantities
+/// library's own functions and classes.
+enum class InstructionSet : int8_t {
+  /// \brief Portable scalar code. Used on processors other than x86-64 and for long double values.
+  Scalar,
+
+  /// \brief 128-bit SSE2 instructions. Always available on x86-64 processors.
+  SSE2,
+
+  /// \brief 256-bit AVX2 instructions.
+  AVX2,
+
+  /// \brief 512-bit AVX-512 Foundation instructions.
+  AVX512,
+};
+
+/// \brief Detects the widest instruction set supported by the processor on which the program runs.
+[[nodiscard]] inline InstructionSet DetectInstructionSet() noexcept {
+#ifdef PHQ_VECTORIZATION_X86_64
+  if (__builtin_cpu_supports("avx512f")) {
+    return InstructionSet::AVX512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return InstructionSet::AVX2;
+  }
+  return InstructionSet::SSE2;
+#else
+  return InstructionSet::Scalar;
+#endif
+}
+
+/// \brief Widest instruction set supported by the processor on which the program runs. The
+/// processor is queried only once.
+[[nodiscard]] inline InstructionSet SupportedInstructionSet() noexcept {
+  static const InstructionSet instruction_set{DetectInstructionSet()};
+  return instruction_set;
+}
+
+/// \brief Number of values below which the bulk arithmetic kernels run the portable scalar code
+/// directly. For such short sequences, the cost of dispatching to a vectorized kernel outweighs its
+/// benefit.
+inline constexpr std::size_t VectorizationThreshold{64};
+
+// The kernels below evaluate every operation exactly as written and correctly rounded, even in
+// translation units compiled with -ffast-math, which would otherwise allow the compiler to replace
+// divisions by multiplications by approximate reciprocals. Their results therefore do not depend on
+// the compiler options.
+#if defined(__clang__)
+#pragma float_control(precise, on, push)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("no-fast-math")
+#endif
+
+/// \brief Multiplies a sequence of values in-place by a given factor using portable scalar code.
+template <typename NumericType>
+inline void MultiplyInPlaceScalar(
+    NumericType* values, const std::size_t size, const NumericType factor) noexcept {
+  const NumericType* const end{values + size};
+  for (; values < end; ++values) {
+    *values *= factor;
+  }
+}
+
+/// \brief Returns a given value unchanged, but prevents the compiler from fusing the operation
+/// that produced it with the next one. In particular, a multiplication followed by an addition is
+/// not contracted into a fused multiply-add instruction, even when the target supports one, so
+/// that each operation is rounded separately.
+template <typename NumericType>
+[[nodiscard]] inline NumericType Rounded(NumericType value) noexcept {
+#ifdef PHQ_VECTORIZATION_X86_64
+  if constexpr (!std::is_same_v<NumericType, long double>) {
+    asm("" : "+v"(value));
+  }
+#endif
+  return value;
+}
+
+/// \brief Divides a sequence of values in-place by a given divisor using portable scalar code.
+template <typename NumericType>
+inline void DivideInPlaceScalar(
+    NumericType* values, const std::size_t size, const NumericType divisor) noexcept {
+  const NumericType* const end{values + size};
+  for (; values < end; ++values) {
+    *values /= divisor;
+  }
+}
+
+/// \brief Multiplies a sequence of values in-place by a given factor and then adds a given offset
+/// to them using portable scalar code. The multiplication and the addition are rounded separately.
+template <typename NumericType>
+inline void MultiplyAddInPlaceScalar(NumericType* values, const std::size_t size,
+                                     const NumericType factor, const NumericType offset) noexcept {
+  const NumericType* const end{values + size};
+  for (; values < end; ++values) {
+    *values = Rounded(factor * *values) + offset;
+  }
+}
+
+#ifdef PHQ_VECTORIZATION_X86_64
+
+// The kernels below yield exactly the same results as the portable scalar code on every
+// instruction set and for every length of sequence. In particular, the multiply-add kernels never
+// use fused multiply-add instructions: the products are passed through an empty assembly statement
+// so that the compiler cannot contract them with the subsequent additions, and each value is
+// therefore rounded twice, as in the portable scalar code.
+
+inline void MultiplyInPlaceSSE2(
+    double* const values, const std::size_t size, const double factor) noexcept {
+  const __m128d factors{_mm_set1_pd(factor)};
+  std::size_t index{0};
+  for (; index + 2 <= size; index += 2) {
+    _mm_storeu_pd(values + index, _mm_mul_pd(_mm_loadu_pd(values + index), factors));
+  }
+  MultiplyInPlaceScalar(values + index, size - index, factor);
+}
+
+inline void MultiplyInPlaceSSE2(
+    float* const values, const std::size_t size, const float factor) noexcept {
+  const __m128 factors{_mm_set1_ps(factor)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    _mm_storeu_ps(values + index, _mm_mul_ps(_mm_loadu_ps(values + index), factors));
+  }
+  MultiplyInPlaceScalar(values + index, size - index, factor);
+}
+
+inline void DivideInPlaceSSE2(
+    double* const values, const std::size_t size, const double divisor) noexcept {
+  const __m128d divisors{_mm_set1_pd(divisor)};
+  std::size_t index{0};
+  for (; index + 2 <= size; index += 2) {
+    _mm_storeu_pd(values + index, _mm_div_pd(_mm_loadu_pd(values + index), divisors));
+  }
+  DivideInPlaceScalar(values + index, size - index, divisor);
+}
+
+inline void DivideInPlaceSSE2(
+    float* const values, const std::size_t size, const float divisor) noexcept {
+  const __m128 divisors{_mm_set1_ps(divisor)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    _mm_storeu_ps(values + index, _mm_div_ps(_mm_loadu_ps(values + index), divisors));
+  }
+  DivideInPlaceScalar(values + index, size - index, divisor);
+}
+
+inline void MultiplyAddInPlaceSSE2(double* const values, const std::size_t size,
+                                   const double factor, const double offset) noexcept {
+  const __m128d factors{_mm_set1_pd(factor)};
+  const __m128d offsets{_mm_set1_pd(offset)};
+  std::size_t index{0};
+  for (; index + 2 <= size; index += 2) {
+    __m128d products{_mm_mul_pd(_mm_loadu_pd(values + index), factors)};
+    asm("" : "+v"(products));
+    _mm_storeu_pd(values + index, _mm_add_pd(products, offsets));
+  }
+  MultiplyAddInPlaceScalar(values + index, size - index, factor, offset);
+}
+
+inline void MultiplyAddInPlaceSSE2(float* const values, const std::size_t size, const float factor,
+                                   const float offset) noexcept {
+  const __m128 factors{_mm_set1_ps(factor)};
+  const __m128 offsets{_mm_set1_ps(offset)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    __m128 products{_mm_mul_ps(_mm_loadu_ps(values + index), factors)};
+    asm("" : "+v"(products));
+    _mm_storeu_ps(values + index, _mm_add_ps(products, offsets));
+  }
+  MultiplyAddInPlaceScalar(values + index, size - index, factor, offset);
+}
+
+__attribute__((target("avx2"))) inline void MultiplyInPlaceAVX2(
+    double* const values, const std::size_t size, const double factor) noexcept {
+  const __m256d factors{_mm256_set1_pd(factor)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    _mm256_storeu_pd(values + index, _mm256_mul_pd(_mm256_loadu_pd(values + index), factors));
+  }
+  MultiplyInPlaceScalar(values + index, size - index, factor);
+}
+
+__attribute__((target("avx2"))) inline void MultiplyInPlaceAVX2(
+    float* const values, const std::size_t size, const float factor) noexcept {
+  const __m256 factors{_mm256_set1_ps(factor)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    _mm256_storeu_ps(values + index, _mm256_mul_ps(_mm256_loadu_ps(values + index), factors));
+  }
+  MultiplyInPlaceScalar(values + index, size - index, factor);
+}
+
+__attribute__((target("avx2"))) inline void DivideInPlaceAVX2(
+    double* const values, const std::size_t size, const double divisor) noexcept {
+  const __m256d divisors{_mm256_set1_pd(divisor)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    _mm256_storeu_pd(values + index, _mm256_div_pd(_mm256_loadu_pd(values + index), divisors));
+  }
+  DivideInPlaceScalar(values + index, size - index, divisor);
+}
+
+__attribute__((target("avx2"))) inline void DivideInPlaceAVX2(
+    float* const values, const std::size_t size, const float divisor) noexcept {
+  const __m256 divisors{_mm256_set1_ps(divisor)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    _mm256_storeu_ps(values + index, _mm256_div_ps(_mm256_loadu_ps(values + index), divisors));
+  }
+  DivideInPlaceScalar(values + index, size - index, divisor);
+}
+
+__attribute__((target("avx2"))) inline void MultiplyAddInPlaceAVX2(
+    double* const values, const std::size_t size, const double factor,
+    const double offset) noexcept {
+  const __m256d factors{_mm256_set1_pd(factor)};
+  const __m256d offsets{_mm256_set1_pd(offset)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    __m256d products{_mm256_mul_pd(_mm256_loadu_pd(values + index), factors)};
+    asm("" : "+v"(products));
+    _mm256_storeu_pd(values + index, _mm256_add_pd(products, offsets));
+  }
+  const __m256i mask{_mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<int64_t>(size - index)),
+                                        _mm256_setr_epi64x(0, 1, 2, 3))};
+  __m256d products{_mm256_mul_pd(_mm256_maskload_pd(values + index, mask), factors)};
+  asm("" : "+v"(products));
+  _mm256_maskstore_pd(values + index, mask, _mm256_add_pd(products, offsets));
+}
+
+__attribute__((target("avx2"))) inline void MultiplyAddInPlaceAVX2(
+    float* const values, const std::size_t size, const float factor, const float offset) noexcept {
+  const __m256 factors{_mm256_set1_ps(factor)};
+  const __m256 offsets{_mm256_set1_ps(offset)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    __m256 products{_mm256_mul_ps(_mm256_loadu_ps(values + index), factors)};
+    asm("" : "+v"(products));
+    _mm256_storeu_ps(values + index, _mm256_add_ps(products, offsets));
+  }
+  const __m256i mask{_mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(size - index)),
+                                        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7))};
+  __m256 products{_mm256_mul_ps(_mm256_maskload_ps(values + index, mask), factors)};
+  asm("" : "+v"(products));
+  _mm256_maskstore_ps(values + index, mask, _mm256_add_ps(products, offsets));
+}
+
+__attribute__((target("avx512f"))) inline void MultiplyInPlaceAVX512(
+    double* const values, const std::size_t size, const double factor) noexcept {
+  const __m512d factors{_mm512_set1_pd(factor)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    _mm512_storeu_pd(values + index, _mm512_mul_pd(_mm512_loadu_pd(values + index), factors));
+  }
+  const __mmask8 mask{static_cast<__mmask8>((1U << (size - index)) - 1U)};
+  _mm512_mask_storeu_pd(
+      values + index, mask, _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, values + index), factors));
+}
+
+__attribute__((target("avx512f"))) inline void MultiplyInPlaceAVX512(
+    float* const values, const std::size_t size, const float factor) noexcept {
+  const __m512 factors{_mm512_set1_ps(factor)};
+  std::size_t index{0};
+  for (; index + 16 <= size; index += 16) {
+    _mm512_storeu_ps(values + index, _mm512_mul_ps(_mm512_loadu_ps(values + index), factors));
+  }
+  const __mmask16 mask{static_cast<__mmask16>((1U << (size - index)) - 1U)};
+  _mm512_mask_storeu_ps(
+      values + index, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, values + index), factors));
+}
+
+__attribute__((target("avx512f"))) inline void DivideInPlaceAVX512(
+    double* const values, const std::size_t size, const double divisor) noexcept {
+  const __m512d divisors{_mm512_set1_pd(divisor)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    _mm512_storeu_pd(values + index, _mm512_div_pd(_mm512_loadu_pd(values + index), divisors));
+  }
+  const __mmask8 mask{static_cast<__mmask8>((1U << (size - index)) - 1U)};
+  _mm512_mask_storeu_pd(
+      values + index, mask, _mm512_div_pd(_mm512_maskz_loadu_pd(mask, values + index), divisors));
+}
+
+__attribute__((target("avx512f"))) inline void DivideInPlaceAVX512(
+    float* const values, const std::size_t size, const float divisor) noexcept {
+  const __m512 divisors{_mm512_set1_ps(divisor)};
+  std::size_t index{0};
+  for (; index + 16 <= size; index += 16) {
+    _mm512_storeu_ps(values + index, _mm512_div_ps(_mm512_loadu_ps(values + index), divisors));
+  }
+  const __mmask16 mask{static_cast<__mmask16>((1U << (size - index)) - 1U)};
+  _mm512_mask_storeu_ps(
+      values + index, mask, _mm512_div_ps(_mm512_maskz_loadu_ps(mask, values + index), divisors));
+}
+
+__attribute__((target("avx512f"))) inline void MultiplyAddInPlaceAVX512(
+    double* const values, const std::size_t size, const double factor,
+    const double offset) noexcept {
+  const __m512d factors{_mm512_set1_pd(factor)};
+  const __m512d offsets{_mm512_set1_pd(offset)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    __m512d products{_mm512_mul_pd(_mm512_loadu_pd(values + index), factors)};
+    asm("" : "+v"(products));
+    _mm512_storeu_pd(values + index, _mm512_add_pd(products, offsets));
+  }
+  const __mmask8 mask{static_cast<__mmask8>((1U << (size - index)) - 1U)};
+  __m512d products{_mm512_mul_pd(_mm512_maskz_loadu_pd(mask, values + index), factors)};
+  asm("" : "+v"(products));
+  _mm512_mask_storeu_pd(values + index, mask, _mm512_add_pd(products, offsets));
+}
+
+__attribute__((target("avx512f"))) inline void MultiplyAddInPlaceAVX512(
+    float* const values, const std::size_t size, const float factor, const float offset) noexcept {
+  const __m512 factors{_mm512_set1_ps(factor)};
+  const __m512 offsets{_mm512_set1_ps(offset)};
+  std::size_t index{0};
+  for (; index + 16 <= size; index += 16) {
+    __m512 products{_mm512_mul_ps(_mm512_loadu_ps(values + index), factors)};
+    asm("" : "+v"(products));
+    _mm512_storeu_ps(values + index, _mm512_add_ps(products, offsets));
+  }
+  const __mmask16 mask{static_cast<__mmask16>((1U << (size - index)) - 1U)};
+  __m512 products{_mm512_mul_ps(_mm512_maskz_loadu_ps(mask, values + index), factors)};
+  asm("" : "+v"(products));
+  _mm512_mask_storeu_ps(values + index, mask, _mm512_add_ps(products, offsets));
+}
+
+#endif  // PHQ_VECTORIZATION_X86_64
+
+#if defined(__clang__)
+#pragma float_control(pop)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+/// \brief Multiplies a sequence of values in-place by a given factor using a given instruction
+/// set. The instruction set must be supported by the processor; see
+/// PhQ::Internal::SupportedInstructionSet. Long double values always use portable scalar code.
+template <typename NumericType>
+inline void MultiplyInPlace(const InstructionSet instruction_set, NumericType* const values,
+                            const std::size_t size, const NumericType factor) noexcept {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::MultiplyInPlace must be a numeric "
+                "floating-point type: float, double, or long double.");
+#ifdef PHQ_VECTORIZATION_X86_64
+  if constexpr (!std::is_same_v<NumericType, long double>) {
+    switch (instruction_set) {
+      case InstructionSet::SSE2:
+        MultiplyInPlaceSSE2(values, size, factor);
+        return;
+      case InstructionSet::AVX2:
+        MultiplyInPlaceAVX2(values, size, factor);
+        return;
+      case InstructionSet::AVX512:
+        MultiplyInPlaceAVX512(values, size, factor);
+        return;
+      default:
+        break;
+    }
+  }
+#endif
+  static_cast<void>(instruction_set);
+  MultiplyInPlaceScalar(values, size, factor);
+}
+
+/// \brief Divides a sequence of values in-place by a given divisor using a given instruction set.
+/// The instruction set must be supported by the processor; see
+/// PhQ::Internal::SupportedInstructionSet. Long double values always use portable scalar code.
+template <typename NumericType>
+inline void DivideInPlace(const InstructionSet instruction_set, NumericType* const values,
+                          const std::size_t size, const NumericType divisor) noexcept {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::DivideInPlace must be a numeric "
+                "floating-point type: float, double, or long double.");
+#ifdef PHQ_VECTORIZATION_X86_64
+  if constexpr (!std::is_same_v<NumericType, long double>) {
+    switch (instruction_set) {
+      case InstructionSet::SSE2:
+        DivideInPlaceSSE2(values, size, divisor);
+        return;
+      case InstructionSet::AVX2:
+        DivideInPlaceAVX2(values, size, divisor);
+        return;
+      case InstructionSet::AVX512:
+        DivideInPlaceAVX512(values, size, divisor);
+        return;
+      default:
+        break;
+    }
+  }
+#endif
+  static_cast<void>(instruction_set);
+  DivideInPlaceScalar(values, size, divisor);
+}
+
+/// \brief Multiplies a sequence of values in-place by a given factor and then adds a given offset
+/// to them using a given instruction set. The instruction set must be supported by the processor;
+/// see PhQ::Internal::SupportedInstructionSet. Long double values always use portable scalar code.
+template <typename NumericType>
+inline void MultiplyAddInPlace(const InstructionSet instruction_set, NumericType* const values,
+                               const std::size_t size, const NumericType factor,
+                               const NumericType offset) noexcept {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::MultiplyAddInPlace must be a numeric "
+                "floating-point type: float, double, or long double.");
+#ifdef PHQ_VECTORIZATION_X86_64
+  if constexpr (!std::is_same_v<NumericType, long double>) {
+    switch (instruction_set) {
+      case InstructionSet::SSE2:
+        MultiplyAddInPlaceSSE2(values, size, factor, offset);
+        return;
+      case InstructionSet::AVX2:
+        MultiplyAddInPlaceAVX2(values, size, factor, offset);
+        return;
+      case InstructionSet::AVX512:
+        MultiplyAddInPlaceAVX512(values, size, factor, offset);
+        return;
+      default:
+        break;
+    }
+  }
+#endif
+  static_cast<void>(instruction_set);
+  MultiplyAddInPlaceScalar(values, size, factor, offset);
+}
+
+/// \brief Multiplies a sequence of values in-place by a given factor using the widest instruction
+/// set supported by the processor.
+template <typename NumericType>
+inline void MultiplyInPlace(
+    NumericType* const values, const std::size_t size, const NumericType factor) noexcept {
+  if (size < VectorizationThreshold) {
+    MultiplyInPlaceScalar(values, size, factor);
+  } else {
+    MultiplyInPlace(SupportedInstructionSet(), values, size, factor);
+  }
+}
+
+/// \brief Divides a sequence of values in-place by a given divisor using the widest instruction set
+/// supported by the processor.
+template <typename NumericType>
+inline void DivideInPlace(
+    NumericType* const values, const std::size_t size, const NumericType divisor) noexcept {
+  if (size < VectorizationThreshold) {
+    DivideInPlaceScalar(values, size, divisor);
+  } else {
+    DivideInPlace(SupportedInstructionSet(), values, size, divisor);
+  }
+}
+
+/// \brief Multiplies a sequence of values in-place by a given factor and then adds a given offset
+/// to them using the widest instruction set supported by the processor.
+template <typename NumericType>
+inline void MultiplyAddInPlace(NumericType* const values, const std::size_t size,
+                               const NumericType factor, const NumericType offset) noexcept {
+  if (size < VectorizationThreshold) {
+    MultiplyAddInPlaceScalar(values, size, factor, offset);
+  } else {
+    MultiplyAddInPlace(SupportedInstructionSet(), values, size, factor, offset);
+  }
+}
+
+}  // namespace PhQ::Internal
+
+#endif  // PHQ_VECTORIZATION_HPP
@@ -341,6 +341,13 @@ inline constexpr Velocity<NumericType> Displacement<NumericType>::operator/(
   return Velocity<NumericType>{*this, time};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Velocity>{87};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -342,6 +342,13 @@ inline constexpr VelocityGradient<NumericType> Frequency<NumericType>::operator*
   return VelocityGradient<NumericType>{displacement_gradient, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<VelocityGradient>{88};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -253,6 +253,13 @@ inline constexpr Volume<NumericType> Area<NumericType>::operator*(
   return Volume<NumericType>{*this, length};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<Volume>{89};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -268,6 +268,13 @@ inline constexpr VolumeRate<NumericType> Volume<NumericType>::operator/(
   return VolumeRate<NumericType>{*this, time};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<VolumeRate>{90};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -246,6 +246,13 @@ inline constexpr Strain<NumericType> TemperatureDifference<NumericType>::operato
   return Strain<NumericType>{volumetric_thermal_expansion_coefficient, *this};
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<VolumetricThermalExpansionCoefficient>{91};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -184,6 +184,13 @@ inline constexpr YoungModulus<NumericType> operator*(
   return young_modulus * number;
 }
 
+namespace Internal {
+
+template <>
+inline constexpr std::uint64_t BinaryTypeIdentifier<YoungModulus>{92};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 namespace std {
@@ -0,0 +1,171 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Aligned.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <vector>
+
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/SymmetricDyad.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Vector.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "Performance.hpp"
+
+namespace PhQ {
+
+namespace {
+
+TEST(Aligned, Alignment) {
+  EXPECT_EQ(alignof(Aligned<Vector<float>>), 4 * sizeof(float));
+  EXPECT_EQ(alignof(Aligned<Vector<double>>), 4 * sizeof(double));
+  EXPECT_EQ(alignof(Aligned<SymmetricDyad<float>>), 8 * sizeof(float));
+  EXPECT_EQ(alignof(Aligned<SymmetricDyad<double>>), 8 * sizeof(double));
+  EXPECT_EQ(alignof(Aligned<Velocity<>>), 4 * sizeof(double));
+  EXPECT_EQ(alignof(Aligned<Stress<>>), 8 * sizeof(double));
+
+  const std::vector<Aligned<Vector<>>> vectors(5, Vector<>{1.0, 2.0, 3.0});
+  for (const Aligned<Vector<>>& vector : vectors) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&vector) % alignof(Aligned<Vector<>>), 0);
+  }
+}
+
+TEST(Aligned, Arithmetic) {
+  Aligned<Vector<>> first{1.0, -2.0, 3.0};
+  const Aligned<Vector<>> second{Vector<>{4.0, 5.0, -6.0}};
+  EXPECT_EQ(first + second, Vector<>(5.0, 3.0, -3.0));
+  EXPECT_EQ(first.Dot(second), -24.0);
+  EXPECT_EQ(first.Cross(second), Vector<>(-3.0, 18.0, 13.0));
+  first += second;
+  EXPECT_EQ(first, Vector<>(5.0, 3.0, -3.0));
+  first = first * 2.0;
+  EXPECT_EQ(first, Vector<>(10.0, 6.0, -6.0));
+
+  const Aligned<SymmetricDyad<>> symmetric_dyad{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  EXPECT_EQ(symmetric_dyad * second, SymmetricDyad<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0) * second);
+  EXPECT_EQ(symmetric_dyad.Trace(), 11.0);
+
+  const Aligned<Velocity<>> velocity{Vector<>{1.0, 2.0, 3.0}, Unit::Speed::KilometrePerSecond};
+  EXPECT_EQ(velocity.Value(), Vector<>(1000.0, 2000.0, 3000.0));
+  const Velocity<>& reference{velocity};
+  EXPECT_EQ(&reference.Value(), &velocity.Value());
+}
+
+TEST(Aligned, BulkPerformance) {
+  constexpr std::size_t size{1 << 14};
+  std::vector<SymmetricDyad<>> symmetric_dyads;
+  std::vector<Vector<>> vectors;
+  symmetric_dyads.reserve(size);
+  vectors.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    symmetric_dyads.emplace_back(value, -0.5 * value, 0.25 * value, 2.0 * value, -value, 1.0);
+    vectors.emplace_back(value, 1.0 - value, 0.5 * value);
+  }
+  const std::vector<Aligned<SymmetricDyad<>>> aligned_symmetric_dyads(
+      symmetric_dyads.begin(), symmetric_dyads.end());
+  const std::vector<Aligned<Vector<>>> aligned_vectors(vectors.begin(), vectors.end());
+  std::vector<Vector<>> products(size);
+  std::vector<Aligned<Vector<>>> aligned_products(size);
+
+  Internal::TestRelativePerformance(
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          aligned_products[index] =
+              aligned_symmetric_dyads[index] * aligned_vectors[index] + aligned_vectors[index];
+        }
+      },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          products[index] = symmetric_dyads[index] * vectors[index] + vectors[index];
+        }
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(aligned_products[index], products[index]);
+  }
+}
+
+TEST(Aligned, Hash) {
+  const Aligned<Vector<>> vector{1.0, -2.0, 3.0};
+  EXPECT_EQ(std::hash<Aligned<Vector<>>>()(vector), std::hash<Vector<>>()(vector));
+}
+
+TEST(Aligned, Performance) {
+  Aligned<Velocity<>> velocity1{
+    {1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012},
+    Unit::Speed::MetrePerSecond
+  };
+  Aligned<Velocity<>> velocity2{
+    {1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012},
+    Unit::Speed::MetrePerSecond
+  };
+  std::array<double, 3> vector_reference1{
+    1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012};
+  std::array<double, 3> vector_reference2{
+    1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012};
+  Internal::TestVectorPerformance(velocity1, velocity2, vector_reference1, vector_reference2);
+
+  Aligned<Stress<>> stress1{
+    {1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012, 4.5678901234567890123,
+     5.6789012345678901234, 6.7890123456789012345},
+    Unit::Pressure::Pascal
+  };
+  Aligned<Stress<>> stress2{
+    {1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012, 4.5678901234567890123,
+     5.6789012345678901234, 6.7890123456789012345},
+    Unit::Pressure::Pascal
+  };
+  std::array<double, 6> symmetric_dyad_reference1{
+    1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012,
+    4.5678901234567890123, 5.6789012345678901234, 6.7890123456789012345};
+  std::array<double, 6> symmetric_dyad_reference2{
+    1.2345678901234567890, 2.3456789012345678901, 3.4567890123456789012,
+    4.5678901234567890123, 5.6789012345678901234, 6.7890123456789012345};
+  Internal::TestSymmetricDyadPerformance(
+      stress1, stress2, symmetric_dyad_reference1, symmetric_dyad_reference2);
+}
+
+TEST(Aligned, SizeOf) {
+  EXPECT_EQ(sizeof(Aligned<Vector<float>>), 4 * sizeof(float));
+  EXPECT_EQ(sizeof(Aligned<Vector<double>>), 4 * sizeof(double));
+  EXPECT_EQ(sizeof(Aligned<SymmetricDyad<float>>), 8 * sizeof(float));
+  EXPECT_EQ(sizeof(Aligned<SymmetricDyad<double>>), 8 * sizeof(double));
+  EXPECT_EQ(sizeof(Aligned<Velocity<>>), 4 * sizeof(double));
+  EXPECT_EQ(sizeof(Aligned<Stress<>>), 8 * sizeof(double));
+  EXPECT_TRUE(std::is_standard_layout_v<Aligned<Vector<>>>);
+  EXPECT_TRUE(std::is_trivially_copyable_v<Aligned<SymmetricDyad<>>>);
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -24,10 +24,14 @@
 
 #include "../include/PhQ/Angle.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/PlanarVector.hpp"
 #include "../include/PhQ/Unit/Angle.hpp"
@@ -82,6 +86,63 @@ TEST(Angle, AssignmentOperatorSubtraction) {
   EXPECT_EQ(angle, Angle(1.0, Unit::Angle::Radian));
 }
 
+TEST(Angle, Between) {
+  const std::array<Vector<>, 5> vectors_1{
+      Vector<>{1.0, 0.0, 0.0}, Vector<>{1.0, 0.0, 0.0}, Vector<>{1.0, 2.0, 3.0},
+      Vector<>{1.0, 0.0, 0.0}, Vector<>{0.0, 0.0, 0.0}};
+  const std::array<Vector<>, 5> vectors_2{
+      Vector<>{0.0, 0.0, 2.0}, Vector<>{1.0, 1.0e-10, 0.0}, Vector<>{-2.0, -4.0, -6.0},
+      Vector<>{1.0, 1.0, 0.0}, Vector<>{1.0, 2.0, 3.0}};
+  std::array<Angle<>, 5> angles;
+  Angle<>::Between(vectors_1.data(), vectors_2.data(), vectors_1.size(), angles.data());
+  EXPECT_DOUBLE_EQ(angles[0].Value(), 0.5 * Pi<double>);
+  EXPECT_DOUBLE_EQ(angles[1].Value(), 1.0e-10);
+  EXPECT_DOUBLE_EQ(angles[2].Value(), Pi<double>);
+  EXPECT_DOUBLE_EQ(angles[3].Value(), 0.25 * Pi<double>);
+  EXPECT_EQ(angles[4].Value(), 0.0);
+
+  const std::array<PlanarVector<>, 4> planar_vectors_1{
+      PlanarVector<>{1.0, 0.0}, PlanarVector<>{1.0, 0.0}, PlanarVector<>{3.0, 4.0},
+      PlanarVector<>{0.0, 0.0}};
+  const std::array<PlanarVector<>, 4> planar_vectors_2{
+      PlanarVector<>{0.0, -2.0}, PlanarVector<>{1.0, 1.0e-10}, PlanarVector<>{-3.0, -4.0},
+      PlanarVector<>{1.0, 2.0}};
+  std::array<Angle<>, 4> planar_angles;
+  Angle<>::Between(planar_vectors_1.data(), planar_vectors_2.data(), planar_vectors_1.size(),
+                   planar_angles.data());
+  EXPECT_DOUBLE_EQ(planar_angles[0].Value(), 0.5 * Pi<double>);
+  EXPECT_DOUBLE_EQ(planar_angles[1].Value(), 1.0e-10);
+  EXPECT_DOUBLE_EQ(planar_angles[2].Value(), Pi<double>);
+  EXPECT_EQ(planar_angles[3].Value(), 0.0);
+}
+
+TEST(Angle, BetweenPerformance) {
+  constexpr std::size_t size{1 << 14};
+  std::vector<Vector<>> vectors_1;
+  std::vector<Vector<>> vectors_2;
+  vectors_1.reserve(size);
+  vectors_2.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64) + 1.0};
+    vectors_1.emplace_back(value, 1.0 - value, 0.5 * value);
+    vectors_2.emplace_back(2.0 - value, value, -value);
+  }
+  std::vector<Angle<>> per_element_angles(size);
+  std::vector<Angle<>> batched_angles(size);
+
+  Internal::TestRelativePerformance(
+      [&]() { Angle<>::Between(vectors_1.data(), vectors_2.data(), size, batched_angles.data()); },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          per_element_angles[index] = Angle<>{vectors_1[index], vectors_2[index]};
+        }
+      });
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_NEAR(batched_angles[index].Value(), per_element_angles[index].Value(), 1.0e-12);
+  }
+}
+
 TEST(Angle, ComparisonOperators) {
   const Angle first{1.0, Unit::Angle::Radian};
   const Angle second{2.0, Unit::Angle::Radian};
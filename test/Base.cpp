@@ -24,17 +24,56 @@
 
 #include "../include/PhQ/Base.hpp"
 
+#include <array>
+#include <cerrno>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <gtest/gtest.h>
 #include <numbers>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "Performance.hpp"
+
 namespace PhQ {
 
 namespace {
 
+TEST(Base, AppendPrint) {
+  std::string buffer{"a="};
+  AppendPrint(buffer, 1.0);
+  buffer.append(", b=");
+  AppendPrint(buffer, -0.0001220703125F);
+  buffer.append(", c=");
+  AppendPrint(buffer, 0.0L);
+  EXPECT_EQ(buffer, "a=" + Print(1.0) + ", b=" + Print(-0.0001220703125F) + ", c=" + Print(0.0L));
+
+  // Reusing a buffer whose capacity suffices does not reallocate it.
+  buffer.clear();
+  const char* const data{buffer.data()};
+  AppendPrint(buffer, -16384.0);
+  EXPECT_EQ(buffer, Print(-16384.0));
+  EXPECT_EQ(buffer.data(), data);
+}
+
+TEST(Base, DefaultPrintFormat) {
+  EXPECT_EQ(DefaultPrintFormat(), PrintFormat::Full);
+  SetDefaultPrintFormat(PrintFormat::Shortest);
+  EXPECT_EQ(DefaultPrintFormat(), PrintFormat::Shortest);
+  EXPECT_EQ(Print(0.125), "0.125");
+  std::string buffer;
+  AppendPrint(buffer, 0.5F);
+  EXPECT_EQ(buffer, "0.5");
+  EXPECT_EQ(Print(0.125, PrintFormat::Full), "0.125000000000000000");
+  SetDefaultPrintFormat(PrintFormat::Full);
+  EXPECT_EQ(DefaultPrintFormat(), PrintFormat::Full);
+  EXPECT_EQ(Print(0.125), "0.125000000000000000");
+}
+
 TEST(Base, Lowercase) {
   EXPECT_EQ(Lowercase(""), "");
   EXPECT_EQ(Lowercase("AbCd123!?^-_"), "abcd123!?^-_");
@@ -90,6 +129,42 @@ TEST(Base, ParseNumberDouble) {
   EXPECT_EQ(ParseNumber<double>("1.0e1000000"), std::nullopt);
 }
 
+TEST(Base, ParseNumberExactDecimals) {
+  // Compares PhQ::ParseNumber against std::strtof and std::strtod on pseudo-random decimal numbers
+  // with various numbers of significant digits and various exponents, including numbers on either
+  // side of the limits of the exact fast path.
+  std::uint64_t state{12345};
+  std::array<char, 64> buffer{};
+  for (int iteration = 0; iteration < 100000; ++iteration) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    const unsigned long long significand{(state >> 11) % (1ULL << (5 + iteration % 50))};
+    const int exponent{static_cast<int>((state >> 3) % 61) - 30};
+    const int length{std::snprintf(buffer.data(), buffer.size(), "%s%llue%d",
+                                   iteration % 2 == 0 ? "" : "-", significand, exponent)};
+    ASSERT_GT(length, 0);
+    const std::string_view string{buffer.data(), static_cast<std::size_t>(length)};
+    errno = 0;
+    const float expected_float{std::strtof(buffer.data(), nullptr)};
+    if (errno == 0) {
+      EXPECT_EQ(ParseNumber<float>(string), expected_float) << string;
+    } else {
+      EXPECT_EQ(ParseNumber<float>(string), std::nullopt) << string;
+    }
+    EXPECT_EQ(ParseNumber<double>(string), std::strtod(buffer.data(), nullptr)) << string;
+  }
+  EXPECT_EQ(ParseNumber<double>("0.1"), 0.1);
+  EXPECT_EQ(ParseNumber<double>(".5"), 0.5);
+  EXPECT_EQ(ParseNumber<double>("5."), 5.0);
+  EXPECT_EQ(ParseNumber<double>("1e"), 1.0);
+  EXPECT_EQ(ParseNumber<double>("1e+"), 1.0);
+  EXPECT_EQ(ParseNumber<double>("9007199254740993"), 9007199254740992.0);
+  EXPECT_EQ(ParseNumber<double>("123456789012345678901234567890"), 1.2345678901234568e29);
+  EXPECT_EQ(ParseNumber<double>("0.000000000000000000000000000001"), 1.0e-30);
+  EXPECT_EQ(ParseNumber<double>("-"), std::nullopt);
+  EXPECT_EQ(ParseNumber<double>("."), std::nullopt);
+  EXPECT_EQ(ParseNumber<double>("e5"), std::nullopt);
+}
+
 TEST(Base, ParseNumberFloat) {
   EXPECT_EQ(ParseNumber<float>(""), std::nullopt);
   EXPECT_EQ(ParseNumber<float>("Hello world!"), std::nullopt);
@@ -115,6 +190,23 @@ TEST(Base, ParseNumberFloat) {
   EXPECT_EQ(ParseNumber<float>("1.0e1000000"), std::nullopt);
 }
 
+TEST(Base, ParseNumberHexadecimal) {
+  EXPECT_EQ(ParseNumber<double>("0x10"), 16.0);
+  EXPECT_EQ(ParseNumber<double>("0X10"), 16.0);
+  EXPECT_EQ(ParseNumber<double>("-0x10"), -16.0);
+  EXPECT_EQ(ParseNumber<double>("+0x10"), 16.0);
+  EXPECT_EQ(ParseNumber<double>(" 0x1.8p3"), 12.0);
+  EXPECT_EQ(ParseNumber<double>("0x.8"), 0.5);
+  EXPECT_EQ(ParseNumber<double>("0xAbC"), 2748.0);
+  EXPECT_EQ(ParseNumber<double>("0x"), 0.0);
+  EXPECT_EQ(ParseNumber<double>("0xg"), 0.0);
+  EXPECT_EQ(ParseNumber<double>("0x1p100000"), std::nullopt);
+  EXPECT_EQ(ParseNumber<float>("0x10"), 16.0F);
+  EXPECT_EQ(ParseNumber<float>("-0x1.8p1"), -3.0F);
+  EXPECT_EQ(ParseNumber<long double>("0x10"), 16.0L);
+  EXPECT_EQ(ParseNumber<long double>("-0x1.8p1"), -3.0L);
+}
+
 TEST(Base, ParseNumberLongDouble) {
   EXPECT_EQ(ParseNumber<long double>(""), std::nullopt);
   EXPECT_EQ(ParseNumber<long double>("Hello world!"), std::nullopt);
@@ -143,6 +235,55 @@ TEST(Base, ParseNumberLongDouble) {
   EXPECT_EQ(ParseNumber<long double>("1.0e1000000"), std::nullopt);
 }
 
+TEST(Base, ParseNumberPerformance) {
+  // Compares PhQ::ParseNumber against std::stod on valid and invalid inputs.
+  const std::vector<std::string> valid_strings{
+    "0", "-1.23456789", "100", "1.23456789e12", "-4.5e-7", "3.14159265358979323846", "2.5",
+    "-1024", "6.02214076e23", "0.001"};
+  const std::vector<std::string> invalid_strings{
+    "", "Hello world!", "m/s", "kN", "-", "e5", "x1.0", ".", "+-1", "abc"};
+  const std::size_t repetitions{200};
+
+  for (const std::vector<std::string>* const strings : {&valid_strings, &invalid_strings}) {
+    double parse_number_sum{0.0};
+    double reference_sum{0.0};
+    Internal::TestRelativePerformance(
+        [&]() {
+          for (std::size_t repetition = 0; repetition < repetitions; ++repetition) {
+            for (const std::string& string : *strings) {
+              parse_number_sum += ParseNumber<double>(std::string_view{string}).value_or(1.0);
+            }
+          }
+        },
+        [&]() {
+          for (std::size_t repetition = 0; repetition < repetitions; ++repetition) {
+            for (const std::string& string : *strings) {
+              try {
+                reference_sum += std::stod(string);
+              } catch (...) {
+                reference_sum += 1.0;
+              }
+            }
+          }
+        });
+    EXPECT_EQ(parse_number_sum, reference_sum);
+  }
+}
+
+TEST(Base, ParseNumberStringView) {
+  const std::string_view fields{"12.5,-3.0e5,kN,,  7"};
+  EXPECT_EQ(ParseNumber<double>(fields.substr(0, 4)), 12.5);
+  EXPECT_EQ(ParseNumber<float>(fields.substr(5, 6)), -3.0e5F);
+  EXPECT_EQ(ParseNumber<long double>(fields.substr(12, 2)), std::nullopt);
+  EXPECT_EQ(ParseNumber<double>(fields.substr(15, 0)), std::nullopt);
+  EXPECT_EQ(ParseNumber<double>(fields.substr(16)), 7.0);
+  EXPECT_EQ(ParseNumber<double>(std::string_view{"1234", 2}), 12.0);
+  EXPECT_EQ(ParseNumber<double>(" \t+2.5"), 2.5);
+  EXPECT_EQ(ParseNumber<double>("+-2.5"), std::nullopt);
+  EXPECT_EQ(ParseNumber<double>("2.5 m"), 2.5);
+  EXPECT_EQ(ParseNumber<double>(std::string{"-0.125"}), -0.125);
+}
+
 TEST(Base, Pi) {
   EXPECT_EQ(Pi<>, static_cast<double>(3.141592653589793238462643383279502884L));
   EXPECT_EQ(Pi<float>, static_cast<float>(3.141592653589793238462643383279502884L));
@@ -221,11 +362,70 @@ TEST(Base, PrintLongDouble) {
   EXPECT_GE(Print(16384.0L).size(), Print(16384.0).size());
 }
 
+TEST(Base, PrintShortest) {
+  EXPECT_EQ(Print(-16384.0, PrintFormat::Shortest), "-16384");
+  EXPECT_EQ(Print(-1.0, PrintFormat::Shortest), "-1");
+  EXPECT_EQ(Print(-0.0, PrintFormat::Shortest), "0");
+  EXPECT_EQ(Print(0.0, PrintFormat::Shortest), "0");
+  EXPECT_EQ(Print(0.1, PrintFormat::Shortest), "0.1");
+  EXPECT_EQ(Print(0.125, PrintFormat::Shortest), "0.125");
+  EXPECT_EQ(Print(1.0e20, PrintFormat::Shortest), "1e+20");
+  EXPECT_EQ(Print(1.0e-20, PrintFormat::Shortest), "1e-20");
+  EXPECT_EQ(Print(0.1F, PrintFormat::Shortest), "0.1");
+  EXPECT_EQ(Print(-2.5F, PrintFormat::Shortest), "-2.5");
+  EXPECT_EQ(Print(0.1L, PrintFormat::Shortest), "0.1");
+  EXPECT_EQ(Print(-2.5L, PrintFormat::Shortest), "-2.5");
+  EXPECT_LT(Print(0.1, PrintFormat::Shortest).size(), Print(0.1, PrintFormat::Full).size());
+}
+
+TEST(Base, PrintShortestRoundTrip) {
+  // Numbers printed in the shortest format parse back to exactly the same numbers and are never
+  // longer than numbers printed in the full format.
+  std::uint64_t state{54321};
+  for (int iteration = 0; iteration < 100000; ++iteration) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    const int exponent{static_cast<int>(state % 80) - 70};
+    const double value{std::ldexp(static_cast<double>(state >> 11), exponent)
+                       * (iteration % 2 == 0 ? 1.0 : -1.0)};
+    const std::string shortest_double{Print(value, PrintFormat::Shortest)};
+    EXPECT_EQ(ParseNumber<double>(shortest_double), value) << shortest_double;
+    EXPECT_LE(shortest_double.size(), Print(value, PrintFormat::Full).size());
+    const float value_float{static_cast<float>(value)};
+    const std::string shortest_float{Print(value_float, PrintFormat::Shortest)};
+    EXPECT_EQ(ParseNumber<float>(shortest_float), value_float) << shortest_float;
+    EXPECT_LE(shortest_float.size(), Print(value_float, PrintFormat::Full).size());
+  }
+}
+
 TEST(Base, SnakeCase) {
   EXPECT_EQ(SnakeCase(""), "");
   EXPECT_EQ(SnakeCase("Ab Cd 123   !?^-_"), "ab_cd_123___!?^-_");
 }
 
+TEST(Base, SpellingTable) {
+  enum class Colour : int8_t { Red, Green, Blue };
+  constexpr Internal::SpellingTable<Colour, 5> table{Internal::MakeSpellingTable<Colour>({
+    {"red",   Colour::Red  },
+    {"R",     Colour::Red  },
+    {"green", Colour::Green},
+    {"blue",  Colour::Blue },
+    {"bleu",  Colour::Blue },
+  })};
+  static_assert(table.Find("red") == Colour::Red);
+  static_assert(table.Find("bleu") == Colour::Blue);
+  static_assert(!table.Find("").has_value());
+  EXPECT_EQ(table.Find("red"), Colour::Red);
+  EXPECT_EQ(table.Find("R"), Colour::Red);
+  EXPECT_EQ(table.Find("green"), Colour::Green);
+  EXPECT_EQ(table.Find("blue"), Colour::Blue);
+  EXPECT_EQ(table.Find("bleu"), Colour::Blue);
+  EXPECT_EQ(table.Find(""), std::nullopt);
+  EXPECT_EQ(table.Find("r"), std::nullopt);
+  EXPECT_EQ(table.Find("Red"), std::nullopt);
+  EXPECT_EQ(table.Find("reds"), std::nullopt);
+  EXPECT_EQ(table.Find("yellow"), std::nullopt);
+}
+
 TEST(Base, Uppercase) {
   EXPECT_EQ(Uppercase(""), "");
   EXPECT_EQ(Uppercase("AbCd123.!?*^-_"), "ABCD123.!?*^-_");
@@ -0,0 +1,406 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Binary.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/PhQ/Acceleration.hpp"
+#include "../include/PhQ/Angle.hpp"
+#include "../include/PhQ/AngularSpeed.hpp"
+#include "../include/PhQ/Area.hpp"
+#include "../include/PhQ/BulkDynamicViscosity.hpp"
+#include "../include/PhQ/Direction.hpp"
+#include "../include/PhQ/Displacement.hpp"
+#include "../include/PhQ/DisplacementGradient.hpp"
+#include "../include/PhQ/DynamicKinematicPressure.hpp"
+#include "../include/PhQ/DynamicPressure.hpp"
+#include "../include/PhQ/DynamicViscosity.hpp"
+#include "../include/PhQ/ElectricCharge.hpp"
+#include "../include/PhQ/ElectricCurrent.hpp"
+#include "../include/PhQ/Energy.hpp"
+#include "../include/PhQ/Force.hpp"
+#include "../include/PhQ/Frequency.hpp"
+#include "../include/PhQ/GasConstant.hpp"
+#include "../include/PhQ/HeatCapacityRatio.hpp"
+#include "../include/PhQ/HeatFlux.hpp"
+#include "../include/PhQ/IsentropicBulkModulus.hpp"
+#include "../include/PhQ/IsobaricHeatCapacity.hpp"
+#include "../include/PhQ/IsochoricHeatCapacity.hpp"
+#include "../include/PhQ/IsothermalBulkModulus.hpp"
+#include "../include/PhQ/KinematicViscosity.hpp"
+#include "../include/PhQ/LameFirstModulus.hpp"
+#include "../include/PhQ/Length.hpp"
+#include "../include/PhQ/LinearThermalExpansionCoefficient.hpp"
+#include "../include/PhQ/MachNumber.hpp"
+#include "../include/PhQ/Mass.hpp"
+#include "../include/PhQ/MassDensity.hpp"
+#include "../include/PhQ/MassRate.hpp"
+#include "../include/PhQ/Memory.hpp"
+#include "../include/PhQ/MemoryRate.hpp"
+#include "../include/PhQ/PWaveModulus.hpp"
+#include "../include/PhQ/PlanarAcceleration.hpp"
+#include "../include/PhQ/PlanarDirection.hpp"
+#include "../include/PhQ/PlanarDisplacement.hpp"
+#include "../include/PhQ/PlanarForce.hpp"
+#include "../include/PhQ/PlanarHeatFlux.hpp"
+#include "../include/PhQ/PlanarPosition.hpp"
+#include "../include/PhQ/PlanarTemperatureGradient.hpp"
+#include "../include/PhQ/PlanarTraction.hpp"
+#include "../include/PhQ/PlanarVelocity.hpp"
+#include "../include/PhQ/PoissonRatio.hpp"
+#include "../include/PhQ/Position.hpp"
+#include "../include/PhQ/Power.hpp"
+#include "../include/PhQ/PrandtlNumber.hpp"
+#include "../include/PhQ/ReynoldsNumber.hpp"
+#include "../include/PhQ/ScalarAcceleration.hpp"
+#include "../include/PhQ/ScalarAngularAcceleration.hpp"
+#include "../include/PhQ/ScalarDisplacementGradient.hpp"
+#include "../include/PhQ/ScalarForce.hpp"
+#include "../include/PhQ/ScalarHeatFlux.hpp"
+#include "../include/PhQ/ScalarStrain.hpp"
+#include "../include/PhQ/ScalarStrainRate.hpp"
+#include "../include/PhQ/ScalarStress.hpp"
+#include "../include/PhQ/ScalarTemperatureGradient.hpp"
+#include "../include/PhQ/ScalarThermalConductivity.hpp"
+#include "../include/PhQ/ScalarTraction.hpp"
+#include "../include/PhQ/ScalarVelocityGradient.hpp"
+#include "../include/PhQ/ShearModulus.hpp"
+#include "../include/PhQ/SolidAngle.hpp"
+#include "../include/PhQ/SoundSpeed.hpp"
+#include "../include/PhQ/SpecificEnergy.hpp"
+#include "../include/PhQ/SpecificGasConstant.hpp"
+#include "../include/PhQ/SpecificIsobaricHeatCapacity.hpp"
+#include "../include/PhQ/SpecificIsochoricHeatCapacity.hpp"
+#include "../include/PhQ/SpecificPower.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/StaticKinematicPressure.hpp"
+#include "../include/PhQ/StaticPressure.hpp"
+#include "../include/PhQ/Strain.hpp"
+#include "../include/PhQ/StrainRate.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/SubstanceAmount.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/TemperatureDifference.hpp"
+#include "../include/PhQ/TemperatureGradient.hpp"
+#include "../include/PhQ/ThermalConductivity.hpp"
+#include "../include/PhQ/ThermalDiffusivity.hpp"
+#include "../include/PhQ/Time.hpp"
+#include "../include/PhQ/TotalKinematicPressure.hpp"
+#include "../include/PhQ/TotalPressure.hpp"
+#include "../include/PhQ/Traction.hpp"
+#include "../include/PhQ/TransportEnergyConsumption.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/VectorArea.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+#include "../include/PhQ/Volume.hpp"
+#include "../include/PhQ/VolumeRate.hpp"
+#include "../include/PhQ/VolumetricThermalExpansionCoefficient.hpp"
+#include "../include/PhQ/YoungModulus.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Returns whether two collections of physical quantities are bit-for-bit identical.
+template <typename Quantity>
+bool BitwiseEqual(const std::vector<Quantity>& first, const std::vector<Quantity>& second) {
+  return first.size() == second.size()
+         && std::memcmp(first.data(), second.data(), first.size() * sizeof(Quantity)) == 0;
+}
+
+// Returns whether two collections of physical quantities have bit-for-bit identical significant
+// bytes. The padding bytes of extended-precision long double components are not compared.
+template <typename Quantity>
+bool SignificantBitwiseEqual(
+    const std::vector<Quantity>& first, const std::vector<Quantity>& second) {
+  using NumericType = typename Internal::BinaryNumericType<Quantity>::Type;
+  constexpr std::size_t width{Internal::BinaryComponentSize<NumericType>};
+  if (first.size() != second.size()) {
+    return false;
+  }
+  const char* const first_bytes{reinterpret_cast<const char*>(first.data())};
+  const char* const second_bytes{reinterpret_cast<const char*>(second.data())};
+  for (std::size_t offset = 0; offset < first.size() * sizeof(Quantity);
+       offset += sizeof(NumericType)) {
+    if (std::memcmp(first_bytes + offset, second_bytes + offset, width) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename NumericType>
+std::vector<Stress<NumericType>> Stresses(const std::size_t size) {
+  std::vector<Stress<NumericType>> stresses;
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType value{static_cast<NumericType>(index) / static_cast<NumericType>(7)};
+    stresses.emplace_back(SymmetricDyad<NumericType>{value, -value, value * 3, 1 / (value + 1),
+                                                     value * value, -value / 3},
+                          Unit::Pressure::Pascal);
+  }
+  return stresses;
+}
+
+TEST(Binary, Header) {
+  std::ostringstream stream;
+  WriteBinary(stream, Velocity<double>({1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond));
+  const std::string bytes{stream.str()};
+  ASSERT_EQ(bytes.size(), 32 + 3 * sizeof(double));
+  EXPECT_EQ(bytes.substr(0, 4), "PhQB");
+  EXPECT_EQ(bytes[4], static_cast<char>(BinaryFormatVersion));
+  EXPECT_EQ(bytes[5], 3);
+  EXPECT_EQ(bytes[6], static_cast<char>(sizeof(double)));
+  EXPECT_EQ(bytes[7], 0);
+  EXPECT_EQ(bytes[8], -1);
+  EXPECT_EQ(bytes[9], 1);
+  EXPECT_EQ(bytes[10], 0);
+  EXPECT_EQ(bytes[15], 0);
+  std::uint64_t identifier{0};
+  for (std::size_t index = 0; index < 8; ++index) {
+    identifier |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[16 + index]))
+                  << (8 * index);
+  }
+  EXPECT_EQ(identifier, Internal::BinaryTypeIdentifier<Velocity>);
+  EXPECT_EQ(bytes[24], 1);
+  EXPECT_EQ(bytes.substr(25, 7), std::string(7, '\0'));
+  // The components are little-endian: the last byte of 1.0 holds its sign and exponent.
+  EXPECT_EQ(bytes[32 + sizeof(double) - 1], 0x3F);
+}
+
+TEST(Binary, RoundTrip) {
+  const std::vector<Stress<double>> stresses{Stresses<double>(1000)};
+  std::stringstream stream;
+  WriteBinary(stream, stresses);
+  EXPECT_EQ(stream.str().size(), 32 + stresses.size() * 6 * sizeof(double));
+  const std::optional<std::vector<Stress<double>>> read{ReadBinary<Stress<double>>(stream)};
+  ASSERT_TRUE(read.has_value());
+  EXPECT_TRUE(BitwiseEqual(*read, stresses));
+
+  const std::vector<Strain<double>> strains{
+      Strain<double>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0),
+      Strain<double>(-0.1, 0.2, -0.3, 0.4, -0.5, 0.6)};
+  const std::vector<Velocity<double>> velocities{
+      Velocity<double>({0.1, -0.2, 0.3}, Unit::Speed::MetrePerSecond),
+      Velocity<double>({4.0e300, -5.0e-300, 0.0}, Unit::Speed::MetrePerSecond)};
+  const std::vector<Length<float>> lengths{
+      Length<float>(1.5F, Unit::Length::Metre), Length<float>(-2.25F, Unit::Length::Millimetre)};
+  stream.str("");
+  WriteBinary(stream, strains);
+  WriteBinary(stream, velocities);
+  WriteBinary(stream, lengths);
+  WriteBinary(stream, std::vector<Velocity<double>>{});
+  const std::optional<std::vector<Strain<double>>> read_strains{
+      ReadBinary<Strain<double>>(stream)};
+  const std::optional<std::vector<Velocity<double>>> read_velocities{
+      ReadBinary<Velocity<double>>(stream)};
+  const std::optional<std::vector<Length<float>>> read_lengths{ReadBinary<Length<float>>(stream)};
+  const std::optional<std::vector<Velocity<double>>> read_empty{
+      ReadBinary<Velocity<double>>(stream)};
+  ASSERT_TRUE(read_strains.has_value());
+  ASSERT_TRUE(read_velocities.has_value());
+  ASSERT_TRUE(read_lengths.has_value());
+  ASSERT_TRUE(read_empty.has_value());
+  EXPECT_TRUE(BitwiseEqual(*read_strains, strains));
+  EXPECT_TRUE(BitwiseEqual(*read_velocities, velocities));
+  EXPECT_TRUE(BitwiseEqual(*read_lengths, lengths));
+  EXPECT_TRUE(read_empty->empty());
+}
+
+TEST(Binary, RoundTripLongDouble) {
+  const std::vector<Stress<long double>> stresses{Stresses<long double>(100)};
+  std::stringstream stream;
+  WriteBinary(stream, stresses);
+  EXPECT_EQ(stream.str().size(),
+            32 + stresses.size() * 6 * Internal::BinaryComponentSize<long double>);
+  const std::optional<std::vector<Stress<long double>>> read{
+      ReadBinary<Stress<long double>>(stream)};
+  ASSERT_TRUE(read.has_value());
+  EXPECT_TRUE(SignificantBitwiseEqual(*read, stresses));
+}
+
+TEST(Binary, Mismatch) {
+  std::stringstream stream;
+  WriteBinary(stream, Stresses<double>(10));
+  const std::string bytes{stream.str()};
+
+  // Wrong physical quantity type.
+  std::istringstream strain_stream{bytes};
+  EXPECT_EQ(ReadBinary<Strain<double>>(strain_stream), std::nullopt);
+
+  // Different physical quantity types that share the same numeric type, number of components,
+  // and physical dimension.
+  std::stringstream scalar_stress_stream;
+  WriteBinary(scalar_stress_stream, ScalarStress<double>(1.0, Unit::Pressure::Pascal));
+  EXPECT_EQ(ReadBinary<YoungModulus<double>>(scalar_stress_stream), std::nullopt);
+  std::stringstream static_pressure_stream;
+  WriteBinary(static_pressure_stream, StaticPressure<double>(1.0, Unit::Pressure::Pascal));
+  EXPECT_EQ(ReadBinary<ShearModulus<double>>(static_pressure_stream), std::nullopt);
+  std::ostringstream poisson_ratio_stream;
+  WriteBinary(poisson_ratio_stream, PoissonRatio<double>(0.3));
+  const std::string poisson_ratio_bytes{poisson_ratio_stream.str()};
+  std::istringstream reynolds_number_stream{poisson_ratio_bytes};
+  EXPECT_EQ(ReadBinary<ReynoldsNumber<double>>(reynolds_number_stream), std::nullopt);
+  std::istringstream mach_number_stream{poisson_ratio_bytes};
+  EXPECT_EQ(ReadBinary<MachNumber<double>>(mach_number_stream), std::nullopt);
+
+  // Wrong numeric type.
+  std::istringstream float_stream{bytes};
+  EXPECT_EQ(ReadBinary<Stress<float>>(float_stream), std::nullopt);
+
+  // Truncated data.
+  std::istringstream truncated_stream{bytes.substr(0, bytes.size() - 1)};
+  EXPECT_EQ(ReadBinary<Stress<double>>(truncated_stream), std::nullopt);
+
+  // Unsupported version.
+  std::string modified{bytes};
+  modified[4] = static_cast<char>(BinaryFormatVersion + 1);
+  std::istringstream version_stream{modified};
+  EXPECT_EQ(ReadBinary<Stress<double>>(version_stream), std::nullopt);
+
+  // Corrupted signature.
+  modified = bytes;
+  modified[0] = 'X';
+  std::istringstream signature_stream{modified};
+  EXPECT_EQ(ReadBinary<Stress<double>>(signature_stream), std::nullopt);
+
+  // Corrupted size that is much larger than the data.
+  modified = bytes;
+  modified[31] = static_cast<char>(0x7F);
+  std::istringstream size_stream{modified};
+  EXPECT_EQ(ReadBinary<Stress<double>>(size_stream), std::nullopt);
+
+  // Empty stream.
+  std::istringstream empty_stream;
+  EXPECT_EQ(ReadBinary<Stress<double>>(empty_stream), std::nullopt);
+}
+
+TEST(Binary, TypeIdentifier) {
+  // The identifiers are part of the binary format and must never change.
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Acceleration>, 1);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Angle>, 2);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<AngularSpeed>, 3);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Area>, 4);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<BulkDynamicViscosity>, 5);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Direction>, 6);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Displacement>, 7);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<DisplacementGradient>, 8);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<DynamicKinematicPressure>, 9);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<DynamicPressure>, 10);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<DynamicViscosity>, 11);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ElectricCharge>, 12);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ElectricCurrent>, 13);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Energy>, 14);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Force>, 15);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Frequency>, 16);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<GasConstant>, 17);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<HeatCapacityRatio>, 18);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<HeatFlux>, 19);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<IsentropicBulkModulus>, 20);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<IsobaricHeatCapacity>, 21);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<IsochoricHeatCapacity>, 22);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<IsothermalBulkModulus>, 23);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<KinematicViscosity>, 24);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<LameFirstModulus>, 25);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Length>, 26);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<LinearThermalExpansionCoefficient>, 27);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<MachNumber>, 28);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Mass>, 29);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<MassDensity>, 30);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<MassRate>, 31);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Memory>, 32);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<MemoryRate>, 33);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PWaveModulus>, 34);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarAcceleration>, 35);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarDirection>, 36);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarDisplacement>, 37);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarForce>, 38);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarHeatFlux>, 39);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarPosition>, 40);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarTemperatureGradient>, 41);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarTraction>, 42);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PlanarVelocity>, 43);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PoissonRatio>, 44);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Position>, 45);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Power>, 46);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<PrandtlNumber>, 47);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ReynoldsNumber>, 48);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarAcceleration>, 49);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarAngularAcceleration>, 50);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarDisplacementGradient>, 51);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarForce>, 52);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarHeatFlux>, 53);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarStrain>, 54);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarStrainRate>, 55);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarStress>, 56);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarTemperatureGradient>, 57);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarThermalConductivity>, 58);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarTraction>, 59);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ScalarVelocityGradient>, 60);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ShearModulus>, 61);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SolidAngle>, 62);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SoundSpeed>, 63);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SpecificEnergy>, 64);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SpecificGasConstant>, 65);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SpecificIsobaricHeatCapacity>, 66);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SpecificIsochoricHeatCapacity>, 67);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SpecificPower>, 68);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Speed>, 69);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<StaticKinematicPressure>, 70);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<StaticPressure>, 71);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Strain>, 72);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<StrainRate>, 73);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Stress>, 74);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<SubstanceAmount>, 75);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Temperature>, 76);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<TemperatureDifference>, 77);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<TemperatureGradient>, 78);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ThermalConductivity>, 79);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<ThermalDiffusivity>, 80);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Time>, 81);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<TotalKinematicPressure>, 82);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<TotalPressure>, 83);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Traction>, 84);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<TransportEnergyConsumption>, 85);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<VectorArea>, 86);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Velocity>, 87);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<VelocityGradient>, 88);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<Volume>, 89);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<VolumeRate>, 90);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<VolumetricThermalExpansionCoefficient>, 91);
+  EXPECT_EQ(Internal::BinaryTypeIdentifier<YoungModulus>, 92);
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -24,11 +24,13 @@
 
 #include "../../include/PhQ/ConstitutiveModel/CompressibleNewtonianFluid.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../../include/PhQ/BulkDynamicViscosity.hpp"
 #include "../../include/PhQ/ConstitutiveModel.hpp"
@@ -38,11 +40,56 @@
 #include "../../include/PhQ/Stress.hpp"
 #include "../../include/PhQ/Unit/DynamicViscosity.hpp"
 #include "../../include/PhQ/Unit/Frequency.hpp"
+#include "../../include/PhQ/VelocityGradient.hpp"
+#include "../Performance.hpp"
 
 namespace PhQ {
 
 namespace {
 
+TEST(ConstitutiveModelCompressibleNewtonianFluid, BatchedStressAndStrain) {
+  const std::unique_ptr<const ConstitutiveModel> model =
+      std::make_unique<const ConstitutiveModel::CompressibleNewtonianFluid<>>(
+          DynamicViscosity(128.0, Unit::DynamicViscosity::PascalSecond),
+          BulkDynamicViscosity(1.0, Unit::DynamicViscosity::PascalSecond));
+  ASSERT_NE(model, nullptr);
+  const std::vector<Strain<>> strains{
+    {32.0, -4.0, -2.0, 16.0, -1.0, 8.0},
+    {-8.0, 2.0, 1.0, 4.0, -2.0, 16.0},
+    {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}
+  };
+  const std::vector<StrainRate<>> strain_rates{
+    {{32.0, -4.0, -2.0, 16.0, -1.0, 8.0}, Unit::Frequency::Hertz},
+    {{-8.0, 2.0, 1.0, 4.0, -2.0, 16.0}, Unit::Frequency::Hertz},
+    {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Frequency::Hertz}
+  };
+  const std::size_t size{strains.size()};
+  std::vector<Stress<>> stresses(size);
+  std::vector<Strain<>> strains_from_stresses(size);
+  std::vector<StrainRate<>> strain_rates_from_stresses(size);
+
+  model->Stresses(strains.data(), strain_rates.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strains[index], strain_rates[index]));
+  }
+  model->Strains(stresses.data(), size, strains_from_stresses.data());
+  model->StrainRates(stresses.data(), size, strain_rates_from_stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(strains_from_stresses[index], model->Strain(stresses[index]));
+    EXPECT_EQ(strain_rates_from_stresses[index], model->StrainRate(stresses[index]));
+  }
+
+  model->Stresses(strains.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strains[index]));
+  }
+
+  model->Stresses(strain_rates.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strain_rates[index]));
+  }
+}
+
 TEST(ConstitutiveModelCompressibleNewtonianFluid, ComparisonOperators) {
   {
     const ConstitutiveModel::CompressibleNewtonianFluid<> first{
@@ -264,6 +311,65 @@ TEST(ConstitutiveModelCompressibleNewtonianFluid, StressAndStrainLongDouble) {
   EXPECT_EQ(model->Stress(strain, strain_rate), stress);
 }
 
+TEST(ConstitutiveModelCompressibleNewtonianFluid, StressFromVelocityGradient) {
+  const ConstitutiveModel::CompressibleNewtonianFluid<> model{
+      DynamicViscosity(128.0, Unit::DynamicViscosity::PascalSecond),
+      BulkDynamicViscosity(1.0, Unit::DynamicViscosity::PascalSecond)};
+  const std::vector<VelocityGradient<>> velocity_gradients{
+    {{32.0, -4.0, -2.0, 6.0, 16.0, -1.0, 3.0, 5.0, 8.0}, Unit::Frequency::Hertz},
+    {{-8.0, 2.0, 1.0, -2.0, 4.0, -2.0, 7.0, 0.5, 16.0}, Unit::Frequency::Hertz},
+    {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Frequency::Hertz}
+  };
+  const std::size_t size{velocity_gradients.size()};
+  std::vector<Stress<>> stresses(size);
+  model.Stresses(velocity_gradients.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    const Stress<> expected{model.Stress(StrainRate<>{velocity_gradients[index]})};
+    EXPECT_EQ(stresses[index], expected);
+    EXPECT_EQ(model.Stress(velocity_gradients[index]), expected);
+  }
+
+  const std::vector<VelocityGradient<float>> float_velocity_gradients{
+      velocity_gradients.begin(), velocity_gradients.end()};
+  std::vector<Stress<float>> float_stresses(size);
+  model.Stresses<ConstitutiveModel::MixedPrecision::Input>(
+      float_velocity_gradients.data(), size, float_stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(float_stresses[index], Stress<float>(stresses[index]));
+  }
+}
+
+TEST(ConstitutiveModelCompressibleNewtonianFluid, StressFromVelocityGradientPerformance) {
+  constexpr std::size_t size{1 << 12};
+  const ConstitutiveModel::CompressibleNewtonianFluid<> model{
+      DynamicViscosity(128.0, Unit::DynamicViscosity::PascalSecond),
+      BulkDynamicViscosity(1.0, Unit::DynamicViscosity::PascalSecond)};
+  std::vector<VelocityGradient<>> velocity_gradients;
+  velocity_gradients.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    velocity_gradients.emplace_back(
+        Dyad<>{value, -0.5 * value, 0.25 * value, 2.0 * value, -value, 4.0 * value, 1.0, -2.0,
+               0.5 * value},
+        Unit::Frequency::Hertz);
+  }
+  std::vector<Stress<>> per_point_stresses(size);
+  std::vector<Stress<>> fused_stresses(size);
+
+  Internal::TestRelativePerformance(
+      [&]() { model.Stresses(velocity_gradients.data(), size, fused_stresses.data()); },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          per_point_stresses[index] = model.Stress(StrainRate<>{velocity_gradients[index]});
+        }
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(fused_stresses[index], per_point_stresses[index]);
+  }
+}
+
 TEST(ConstitutiveModelCompressibleNewtonianFluid, Type) {
   const std::unique_ptr<const ConstitutiveModel> model =
       std::make_unique<const ConstitutiveModel::CompressibleNewtonianFluid<>>(
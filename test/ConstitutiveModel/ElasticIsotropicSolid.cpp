@@ -24,13 +24,16 @@
 
 #include "../../include/PhQ/ConstitutiveModel/ElasticIsotropicSolid.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../../include/PhQ/ConstitutiveModel.hpp"
+#include "../../include/PhQ/DisplacementGradient.hpp"
 #include "../../include/PhQ/IsentropicBulkModulus.hpp"
 #include "../../include/PhQ/IsothermalBulkModulus.hpp"
 #include "../../include/PhQ/LameFirstModulus.hpp"
@@ -43,11 +46,54 @@
 #include "../../include/PhQ/Unit/Frequency.hpp"
 #include "../../include/PhQ/Unit/Pressure.hpp"
 #include "../../include/PhQ/YoungModulus.hpp"
+#include "../Performance.hpp"
 
 namespace PhQ {
 
 namespace {
 
+TEST(ConstitutiveModelElasticIsotropicSolid, BatchedStressAndStrain) {
+  const std::unique_ptr<ConstitutiveModel> model =
+      std::make_unique<ConstitutiveModel::ElasticIsotropicSolid<>>(
+          ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal));
+  ASSERT_NE(model, nullptr);
+  const std::vector<Strain<>> strains{
+    {32.0, -4.0, -2.0, 16.0, -1.0, 8.0},
+    {-8.0, 2.0, 1.0, 4.0, -2.0, 16.0},
+    {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}
+  };
+  const std::vector<StrainRate<>> strain_rates{
+    {{32.0, -4.0, -2.0, 16.0, -1.0, 8.0}, Unit::Frequency::Hertz},
+    {{-8.0, 2.0, 1.0, 4.0, -2.0, 16.0}, Unit::Frequency::Hertz},
+    {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Frequency::Hertz}
+  };
+  const std::size_t size{strains.size()};
+  std::vector<Stress<>> stresses(size);
+  std::vector<Strain<>> strains_from_stresses(size);
+  std::vector<StrainRate<>> strain_rates_from_stresses(size);
+
+  model->Stresses(strains.data(), strain_rates.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strains[index], strain_rates[index]));
+  }
+  model->Strains(stresses.data(), size, strains_from_stresses.data());
+  model->StrainRates(stresses.data(), size, strain_rates_from_stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(strains_from_stresses[index], model->Strain(stresses[index]));
+    EXPECT_EQ(strain_rates_from_stresses[index], model->StrainRate(stresses[index]));
+  }
+
+  model->Stresses(strains.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strains[index]));
+  }
+
+  model->Stresses(strain_rates.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strain_rates[index]));
+  }
+}
+
 TEST(ConstitutiveModelElasticIsotropicSolid, ComparisonOperators) {
   {
     const ConstitutiveModel::ElasticIsotropicSolid<> first{
@@ -198,6 +244,36 @@ TEST(ConstitutiveModelElasticIsotropicSolid, JSON) {
                 + LameFirstModulus(1.0, Unit::Pressure::Pascal).JSON() + "}");
 }
 
+TEST(ConstitutiveModelElasticIsotropicSolid, MixedPrecision) {
+  const ConstitutiveModel::ElasticIsotropicSolid<> model{
+    ShearModulus(0.3, Unit::Pressure::Pascal), LameFirstModulus(0.7, Unit::Pressure::Pascal)};
+  const std::vector<Strain<float>> strains{
+    {0.1F, -0.2F, 0.3F, 0.4F, -0.5F, 0.6F},
+    {-1.7F, 2.3F, 0.9F, -3.1F, 0.2F, 1.3F}
+  };
+  const std::size_t size{strains.size()};
+  std::vector<Stress<float>> widest_stresses(size);
+  std::vector<Stress<float>> input_stresses(size);
+  model.Stresses<ConstitutiveModel::MixedPrecision::Widest>(
+      strains.data(), size, widest_stresses.data());
+  model.Stresses<ConstitutiveModel::MixedPrecision::Input>(
+      strains.data(), size, input_stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    // The widest policy evaluates in double precision and rounds only the results.
+    const Stress<double> expected{model.Stress(Strain<double>{strains[index]})};
+    EXPECT_EQ(widest_stresses[index], Stress<float>{expected});
+    EXPECT_EQ(model.Stress(strains[index]), widest_stresses[index]);
+
+    // The input policy evaluates in single precision.
+    EXPECT_FLOAT_EQ(input_stresses[index].Value().xx(), widest_stresses[index].Value().xx());
+    EXPECT_FLOAT_EQ(input_stresses[index].Value().xy(), widest_stresses[index].Value().xy());
+    EXPECT_FLOAT_EQ(input_stresses[index].Value().xz(), widest_stresses[index].Value().xz());
+    EXPECT_FLOAT_EQ(input_stresses[index].Value().yy(), widest_stresses[index].Value().yy());
+    EXPECT_FLOAT_EQ(input_stresses[index].Value().yz(), widest_stresses[index].Value().yz());
+    EXPECT_FLOAT_EQ(input_stresses[index].Value().zz(), widest_stresses[index].Value().zz());
+  }
+}
+
 TEST(ConstitutiveModelElasticIsotropicSolid, MoveAssignmentOperator) {
   ConstitutiveModel::ElasticIsotropicSolid<> first{
     ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal)};
@@ -218,6 +294,56 @@ TEST(ConstitutiveModelElasticIsotropicSolid, MoveConstructor) {
                         LameFirstModulus(1.0, Unit::Pressure::Pascal)));
 }
 
+TEST(ConstitutiveModelElasticIsotropicSolid, Performance) {
+  constexpr std::size_t size{1 << 12};
+  const std::unique_ptr<const ConstitutiveModel> model =
+      std::make_unique<const ConstitutiveModel::ElasticIsotropicSolid<>>(
+          ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal));
+  ASSERT_NE(model, nullptr);
+  std::vector<Strain<>> strains;
+  strains.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    strains.emplace_back(value, -0.5 * value, 0.25 * value, 2.0 * value, -value, 4.0 * value);
+  }
+  std::vector<Stress<>> per_point_stresses(size);
+  std::vector<Stress<>> batched_stresses(size);
+
+  Internal::TestRelativePerformance(
+      [&]() { model->Stresses(strains.data(), size, batched_stresses.data()); },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          per_point_stresses[index] = model->Stress(strains[index]);
+        }
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(batched_stresses[index], per_point_stresses[index]);
+  }
+
+  const std::vector<Strain<float>> float_strains{strains.begin(), strains.end()};
+  std::vector<Stress<float>> widest_stresses(size);
+  std::vector<Stress<float>> input_stresses(size);
+  const ConstitutiveModel::ElasticIsotropicSolid<> concrete_model{
+    ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal)};
+
+  Internal::TestRelativePerformance(
+      [&]() {
+        concrete_model.Stresses<ConstitutiveModel::MixedPrecision::Input>(
+            float_strains.data(), size, input_stresses.data());
+      },
+      [&]() {
+        concrete_model.Stresses<ConstitutiveModel::MixedPrecision::Widest>(
+            float_strains.data(), size, widest_stresses.data());
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(input_stresses[index], widest_stresses[index]);
+  }
+}
+
 TEST(ConstitutiveModelElasticIsotropicSolid, Print) {
   const std::unique_ptr<ConstitutiveModel> model =
       std::make_unique<ConstitutiveModel::ElasticIsotropicSolid<>>(
@@ -304,6 +430,60 @@ TEST(ConstitutiveModelElasticIsotropicSolid, StressAndStrainLongDouble) {
   EXPECT_EQ(model->Stress(strain, strain_rate), stress);
 }
 
+TEST(ConstitutiveModelElasticIsotropicSolid, StressFromDisplacementGradient) {
+  const ConstitutiveModel::ElasticIsotropicSolid<> model{
+    ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal)};
+  const std::vector<DisplacementGradient<>> displacement_gradients{
+    DisplacementGradient<>(Dyad<>{32.0, -4.0, -2.0, 6.0, 16.0, -1.0, 3.0, 5.0, 8.0}),
+    DisplacementGradient<>(Dyad<>{-8.0, 2.0, 1.0, -2.0, 4.0, -2.0, 7.0, 0.5, 16.0}),
+    DisplacementGradient<>::Zero()};
+  const std::size_t size{displacement_gradients.size()};
+  std::vector<Stress<>> stresses(size);
+  model.Stresses(displacement_gradients.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    const Stress<> expected{model.Stress(Strain<>{displacement_gradients[index]})};
+    EXPECT_EQ(stresses[index], expected);
+    EXPECT_EQ(model.Stress(displacement_gradients[index]), expected);
+  }
+
+  const std::vector<DisplacementGradient<float>> float_displacement_gradients{
+      displacement_gradients.begin(), displacement_gradients.end()};
+  std::vector<Stress<float>> float_stresses(size);
+  model.Stresses<ConstitutiveModel::MixedPrecision::Input>(
+      float_displacement_gradients.data(), size, float_stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(float_stresses[index], Stress<float>(stresses[index]));
+  }
+}
+
+TEST(ConstitutiveModelElasticIsotropicSolid, StressFromDisplacementGradientPerformance) {
+  constexpr std::size_t size{1 << 12};
+  const ConstitutiveModel::ElasticIsotropicSolid<> model{
+    ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal)};
+  std::vector<DisplacementGradient<>> displacement_gradients;
+  displacement_gradients.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    displacement_gradients.emplace_back(Dyad<>{value, -0.5 * value, 0.25 * value, 2.0 * value,
+                                               -value, 4.0 * value, 1.0, -2.0, 0.5 * value});
+  }
+  std::vector<Stress<>> per_point_stresses(size);
+  std::vector<Stress<>> fused_stresses(size);
+
+  Internal::TestRelativePerformance(
+      [&]() { model.Stresses(displacement_gradients.data(), size, fused_stresses.data()); },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          per_point_stresses[index] = model.Stress(Strain<>{displacement_gradients[index]});
+        }
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(fused_stresses[index], per_point_stresses[index]);
+  }
+}
+
 TEST(ConstitutiveModelElasticIsotropicSolid, Type) {
   const std::unique_ptr<ConstitutiveModel> model =
       std::make_unique<ConstitutiveModel::ElasticIsotropicSolid<>>(
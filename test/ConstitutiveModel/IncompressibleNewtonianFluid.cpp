@@ -24,11 +24,13 @@
 
 #include "../../include/PhQ/ConstitutiveModel/IncompressibleNewtonianFluid.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../../include/PhQ/ConstitutiveModel.hpp"
 #include "../../include/PhQ/DynamicViscosity.hpp"
@@ -37,11 +39,54 @@
 #include "../../include/PhQ/Stress.hpp"
 #include "../../include/PhQ/Unit/DynamicViscosity.hpp"
 #include "../../include/PhQ/Unit/Frequency.hpp"
+#include "../../include/PhQ/VelocityGradient.hpp"
 
 namespace PhQ {
 
 namespace {
 
+TEST(ConstitutiveModelIncompressibleNewtonianFluid, BatchedStressAndStrain) {
+  const std::unique_ptr<ConstitutiveModel> model =
+      std::make_unique<ConstitutiveModel::IncompressibleNewtonianFluid<>>(
+          DynamicViscosity(4.0, Unit::DynamicViscosity::PascalSecond));
+  ASSERT_NE(model, nullptr);
+  const std::vector<Strain<>> strains{
+    {32.0, -4.0, -2.0, 16.0, -1.0, 8.0},
+    {-8.0, 2.0, 1.0, 4.0, -2.0, 16.0},
+    {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}
+  };
+  const std::vector<StrainRate<>> strain_rates{
+    {{32.0, -4.0, -2.0, 16.0, -1.0, 8.0}, Unit::Frequency::Hertz},
+    {{-8.0, 2.0, 1.0, 4.0, -2.0, 16.0}, Unit::Frequency::Hertz},
+    {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Frequency::Hertz}
+  };
+  const std::size_t size{strains.size()};
+  std::vector<Stress<>> stresses(size);
+  std::vector<Strain<>> strains_from_stresses(size);
+  std::vector<StrainRate<>> strain_rates_from_stresses(size);
+
+  model->Stresses(strains.data(), strain_rates.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strains[index], strain_rates[index]));
+  }
+  model->Strains(stresses.data(), size, strains_from_stresses.data());
+  model->StrainRates(stresses.data(), size, strain_rates_from_stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(strains_from_stresses[index], model->Strain(stresses[index]));
+    EXPECT_EQ(strain_rates_from_stresses[index], model->StrainRate(stresses[index]));
+  }
+
+  model->Stresses(strains.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strains[index]));
+  }
+
+  model->Stresses(strain_rates.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(stresses[index], model->Stress(strain_rates[index]));
+  }
+}
+
 TEST(ConstitutiveModelIncompressibleNewtonianFluid, ComparisonOperators) {
   const ConstitutiveModel::IncompressibleNewtonianFluid<> first{
     DynamicViscosity(4.0, Unit::DynamicViscosity::PascalSecond)};
@@ -207,6 +252,33 @@ TEST(ConstitutiveModelIncompressibleNewtonianFluid, StressAndStrainLongDouble) {
   EXPECT_EQ(model->Stress(strain, strain_rate), stress);
 }
 
+TEST(ConstitutiveModelIncompressibleNewtonianFluid, StressFromVelocityGradient) {
+  const ConstitutiveModel::IncompressibleNewtonianFluid<> model{
+      DynamicViscosity(128.0, Unit::DynamicViscosity::PascalSecond)};
+  const std::vector<VelocityGradient<>> velocity_gradients{
+    {{32.0, -4.0, -2.0, 6.0, 16.0, -1.0, 3.0, 5.0, 8.0}, Unit::Frequency::Hertz},
+    {{-8.0, 2.0, 1.0, -2.0, 4.0, -2.0, 7.0, 0.5, 16.0}, Unit::Frequency::Hertz},
+    {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Frequency::Hertz}
+  };
+  const std::size_t size{velocity_gradients.size()};
+  std::vector<Stress<>> stresses(size);
+  model.Stresses(velocity_gradients.data(), size, stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    const Stress<> expected{model.Stress(StrainRate<>{velocity_gradients[index]})};
+    EXPECT_EQ(stresses[index], expected);
+    EXPECT_EQ(model.Stress(velocity_gradients[index]), expected);
+  }
+
+  const std::vector<VelocityGradient<float>> float_velocity_gradients{
+      velocity_gradients.begin(), velocity_gradients.end()};
+  std::vector<Stress<float>> float_stresses(size);
+  model.Stresses<ConstitutiveModel::MixedPrecision::Input>(
+      float_velocity_gradients.data(), size, float_stresses.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(float_stresses[index], Stress<float>(stresses[index]));
+  }
+}
+
 TEST(ConstitutiveModelIncompressibleNewtonianFluid, Type) {
   const std::unique_ptr<ConstitutiveModel> model =
       std::make_unique<ConstitutiveModel::IncompressibleNewtonianFluid<>>(
@@ -0,0 +1,190 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../../include/PhQ/ConstitutiveModel/Variant.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "../../include/PhQ/BulkDynamicViscosity.hpp"
+#include "../../include/PhQ/ConstitutiveModel.hpp"
+#include "../../include/PhQ/ConstitutiveModel/CompressibleNewtonianFluid.hpp"
+#include "../../include/PhQ/ConstitutiveModel/ElasticIsotropicSolid.hpp"
+#include "../../include/PhQ/ConstitutiveModel/IncompressibleNewtonianFluid.hpp"
+#include "../../include/PhQ/DynamicViscosity.hpp"
+#include "../../include/PhQ/LameFirstModulus.hpp"
+#include "../../include/PhQ/ShearModulus.hpp"
+#include "../../include/PhQ/Strain.hpp"
+#include "../../include/PhQ/StrainRate.hpp"
+#include "../../include/PhQ/Stress.hpp"
+#include "../../include/PhQ/Unit/DynamicViscosity.hpp"
+#include "../../include/PhQ/Unit/Frequency.hpp"
+#include "../../include/PhQ/Unit/Pressure.hpp"
+
+namespace PhQ {
+
+namespace {
+
+const Strain<> strain{32.0, -4.0, -2.0, 16.0, -1.0, 8.0};
+
+const StrainRate<> strain_rate{
+  {32.0, -4.0, -2.0, 16.0, -1.0, 8.0},
+  Unit::Frequency::Hertz
+};
+
+// Checks that a statically dispatched constitutive model gives the same results as the
+// polymorphic constitutive model from which it was created.
+void ExpectSameResults(
+    const ConstitutiveModel& polymorphic, const ConstitutiveModel::Variant<>& variant) {
+  EXPECT_EQ(variant.GetType(), polymorphic.GetType());
+  const Stress<> stress = polymorphic.Stress(strain, strain_rate);
+  EXPECT_EQ(variant.Stress(strain, strain_rate), stress);
+  EXPECT_EQ(variant.Stress(strain), polymorphic.Stress(strain));
+  EXPECT_EQ(variant.Stress(strain_rate), polymorphic.Stress(strain_rate));
+  EXPECT_EQ(variant.Strain(stress), polymorphic.Strain(stress));
+  EXPECT_EQ(variant.StrainRate(stress), polymorphic.StrainRate(stress));
+  EXPECT_EQ(variant.Print(), polymorphic.Print());
+  EXPECT_EQ(variant.JSON(), polymorphic.JSON());
+  EXPECT_EQ(variant.XML(), polymorphic.XML());
+  EXPECT_EQ(variant.YAML(), polymorphic.YAML());
+}
+
+TEST(ConstitutiveModelVariant, BatchedStressAndStrain) {
+  const ConstitutiveModel::Variant<> variant{ConstitutiveModel::ElasticIsotropicSolid<>{
+    ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal)}};
+  const std::vector<Strain<>> strains{strain, 2.0 * strain, Strain<>::Zero()};
+  std::vector<Stress<>> stresses(strains.size());
+  std::vector<Strain<>> strains_from_stresses(strains.size());
+  variant.Stresses(strains.data(), strains.size(), stresses.data());
+  variant.Strains(stresses.data(), stresses.size(), strains_from_stresses.data());
+  for (std::size_t index = 0; index < strains.size(); ++index) {
+    EXPECT_EQ(stresses[index], variant.Stress(strains[index]));
+    EXPECT_EQ(strains_from_stresses[index], variant.Strain(stresses[index]));
+  }
+}
+
+TEST(ConstitutiveModelVariant, CompressibleNewtonianFluid) {
+  const std::unique_ptr<const ConstitutiveModel> model =
+      std::make_unique<const ConstitutiveModel::CompressibleNewtonianFluid<>>(
+          DynamicViscosity(128.0, Unit::DynamicViscosity::PascalSecond),
+          BulkDynamicViscosity(1.0, Unit::DynamicViscosity::PascalSecond));
+  ASSERT_NE(model, nullptr);
+  const std::optional<ConstitutiveModel::Variant<>> variant =
+      ConstitutiveModel::Variant<>::Create(*model);
+  ASSERT_TRUE(variant.has_value());
+  ExpectSameResults(*model, variant.value());
+}
+
+TEST(ConstitutiveModelVariant, CopyAndMove) {
+  const ConstitutiveModel::Variant<> first{ConstitutiveModel::IncompressibleNewtonianFluid<>{
+    DynamicViscosity(4.0, Unit::DynamicViscosity::PascalSecond)}};
+  ConstitutiveModel::Variant<> second{first};
+  EXPECT_EQ(second.Print(), first.Print());
+  ConstitutiveModel::Variant<> third{std::move(second)};
+  EXPECT_EQ(third.Print(), first.Print());
+  ConstitutiveModel::Variant<> fourth;
+  fourth = third;
+  EXPECT_EQ(fourth.Print(), first.Print());
+  ConstitutiveModel::Variant<> fifth;
+  fifth = std::move(fourth);
+  EXPECT_EQ(fifth.Print(), first.Print());
+}
+
+TEST(ConstitutiveModelVariant, DerivedModel) {
+  // A user-defined class derived from one of the library's constitutive models may override its
+  // behavior, so it is not converted.
+  class DerivedModel : public ConstitutiveModel::ElasticIsotropicSolid<> {
+  public:
+    using ConstitutiveModel::ElasticIsotropicSolid<>::ElasticIsotropicSolid;
+  };
+  const std::unique_ptr<const ConstitutiveModel> model = std::make_unique<const DerivedModel>(
+      ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal));
+  ASSERT_NE(model, nullptr);
+  EXPECT_EQ(ConstitutiveModel::Variant<>::Create(*model), std::nullopt);
+}
+
+TEST(ConstitutiveModelVariant, ElasticIsotropicSolid) {
+  const std::unique_ptr<const ConstitutiveModel> model =
+      std::make_unique<const ConstitutiveModel::ElasticIsotropicSolid<>>(
+          ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal));
+  ASSERT_NE(model, nullptr);
+  const std::optional<ConstitutiveModel::Variant<>> variant =
+      ConstitutiveModel::Variant<>::Create(*model);
+  ASSERT_TRUE(variant.has_value());
+  ExpectSameResults(*model, variant.value());
+}
+
+TEST(ConstitutiveModelVariant, IncompressibleNewtonianFluid) {
+  const std::unique_ptr<const ConstitutiveModel> model =
+      std::make_unique<const ConstitutiveModel::IncompressibleNewtonianFluid<>>(
+          DynamicViscosity(4.0, Unit::DynamicViscosity::PascalSecond));
+  ASSERT_NE(model, nullptr);
+  const std::optional<ConstitutiveModel::Variant<>> variant =
+      ConstitutiveModel::Variant<>::Create(*model);
+  ASSERT_TRUE(variant.has_value());
+  ExpectSameResults(*model, variant.value());
+}
+
+TEST(ConstitutiveModelVariant, OtherNumericType) {
+  const std::unique_ptr<const ConstitutiveModel> model =
+      std::make_unique<const ConstitutiveModel::ElasticIsotropicSolid<float>>(
+          ShearModulus<float>(4.0F, Unit::Pressure::Pascal),
+          LameFirstModulus<float>(1.0F, Unit::Pressure::Pascal));
+  ASSERT_NE(model, nullptr);
+  const std::optional<ConstitutiveModel::Variant<>> variant =
+      ConstitutiveModel::Variant<>::Create(*model);
+  ASSERT_TRUE(variant.has_value());
+  EXPECT_EQ(variant->GetType(), ConstitutiveModel::Type::ElasticIsotropicSolid);
+  const ConstitutiveModel::ElasticIsotropicSolid<> expected{
+    ShearModulus(4.0, Unit::Pressure::Pascal), LameFirstModulus(1.0, Unit::Pressure::Pascal)};
+  EXPECT_EQ(variant->Stress(strain), expected.Stress(strain));
+}
+
+TEST(ConstitutiveModelVariant, Stream) {
+  const ConstitutiveModel::Variant<> variant{ConstitutiveModel::IncompressibleNewtonianFluid<>{
+    DynamicViscosity(4.0, Unit::DynamicViscosity::PascalSecond)}};
+  std::ostringstream stream;
+  stream << variant;
+  EXPECT_EQ(stream.str(), variant.Print());
+}
+
+TEST(ConstitutiveModelVariant, Visit) {
+  const ConstitutiveModel::Variant<> variant{ConstitutiveModel::CompressibleNewtonianFluid<>{
+    DynamicViscosity(128.0, Unit::DynamicViscosity::PascalSecond),
+    BulkDynamicViscosity(1.0, Unit::DynamicViscosity::PascalSecond)}};
+  const Stress<> stress = variant.Visit([](const auto& model) {
+    EXPECT_TRUE((std::is_same_v<std::decay_t<decltype(model)>,
+                                ConstitutiveModel::CompressibleNewtonianFluid<>>));
+    return model.Stress(strain_rate);
+  });
+  EXPECT_EQ(stress, variant.Stress(strain_rate));
+}
+
+}  // namespace
+
+}  // namespace PhQ
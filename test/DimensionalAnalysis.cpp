@@ -0,0 +1,248 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/DimensionalAnalysis.hpp"
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <type_traits>
+
+#include "../include/PhQ/Area.hpp"
+#include "../include/PhQ/Base.hpp"
+#include "../include/PhQ/Dimensions.hpp"
+#include "../include/PhQ/Energy.hpp"
+#include "../include/PhQ/Frequency.hpp"
+#include "../include/PhQ/Length.hpp"
+#include "../include/PhQ/Mass.hpp"
+#include "../include/PhQ/MassDensity.hpp"
+#include "../include/PhQ/MassRate.hpp"
+#include "../include/PhQ/Power.hpp"
+#include "../include/PhQ/ReynoldsNumber.hpp"
+#include "../include/PhQ/ScalarForce.hpp"
+#include "../include/PhQ/ScalarTemperatureGradient.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/StaticPressure.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/TemperatureDifference.hpp"
+#include "../include/PhQ/Time.hpp"
+#include "../include/PhQ/Unit/Area.hpp"
+#include "../include/PhQ/Unit/Energy.hpp"
+#include "../include/PhQ/Unit/Force.hpp"
+#include "../include/PhQ/Unit/Frequency.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/Mass.hpp"
+#include "../include/PhQ/Unit/MassDensity.hpp"
+#include "../include/PhQ/Unit/MassRate.hpp"
+#include "../include/PhQ/Unit/Power.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Unit/Time.hpp"
+#include "Performance.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Mass flux, M·L^(-2)·T^(-1), has no named scalar physical quantity.
+using MassFluxDimensions = StaticDimensions<-1, -2, 1, 0, 0, 0, 0>;
+
+static_assert(std::is_same_v<StaticDimensionsOf<Speed<>>, StaticDimensions<-1, 1, 0, 0, 0, 0, 0>>);
+static_assert(std::is_same_v<StaticDimensionsOf<ReynoldsNumber<>>, StaticDimensionless>);
+static_assert(std::is_same_v<Product<Length<>, Frequency<>>, Speed<>>);
+static_assert(std::is_same_v<Product<Mass<>, ScalarAcceleration<>>, ScalarForce<>>);
+static_assert(std::is_same_v<Product<ScalarForce<>, Speed<>>, Power<>>);
+static_assert(std::is_same_v<Product<Length<float>, Length<float>>, Area<float>>);
+static_assert(std::is_same_v<Quotient<Length<>, Time<>>, Speed<>>);
+static_assert(std::is_same_v<Quotient<ScalarForce<>, Area<>>, StaticPressure<>>);
+static_assert(std::is_same_v<Quotient<Energy<>, Time<>>, Power<>>);
+static_assert(std::is_same_v<Quotient<Length<>, Length<>>, double>);
+static_assert(
+    std::is_same_v<Product<ScalarTemperatureGradient<>, Length<>>, TemperatureDifference<>>);
+static_assert(
+    std::is_same_v<NamedQuantity<StaticDimensionsOf<Temperature<>>>, TemperatureDifference<>>);
+static_assert(std::is_same_v<Product<MassDensity<>, Speed<>>, StaticQuantity<MassFluxDimensions>>);
+static_assert(std::is_same_v<Product<StaticQuantity<MassFluxDimensions>, Area<>>, MassRate<>>);
+static_assert(sizeof(StaticQuantity<MassFluxDimensions>) == sizeof(double));
+static_assert(std::is_trivially_copyable_v<StaticQuantity<MassFluxDimensions>>);
+static_assert(std::is_convertible_v<StaticQuantity<StaticDimensionsOf<Speed<>>>, Speed<>>);
+static_assert(!std::is_convertible_v<StaticQuantity<StaticDimensionsOf<Speed<>>>, Length<>>);
+static_assert(!std::is_convertible_v<StaticQuantity<MassFluxDimensions>, double>);
+
+TEST(DimensionalAnalysis, ArithmeticOperatorAddition) {
+  const StaticQuantity<MassFluxDimensions> first{1.0};
+  const StaticQuantity<MassFluxDimensions> second{2.0};
+  EXPECT_EQ(first + second, StaticQuantity<MassFluxDimensions>(3.0));
+}
+
+TEST(DimensionalAnalysis, ArithmeticOperatorDivision) {
+  const Length length(6.0, Unit::Length::Metre);
+  const Time time(2.0, Unit::Time::Second);
+  const StaticQuantity<StaticDimensionsOf<Speed<>>> speed{length / MakeStaticQuantity(time)};
+  EXPECT_EQ(speed.Value(), 3.0);
+  EXPECT_EQ(MakeStaticQuantity(length) / time, speed);
+  EXPECT_EQ(speed / 3.0, StaticQuantity<StaticDimensionsOf<Speed<>>>(1.0));
+  const Frequency<> frequency = 6.0 / MakeStaticQuantity(time);
+  EXPECT_EQ(frequency, Frequency(3.0, Unit::Frequency::Hertz));
+}
+
+TEST(DimensionalAnalysis, ArithmeticOperatorMultiplication) {
+  const MassDensity mass_density(2.0, Unit::MassDensity::KilogramPerCubicMetre);
+  const Speed speed(3.0, Unit::Speed::MetrePerSecond);
+  const Area area(4.0, Unit::Area::SquareMetre);
+  const StaticQuantity<MassFluxDimensions> mass_flux{MakeStaticQuantity(mass_density) * speed};
+  EXPECT_EQ(mass_flux.Value(), 6.0);
+  EXPECT_EQ(mass_density * MakeStaticQuantity(speed), mass_flux);
+  EXPECT_EQ(2.0 * mass_flux, StaticQuantity<MassFluxDimensions>(12.0));
+  EXPECT_EQ(mass_flux * 2.0, StaticQuantity<MassFluxDimensions>(12.0));
+  const MassRate<> mass_rate = mass_flux * area;
+  EXPECT_EQ(mass_rate, MassRate(24.0, Unit::MassRate::KilogramPerSecond));
+}
+
+TEST(DimensionalAnalysis, ArithmeticOperatorSubtraction) {
+  const StaticQuantity<MassFluxDimensions> first{3.0};
+  const StaticQuantity<MassFluxDimensions> second{2.0};
+  EXPECT_EQ(first - second, StaticQuantity<MassFluxDimensions>(1.0));
+}
+
+TEST(DimensionalAnalysis, AssignmentOperatorAddition) {
+  StaticQuantity<MassFluxDimensions> quantity{1.0};
+  quantity += StaticQuantity<MassFluxDimensions>(2.0);
+  EXPECT_EQ(quantity.Value(), 3.0);
+}
+
+TEST(DimensionalAnalysis, AssignmentOperatorDivision) {
+  StaticQuantity<MassFluxDimensions> quantity{6.0};
+  quantity /= 2.0;
+  EXPECT_EQ(quantity.Value(), 3.0);
+}
+
+TEST(DimensionalAnalysis, AssignmentOperatorMultiplication) {
+  StaticQuantity<MassFluxDimensions> quantity{3.0};
+  quantity *= 2.0;
+  EXPECT_EQ(quantity.Value(), 6.0);
+}
+
+TEST(DimensionalAnalysis, AssignmentOperatorSubtraction) {
+  StaticQuantity<MassFluxDimensions> quantity{3.0};
+  quantity -= StaticQuantity<MassFluxDimensions>(2.0);
+  EXPECT_EQ(quantity.Value(), 1.0);
+}
+
+TEST(DimensionalAnalysis, ComparisonOperators) {
+  const StaticQuantity<MassFluxDimensions> first{1.0};
+  const StaticQuantity<MassFluxDimensions> second{2.0};
+  EXPECT_EQ(first, first);
+  EXPECT_NE(first, second);
+  EXPECT_LT(first, second);
+  EXPECT_GT(second, first);
+  EXPECT_LE(first, first);
+  EXPECT_LE(first, second);
+  EXPECT_GE(first, first);
+  EXPECT_GE(second, first);
+}
+
+TEST(DimensionalAnalysis, Conversions) {
+  const Speed speed(3.0, Unit::Speed::MetrePerSecond);
+  const StaticQuantity<StaticDimensionsOf<Speed<>>> quantity{speed};
+  EXPECT_EQ(quantity.Value(), 3.0);
+  const Speed<> converted = quantity;
+  EXPECT_EQ(converted, speed);
+  EXPECT_EQ(quantity.Named(), speed);
+  EXPECT_EQ(MakeStaticQuantity(speed), quantity);
+}
+
+TEST(DimensionalAnalysis, Dimensions) {
+  EXPECT_EQ(StaticDimensionsOf<Speed<>>::Value(), Speed<>::Dimensions());
+  EXPECT_EQ(StaticQuantity<MassFluxDimensions>::Dimensions(),
+            PhQ::Dimensions(Dimension::Time(-1), Dimension::Length(-2), Dimension::Mass(1),
+                            Dimension::ElectricCurrent(0), Dimension::Temperature(0),
+                            Dimension::SubstanceAmount(0), Dimension::LuminousIntensity(0)));
+  EXPECT_EQ((StaticDimensionsProduct<StaticDimensionsOf<Length<>>, StaticDimensionsOf<Time<>>>::
+                 Value()),
+            PhQ::Dimensions(Dimension::Time(1), Dimension::Length(1), Dimension::Mass(0),
+                            Dimension::ElectricCurrent(0), Dimension::Temperature(0),
+                            Dimension::SubstanceAmount(0), Dimension::LuminousIntensity(0)));
+  EXPECT_EQ((StaticDimensionsQuotient<StaticDimensionless, StaticDimensionsOf<Time<>>>::Value()),
+            Frequency<>::Dimensions());
+}
+
+TEST(DimensionalAnalysis, Divide) {
+  const Length length(6.0, Unit::Length::Metre);
+  const Time time(2.0, Unit::Time::Second);
+  EXPECT_EQ(Divide(length, time), Speed(3.0, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(Divide(Energy(6.0, Unit::Energy::Joule), time), Power(3.0, Unit::Power::Watt));
+  EXPECT_EQ(Divide(length, Length(3.0, Unit::Length::Metre)), 2.0);
+}
+
+TEST(DimensionalAnalysis, Hash) {
+  const StaticQuantity<MassFluxDimensions> first{1.0};
+  const StaticQuantity<MassFluxDimensions> second{1.000001};
+  const StaticQuantity<MassFluxDimensions> third{-1.0};
+  const std::hash<StaticQuantity<MassFluxDimensions>> hasher;
+  EXPECT_NE(hasher(first), hasher(second));
+  EXPECT_NE(hasher(first), hasher(third));
+  EXPECT_NE(hasher(second), hasher(third));
+}
+
+TEST(DimensionalAnalysis, Multiply) {
+  const Length length(2.0, Unit::Length::Metre);
+  const Frequency frequency(3.0, Unit::Frequency::Hertz);
+  EXPECT_EQ(Multiply(length, frequency), Speed(6.0, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(Multiply(Mass(2.0, Unit::Mass::Kilogram), Multiply(length, Multiply(frequency,
+                                                                                  frequency))),
+            ScalarForce(36.0, Unit::Force::Newton));
+  const MassDensity mass_density(2.0, Unit::MassDensity::KilogramPerCubicMetre);
+  const Speed speed(3.0, Unit::Speed::MetrePerSecond);
+  EXPECT_EQ(Multiply(Multiply(mass_density, speed), Area(4.0, Unit::Area::SquareMetre)),
+            MassRate(24.0, Unit::MassRate::KilogramPerSecond));
+}
+
+TEST(DimensionalAnalysis, MutableValue) {
+  StaticQuantity<MassFluxDimensions> quantity{1.0};
+  quantity.SetValue(2.0);
+  EXPECT_EQ(quantity.Value(), 2.0);
+}
+
+TEST(DimensionalAnalysis, Performance) {
+  StaticQuantity<MassFluxDimensions> first{1.2345678901234567890};
+  StaticQuantity<MassFluxDimensions> second{1.2345678901234567890};
+  double first_reference{1.2345678901234567890};
+  double second_reference{1.2345678901234567890};
+  Internal::TestScalarPerformance(first, second, first_reference, second_reference);
+}
+
+TEST(DimensionalAnalysis, Print) {
+  std::ostringstream stream;
+  stream << StaticQuantity<MassFluxDimensions>(1.0);
+  EXPECT_EQ(stream.str(), Print(1.0));
+}
+
+TEST(DimensionalAnalysis, Zero) {
+  EXPECT_EQ(StaticQuantity<MassFluxDimensions>::Zero().Value(), 0.0);
+}
+
+}  // namespace
+
+}  // namespace PhQ
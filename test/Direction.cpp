@@ -25,10 +25,12 @@
 #include "../include/PhQ/Direction.hpp"
 
 #include <array>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/Angle.hpp"
 #include "../include/PhQ/Dimensions.hpp"
@@ -37,6 +39,7 @@
 #include "../include/PhQ/SymmetricDyad.hpp"
 #include "../include/PhQ/Unit/Angle.hpp"
 #include "../include/PhQ/Vector.hpp"
+#include "Performance.hpp"
 
 namespace PhQ {
 
@@ -205,6 +208,47 @@ TEST(Direction, MoveConstructor) {
   EXPECT_EQ(second, Direction(1.0, -2.0, 3.0));
 }
 
+TEST(Direction, Normalize) {
+  const std::array<Vector<>, 3> vectors{
+      Vector<>{3.0, -4.0, 12.0}, Vector<>{0.0, 0.0, 0.0}, Vector<>{1.0e-150, 0.0, 0.0}};
+  std::array<Direction<>, 3> directions;
+  Direction<>::Normalize(vectors.data(), vectors.size(), directions.data());
+  EXPECT_DOUBLE_EQ(directions[0].x(), 3.0 / 13.0);
+  EXPECT_DOUBLE_EQ(directions[0].y(), -4.0 / 13.0);
+  EXPECT_DOUBLE_EQ(directions[0].z(), 12.0 / 13.0);
+  EXPECT_EQ(directions[1], Direction<>::Zero());
+  EXPECT_DOUBLE_EQ(directions[2].x(), 1.0);
+  EXPECT_EQ(directions[2].y(), 0.0);
+  EXPECT_EQ(directions[2].z(), 0.0);
+}
+
+TEST(Direction, NormalizePerformance) {
+  constexpr std::size_t size{1 << 14};
+  std::vector<Vector<>> vectors;
+  vectors.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    vectors.emplace_back(value, 1.0 - value, 0.5 * value);
+  }
+  std::vector<Direction<>> per_element_directions(size);
+  std::vector<Direction<>> batched_directions(size);
+
+  Internal::TestRelativePerformance(
+      [&]() { Direction<>::Normalize(vectors.data(), size, batched_directions.data()); },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          per_element_directions[index].Set(vectors[index]);
+        }
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_DOUBLE_EQ(batched_directions[index].x(), per_element_directions[index].x());
+    EXPECT_DOUBLE_EQ(batched_directions[index].y(), per_element_directions[index].y());
+    EXPECT_DOUBLE_EQ(batched_directions[index].z(), per_element_directions[index].z());
+  }
+}
+
 TEST(Direction, Print) {
   EXPECT_EQ(Direction<>{}.Print(), "(" + Print(0.0) + ", " + Print(0.0) + ", " + Print(0.0) + ")");
   EXPECT_EQ(Direction(0.0, -2.0, 0.0).Print(),
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 #include <optional>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Base.hpp"
@@ -51,6 +52,25 @@ TEST(Dyad, Adjugate) {
       Dyad(32512.0L, -992.0L, -96.0L, -4080.0L, 16382.0L, -496.0L, 256.0L, -2040.0L, 8128.0L));
 }
 
+TEST(Dyad, Append) {
+  const Dyad first(1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0);
+  const Dyad second(first * 0.5);
+  std::string buffer{"["};
+  first.AppendPrint(buffer);
+  buffer.push_back(',');
+  second.AppendPrint(buffer);
+  EXPECT_EQ(buffer, "[" + first.Print() + "," + second.Print());
+  buffer.clear();
+  first.AppendJSON(buffer);
+  EXPECT_EQ(buffer, first.JSON());
+  buffer.clear();
+  first.AppendXML(buffer);
+  EXPECT_EQ(buffer, first.XML());
+  buffer.clear();
+  first.AppendYAML(buffer);
+  EXPECT_EQ(buffer, first.YAML());
+}
+
 TEST(Dyad, ArithmeticOperatorAddition) {
   EXPECT_EQ(Dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F, 7.0F, -8.0F, 9.0F)
                 + Dyad(2.0F, -4.0F, 6.0F, -8.0F, 10.0F, -12.0F, 14.0F, -16.0F, 18.0F),
@@ -657,6 +677,91 @@ TEST(Dyad, Inverse) {
   }
 }
 
+TEST(Dyad, InverseArray) {
+  const std::array<Dyad<>, 3> dyads{
+      Dyad<>{64.0, 4.0, 1.0, 16.0, 128.0, 8.0, 2.0, 32.0, 256.0},
+      Dyad<>{1.0, 2.0, 3.0, 2.0, 4.0, 6.0, -1.0, 0.5, 8.0},
+      Dyad<>{2.0, -1.0, 0.0, -1.0, 2.0, -1.0, 0.0, -1.0, 2.0}
+  };
+  std::array<Dyad<>, 3> inverses;
+  bool invertible[3];
+  Dyad<>::Inverse(dyads.data(), dyads.size(), inverses.data(), invertible);
+  EXPECT_TRUE(invertible[0]);
+  EXPECT_FALSE(invertible[1]);
+  EXPECT_TRUE(invertible[2]);
+  EXPECT_EQ(inverses[0], dyads[0].Inverse().value());
+  EXPECT_EQ(inverses[1], Dyad<>::Zero());
+  EXPECT_EQ(inverses[2], dyads[2].Inverse().value());
+}
+
+TEST(Dyad, InverseWithTolerance) {
+  {
+    constexpr Dyad dyad{64.0, 4.0, 1.0, 16.0, 128.0, 8.0, 2.0, 32.0, 256.0};
+    const std::optional<Dyad<>> inverse{dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_EQ(inverse.value(), dyad.Inverse().value());
+  }
+  {
+    constexpr Dyad dyad{64.0e-30, 4.0e-30, 1.0e-30, 16.0e-30, 128.0e-30,
+                        8.0e-30,  2.0e-30, 32.0e-30, 256.0e-30};
+    const std::optional<Dyad<>> inverse{dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_DOUBLE_EQ(inverse.value().xx(), 32512.0e30 / 2064704.0);
+    EXPECT_DOUBLE_EQ(inverse.value().zz(), 8128.0e30 / 2064704.0);
+  }
+  {
+    constexpr Dyad dyad{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 + 1.0e-13};
+    EXPECT_FALSE(dyad.Inverse(1.0e-6).has_value());
+  }
+  {
+    constexpr Dyad dyad{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    EXPECT_FALSE(dyad.Inverse(0.0).has_value());
+  }
+  {
+    // The squared determinant and the product of the squared magnitudes of the rows overflow.
+    constexpr Dyad dyad{1.0e8F, 0.0F, 0.0F, 0.0F, 1.0e8F, 0.0F, 0.0F, 0.0F, 1.0e8F};
+    const std::optional<Dyad<float>> inverse{dyad.Inverse(1.0e-3F)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_FLOAT_EQ(inverse.value().xx(), 1.0e-8F);
+    EXPECT_FLOAT_EQ(inverse.value().zz(), 1.0e-8F);
+  }
+  {
+    // The squared determinant and the product of the squared magnitudes of the rows underflow.
+    constexpr Dyad dyad{1.0e-7F, 0.0F, 0.0F, 0.0F, 1.0e-7F, 0.0F, 0.0F, 0.0F, 1.0e-7F};
+    const std::optional<Dyad<float>> inverse{dyad.Inverse(1.0e-3F)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_FLOAT_EQ(inverse.value().xx(), 1.0e7F);
+    EXPECT_FLOAT_EQ(inverse.value().zz(), 1.0e7F);
+  }
+  {
+    constexpr Dyad dyad{1.0e60, 0.0, 0.0, 0.0, 1.0e60, 0.0, 0.0, 0.0, 1.0e60};
+    const std::optional<Dyad<>> inverse{dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_DOUBLE_EQ(inverse.value().xx(), 1.0e-60);
+    EXPECT_DOUBLE_EQ(inverse.value().zz(), 1.0e-60);
+    const std::optional<Vector<>> solution{
+        dyad.Solve(Vector<>{1.0e60, 2.0e60, 3.0e60}, 1.0e-6)};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_DOUBLE_EQ(solution.value().z(), 3.0);
+  }
+  {
+    constexpr Dyad dyad{1.0e-60, 0.0, 0.0, 0.0, 1.0e-60, 0.0, 0.0, 0.0, 1.0e-60};
+    const std::optional<Dyad<>> inverse{dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_DOUBLE_EQ(inverse.value().xx(), 1.0e60);
+    EXPECT_DOUBLE_EQ(inverse.value().zz(), 1.0e60);
+    const std::optional<Vector<>> solution{
+        dyad.Solve(Vector<>{1.0e-60, 2.0e-60, 3.0e-60}, 1.0e-6)};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_DOUBLE_EQ(solution.value().z(), 3.0);
+  }
+  {
+    constexpr Dyad dyad{1.0e60, 2.0e60, 3.0e60, 4.0e60, 5.0e60,
+                        6.0e60, 7.0e60, 8.0e60, 9.0e60};
+    EXPECT_FALSE(dyad.Inverse(1.0e-6).has_value());
+  }
+}
+
 TEST(Dyad, IsSymmetric) {
   EXPECT_FALSE(Dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F, 7.0F, -8.0F, 9.0F).IsSymmetric());
   EXPECT_FALSE(Dyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0).IsSymmetric());
@@ -939,6 +1044,65 @@ TEST(Dyad, SizeOf) {
   EXPECT_EQ(sizeof(Dyad<long double>{}), 9 * sizeof(long double));
 }
 
+TEST(Dyad, Solve) {
+  {
+    constexpr Dyad dyad{64.0F, 4.0F, 1.0F, 16.0F, 128.0F, 8.0F, 2.0F, 32.0F, 256.0F};
+    const std::optional<Vector<float>> solution{dyad.Solve(dyad * Vector{1.0F, -2.0F, 3.0F})};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_NEAR(solution.value().x(), 1.0F, 1.0E-5F);
+    EXPECT_NEAR(solution.value().y(), -2.0F, 1.0E-5F);
+    EXPECT_NEAR(solution.value().z(), 3.0F, 1.0E-5F);
+  }
+  {
+    constexpr Dyad dyad{64.0, 4.0, 1.0, 16.0, 128.0, 8.0, 2.0, 32.0, 256.0};
+    const std::optional<Vector<>> solution{dyad.Solve(dyad * Vector{1.0, -2.0, 3.0})};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_DOUBLE_EQ(solution.value().x(), 1.0);
+    EXPECT_DOUBLE_EQ(solution.value().y(), -2.0);
+    EXPECT_DOUBLE_EQ(solution.value().z(), 3.0);
+  }
+  {
+    constexpr Dyad dyad{64.0L, 4.0L, 1.0L, 16.0L, 128.0L, 8.0L, 2.0L, 32.0L, 256.0L};
+    const std::optional<Vector<long double>> solution{
+        dyad.Solve(dyad * Vector{1.0L, -2.0L, 3.0L})};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_DOUBLE_EQ(solution.value().x(), 1.0L);
+    EXPECT_DOUBLE_EQ(solution.value().y(), -2.0L);
+    EXPECT_DOUBLE_EQ(solution.value().z(), 3.0L);
+  }
+  {
+    constexpr Dyad dyad{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 + 1.0e-13};
+    EXPECT_FALSE(dyad.Solve(Vector{1.0, 2.0, 3.0}).has_value());
+  }
+  {
+    constexpr Dyad dyad{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    EXPECT_FALSE(dyad.Solve(Vector{1.0, 2.0, 3.0}).has_value());
+  }
+}
+
+TEST(Dyad, SolveArray) {
+  const std::array<Dyad<>, 3> dyads{
+      Dyad<>{64.0, 4.0, 1.0, 16.0, 128.0, 8.0, 2.0, 32.0, 256.0},
+      Dyad<>{1.0, 2.0, 3.0, 2.0, 4.0, 6.0, -1.0, 0.5, 8.0},
+      Dyad<>{2.0, -1.0, 0.0, -1.0, 2.0, -1.0, 0.0, -1.0, 2.0}
+  };
+  const std::array<Vector<>, 3> vectors{
+      Vector<>{1.0, -2.0, 3.0}, Vector<>{4.0, 5.0, -6.0}, Vector<>{-7.0, 8.0, 9.0}};
+  std::array<Vector<>, 3> solutions;
+  bool solved[3];
+  Dyad<>::Solve(dyads.data(), vectors.data(), dyads.size(), solutions.data(), solved);
+  EXPECT_TRUE(solved[0]);
+  EXPECT_FALSE(solved[1]);
+  EXPECT_TRUE(solved[2]);
+  EXPECT_DOUBLE_EQ(solutions[0].x(), dyads[0].Solve(vectors[0]).value().x());
+  EXPECT_DOUBLE_EQ(solutions[0].y(), dyads[0].Solve(vectors[0]).value().y());
+  EXPECT_DOUBLE_EQ(solutions[0].z(), dyads[0].Solve(vectors[0]).value().z());
+  EXPECT_EQ(solutions[1], Vector<>::Zero());
+  EXPECT_DOUBLE_EQ(solutions[2].x(), dyads[2].Solve(vectors[2]).value().x());
+  EXPECT_DOUBLE_EQ(solutions[2].y(), dyads[2].Solve(vectors[2]).value().y());
+  EXPECT_DOUBLE_EQ(solutions[2].z(), dyads[2].Solve(vectors[2]).value().z());
+}
+
 TEST(Dyad, Stream) {
   {
     std::ostringstream stream;
@@ -0,0 +1,195 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Expression.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../include/PhQ/Direction.hpp"
+#include "../include/PhQ/Dyad.hpp"
+#include "../include/PhQ/Field.hpp"
+#include "../include/PhQ/PlanarDirection.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/SymmetricDyad.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Vector.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "Performance.hpp"
+
+namespace PhQ {
+
+namespace {
+
+std::vector<Velocity<>> Velocities(const double scale) {
+  std::vector<Velocity<>> velocities;
+  for (std::size_t index = 0; index < 37; ++index) {
+    const double value{scale * static_cast<double>(index)};
+    velocities.emplace_back(
+        Vector<>{value, -2.0 * value, 0.5 + value}, Unit::Speed::MetrePerSecond);
+  }
+  return velocities;
+}
+
+// Whether objects of a given type can be wrapped in a lazy expression.
+template <typename Type, typename = void>
+inline constexpr bool CanBeLazy{false};
+
+template <typename Type>
+inline constexpr bool CanBeLazy<Type, std::void_t<decltype(Lazy(std::declval<const Type&>()))>>{
+    true};
+
+TEST(Expression, Direction) {
+  static_assert(CanBeLazy<Vector<>>);
+  static_assert(CanBeLazy<Velocity<>>);
+  static_assert(CanBeLazy<Field<Velocity<>>>);
+  static_assert(!CanBeLazy<Direction<>>);
+  static_assert(!CanBeLazy<Direction<float>>);
+  static_assert(!CanBeLazy<Field<Direction<>>>);
+  static_assert(!CanBeLazy<PlanarDirection<>>);
+}
+
+TEST(Expression, Dyad) {
+  const Dyad<> first{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+  const Dyad<> second{-1.0, 0.5, 2.0, -4.0, 3.0, 1.0, 0.0, -2.0, 8.0};
+  EXPECT_EQ(Evaluate(Lazy(first) + Lazy(second) * 2.0), first + second * 2.0);
+  EXPECT_EQ(Evaluate(-Lazy(first) - Lazy(second) / 4.0), first * -1.0 - second / 4.0);
+}
+
+TEST(Expression, Field) {
+  const std::vector<Velocity<>> first{Velocities(1.0)};
+  const std::vector<Velocity<>> second{Velocities(-0.5)};
+  const std::vector<Velocity<>> third{Velocities(2.0)};
+  const Field<Velocity<>> first_field{first};
+  const Field<Velocity<>> second_field{second};
+  const Field<Velocity<>> third_field{third};
+  const Velocity<> offset{Vector<>{1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond};
+
+  const Field<Velocity<>> result{Evaluate(
+      Lazy(first_field) + Lazy(second_field) - 0.5 * Lazy(third_field) + Lazy(offset))};
+  ASSERT_EQ(result.Size(), first.size());
+  for (std::size_t index = 0; index < first.size(); ++index) {
+    const Vector<> expected{(first[index] + second[index] - 0.5 * third[index] + offset).Value()};
+    EXPECT_DOUBLE_EQ(result[index].Value().x(), expected.x());
+    EXPECT_DOUBLE_EQ(result[index].Value().y(), expected.y());
+    EXPECT_DOUBLE_EQ(result[index].Value().z(), expected.z());
+  }
+
+  Field<Velocity<>> accumulated{first};
+  Evaluate(Lazy(accumulated) * 2.0 - Lazy(second_field), accumulated);
+  ASSERT_EQ(accumulated.Size(), first.size());
+  for (std::size_t index = 0; index < first.size(); ++index) {
+    const Vector<> expected{(first[index] * 2.0 - second[index]).Value()};
+    EXPECT_DOUBLE_EQ(accumulated.Get(index).Value().x(), expected.x());
+    EXPECT_DOUBLE_EQ(accumulated.Get(index).Value().y(), expected.y());
+    EXPECT_DOUBLE_EQ(accumulated.Get(index).Value().z(), expected.z());
+  }
+}
+
+TEST(Expression, Performance) {
+  constexpr std::size_t size{1 << 14};
+  std::vector<Velocity<>> first;
+  std::vector<Velocity<>> second;
+  std::vector<Velocity<>> third;
+  first.reserve(size);
+  second.reserve(size);
+  third.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    first.emplace_back(Vector<>{value, -value, 2.0 * value}, Unit::Speed::MetrePerSecond);
+    second.emplace_back(Vector<>{0.5 * value, value, -value}, Unit::Speed::MetrePerSecond);
+    third.emplace_back(Vector<>{-value, 4.0 * value, value}, Unit::Speed::MetrePerSecond);
+  }
+  const Field<Velocity<>> first_field{first};
+  const Field<Velocity<>> second_field{second};
+  const Field<Velocity<>> third_field{third};
+  std::vector<Velocity<>> eager_result(size);
+  Field<Velocity<>> field_result;
+  Field<Velocity<>> lazy_result;
+
+  const auto lazy = [&]() {
+    Evaluate(Lazy(first_field) + Lazy(second_field) - Lazy(third_field) * 0.5, lazy_result);
+  };
+  Internal::TestRelativePerformance(
+      lazy,
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          eager_result[index] = first[index] + second[index] - third[index] * 0.5;
+        }
+      },
+      1000);
+  Internal::TestRelativePerformance(
+      lazy,
+      [&]() {
+        field_result = third_field;
+        field_result *= -0.5;
+        field_result += first_field;
+        field_result += second_field;
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(lazy_result.Get(index), eager_result[index]);
+    EXPECT_DOUBLE_EQ(field_result.Get(index).Value().x(), eager_result[index].Value().x());
+    EXPECT_DOUBLE_EQ(field_result.Get(index).Value().y(), eager_result[index].Value().y());
+    EXPECT_DOUBLE_EQ(field_result.Get(index).Value().z(), eager_result[index].Value().z());
+  }
+}
+
+TEST(Expression, Quantity) {
+  const Velocity<> first{Vector<>{1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond};
+  const Velocity<> second{Vector<>{4.0, 0.5, -6.0}, Unit::Speed::KilometrePerSecond};
+  const Velocity<> velocity{Evaluate(Lazy(first) - Lazy(second) / 2.0)};
+  EXPECT_EQ(velocity, first - second / 2.0);
+
+  const Stress<> first_stress{
+      SymmetricDyad<>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal};
+  const Stress<> second_stress{
+      SymmetricDyad<>{-1.0, 0.5, 0.25, 2.0, -3.0, 7.0}, Unit::Pressure::Kilopascal};
+  const Stress<> stress{Evaluate(2.0 * Lazy(first_stress) + Lazy(second_stress))};
+  EXPECT_EQ(stress, 2.0 * first_stress + second_stress);
+}
+
+TEST(Expression, SymmetricDyad) {
+  const SymmetricDyad<> first{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  const SymmetricDyad<> second{-1.0, 0.5, 0.25, 2.0, -3.0, 7.0};
+  EXPECT_EQ(Evaluate(Lazy(first) - Lazy(second) * 4.0), first - second * 4.0);
+  EXPECT_EQ(Evaluate((Lazy(first) + Lazy(second)) / 2.0), (first + second) / 2.0);
+}
+
+TEST(Expression, Vector) {
+  const Vector<> first{1.0, -2.0, 3.0};
+  const Vector<> second{4.0, 0.5, -6.0};
+  const Vector<> third{-1.0, 8.0, 0.25};
+  EXPECT_EQ(Evaluate(Lazy(first) + Lazy(second) - Lazy(third)), first + second - third);
+  EXPECT_EQ(Evaluate(-(Lazy(first) * 3.0) + Lazy(third)), first * -3.0 + third);
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -0,0 +1,333 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Field.hpp"
+
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../include/PhQ/DimensionalAnalysis.hpp"
+#include "../include/PhQ/Direction.hpp"
+#include "../include/PhQ/Length.hpp"
+#include "../include/PhQ/PlanarVelocity.hpp"
+#include "../include/PhQ/ScalarStrain.hpp"
+#include "../include/PhQ/ScalarStress.hpp"
+#include "../include/PhQ/ScalarVelocityGradient.hpp"
+#include "../include/PhQ/SpecificEnergy.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/Strain.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/SymmetricDyad.hpp"
+#include "../include/PhQ/Unit/Frequency.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+#include "Performance.hpp"
+
+namespace PhQ {
+
+namespace {
+
+std::vector<Velocity<>> Velocities() {
+  std::vector<Velocity<>> velocities;
+  for (std::size_t index = 0; index < 37; ++index) {
+    const double value{static_cast<double>(index)};
+    velocities.emplace_back(
+        Vector<>{value, -2.0 * value, 0.5 + value}, Unit::Speed::MillimetrePerSecond);
+  }
+  return velocities;
+}
+
+TEST(Field, Arithmetic) {
+  const std::vector<Velocity<>> velocities{Velocities()};
+  Field<Velocity<>> field{velocities};
+  field += Field<Velocity<>>{velocities};
+  field *= 1.5;
+  field -= Field<Velocity<>>{velocities};
+  field /= 4.0;
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    const Vector<> expected{((velocities[index] * 2.0 * 1.5 - velocities[index]) / 4.0).Value()};
+    EXPECT_DOUBLE_EQ(field.Get(index).Value().x(), expected.x());
+    EXPECT_DOUBLE_EQ(field.Get(index).Value().y(), expected.y());
+    EXPECT_DOUBLE_EQ(field.Get(index).Value().z(), expected.z());
+  }
+}
+
+TEST(Field, Division) {
+  std::vector<Velocity<>> velocities;
+  for (std::size_t index = 0; index < 1000; ++index) {
+    const double value{0.1 * static_cast<double>(index)};
+    velocities.emplace_back(Vector<>{value, -value, 0.7 + value}, Unit::Speed::MetrePerSecond);
+  }
+  Field<Velocity<>> field{velocities};
+  field /= 3.0;
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    const Vector<> expected{(velocities[index] / 3.0).Value()};
+    EXPECT_DOUBLE_EQ(field.Get(index).Value().x(), expected.x());
+    EXPECT_DOUBLE_EQ(field.Get(index).Value().y(), expected.y());
+    EXPECT_DOUBLE_EQ(field.Get(index).Value().z(), expected.z());
+  }
+}
+
+TEST(Field, Components) {
+  Field<Velocity<>> field{Velocities()};
+  EXPECT_EQ(field.Components()[0].size(), field.Size());
+  EXPECT_DOUBLE_EQ(field.Components()[2][1], 0.0015);
+  ConvertInPlace(
+      field.MutableComponents(), Unit::Speed::MetrePerSecond, Unit::Speed::MillimetrePerSecond);
+  EXPECT_DOUBLE_EQ(field.Components()[0][3], 3.0);
+  EXPECT_DOUBLE_EQ(field.Components()[1][3], -6.0);
+  EXPECT_DOUBLE_EQ(field.Components()[2][3], 3.5);
+}
+
+TEST(Field, Constructors) {
+  const Field<Velocity<>> empty;
+  EXPECT_EQ(empty.Size(), 0);
+
+  const Field<Velocity<>> zeros(5);
+  EXPECT_EQ(zeros.Size(), 5);
+  EXPECT_EQ(zeros[4], Velocity<>::Zero());
+
+  const Stress<> stress({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal);
+  const Field<Stress<>> filled(3, stress);
+  EXPECT_EQ(filled.Size(), 3);
+  EXPECT_EQ(filled[2], stress);
+
+  const std::vector<Velocity<>> velocities{Velocities()};
+  const Field<Velocity<>> field{velocities};
+  EXPECT_EQ(field.Size(), velocities.size());
+  EXPECT_EQ(field.Quantities(), velocities);
+}
+
+TEST(Field, Determinant) {
+  const std::vector<Stress<>> stresses{
+      Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal),
+      Stress<>({-1.0, 0.5, 0.25, 2.0, -3.0, 7.0}, Unit::Pressure::Kilopascal)};
+  const Field<StaticQuantity<StaticDimensions<-6, -3, 3, 0, 0, 0, 0>>> stress_determinants{
+      Field<Stress<>>{stresses}.Determinant()};
+  ASSERT_EQ(stress_determinants.Size(), stresses.size());
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_DOUBLE_EQ(
+        stress_determinants[index].Value(), stresses[index].Value().Determinant());
+  }
+
+  const std::vector<VelocityGradient<>> gradients{
+      VelocityGradient<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 10.0}, Unit::Frequency::Hertz),
+      VelocityGradient<>({-1.0, 0.5, 0.25, 2.0, -3.0, 7.0, 1.0, 1.0, 1.0}, Unit::Frequency::Hertz)};
+  const Field<StaticQuantity<StaticDimensions<-3, 0, 0, 0, 0, 0, 0>>> gradient_determinants{
+      Field<VelocityGradient<>>{gradients}.Determinant()};
+  ASSERT_EQ(gradient_determinants.Size(), gradients.size());
+  for (std::size_t index = 0; index < gradients.size(); ++index) {
+    EXPECT_DOUBLE_EQ(
+        gradient_determinants[index].Value(), gradients[index].Value().Determinant());
+  }
+}
+
+TEST(Field, Dot) {
+  const std::vector<Velocity<>> velocities{Velocities()};
+  const Field<Velocity<>> field{velocities};
+  const Field<SpecificEnergy<>> dots{field.Dot(field)};
+  ASSERT_EQ(dots.Size(), velocities.size());
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    EXPECT_DOUBLE_EQ(
+        dots[index].Value(), velocities[index].Value().Dot(velocities[index].Value()));
+  }
+
+  const std::vector<Direction<>> directions{
+      Direction<>(1.0, 0.0, 0.0), Direction<>(0.0, 1.0, 0.0), Direction<>(0.0, 0.0, 1.0)};
+  const Field<StaticQuantity<StaticDimensionless>> cosines{
+      Field<Direction<>>{directions}.Dot(Field<Direction<>>{directions})};
+  for (std::size_t index = 0; index < directions.size(); ++index) {
+    EXPECT_DOUBLE_EQ(cosines[index].Value(), 1.0);
+  }
+}
+
+TEST(Field, Eigenvalues) {
+  const std::vector<Stress<>> stresses{
+      Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal),
+      Stress<>({-1.0, 0.5, 0.25, 2.0, -3.0, 7.0}, Unit::Pressure::Kilopascal),
+      Stress<>({2.0, 0.0, 0.0, 2.0, 0.0, 2.0}, Unit::Pressure::Megapascal)};
+  const std::array<Field<ScalarStress<>>, 3> eigenvalues{Field<Stress<>>{stresses}.Eigenvalues()};
+  for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+    ASSERT_EQ(eigenvalues[eigen_index].Size(), stresses.size());
+  }
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    const std::array<ScalarStress<>, 3> principal_stresses{stresses[index].PrincipalStresses()};
+    for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+      EXPECT_DOUBLE_EQ(
+          eigenvalues[eigen_index][index].Value(), principal_stresses[eigen_index].Value());
+    }
+  }
+}
+
+TEST(Field, PrincipalDirections) {
+  const std::vector<Stress<>> stresses{
+      Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal),
+      Stress<>({-1.0, 0.5, 0.25, 2.0, -3.0, 7.0}, Unit::Pressure::Kilopascal),
+      Stress<>({3.0, 0.0, 0.0, 1.0, 0.0, 2.0}, Unit::Pressure::Megapascal)};
+  const std::array<Field<Direction<>>, 3> directions{
+      Field<Stress<>>{stresses}.PrincipalDirections()};
+  for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+    ASSERT_EQ(directions[eigen_index].Size(), stresses.size());
+  }
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    const std::array<Direction<>, 3> principal_directions{stresses[index].PrincipalDirections()};
+    for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+      const Direction<> direction{directions[eigen_index][index]};
+      EXPECT_DOUBLE_EQ(direction.x(), principal_directions[eigen_index].x());
+      EXPECT_DOUBLE_EQ(direction.y(), principal_directions[eigen_index].y());
+      EXPECT_DOUBLE_EQ(direction.z(), principal_directions[eigen_index].z());
+    }
+  }
+}
+
+TEST(Field, ElementAccess) {
+  Field<Velocity<>> field(3);
+  const Velocity<> velocity({1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond);
+  field[1] = velocity;
+  EXPECT_EQ(field[1], velocity);
+  EXPECT_EQ(field.Get(1), velocity);
+  field[2] = field[1];
+  EXPECT_EQ(field[2], velocity);
+  const Velocity<> read = field[2];
+  EXPECT_EQ(read, velocity);
+  field.Set(0, velocity * 2.0);
+  EXPECT_EQ(field[0], velocity * 2.0);
+  field.PushBack(velocity * -1.0);
+  EXPECT_EQ(field.Size(), 4);
+  EXPECT_EQ(field[3], velocity * -1.0);
+  field.Resize(2);
+  EXPECT_EQ(field.Size(), 2);
+
+  Field<Length<float>> lengths;
+  lengths.PushBack(Length<float>(2.0F, Unit::Length::Metre));
+  EXPECT_EQ(lengths[0], Length<float>(2.0F, Unit::Length::Metre));
+
+  Field<Strain<>> strains(1);
+  strains[0] = Strain<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0);
+  EXPECT_EQ(strains[0], Strain<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0));
+}
+
+TEST(Field, Invariants) {
+  const std::vector<Stress<>> stresses{
+      Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal),
+      Stress<>({-1.0, 0.5, 0.25, 2.0, -3.0, 7.0}, Unit::Pressure::Kilopascal),
+      Stress<>({2.0, 0.0, 0.0, 2.0, 0.0, 2.0}, Unit::Pressure::Megapascal)};
+  const Field<Stress<>> field{stresses};
+  const Field<Stress<>> deviatoric{field.Deviatoric()};
+  const Field<ScalarStress<>> hydrostatic{field.Hydrostatic()};
+  const Field<StaticQuantity<StaticDimensions<-4, -2, 2, 0, 0, 0, 0>>> j2{field.J2()};
+  const Field<StaticQuantity<StaticDimensions<-6, -3, 3, 0, 0, 0, 0>>> j3{field.J3()};
+  const Field<ScalarStress<>> von_mises{field.VonMises()};
+  const Field<ScalarStress<>> tresca{field.Tresca()};
+  ASSERT_EQ(deviatoric.Size(), stresses.size());
+  ASSERT_EQ(hydrostatic.Size(), stresses.size());
+  ASSERT_EQ(j2.Size(), stresses.size());
+  ASSERT_EQ(j3.Size(), stresses.size());
+  ASSERT_EQ(von_mises.Size(), stresses.size());
+  ASSERT_EQ(tresca.Size(), stresses.size());
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_EQ(deviatoric[index], stresses[index].Deviatoric());
+    EXPECT_EQ(hydrostatic[index], stresses[index].Hydrostatic());
+    EXPECT_EQ(j2[index], stresses[index].J2());
+    EXPECT_EQ(j3[index], stresses[index].J3());
+    EXPECT_EQ(von_mises[index], stresses[index].VonMises());
+    EXPECT_EQ(tresca[index], stresses[index].Tresca());
+  }
+
+  const std::vector<Strain<>> strains{
+      Strain<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0), Strain<>(-1.0, 0.5, 0.25, 2.0, -3.0, 7.0)};
+  const Field<ScalarStrain<>> strain_von_mises{Field<Strain<>>{strains}.VonMises()};
+  ASSERT_EQ(strain_von_mises.Size(), strains.size());
+  const Field<StaticQuantity<StaticDimensionless>> strain_j2{Field<Strain<>>{strains}.J2()};
+  ASSERT_EQ(strain_j2.Size(), strains.size());
+  for (std::size_t index = 0; index < strains.size(); ++index) {
+    EXPECT_EQ(strain_von_mises[index], strains[index].VonMises());
+    EXPECT_EQ(strain_j2[index].Value(), strains[index].J2());
+  }
+}
+
+TEST(Field, InvariantsPerformance) {
+  constexpr std::size_t size{1 << 14};
+  std::vector<Stress<>> stresses;
+  stresses.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    stresses.emplace_back(
+        SymmetricDyad<>{value, -0.5 * value, 0.25 * value, 2.0 * value, -value, 4.0 * value},
+        Unit::Pressure::Pascal);
+  }
+  const Field<Stress<>> field{stresses};
+  std::vector<ScalarStress<>> per_element_von_mises(size);
+  Field<ScalarStress<>> field_von_mises;
+
+  Internal::TestRelativePerformance(
+      [&]() { field_von_mises = field.VonMises(); },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          per_element_von_mises[index] = stresses[index].VonMises();
+        }
+      },
+      1000);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(field_von_mises[index], per_element_von_mises[index]);
+  }
+}
+
+TEST(Field, Magnitude) {
+  const std::vector<Velocity<>> velocities{Velocities()};
+  const Field<Speed<>> speeds{Field<Velocity<>>{velocities}.Magnitude()};
+  ASSERT_EQ(speeds.Size(), velocities.size());
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    EXPECT_DOUBLE_EQ(speeds[index].Value(), velocities[index].Magnitude().Value());
+  }
+
+  const Field<PlanarVelocity<>> planar(
+      2, PlanarVelocity<>({3.0, 4.0}, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(planar.Magnitude()[1], Speed<>(5.0, Unit::Speed::MetrePerSecond));
+}
+
+TEST(Field, Trace) {
+  const std::vector<Stress<>> stresses{
+      Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal),
+      Stress<>({-1.0, 0.5, 0.25, 2.0, -3.0, 7.0}, Unit::Pressure::Kilopascal)};
+  const Field<ScalarStress<>> traces{Field<Stress<>>{stresses}.Trace()};
+  ASSERT_EQ(traces.Size(), stresses.size());
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_DOUBLE_EQ(traces[index].Value(), stresses[index].Value().Trace());
+  }
+
+  const Field<VelocityGradient<>> gradients(
+      1, VelocityGradient<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0}, Unit::Frequency::Hertz));
+  EXPECT_EQ(gradients.Trace()[0], ScalarVelocityGradient<>(15.0, Unit::Frequency::Hertz));
+}
+
+}  // namespace
+
+}  // namespace PhQ
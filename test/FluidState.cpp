@@ -0,0 +1,315 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/FluidState.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "../include/PhQ/DynamicPressure.hpp"
+#include "../include/PhQ/DynamicViscosity.hpp"
+#include "../include/PhQ/HeatCapacityRatio.hpp"
+#include "../include/PhQ/KinematicViscosity.hpp"
+#include "../include/PhQ/Length.hpp"
+#include "../include/PhQ/MachNumber.hpp"
+#include "../include/PhQ/MassDensity.hpp"
+#include "../include/PhQ/PrandtlNumber.hpp"
+#include "../include/PhQ/ReynoldsNumber.hpp"
+#include "../include/PhQ/ScalarThermalConductivity.hpp"
+#include "../include/PhQ/SoundSpeed.hpp"
+#include "../include/PhQ/SpecificGasConstant.hpp"
+#include "../include/PhQ/SpecificIsobaricHeatCapacity.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/StaticPressure.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/ThermalDiffusivity.hpp"
+#include "../include/PhQ/TotalPressure.hpp"
+#include "../include/PhQ/Unit/DynamicViscosity.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/MassDensity.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/SpecificHeatCapacity.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Unit/Temperature.hpp"
+#include "../include/PhQ/Unit/ThermalConductivity.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "Performance.hpp"
+
+namespace PhQ {
+
+namespace {
+
+FluidState<> Air(const double speed_factor = 1.0) {
+  return FluidState<>{
+    MassDensity(1.2, Unit::MassDensity::KilogramPerCubicMetre),
+    Velocity({30.0 * speed_factor, -40.0 * speed_factor, 0.0}, Unit::Speed::MetrePerSecond),
+    StaticPressure(101325.0, Unit::Pressure::Pascal),
+    Temperature(293.15, Unit::Temperature::Kelvin),
+    DynamicViscosity(1.8e-5, Unit::DynamicViscosity::PascalSecond),
+    SpecificIsobaricHeatCapacity(1005.0, Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin),
+    ScalarThermalConductivity(0.025, Unit::ThermalConductivity::WattPerMetrePerKelvin)};
+}
+
+FluidState<>::Fields Fields(const std::vector<FluidState<>>& states) {
+  FluidState<>::Fields fields;
+  for (const FluidState<>& state : states) {
+    fields.mass_densities.PushBack(state.MassDensity());
+    fields.velocities.PushBack(state.Velocity());
+    fields.static_pressures.PushBack(state.StaticPressure());
+    fields.temperatures.PushBack(state.Temperature());
+    fields.dynamic_viscosities.PushBack(state.DynamicViscosity());
+    fields.specific_isobaric_heat_capacities.PushBack(state.SpecificIsobaricHeatCapacity());
+    fields.scalar_thermal_conductivities.PushBack(state.ScalarThermalConductivity());
+  }
+  return fields;
+}
+
+TEST(FluidState, Accessors) {
+  const FluidState<> state{Air()};
+  EXPECT_EQ(state.MassDensity(), MassDensity(1.2, Unit::MassDensity::KilogramPerCubicMetre));
+  EXPECT_EQ(state.Velocity(), Velocity({30.0, -40.0, 0.0}, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(state.StaticPressure(), StaticPressure(101325.0, Unit::Pressure::Pascal));
+  EXPECT_EQ(state.Temperature(), Temperature(293.15, Unit::Temperature::Kelvin));
+  EXPECT_EQ(
+      state.DynamicViscosity(), DynamicViscosity(1.8e-5, Unit::DynamicViscosity::PascalSecond));
+  EXPECT_EQ(
+      state.SpecificIsobaricHeatCapacity(),
+      SpecificIsobaricHeatCapacity(1005.0, Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin));
+  EXPECT_EQ(state.ScalarThermalConductivity(),
+            ScalarThermalConductivity(0.025, Unit::ThermalConductivity::WattPerMetrePerKelvin));
+}
+
+TEST(FluidState, Batched) {
+  std::vector<FluidState<>> states;
+  for (std::size_t index = 0; index < 8; ++index) {
+    states.push_back(Air(static_cast<double>(index)));
+  }
+  const std::size_t size{states.size()};
+  const Length<> length{2.0, Unit::Length::Metre};
+
+  std::vector<HeatCapacityRatio<>> heat_capacity_ratios(size);
+  std::vector<SoundSpeed<>> sound_speeds(size);
+  std::vector<MachNumber<>> mach_numbers(size);
+  std::vector<DynamicPressure<>> dynamic_pressures(size);
+  std::vector<TotalPressure<>> total_pressures(size);
+  std::vector<PrandtlNumber<>> prandtl_numbers(size);
+  std::vector<ReynoldsNumber<>> reynolds_numbers(size);
+  FluidState<>::HeatCapacityRatios(states.data(), size, heat_capacity_ratios.data());
+  FluidState<>::SoundSpeeds(states.data(), size, sound_speeds.data());
+  FluidState<>::MachNumbers(states.data(), size, mach_numbers.data());
+  FluidState<>::DynamicPressures(states.data(), size, dynamic_pressures.data());
+  FluidState<>::TotalPressures(states.data(), size, total_pressures.data());
+  FluidState<>::PrandtlNumbers(states.data(), size, prandtl_numbers.data());
+  FluidState<>::ReynoldsNumbers(states.data(), size, reynolds_numbers.data(), length);
+
+  for (std::size_t index = 0; index < size; ++index) {
+    const FluidState<> state{Air(static_cast<double>(index))};
+    EXPECT_DOUBLE_EQ(heat_capacity_ratios[index].Value(), state.HeatCapacityRatio().Value());
+    EXPECT_DOUBLE_EQ(sound_speeds[index].Value(), state.SoundSpeed().Value());
+    EXPECT_DOUBLE_EQ(mach_numbers[index].Value(), state.MachNumber().Value());
+    EXPECT_DOUBLE_EQ(dynamic_pressures[index].Value(), state.DynamicPressure().Value());
+    EXPECT_DOUBLE_EQ(total_pressures[index].Value(), state.TotalPressure().Value());
+    EXPECT_DOUBLE_EQ(prandtl_numbers[index].Value(), state.PrandtlNumber().Value());
+    EXPECT_DOUBLE_EQ(reynolds_numbers[index].Value(), state.ReynoldsNumber(length).Value());
+  }
+  EXPECT_EQ(mach_numbers[0], MachNumber(0.0));
+}
+
+TEST(FluidState, BatchedFields) {
+  std::vector<FluidState<>> states;
+  for (std::size_t index = 0; index < 37; ++index) {
+    states.push_back(Air(static_cast<double>(index) / 8.0));
+  }
+  const FluidState<>::Fields fields{Fields(states)};
+  const Length<> length{2.0, Unit::Length::Metre};
+  FluidState<>::DerivedFields derived;
+  FluidState<>::DerivedQuantities(fields, derived, length);
+
+  ASSERT_EQ(derived.heat_capacity_ratios.Size(), states.size());
+  ASSERT_EQ(derived.reynolds_numbers.Size(), states.size());
+  for (std::size_t index = 0; index < states.size(); ++index) {
+    const FluidState<>& state{states[index]};
+    EXPECT_DOUBLE_EQ(
+        derived.heat_capacity_ratios.Get(index).Value(), state.HeatCapacityRatio().Value());
+    EXPECT_DOUBLE_EQ(derived.sound_speeds.Get(index).Value(), state.SoundSpeed().Value());
+    EXPECT_DOUBLE_EQ(derived.mach_numbers.Get(index).Value(), state.MachNumber().Value());
+    EXPECT_DOUBLE_EQ(derived.dynamic_pressures.Get(index).Value(), state.DynamicPressure().Value());
+    EXPECT_DOUBLE_EQ(derived.total_pressures.Get(index).Value(), state.TotalPressure().Value());
+    EXPECT_DOUBLE_EQ(derived.prandtl_numbers.Get(index).Value(), state.PrandtlNumber().Value());
+    EXPECT_DOUBLE_EQ(
+        derived.reynolds_numbers.Get(index).Value(), state.ReynoldsNumber(length).Value());
+  }
+  EXPECT_EQ(derived.mach_numbers[0], MachNumber(0.0));
+}
+
+TEST(FluidState, BatchedFieldsPerformance) {
+  constexpr std::size_t size{1 << 14};
+  std::vector<FluidState<>> states;
+  states.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    states.push_back(Air(static_cast<double>(index % 64) / 64.0));
+  }
+  const FluidState<>::Fields fields{Fields(states)};
+  const Length<> length{2.0, Unit::Length::Metre};
+  FluidState<>::DerivedFields derived;
+  std::vector<SoundSpeed<>> sound_speeds(size);
+  std::vector<MachNumber<>> mach_numbers(size);
+  std::vector<TotalPressure<>> total_pressures(size);
+  std::vector<ReynoldsNumber<>> reynolds_numbers(size);
+
+  const Internal::RelativePerformance performance{Internal::TestRelativePerformance(
+      [&]() { FluidState<>::DerivedQuantities(fields, derived, length); },
+      [&]() {
+        FluidState<>::SoundSpeeds(states.data(), size, sound_speeds.data());
+        FluidState<>::MachNumbers(states.data(), size, mach_numbers.data());
+        FluidState<>::TotalPressures(states.data(), size, total_pressures.data());
+        FluidState<>::ReynoldsNumbers(states.data(), size, reynolds_numbers.data(), length);
+      })};
+  RecordProperty("FieldsCellsPerSecond",
+                 std::to_string(static_cast<double>(size) / performance.duration.count()));
+  RecordProperty(
+      "ArrayOfStructuresCellsPerSecond",
+      std::to_string(static_cast<double>(size) / performance.reference_duration.count()));
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_DOUBLE_EQ(derived.sound_speeds.Get(index).Value(), sound_speeds[index].Value());
+    EXPECT_DOUBLE_EQ(derived.reynolds_numbers.Get(index).Value(), reynolds_numbers[index].Value());
+  }
+}
+
+TEST(FluidState, CopyConstructor) {
+  const FluidState<> first{Air()};
+  const SoundSpeed<> sound_speed{first.SoundSpeed()};
+  const FluidState<> second{first};
+  EXPECT_EQ(second.MassDensity(), first.MassDensity());
+  EXPECT_EQ(second.SoundSpeed(), sound_speed);
+  EXPECT_EQ(second.MachNumber(), first.MachNumber());
+}
+
+TEST(FluidState, DerivedQuantities) {
+  const FluidState<> state{Air()};
+  const MassDensity<> mass_density{state.MassDensity()};
+  const Speed<> speed{50.0, Unit::Speed::MetrePerSecond};
+  const SpecificGasConstant<> specific_gas_constant{
+    101325.0 / (1.2 * 293.15), Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin};
+  const HeatCapacityRatio<> heat_capacity_ratio{
+    state.SpecificIsobaricHeatCapacity(), specific_gas_constant};
+  const SoundSpeed<> sound_speed{heat_capacity_ratio, state.StaticPressure(), mass_density};
+  const DynamicPressure<> dynamic_pressure{mass_density, speed};
+  const Length<> length{2.0, Unit::Length::Metre};
+
+  EXPECT_DOUBLE_EQ(state.Speed().Value(), speed.Value());
+  EXPECT_DOUBLE_EQ(state.SpecificGasConstant().Value(), specific_gas_constant.Value());
+  EXPECT_DOUBLE_EQ(state.HeatCapacityRatio().Value(), heat_capacity_ratio.Value());
+  EXPECT_DOUBLE_EQ(state.SoundSpeed().Value(), sound_speed.Value());
+  EXPECT_DOUBLE_EQ(state.MachNumber().Value(), MachNumber(speed, sound_speed).Value());
+  EXPECT_DOUBLE_EQ(state.DynamicPressure().Value(), dynamic_pressure.Value());
+  EXPECT_DOUBLE_EQ(state.TotalPressure().Value(),
+                   TotalPressure(state.StaticPressure(), dynamic_pressure).Value());
+  EXPECT_DOUBLE_EQ(state.KinematicViscosity().Value(),
+                   KinematicViscosity(state.DynamicViscosity(), mass_density).Value());
+  EXPECT_DOUBLE_EQ(state.ThermalDiffusivity().Value(),
+                   ThermalDiffusivity(state.ScalarThermalConductivity(), mass_density,
+                                      state.SpecificIsobaricHeatCapacity())
+                       .Value());
+  EXPECT_DOUBLE_EQ(state.PrandtlNumber().Value(),
+                   PrandtlNumber(state.SpecificIsobaricHeatCapacity(), state.DynamicViscosity(),
+                                 state.ScalarThermalConductivity())
+                       .Value());
+  EXPECT_DOUBLE_EQ(
+      state.ReynoldsNumber(length).Value(),
+      ReynoldsNumber(mass_density, speed, length, state.DynamicViscosity()).Value());
+  EXPECT_NEAR(state.HeatCapacityRatio().Value(), 1.4, 0.01);
+}
+
+TEST(FluidState, Memoization) {
+  const FluidState<> state{Air()};
+  const MachNumber<> mach_number{state.MachNumber()};
+  const SoundSpeed<> sound_speed{state.SoundSpeed()};
+  const HeatCapacityRatio<> heat_capacity_ratio{state.HeatCapacityRatio()};
+  EXPECT_EQ(state.MachNumber(), mach_number);
+  EXPECT_EQ(state.SoundSpeed(), sound_speed);
+  EXPECT_EQ(state.HeatCapacityRatio(), heat_capacity_ratio);
+
+  const FluidState<> fresh{Air()};
+  EXPECT_EQ(fresh.HeatCapacityRatio(), heat_capacity_ratio);
+  EXPECT_EQ(fresh.SoundSpeed(), sound_speed);
+  EXPECT_EQ(fresh.MachNumber(), mach_number);
+}
+
+TEST(FluidState, Performance) {
+  constexpr std::size_t size{1 << 12};
+  std::vector<FluidState<>> states;
+  states.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    states.push_back(Air(static_cast<double>(index % 64) / 64.0));
+  }
+  const Length<> length{2.0, Unit::Length::Metre};
+  double primitive_sum{0.0};
+  double fluid_state_sum{0.0};
+
+  Internal::TestRelativePerformance(
+      [&]() {
+        for (const FluidState<>& original : states) {
+          const FluidState<> state{original.MassDensity(),
+                                   original.Velocity(),
+                                   original.StaticPressure(),
+                                   original.Temperature(),
+                                   original.DynamicViscosity(),
+                                   original.SpecificIsobaricHeatCapacity(),
+                                   original.ScalarThermalConductivity()};
+          fluid_state_sum += state.MachNumber().Value() + state.SoundSpeed().Value()
+                             + state.TotalPressure().Value() + state.KinematicViscosity().Value()
+                             + state.ReynoldsNumber(length).Value();
+        }
+      },
+      [&]() {
+        for (const FluidState<>& state : states) {
+          const Speed<> speed{state.Velocity().Magnitude()};
+          const HeatCapacityRatio<> heat_capacity_ratio{
+            state.SpecificIsobaricHeatCapacity(),
+            SpecificGasConstant<>{state.StaticPressure().Value()
+                                      / (state.MassDensity().Value() * state.Temperature().Value()),
+                                  Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin}};
+          const SoundSpeed<> sound_speed{
+            heat_capacity_ratio, state.StaticPressure(), state.MassDensity()};
+          const DynamicPressure<> dynamic_pressure{state.MassDensity(), speed};
+          primitive_sum +=
+              MachNumber<>{speed, sound_speed}.Value() + sound_speed.Value()
+              + TotalPressure<>{state.StaticPressure(), dynamic_pressure}.Value()
+              + KinematicViscosity<>{state.DynamicViscosity(), state.MassDensity()}.Value()
+              + ReynoldsNumber<>{state.MassDensity(), speed, length, state.DynamicViscosity()}
+                    .Value();
+        }
+      },
+      1000);
+
+  EXPECT_NEAR(fluid_state_sum, primitive_sum, 1.0e-9 * primitive_sum);
+}
+
+}  // namespace
+
+}  // namespace PhQ
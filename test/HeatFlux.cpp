@@ -25,10 +25,13 @@
 #include "../include/PhQ/HeatFlux.hpp"
 
 #include <array>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/Angle.hpp"
 #include "../include/PhQ/Direction.hpp"
@@ -118,6 +121,103 @@ TEST(HeatFlux, ComparisonOperators) {
   EXPECT_GE(second, first);
 }
 
+TEST(HeatFlux, Conduction) {
+  const std::vector<ScalarThermalConductivity<>> scalar_thermal_conductivities{
+    ScalarThermalConductivity(2.0, Unit::ThermalConductivity::WattPerMetrePerKelvin),
+    ScalarThermalConductivity(0.5, Unit::ThermalConductivity::WattPerMetrePerKelvin)};
+  const std::vector<ThermalConductivity<>> thermal_conductivities{
+    ThermalConductivity({1.0, -2.0, 3.0, -4.0, 5.0, -6.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin),
+    ThermalConductivity({2.0, 0.0, 0.0, 2.0, 0.0, 2.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin)};
+  const std::vector<std::size_t> material_indices{1, 0, 0, 1};
+  const std::vector<TemperatureGradient<>> temperature_gradients{
+    TemperatureGradient({1.0, -2.0, 3.0}, Unit::TemperatureGradient::KelvinPerMetre),
+    TemperatureGradient({1.0, -2.0, 3.0}, Unit::TemperatureGradient::KelvinPerMetre),
+    TemperatureGradient({-4.0, 0.5, 8.0}, Unit::TemperatureGradient::KelvinPerMetre),
+    TemperatureGradient({0.0, 0.0, 0.0}, Unit::TemperatureGradient::KelvinPerMetre)};
+  const std::size_t size{temperature_gradients.size()};
+
+  std::vector<HeatFlux<>> heat_fluxes(size);
+  HeatFlux<>::Conduction(scalar_thermal_conductivities.data(), material_indices.data(),
+                         temperature_gradients.data(), size, heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(heat_fluxes[index], HeatFlux(scalar_thermal_conductivities[material_indices[index]],
+                                           temperature_gradients[index]));
+  }
+  EXPECT_EQ(heat_fluxes[1], HeatFlux({-2.0, 4.0, -6.0}, Unit::EnergyFlux::WattPerSquareMetre));
+
+  HeatFlux<>::Conduction(thermal_conductivities.data(), material_indices.data(),
+                         temperature_gradients.data(), size, heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(heat_fluxes[index], HeatFlux(thermal_conductivities[material_indices[index]],
+                                           temperature_gradients[index]));
+  }
+  EXPECT_EQ(heat_fluxes[1], HeatFlux({-14.0, -21.0, 25.0}, Unit::EnergyFlux::WattPerSquareMetre));
+
+  HeatFlux<>::Conduction(
+      scalar_thermal_conductivities[0], temperature_gradients.data(), size, heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(heat_fluxes[index],
+              HeatFlux(scalar_thermal_conductivities[0], temperature_gradients[index]));
+  }
+
+  HeatFlux<>::Conduction(
+      thermal_conductivities[0], temperature_gradients.data(), size, heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(
+        heat_fluxes[index], HeatFlux(thermal_conductivities[0], temperature_gradients[index]));
+  }
+}
+
+TEST(HeatFlux, ConductionPerformance) {
+  constexpr std::size_t size{16384};
+  constexpr std::size_t iterations{1000};
+  const std::vector<ThermalConductivity<>> thermal_conductivities{
+    ThermalConductivity({1.0, -2.0, 3.0, -4.0, 5.0, -6.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin),
+    ThermalConductivity({2.0, 0.0, 0.0, 2.0, 0.0, 2.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin),
+    ThermalConductivity({4.0, 0.5, 0.25, 3.0, 0.5, 2.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin),
+    ThermalConductivity({0.5, 0.0, 0.0, 0.5, 0.0, 8.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin)};
+  std::vector<std::size_t> material_indices;
+  std::vector<TemperatureGradient<>> temperature_gradients;
+  material_indices.reserve(size);
+  temperature_gradients.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 64)};
+    material_indices.push_back((index / 256) % thermal_conductivities.size());
+    temperature_gradients.emplace_back(
+        Vector<>{value, -0.5 * value, 0.25 * value}, Unit::TemperatureGradient::KelvinPerMetre);
+  }
+  std::vector<HeatFlux<>> per_point_heat_fluxes(size);
+  std::vector<HeatFlux<>> batched_heat_fluxes(size);
+
+  const Internal::RelativePerformance performance{Internal::TestRelativePerformance(
+      [&]() {
+        HeatFlux<>::Conduction(thermal_conductivities.data(), material_indices.data(),
+                               temperature_gradients.data(), size, batched_heat_fluxes.data());
+      },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          per_point_heat_fluxes[index] = HeatFlux(
+              thermal_conductivities[material_indices[index]], temperature_gradients[index]);
+        }
+      },
+      iterations)};
+  RecordProperty("BatchedPointsPerSecond",
+                 std::to_string(static_cast<double>(size) / performance.duration.count()));
+  RecordProperty(
+      "PerPointPointsPerSecond",
+      std::to_string(static_cast<double>(size) / performance.reference_duration.count()));
+
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(batched_heat_fluxes[index], per_point_heat_fluxes[index]);
+  }
+}
+
 TEST(HeatFlux, Constructor) {
   EXPECT_NO_THROW(HeatFlux({1.0, -2.0, 3.0}, Unit::EnergyFlux::NanowattPerSquareMillimetre));
   EXPECT_EQ(HeatFlux(ScalarHeatFlux(1.0, Unit::EnergyFlux::WattPerSquareMetre),
@@ -27,6 +27,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Unit/Length.hpp"
@@ -36,6 +37,24 @@ namespace PhQ {
 
 namespace {
 
+TEST(Length, Append) {
+  const Length length(1.0, Unit::Length::Metre);
+  std::string buffer{"["};
+  length.AppendJSON(buffer);
+  buffer.push_back(',');
+  length.AppendJSON(buffer, Unit::Length::Millimetre);
+  EXPECT_EQ(buffer, "[" + length.JSON() + "," + length.JSON(Unit::Length::Millimetre));
+  buffer.clear();
+  length.AppendPrint(buffer, Unit::Length::Millimetre);
+  EXPECT_EQ(buffer, length.Print(Unit::Length::Millimetre));
+  buffer.clear();
+  length.AppendXML(buffer);
+  EXPECT_EQ(buffer, length.XML());
+  buffer.clear();
+  length.AppendYAML(buffer, Unit::Length::Millimetre);
+  EXPECT_EQ(buffer, length.YAML(Unit::Length::Millimetre));
+}
+
 TEST(Length, ArithmeticOperatorAddition) {
   EXPECT_EQ(Length(1.0, Unit::Length::Metre) + Length(2.0, Unit::Length::Metre),
             Length(3.0, Unit::Length::Metre));
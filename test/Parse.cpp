@@ -0,0 +1,128 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Parse.hpp"
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+
+#include "../include/PhQ/PlanarVelocity.hpp"
+#include "../include/PhQ/ScalarForce.hpp"
+#include "../include/PhQ/StaticPressure.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+
+namespace PhQ {
+
+namespace {
+
+TEST(Parse, DimensionalScalarPrint) {
+  EXPECT_EQ(Parse<ScalarForce<>>("12.5 kN"), ScalarForce<>(12.5, Unit::Force::Kilonewton));
+  EXPECT_EQ(Parse<ScalarForce<>>("  -3 N  "), ScalarForce<>(-3.0, Unit::Force::Newton));
+  EXPECT_EQ(Parse<StaticPressure<>>("3.2e5 Pa"), StaticPressure<>(3.2e5, Unit::Pressure::Pascal));
+  EXPECT_EQ(Parse<ScalarForce<float>>("1.5 N"), ScalarForce<float>(1.5F, Unit::Force::Newton));
+}
+
+TEST(Parse, DimensionalScalarJSON) {
+  EXPECT_EQ(Parse<ScalarForce<>>("{\"value\":12.5,\"unit\":\"kN\"}"),
+            ScalarForce<>(12.5, Unit::Force::Kilonewton));
+  EXPECT_EQ(Parse<ScalarForce<>>(" { \"unit\" : \"N\" , \"value\" : -3 } "),
+            ScalarForce<>(-3.0, Unit::Force::Newton));
+}
+
+TEST(Parse, DimensionalPlanarVector) {
+  EXPECT_EQ(Parse<PlanarVelocity<>>("(1, -2) m/s"),
+            PlanarVelocity<>({1.0, -2.0}, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(Parse<PlanarVelocity<>>("{\"value\":{\"y\":-2,\"x\":1},\"unit\":\"mm/s\"}"),
+            PlanarVelocity<>({1.0, -2.0}, Unit::Speed::MillimetrePerSecond));
+}
+
+TEST(Parse, DimensionalVector) {
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2, 3) m/s"),
+            Velocity<>({1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(Parse<Velocity<>>("{\"value\":{\"x\":1,\"y\":2,\"z\":3},\"unit\":\"m/s\"}"),
+            Velocity<>({1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(Parse<Velocity<float>>("(1.5,2.5,3.5)mm/s"),
+            Velocity<float>({1.5F, 2.5F, 3.5F}, Unit::Speed::MillimetrePerSecond));
+}
+
+TEST(Parse, DimensionalSymmetricDyad) {
+  EXPECT_EQ(Parse<Stress<>>("(1, 2, 3; 4, 5; 6) Pa"),
+            Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Pascal));
+  EXPECT_EQ(
+      Parse<Stress<>>("{\"value\":{\"xx\":1,\"xy\":2,\"xz\":3,\"yy\":4,\"yz\":5,\"zz\":6},"
+                      "\"unit\":\"kPa\"}"),
+      Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Kilopascal));
+}
+
+TEST(Parse, DimensionalDyad) {
+  EXPECT_EQ(Parse<VelocityGradient<>>("(1, 2, 3; 4, 5, 6; 7, 8, 9) Hz"),
+            VelocityGradient<>(
+                {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0}, Unit::Frequency::Hertz));
+  EXPECT_EQ(Parse<VelocityGradient<>>(
+                "{\"value\":{\"zz\":9,\"zy\":8,\"zx\":7,\"yz\":6,\"yy\":5,\"yx\":4,\"xz\":3,"
+                "\"xy\":2,\"xx\":1},\"unit\":\"Hz\"}"),
+            VelocityGradient<>(
+                {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0}, Unit::Frequency::Hertz));
+}
+
+TEST(Parse, RoundTrip) {
+  const Velocity<> velocity({1.25, -2.5, 3.0e-7}, Unit::Speed::KilometrePerHour);
+  EXPECT_EQ(Parse<Velocity<>>(velocity.Print()), velocity);
+  EXPECT_EQ(Parse<Velocity<>>(velocity.JSON()), velocity);
+  const Stress<> stress({1.0, -2.0, 3.0, 4.5, 5.0, -6.0}, Unit::Pressure::Megapascal);
+  EXPECT_EQ(Parse<Stress<>>(stress.Print()), stress);
+  EXPECT_EQ(Parse<Stress<>>(stress.JSON()), stress);
+  const VelocityGradient<> gradient(
+      {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0}, Unit::Frequency::Kilohertz);
+  EXPECT_EQ(Parse<VelocityGradient<>>(gradient.Print()), gradient);
+  EXPECT_EQ(Parse<VelocityGradient<>>(gradient.JSON()), gradient);
+  const ScalarForce<> force(-12.5, Unit::Force::Kilonewton);
+  EXPECT_EQ(Parse<ScalarForce<>>(force.Print()), force);
+  EXPECT_EQ(Parse<ScalarForce<>>(force.JSON()), force);
+}
+
+TEST(Parse, Invalid) {
+  EXPECT_EQ(Parse<ScalarForce<>>(""), std::nullopt);
+  EXPECT_EQ(Parse<ScalarForce<>>("12.5"), std::nullopt);
+  EXPECT_EQ(Parse<ScalarForce<>>("12.5 m/s"), std::nullopt);
+  EXPECT_EQ(Parse<ScalarForce<>>("N"), std::nullopt);
+  EXPECT_EQ(Parse<ScalarForce<>>("{\"value\":12.5}"), std::nullopt);
+  EXPECT_EQ(Parse<ScalarForce<>>("{\"value\":12.5,\"value\":1}"), std::nullopt);
+  EXPECT_EQ(Parse<ScalarForce<>>("{\"value\":12.5,\"unit\":\"N\"} x"), std::nullopt);
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2) m/s"), std::nullopt);
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2, 3, 4) m/s"), std::nullopt);
+  EXPECT_EQ(Parse<Velocity<>>("1, 2, 3 m/s"), std::nullopt);
+  EXPECT_EQ(Parse<Velocity<>>("{\"value\":{\"x\":1,\"x\":2,\"z\":3},\"unit\":\"m/s\"}"),
+            std::nullopt);
+  EXPECT_EQ(Parse<Velocity<>>("{\"value\":{\"x\":1,\"y\":2,\"w\":3},\"unit\":\"m/s\"}"),
+            std::nullopt);
+  EXPECT_EQ(Parse<Stress<>>("(1, 2, 3; 4, 5) Pa"), std::nullopt);
+}
+
+}  // namespace
+
+}  // namespace PhQ
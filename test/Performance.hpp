@@ -27,6 +27,8 @@
 
 #include <array>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <gtest/gtest.h>
 
 namespace PhQ::Internal {
@@ -750,6 +752,47 @@ void TestDyadPerformance(Type& quantity1, Type& quantity2, std::array<double, 9>
   EXPECT_EQ(quantity2.Value().zz(), reference2[8]);
 }
 
+/// @brief Mean durations of one call of a function and of one call of its reference function, as
+/// measured by PhQ::Internal::TestRelativePerformance.
+struct RelativePerformance {
+  /// @brief Mean duration of one call of the function.
+  std::chrono::duration<double> duration;
+
+  /// @brief Mean duration of one call of the reference function.
+  std::chrono::duration<double> reference_duration;
+};
+
+/// @brief Tests the performance of a given function against a given reference function that
+/// computes the same results by simpler means. The two functions are called alternately a given
+/// number of times so that both see the same cache and clock frequency conditions. The results of
+/// the two functions are not compared here. Returns the mean duration of one call of each function
+/// so that callers can record throughputs.
+template <typename Function, typename ReferenceFunction>
+RelativePerformance TestRelativePerformance(
+    const Function& function, const ReferenceFunction& reference_function,
+    const std::size_t iterations = 100) {
+  std::chrono::duration<double> duration{std::chrono::duration<double>::zero()};
+  std::chrono::duration<double> reference_duration{std::chrono::duration<double>::zero()};
+
+  for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+    const std::chrono::time_point time_start{std::chrono::steady_clock::now()};
+    function();
+    const std::chrono::time_point time_end{std::chrono::steady_clock::now()};
+    duration += time_end - time_start;
+
+    const std::chrono::time_point reference_time_start{std::chrono::steady_clock::now()};
+    reference_function();
+    const std::chrono::time_point reference_time_end{std::chrono::steady_clock::now()};
+    reference_duration += reference_time_end - reference_time_start;
+  }
+
+  const double error{std::abs(duration / reference_duration - 1.0)};
+  EXPECT_LE(error, 1.0);
+
+  return {duration / static_cast<double>(iterations),
+          reference_duration / static_cast<double>(iterations)};
+}
+
 }  // namespace PhQ::Internal
 
 #endif  // PHYSICAL_QUANTITIES_TEST_PERFORMANCE_HPP
@@ -196,6 +196,19 @@ TEST(PlanarDirection, MoveConstructor) {
   EXPECT_EQ(second, PlanarDirection(1.0, -2.0));
 }
 
+TEST(PlanarDirection, Normalize) {
+  const std::array<PlanarVector<>, 3> planar_vectors{
+      PlanarVector<>{3.0, -4.0}, PlanarVector<>{0.0, 0.0}, PlanarVector<>{0.0, 1.0e-150}};
+  std::array<PlanarDirection<>, 3> planar_directions;
+  PlanarDirection<>::Normalize(
+      planar_vectors.data(), planar_vectors.size(), planar_directions.data());
+  EXPECT_DOUBLE_EQ(planar_directions[0].x(), 0.6);
+  EXPECT_DOUBLE_EQ(planar_directions[0].y(), -0.8);
+  EXPECT_EQ(planar_directions[1], PlanarDirection<>::Zero());
+  EXPECT_EQ(planar_directions[2].x(), 0.0);
+  EXPECT_DOUBLE_EQ(planar_directions[2].y(), 1.0);
+}
+
 TEST(PlanarDirection, Print) {
   EXPECT_EQ(PlanarDirection<>{}.Print(), "(" + Print(0.0) + ", " + Print(0.0) + ")");
   EXPECT_EQ(PlanarDirection(0.0, -2.0).Print(), "(" + Print(0.0) + ", " + Print(-1.0) + ")");
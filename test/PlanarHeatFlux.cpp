@@ -25,10 +25,12 @@
 #include "../include/PhQ/PlanarHeatFlux.hpp"
 
 #include <array>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/Angle.hpp"
 #include "../include/PhQ/PlanarDirection.hpp"
@@ -118,6 +120,62 @@ TEST(PlanarHeatFlux, ComparisonOperators) {
   EXPECT_GE(second, first);
 }
 
+TEST(PlanarHeatFlux, Conduction) {
+  const std::vector<ScalarThermalConductivity<>> scalar_thermal_conductivities{
+    ScalarThermalConductivity(2.0, Unit::ThermalConductivity::WattPerMetrePerKelvin),
+    ScalarThermalConductivity(0.5, Unit::ThermalConductivity::WattPerMetrePerKelvin)};
+  const std::vector<ThermalConductivity<>> thermal_conductivities{
+    ThermalConductivity({1.0, -2.0, 3.0, -4.0, 5.0, -6.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin),
+    ThermalConductivity({2.0, 0.0, 0.0, 2.0, 0.0, 2.0},
+                        Unit::ThermalConductivity::WattPerMetrePerKelvin)};
+  const std::vector<std::size_t> material_indices{1, 0, 0, 1};
+  const std::vector<PlanarTemperatureGradient<>> planar_temperature_gradients{
+    PlanarTemperatureGradient({1.0, -2.0}, Unit::TemperatureGradient::KelvinPerMetre),
+    PlanarTemperatureGradient({1.0, -2.0}, Unit::TemperatureGradient::KelvinPerMetre),
+    PlanarTemperatureGradient({-4.0, 0.5}, Unit::TemperatureGradient::KelvinPerMetre),
+    PlanarTemperatureGradient({0.0, 0.0}, Unit::TemperatureGradient::KelvinPerMetre)};
+  const std::size_t size{planar_temperature_gradients.size()};
+
+  std::vector<PlanarHeatFlux<>> planar_heat_fluxes(size);
+  PlanarHeatFlux<>::Conduction(scalar_thermal_conductivities.data(), material_indices.data(),
+                               planar_temperature_gradients.data(), size,
+                               planar_heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(planar_heat_fluxes[index],
+              PlanarHeatFlux(scalar_thermal_conductivities[material_indices[index]],
+                             planar_temperature_gradients[index]));
+  }
+  EXPECT_EQ(
+      planar_heat_fluxes[1], PlanarHeatFlux({-2.0, 4.0}, Unit::EnergyFlux::WattPerSquareMetre));
+
+  PlanarHeatFlux<>::Conduction(thermal_conductivities.data(), material_indices.data(),
+                               planar_temperature_gradients.data(), size,
+                               planar_heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(planar_heat_fluxes[index],
+              PlanarHeatFlux(thermal_conductivities[material_indices[index]],
+                             planar_temperature_gradients[index]));
+  }
+  EXPECT_EQ(
+      planar_heat_fluxes[1], PlanarHeatFlux({-5.0, -6.0}, Unit::EnergyFlux::WattPerSquareMetre));
+
+  PlanarHeatFlux<>::Conduction(scalar_thermal_conductivities[0],
+                               planar_temperature_gradients.data(), size,
+                               planar_heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(planar_heat_fluxes[index], PlanarHeatFlux(scalar_thermal_conductivities[0],
+                                                        planar_temperature_gradients[index]));
+  }
+
+  PlanarHeatFlux<>::Conduction(thermal_conductivities[0], planar_temperature_gradients.data(),
+                               size, planar_heat_fluxes.data());
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(planar_heat_fluxes[index],
+              PlanarHeatFlux(thermal_conductivities[0], planar_temperature_gradients[index]));
+  }
+}
+
 TEST(PlanarHeatFlux, Constructor) {
   EXPECT_NO_THROW(PlanarHeatFlux({1.0, -2.0}, Unit::EnergyFlux::NanowattPerSquareMillimetre));
   EXPECT_EQ(PlanarHeatFlux(ScalarHeatFlux(1.0, Unit::EnergyFlux::WattPerSquareMetre),
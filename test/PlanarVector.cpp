@@ -28,12 +28,32 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 namespace PhQ {
 
 namespace {
 
+TEST(PlanarVector, Append) {
+  const PlanarVector first(1.0, -2.0);
+  const PlanarVector second(first * 0.5);
+  std::string buffer{"["};
+  first.AppendPrint(buffer);
+  buffer.push_back(',');
+  second.AppendPrint(buffer);
+  EXPECT_EQ(buffer, "[" + first.Print() + "," + second.Print());
+  buffer.clear();
+  first.AppendJSON(buffer);
+  EXPECT_EQ(buffer, first.JSON());
+  buffer.clear();
+  first.AppendXML(buffer);
+  EXPECT_EQ(buffer, first.XML());
+  buffer.clear();
+  first.AppendYAML(buffer);
+  EXPECT_EQ(buffer, first.YAML());
+}
+
 TEST(PlanarVector, ArithmeticOperatorAddition) {
   EXPECT_EQ(PlanarVector(1.0F, -2.0F) + PlanarVector(2.0F, -4.0F), PlanarVector(3.0F, -6.0F));
   EXPECT_EQ(PlanarVector(1.0, -2.0) + PlanarVector(2.0, -4.0), PlanarVector(3.0, -6.0));
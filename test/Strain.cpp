@@ -25,12 +25,16 @@
 #include "../include/PhQ/Strain.hpp"
 
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
 
 #include "../include/PhQ/Dimensions.hpp"
+#include "../include/PhQ/Direction.hpp"
+#include "../include/PhQ/ScalarStrain.hpp"
 #include "../include/PhQ/SymmetricDyad.hpp"
 #include "Performance.hpp"
 
@@ -147,6 +151,16 @@ TEST(Strain, DefaultConstructor) {
   EXPECT_NO_THROW(Strain<>{});
 }
 
+TEST(Strain, Deviatoric) {
+  const Strain<> deviatoric{Strain(8.0, 2.0, 1.0, 16.0, 4.0, 32.0).Deviatoric()};
+  EXPECT_NEAR(deviatoric.Value().xx(), 8.0 - 56.0 / 3.0, 1.0e-13);
+  EXPECT_DOUBLE_EQ(deviatoric.Value().xy(), 2.0);
+  EXPECT_DOUBLE_EQ(deviatoric.Value().xz(), 1.0);
+  EXPECT_NEAR(deviatoric.Value().yy(), 16.0 - 56.0 / 3.0, 1.0e-13);
+  EXPECT_DOUBLE_EQ(deviatoric.Value().yz(), 4.0);
+  EXPECT_NEAR(deviatoric.Value().zz(), 32.0 - 56.0 / 3.0, 1.0e-13);
+}
+
 TEST(Strain, Dimensions) {
   EXPECT_EQ(Strain<>::Dimensions(), Dimensionless);
 }
@@ -161,6 +175,17 @@ TEST(Strain, Hash) {
   EXPECT_NE(hash(second), hash(third));
 }
 
+TEST(Strain, Hydrostatic) {
+  EXPECT_DOUBLE_EQ(Strain(8.0, 2.0, 1.0, 16.0, 4.0, 32.0).Hydrostatic().Value(), 56.0 / 3.0);
+}
+
+TEST(Strain, Invariants) {
+  const Strain strain(8.0, 2.0, 1.0, 16.0, 4.0, 32.0);
+  EXPECT_EQ(strain.J2(), strain.Value().J2());
+  EXPECT_EQ(strain.J3(), strain.Value().J3());
+  EXPECT_DOUBLE_EQ(strain.J2(), 511.0 / 3.0);
+}
+
 TEST(Strain, JSON) {
   EXPECT_EQ(
       Strain(1.0, -2.0, 3.0, -4.0, 5.0, -6.0).JSON(),
@@ -202,6 +227,30 @@ TEST(Strain, Performance) {
   Internal::TestSymmetricDyadPerformance(strain1, strain2, reference1, reference2);
 }
 
+TEST(Strain, PrincipalDirections) {
+  const std::array<Direction<>, 3> directions{
+      Strain(3.0, 0.0, 0.0, -1.0, 0.0, 2.0).PrincipalDirections()};
+  EXPECT_DOUBLE_EQ(std::abs(directions[0].x()), 1.0);
+  EXPECT_DOUBLE_EQ(std::abs(directions[1].z()), 1.0);
+  EXPECT_DOUBLE_EQ(std::abs(directions[2].y()), 1.0);
+}
+
+TEST(Strain, PrincipalStrains) {
+  const std::array<ScalarStrain<>, 3> principal{
+      Strain(3.0, 0.0, 0.0, -1.0, 0.0, 2.0).PrincipalStrains()};
+  EXPECT_DOUBLE_EQ(principal[0].Value(), 3.0);
+  EXPECT_DOUBLE_EQ(principal[1].Value(), 2.0);
+  EXPECT_DOUBLE_EQ(principal[2].Value(), -1.0);
+
+  const Strain strain(1.0, -2.0, 3.0, -4.0, 5.0, -6.0);
+  const std::array<ScalarStrain<>, 3> eigenvalues{strain.PrincipalStrains()};
+  const std::array<Direction<>, 3> directions{strain.PrincipalDirections()};
+  for (std::size_t index = 0; index < 3; ++index) {
+    EXPECT_EQ(eigenvalues[index].Value(), strain.Value().Eigenvalues()[index]);
+    EXPECT_EQ(directions[index], Direction<>(strain.Value().Eigenvectors()[index]));
+  }
+}
+
 TEST(Strain, Print) {
   EXPECT_EQ(Strain(1.0, -2.0, 3.0, -4.0, 5.0, -6.0).Print(),
             "(" + Print(1.0) + ", " + Print(-2.0) + ", " + Print(3.0) + "; " + Print(-4.0) + ", "
@@ -229,6 +278,15 @@ TEST(Strain, Value) {
             SymmetricDyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0));
 }
 
+TEST(Strain, VonMises) {
+  const Strain strain(8.0, 2.0, 1.0, 16.0, 4.0, 32.0);
+  EXPECT_DOUBLE_EQ(strain.VonMises().Value(), std::sqrt(4.0 / 3.0 * strain.J2()));
+
+  // Uniaxial strain of an incompressible material: e, -e / 2, -e / 2.
+  EXPECT_DOUBLE_EQ(Strain(2.0, 0.0, 0.0, -1.0, 0.0, -1.0).VonMises().Value(), 2.0);
+  EXPECT_EQ(Strain(3.0, 0.0, 0.0, 3.0, 0.0, 3.0).VonMises(), ScalarStrain(0.0));
+}
+
 TEST(Strain, XML) {
   EXPECT_EQ(Strain(1.0, -2.0, 3.0, -4.0, 5.0, -6.0).XML(),
             "<xx>" + Print(1.0) + "</xx><xy>" + Print(-2.0) + "</xy><xz>" + Print(3.0) + "</xz><yy>"
@@ -26,11 +26,13 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
 
+#include "../include/PhQ/DimensionalAnalysis.hpp"
 #include "../include/PhQ/Direction.hpp"
 #include "../include/PhQ/PlanarDirection.hpp"
 #include "../include/PhQ/PlanarTraction.hpp"
@@ -191,6 +193,17 @@ TEST(Stress, DefaultConstructor) {
   EXPECT_NO_THROW(Stress<>{});
 }
 
+TEST(Stress, Deviatoric) {
+  const Stress<> deviatoric{
+      Stress({8.0, 2.0, 1.0, 16.0, 4.0, 32.0}, Unit::Pressure::Pascal).Deviatoric()};
+  EXPECT_NEAR(deviatoric.Value().xx(), 8.0 - 56.0 / 3.0, 1.0e-13);
+  EXPECT_DOUBLE_EQ(deviatoric.Value().xy(), 2.0);
+  EXPECT_DOUBLE_EQ(deviatoric.Value().xz(), 1.0);
+  EXPECT_NEAR(deviatoric.Value().yy(), 16.0 - 56.0 / 3.0, 1.0e-13);
+  EXPECT_DOUBLE_EQ(deviatoric.Value().yz(), 4.0);
+  EXPECT_NEAR(deviatoric.Value().zz(), 32.0 - 56.0 / 3.0, 1.0e-13);
+}
+
 TEST(Stress, Dimensions) {
   EXPECT_EQ(Stress<>::Dimensions(), RelatedDimensions<Unit::Pressure>);
 }
@@ -205,6 +218,23 @@ TEST(Stress, Hash) {
   EXPECT_NE(hash(second), hash(third));
 }
 
+TEST(Stress, Hydrostatic) {
+  EXPECT_DOUBLE_EQ(
+      Stress({8.0, 2.0, 1.0, 16.0, 4.0, 32.0}, Unit::Pressure::Pascal).Hydrostatic().Value(),
+      56.0 / 3.0);
+  EXPECT_EQ(Stress(StaticPressure(5.0, Unit::Pressure::Pascal)).Hydrostatic(),
+            ScalarStress(-5.0, Unit::Pressure::Pascal));
+}
+
+TEST(Stress, Invariants) {
+  const Stress stress({8.0, 2.0, 1.0, 16.0, 4.0, 32.0}, Unit::Pressure::Pascal);
+  const StaticQuantity<StaticDimensions<-4, -2, 2, 0, 0, 0, 0>> j2{stress.J2()};
+  const StaticQuantity<StaticDimensions<-6, -3, 3, 0, 0, 0, 0>> j3{stress.J3()};
+  EXPECT_EQ(j2.Value(), stress.Value().J2());
+  EXPECT_EQ(j3.Value(), stress.Value().J3());
+  EXPECT_DOUBLE_EQ(j2.Value(), 511.0 / 3.0);
+}
+
 TEST(Stress, JSON) {
   EXPECT_EQ(Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal).JSON(),
             "{\"value\":{\"xx\":" + Print(1.0) + ",\"xy\":" + Print(-2.0) + ",\"xz\":" + Print(3.0)
@@ -274,6 +304,30 @@ TEST(Stress, Performance) {
   Internal::TestSymmetricDyadPerformance(stress1, stress2, reference1, reference2);
 }
 
+TEST(Stress, PrincipalDirections) {
+  const std::array<Direction<>, 3> directions{
+      Stress({3.0, 0.0, 0.0, -1.0, 0.0, 2.0}, Unit::Pressure::Pascal).PrincipalDirections()};
+  EXPECT_DOUBLE_EQ(std::abs(directions[0].x()), 1.0);
+  EXPECT_DOUBLE_EQ(std::abs(directions[1].z()), 1.0);
+  EXPECT_DOUBLE_EQ(std::abs(directions[2].y()), 1.0);
+}
+
+TEST(Stress, PrincipalStresses) {
+  const std::array<ScalarStress<>, 3> principal{
+      Stress({3.0, 0.0, 0.0, -1.0, 0.0, 2.0}, Unit::Pressure::Pascal).PrincipalStresses()};
+  EXPECT_DOUBLE_EQ(principal[0].Value(), 3.0);
+  EXPECT_DOUBLE_EQ(principal[1].Value(), 2.0);
+  EXPECT_DOUBLE_EQ(principal[2].Value(), -1.0);
+
+  const Stress stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal);
+  const std::array<ScalarStress<>, 3> eigenvalues{stress.PrincipalStresses()};
+  const std::array<Direction<>, 3> directions{stress.PrincipalDirections()};
+  for (std::size_t index = 0; index < 3; ++index) {
+    EXPECT_EQ(eigenvalues[index].Value(), stress.Value().Eigenvalues()[index]);
+    EXPECT_EQ(directions[index], Direction<>(stress.Value().Eigenvectors()[index]));
+  }
+}
+
 TEST(Stress, Print) {
   EXPECT_EQ(Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal).Print(),
             "(" + Print(1.0) + ", " + Print(-2.0) + ", " + Print(3.0) + "; " + Print(-4.0) + ", "
@@ -308,6 +362,14 @@ TEST(Stress, Stream) {
       stream.str(), Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal).Print());
 }
 
+TEST(Stress, Tresca) {
+  EXPECT_DOUBLE_EQ(
+      Stress({3.0, 0.0, 0.0, -1.0, 0.0, 2.0}, Unit::Pressure::Pascal).Tresca().Value(), 4.0);
+  EXPECT_DOUBLE_EQ(
+      Stress({0.0, 5.0, 0.0, 0.0, 0.0, 0.0}, Unit::Pressure::Pascal).Tresca().Value(), 10.0);
+  EXPECT_NEAR(Stress(StaticPressure(5.0, Unit::Pressure::Pascal)).Tresca().Value(), 0.0, 1.0e-14);
+}
+
 TEST(Stress, Value) {
   EXPECT_EQ(Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal).Value(),
             SymmetricDyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0));
@@ -316,6 +378,18 @@ TEST(Stress, Value) {
             SymmetricDyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0));
 }
 
+TEST(Stress, VonMises) {
+  const Stress stress({8.0, 2.0, 1.0, 16.0, 4.0, 32.0}, Unit::Pressure::Pascal);
+  EXPECT_DOUBLE_EQ(stress.VonMises().Value(), std::sqrt(3.0 * stress.J2().Value()));
+  EXPECT_DOUBLE_EQ(
+      Stress({0.0, 1.0, 0.0, 0.0, 0.0, 0.0}, Unit::Pressure::Pascal).VonMises().Value(),
+      std::sqrt(3.0));
+  EXPECT_DOUBLE_EQ(
+      Stress({2.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Pressure::Pascal).VonMises().Value(), 2.0);
+  EXPECT_EQ(Stress(StaticPressure(5.0, Unit::Pressure::Pascal)).VonMises(),
+            ScalarStress(0.0, Unit::Pressure::Pascal));
+}
+
 TEST(Stress, XML) {
   EXPECT_EQ(Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal).XML(),
             "<value><xx>" + Print(1.0) + "</xx><xy>" + Print(-2.0) + "</xy><xz>" + Print(3.0)
@@ -24,21 +24,139 @@
 
 #include "../include/PhQ/SymmetricDyad.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
+#include <limits>
 #include <optional>
 #include <sstream>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/Base.hpp"
 #include "../include/PhQ/PlanarVector.hpp"
 #include "../include/PhQ/Vector.hpp"
+#include "Performance.hpp"
 
 namespace PhQ {
 
 namespace {
 
+// Computes the eigenvalues and eigenvectors of a symmetric dyadic tensor with the cyclic Jacobi
+// eigenvalue algorithm and sorts them in decreasing order of eigenvalue. This iterative algorithm
+// is the reference for the closed-form eigenvalues and eigenvectors.
+template <typename NumericType>
+void JacobiEigenDecomposition(
+    const SymmetricDyad<NumericType>& symmetric_dyad, std::array<NumericType, 3>& eigenvalues,
+    std::array<Vector<NumericType>, 3>& eigenvectors) {
+  std::array<std::array<NumericType, 3>, 3> matrix{
+      {{symmetric_dyad.xx(), symmetric_dyad.xy(), symmetric_dyad.xz()},
+       {symmetric_dyad.yx(), symmetric_dyad.yy(), symmetric_dyad.yz()},
+       {symmetric_dyad.zx(), symmetric_dyad.zy(), symmetric_dyad.zz()}}
+  };
+  std::array<std::array<NumericType, 3>, 3> rotation{
+      {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}
+  };
+  NumericType tolerance{0};
+  for (const NumericType component : symmetric_dyad.xx_xy_xz_yy_yz_zz()) {
+    tolerance += static_cast<NumericType>(2) * component * component;
+  }
+  tolerance *=
+      std::numeric_limits<NumericType>::epsilon() * std::numeric_limits<NumericType>::epsilon();
+  constexpr std::array<std::pair<std::size_t, std::size_t>, 3> pairs{
+      {{0, 1}, {0, 2}, {1, 2}}
+  };
+  for (std::size_t sweep = 0; sweep < 32; ++sweep) {
+    if (matrix[0][1] * matrix[0][1] + matrix[0][2] * matrix[0][2] + matrix[1][2] * matrix[1][2]
+        <= tolerance) {
+      break;
+    }
+    for (const auto& [row, column] : pairs) {
+      if (matrix[row][column] == static_cast<NumericType>(0)) {
+        continue;
+      }
+      const NumericType theta{(matrix[column][column] - matrix[row][row])
+                              / (static_cast<NumericType>(2) * matrix[row][column])};
+      const NumericType tangent{
+          (theta >= static_cast<NumericType>(0) ? static_cast<NumericType>(1) :
+                                                  static_cast<NumericType>(-1))
+          / (std::abs(theta) + std::sqrt(theta * theta + static_cast<NumericType>(1)))};
+      const NumericType cosine{
+          static_cast<NumericType>(1) / std::sqrt(tangent * tangent + static_cast<NumericType>(1))};
+      const NumericType sine{tangent * cosine};
+      for (std::size_t index = 0; index < 3; ++index) {
+        const NumericType first{matrix[index][row]};
+        const NumericType second{matrix[index][column]};
+        matrix[index][row] = cosine * first - sine * second;
+        matrix[index][column] = sine * first + cosine * second;
+      }
+      for (std::size_t index = 0; index < 3; ++index) {
+        const NumericType first{matrix[row][index]};
+        const NumericType second{matrix[column][index]};
+        matrix[row][index] = cosine * first - sine * second;
+        matrix[column][index] = sine * first + cosine * second;
+      }
+      for (std::size_t index = 0; index < 3; ++index) {
+        const NumericType first{rotation[index][row]};
+        const NumericType second{rotation[index][column]};
+        rotation[index][row] = cosine * first - sine * second;
+        rotation[index][column] = sine * first + cosine * second;
+      }
+    }
+  }
+  std::array<std::size_t, 3> order{0, 1, 2};
+  std::sort(order.begin(), order.end(), [&matrix](const std::size_t left, const std::size_t right) {
+    return matrix[left][left] > matrix[right][right];
+  });
+  for (std::size_t index = 0; index < 3; ++index) {
+    eigenvalues[index] = matrix[order[index]][order[index]];
+    eigenvectors[index] = Vector<NumericType>{
+        rotation[0][order[index]], rotation[1][order[index]], rotation[2][order[index]]};
+  }
+}
+
+// Returns a deterministic set of symmetric dyadic tensors whose magnitudes span many orders of
+// magnitude. Every third tensor has a repeated eigenvalue.
+std::vector<SymmetricDyad<>> SymmetricDyads(const std::size_t size) {
+  std::vector<SymmetricDyad<>> symmetric_dyads;
+  symmetric_dyads.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index)};
+    const double magnitude{std::pow(10.0, static_cast<double>(index % 13) - 6.0)};
+    if (index % 3 == 0) {
+      const Vector<> axis{std::sin(value), std::cos(1.3 * value), std::sin(0.7 * value + 0.5)};
+      const Vector<> direction{axis / axis.Magnitude()};
+      const double isotropic{magnitude * std::sin(2.1 * value)};
+      const double uniaxial{magnitude * std::cos(0.9 * value)};
+      symmetric_dyads.emplace_back(
+          isotropic + uniaxial * direction.x() * direction.x(),
+          uniaxial * direction.x() * direction.y(), uniaxial * direction.x() * direction.z(),
+          isotropic + uniaxial * direction.y() * direction.y(),
+          uniaxial * direction.y() * direction.z(),
+          isotropic + uniaxial * direction.z() * direction.z());
+    } else {
+      symmetric_dyads.emplace_back(
+          magnitude * std::sin(value), magnitude * std::sin(1.1 * value + 1.0),
+          magnitude * std::sin(1.2 * value + 2.0), magnitude * std::sin(1.3 * value + 3.0),
+          magnitude * std::sin(1.4 * value + 4.0), magnitude * std::sin(1.5 * value + 5.0));
+    }
+  }
+  return symmetric_dyads;
+}
+
+// Returns the largest absolute value of the components of a symmetric dyadic tensor.
+double LargestComponent(const SymmetricDyad<>& symmetric_dyad) {
+  double largest{0.0};
+  for (const double component : symmetric_dyad.xx_xy_xz_yy_yz_zz()) {
+    largest = std::max(largest, std::abs(component));
+  }
+  return largest;
+}
+
 TEST(SymmetricDyad, Adjugate) {
   EXPECT_EQ(SymmetricDyad(8.0F, 2.0F, 1.0F, 16.0F, 4.0F, 32.0F).Adjugate(),
             SymmetricDyad(496.0F, -60.0F, -8.0F, 255.0F, -30.0F, 124.0F));
@@ -48,6 +166,25 @@ TEST(SymmetricDyad, Adjugate) {
             SymmetricDyad(496.0L, -60.0L, -8.0L, 255.0L, -30.0L, 124.0L));
 }
 
+TEST(SymmetricDyad, Append) {
+  const SymmetricDyad first(1.0, -2.0, 3.0, -4.0, 5.0, -6.0);
+  const SymmetricDyad second(first * 0.5);
+  std::string buffer{"["};
+  first.AppendPrint(buffer);
+  buffer.push_back(',');
+  second.AppendPrint(buffer);
+  EXPECT_EQ(buffer, "[" + first.Print() + "," + second.Print());
+  buffer.clear();
+  first.AppendJSON(buffer);
+  EXPECT_EQ(buffer, first.JSON());
+  buffer.clear();
+  first.AppendXML(buffer);
+  EXPECT_EQ(buffer, first.XML());
+  buffer.clear();
+  first.AppendYAML(buffer);
+  EXPECT_EQ(buffer, first.YAML());
+}
+
 TEST(SymmetricDyad, ArithmeticOperatorAddition) {
   EXPECT_EQ(SymmetricDyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F)
                 + SymmetricDyad(2.0F, -4.0F, 6.0F, -8.0F, 10.0F, -12.0F),
@@ -527,6 +664,119 @@ TEST(SymmetricDyad, Determinant) {
   EXPECT_EQ(SymmetricDyad(8.0L, 2.0L, 1.0L, 16.0L, 4.0L, 32.0L).Determinant(), 3840.0L);
 }
 
+TEST(SymmetricDyad, Deviatoric) {
+  const SymmetricDyad<> deviatoric{SymmetricDyad(8.0, 2.0, 1.0, 16.0, 4.0, 32.0).Deviatoric()};
+  EXPECT_NEAR(deviatoric.xx(), 8.0 - 56.0 / 3.0, 1.0e-13);
+  EXPECT_DOUBLE_EQ(deviatoric.xy(), 2.0);
+  EXPECT_DOUBLE_EQ(deviatoric.xz(), 1.0);
+  EXPECT_NEAR(deviatoric.yy(), 16.0 - 56.0 / 3.0, 1.0e-13);
+  EXPECT_DOUBLE_EQ(deviatoric.yz(), 4.0);
+  EXPECT_NEAR(deviatoric.zz(), 32.0 - 56.0 / 3.0, 1.0e-13);
+  EXPECT_NEAR(deviatoric.Trace(), 0.0, 1.0e-14);
+}
+
+TEST(SymmetricDyad, EigenDecompositionPerformance) {
+  constexpr std::size_t size{1 << 12};
+  const std::vector<SymmetricDyad<>> symmetric_dyads{SymmetricDyads(size)};
+  std::vector<std::array<double, 3>> closed_form_eigenvalues(size);
+  std::vector<std::array<Vector<>, 3>> closed_form_eigenvectors(size);
+  std::vector<std::array<double, 3>> jacobi_eigenvalues(size);
+  std::vector<std::array<Vector<>, 3>> jacobi_eigenvectors(size);
+
+  Internal::TestRelativePerformance(
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          closed_form_eigenvalues[index] = symmetric_dyads[index].Eigenvalues();
+          closed_form_eigenvectors[index] =
+              symmetric_dyads[index].Eigenvectors(closed_form_eigenvalues[index]);
+        }
+      },
+      [&]() {
+        for (std::size_t index = 0; index < size; ++index) {
+          JacobiEigenDecomposition(
+              symmetric_dyads[index], jacobi_eigenvalues[index], jacobi_eigenvectors[index]);
+        }
+      });
+
+  double largest_error{0.0};
+  for (std::size_t index = 0; index < size; ++index) {
+    const double largest_component{LargestComponent(symmetric_dyads[index])};
+    for (std::size_t eigen_index = 0; eigen_index < 3; ++eigen_index) {
+      largest_error = std::max(
+          largest_error, std::abs(closed_form_eigenvalues[index][eigen_index]
+                                  - jacobi_eigenvalues[index][eigen_index])
+                             / largest_component);
+    }
+  }
+  EXPECT_LE(largest_error, 1.0e-13);
+}
+
+TEST(SymmetricDyad, Eigenvalues) {
+  EXPECT_EQ(SymmetricDyad<>::Zero().Eigenvalues(), (std::array<double, 3>{0.0, 0.0, 0.0}));
+  EXPECT_EQ(SymmetricDyad(2.0, 0.0, 0.0, 2.0, 0.0, 2.0).Eigenvalues(),
+            (std::array<double, 3>{2.0, 2.0, 2.0}));
+
+  const std::array<double, 3> diagonal{SymmetricDyad(3.0, 0.0, 0.0, -1.0, 0.0, 2.0).Eigenvalues()};
+  EXPECT_DOUBLE_EQ(diagonal[0], 3.0);
+  EXPECT_DOUBLE_EQ(diagonal[1], 2.0);
+  EXPECT_DOUBLE_EQ(diagonal[2], -1.0);
+
+  const std::array<float, 3> single{
+      SymmetricDyad(8.0F, 2.0F, 1.0F, 16.0F, 4.0F, 32.0F).Eigenvalues()};
+  const std::array<long double, 3> extended{
+      SymmetricDyad(8.0L, 2.0L, 1.0L, 16.0L, 4.0L, 32.0L).Eigenvalues()};
+  std::array<long double, 3> reference;
+  std::array<Vector<long double>, 3> reference_eigenvectors;
+  JacobiEigenDecomposition(
+      SymmetricDyad(8.0L, 2.0L, 1.0L, 16.0L, 4.0L, 32.0L), reference, reference_eigenvectors);
+  for (std::size_t index = 0; index < 3; ++index) {
+    EXPECT_FLOAT_EQ(single[index], static_cast<float>(reference[index]));
+    EXPECT_NEAR(extended[index], reference[index], 1.0e-15L);
+  }
+
+  for (const SymmetricDyad<>& symmetric_dyad : SymmetricDyads(1000)) {
+    const std::array<double, 3> eigenvalues{symmetric_dyad.Eigenvalues()};
+    std::array<double, 3> jacobi_eigenvalues;
+    std::array<Vector<>, 3> jacobi_eigenvectors;
+    JacobiEigenDecomposition(symmetric_dyad, jacobi_eigenvalues, jacobi_eigenvectors);
+    const double tolerance{1.0e-13 * LargestComponent(symmetric_dyad)};
+    EXPECT_GE(eigenvalues[0], eigenvalues[1]);
+    EXPECT_GE(eigenvalues[1], eigenvalues[2]);
+    for (std::size_t index = 0; index < 3; ++index) {
+      EXPECT_NEAR(eigenvalues[index], jacobi_eigenvalues[index], tolerance);
+    }
+  }
+}
+
+TEST(SymmetricDyad, Eigenvectors) {
+  const std::array<Vector<>, 3> diagonal{
+      SymmetricDyad(3.0, 0.0, 0.0, -1.0, 0.0, 2.0).Eigenvectors()};
+  EXPECT_DOUBLE_EQ(std::abs(diagonal[0].x()), 1.0);
+  EXPECT_DOUBLE_EQ(std::abs(diagonal[1].z()), 1.0);
+  EXPECT_DOUBLE_EQ(std::abs(diagonal[2].y()), 1.0);
+
+  const std::array<Vector<>, 3> zero{SymmetricDyad<>::Zero().Eigenvectors()};
+  EXPECT_EQ(zero[0], Vector<>(1.0, 0.0, 0.0));
+  EXPECT_EQ(zero[1], Vector<>(0.0, 1.0, 0.0));
+  EXPECT_EQ(zero[2], Vector<>(0.0, 0.0, 1.0));
+
+  for (const SymmetricDyad<>& symmetric_dyad : SymmetricDyads(1000)) {
+    const std::array<double, 3> eigenvalues{symmetric_dyad.Eigenvalues()};
+    const std::array<Vector<>, 3> eigenvectors{symmetric_dyad.Eigenvectors(eigenvalues)};
+    const double largest_component{LargestComponent(symmetric_dyad)};
+    for (std::size_t index = 0; index < 3; ++index) {
+      EXPECT_NEAR(eigenvectors[index].Magnitude(), 1.0, 1.0e-14);
+      const Vector<> residual{
+          symmetric_dyad * eigenvectors[index] - eigenvectors[index] * eigenvalues[index]};
+      EXPECT_LE(residual.Magnitude(), 1.0e-13 * largest_component);
+    }
+    EXPECT_NEAR(eigenvectors[0].Dot(eigenvectors[1]), 0.0, 1.0e-14);
+    EXPECT_NEAR(eigenvectors[0].Dot(eigenvectors[2]), 0.0, 1.0e-14);
+    EXPECT_NEAR(eigenvectors[1].Dot(eigenvectors[2]), 0.0, 1.0e-14);
+    EXPECT_NEAR(eigenvectors[0].Cross(eigenvectors[1]).Dot(eigenvectors[2]), 1.0, 1.0e-14);
+  }
+}
+
 TEST(SymmetricDyad, Hash) {
   {
     constexpr SymmetricDyad first{1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F};
@@ -608,6 +858,121 @@ TEST(SymmetricDyad, Inverse) {
   }
 }
 
+TEST(SymmetricDyad, InverseArray) {
+  const std::array<SymmetricDyad<>, 3> symmetric_dyads{
+      SymmetricDyad<>{64.0, 4.0, 1.0, 128.0, 8.0, 256.0},
+      SymmetricDyad<>{1.0, 2.0, 3.0, 4.0, 6.0, 9.0},
+      SymmetricDyad<>{2.0, -1.0, 0.0, 2.0, -1.0, 2.0}
+  };
+  std::array<SymmetricDyad<>, 3> inverses;
+  bool invertible[3];
+  SymmetricDyad<>::Inverse(
+      symmetric_dyads.data(), symmetric_dyads.size(), inverses.data(), invertible);
+  EXPECT_TRUE(invertible[0]);
+  EXPECT_FALSE(invertible[1]);
+  EXPECT_TRUE(invertible[2]);
+  EXPECT_EQ(inverses[0], symmetric_dyads[0].Inverse().value());
+  EXPECT_EQ(inverses[1], SymmetricDyad<>::Zero());
+  EXPECT_EQ(inverses[2], symmetric_dyads[2].Inverse().value());
+}
+
+TEST(SymmetricDyad, InverseWithTolerance) {
+  {
+    constexpr SymmetricDyad symmetric_dyad{2.0, -1.0, 0.0, 2.0, -1.0, 2.0};
+    const std::optional<SymmetricDyad<>> inverse{symmetric_dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_EQ(inverse.value(), symmetric_dyad.Inverse().value());
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{2.0e-30, -1.0e-30, 0.0, 2.0e-30, -1.0e-30, 2.0e-30};
+    const std::optional<SymmetricDyad<>> inverse{symmetric_dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_DOUBLE_EQ(inverse.value().xx(), 0.75e30);
+    EXPECT_DOUBLE_EQ(inverse.value().xy(), 0.5e30);
+    EXPECT_DOUBLE_EQ(inverse.value().yy(), 1.0e30);
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{1.0, 2.0, 3.0, 4.0, 6.0, 9.0 + 1.0e-13};
+    EXPECT_FALSE(symmetric_dyad.Inverse(1.0e-6).has_value());
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    EXPECT_FALSE(symmetric_dyad.Inverse(0.0).has_value());
+  }
+  {
+    // The squared determinant and the product of the squared magnitudes of the rows overflow.
+    constexpr SymmetricDyad symmetric_dyad{1.0e8F, 0.0F, 0.0F, 1.0e8F, 0.0F, 1.0e8F};
+    const std::optional<SymmetricDyad<float>> inverse{symmetric_dyad.Inverse(1.0e-3F)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_FLOAT_EQ(inverse.value().xx(), 1.0e-8F);
+    EXPECT_FLOAT_EQ(inverse.value().zz(), 1.0e-8F);
+    const std::optional<Vector<float>> solution{
+        symmetric_dyad.Solve(Vector<float>{1.0e8F, 2.0e8F, 3.0e8F}, 1.0e-3F)};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_FLOAT_EQ(solution.value().z(), 3.0F);
+  }
+  {
+    // The squared determinant and the product of the squared magnitudes of the rows underflow.
+    constexpr SymmetricDyad symmetric_dyad{1.0e-7F, 0.0F, 0.0F, 1.0e-7F, 0.0F, 1.0e-7F};
+    const std::optional<SymmetricDyad<float>> inverse{symmetric_dyad.Inverse(1.0e-3F)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_FLOAT_EQ(inverse.value().xx(), 1.0e7F);
+    EXPECT_FLOAT_EQ(inverse.value().zz(), 1.0e7F);
+    const std::optional<Vector<float>> solution{
+        symmetric_dyad.Solve(Vector<float>{1.0e-7F, 2.0e-7F, 3.0e-7F}, 1.0e-3F)};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_FLOAT_EQ(solution.value().z(), 3.0F);
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{1.0e8F, 2.0e8F, 3.0e8F, 4.0e8F, 6.0e8F, 9.0e8F};
+    EXPECT_FALSE(symmetric_dyad.Inverse(1.0e-3F).has_value());
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{1.0e60, 0.0, 0.0, 1.0e60, 0.0, 1.0e60};
+    const std::optional<SymmetricDyad<>> inverse{symmetric_dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_DOUBLE_EQ(inverse.value().xx(), 1.0e-60);
+    EXPECT_DOUBLE_EQ(inverse.value().zz(), 1.0e-60);
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{1.0e-60, 0.0, 0.0, 1.0e-60, 0.0, 1.0e-60};
+    const std::optional<SymmetricDyad<>> inverse{symmetric_dyad.Inverse(1.0e-6)};
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_DOUBLE_EQ(inverse.value().xx(), 1.0e60);
+    EXPECT_DOUBLE_EQ(inverse.value().zz(), 1.0e60);
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{
+        1.0e-60, 2.0e-60, 3.0e-60, 4.0e-60, 6.0e-60, 9.0e-60 + 1.0e-73};
+    EXPECT_FALSE(symmetric_dyad.Inverse(1.0e-6).has_value());
+  }
+}
+
+TEST(SymmetricDyad, J2) {
+  const SymmetricDyad<> symmetric_dyad{8.0, 2.0, 1.0, 16.0, 4.0, 32.0};
+  const SymmetricDyad<> deviatoric{symmetric_dyad.Deviatoric()};
+  EXPECT_DOUBLE_EQ(symmetric_dyad.J2(), 511.0 / 3.0);
+  EXPECT_DOUBLE_EQ(
+      symmetric_dyad.J2(),
+      0.5
+          * (deviatoric.xx() * deviatoric.xx() + deviatoric.yy() * deviatoric.yy()
+             + deviatoric.zz() * deviatoric.zz()
+             + 2.0
+                   * (deviatoric.xy() * deviatoric.xy() + deviatoric.xz() * deviatoric.xz()
+                      + deviatoric.yz() * deviatoric.yz())));
+  EXPECT_FLOAT_EQ(SymmetricDyad(8.0F, 2.0F, 1.0F, 16.0F, 4.0F, 32.0F).J2(), 511.0F / 3.0F);
+  EXPECT_DOUBLE_EQ(
+      static_cast<double>(SymmetricDyad(8.0L, 2.0L, 1.0L, 16.0L, 4.0L, 32.0L).J2()), 511.0 / 3.0);
+  EXPECT_EQ(SymmetricDyad(2.0, 0.0, 0.0, 2.0, 0.0, 2.0).J2(), 0.0);
+}
+
+TEST(SymmetricDyad, J3) {
+  const SymmetricDyad<> symmetric_dyad{8.0, 2.0, 1.0, 16.0, 4.0, 32.0};
+  EXPECT_DOUBLE_EQ(symmetric_dyad.J3(), symmetric_dyad.Deviatoric().Determinant());
+  EXPECT_EQ(SymmetricDyad(2.0, 0.0, 0.0, 2.0, 0.0, 2.0).J3(), 0.0);
+  EXPECT_DOUBLE_EQ(SymmetricDyad(3.0, 0.0, 0.0, 0.0, 0.0, 0.0).J3(), 2.0 * -1.0 * -1.0);
+}
+
 TEST(SymmetricDyad, JSON) {
   EXPECT_EQ(
       SymmetricDyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F).JSON(),
@@ -867,6 +1232,68 @@ TEST(SymmetricDyad, SizeOf) {
   EXPECT_EQ(sizeof(SymmetricDyad<long double>{}), 6 * sizeof(long double));
 }
 
+TEST(SymmetricDyad, Solve) {
+  {
+    constexpr SymmetricDyad symmetric_dyad{64.0F, 4.0F, 1.0F, 128.0F, 8.0F, 256.0F};
+    const std::optional<Vector<float>> solution{
+        symmetric_dyad.Solve(symmetric_dyad * Vector{1.0F, -2.0F, 3.0F})};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_NEAR(solution.value().x(), 1.0F, 1.0E-5F);
+    EXPECT_NEAR(solution.value().y(), -2.0F, 1.0E-5F);
+    EXPECT_NEAR(solution.value().z(), 3.0F, 1.0E-5F);
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{64.0, 4.0, 1.0, 128.0, 8.0, 256.0};
+    const std::optional<Vector<>> solution{
+        symmetric_dyad.Solve(symmetric_dyad * Vector{1.0, -2.0, 3.0})};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_DOUBLE_EQ(solution.value().x(), 1.0);
+    EXPECT_DOUBLE_EQ(solution.value().y(), -2.0);
+    EXPECT_DOUBLE_EQ(solution.value().z(), 3.0);
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{64.0L, 4.0L, 1.0L, 128.0L, 8.0L, 256.0L};
+    const std::optional<Vector<long double>> solution{
+        symmetric_dyad.Solve(symmetric_dyad * Vector{1.0L, -2.0L, 3.0L})};
+    ASSERT_TRUE(solution.has_value());
+    EXPECT_DOUBLE_EQ(solution.value().x(), 1.0L);
+    EXPECT_DOUBLE_EQ(solution.value().y(), -2.0L);
+    EXPECT_DOUBLE_EQ(solution.value().z(), 3.0L);
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{1.0, 2.0, 3.0, 4.0, 6.0, 9.0 + 1.0e-13};
+    EXPECT_FALSE(symmetric_dyad.Solve(Vector{1.0, 2.0, 3.0}).has_value());
+  }
+  {
+    constexpr SymmetricDyad symmetric_dyad{0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    EXPECT_FALSE(symmetric_dyad.Solve(Vector{1.0, 2.0, 3.0}).has_value());
+  }
+}
+
+TEST(SymmetricDyad, SolveArray) {
+  const std::array<SymmetricDyad<>, 3> symmetric_dyads{
+      SymmetricDyad<>{64.0, 4.0, 1.0, 128.0, 8.0, 256.0},
+      SymmetricDyad<>{1.0, 2.0, 3.0, 4.0, 6.0, 9.0},
+      SymmetricDyad<>{2.0, -1.0, 0.0, 2.0, -1.0, 2.0}
+  };
+  const std::array<Vector<>, 3> vectors{
+      Vector<>{1.0, -2.0, 3.0}, Vector<>{4.0, 5.0, -6.0}, Vector<>{-7.0, 8.0, 9.0}};
+  std::array<Vector<>, 3> solutions;
+  bool solved[3];
+  SymmetricDyad<>::Solve(symmetric_dyads.data(), vectors.data(), symmetric_dyads.size(),
+                         solutions.data(), solved);
+  EXPECT_TRUE(solved[0]);
+  EXPECT_FALSE(solved[1]);
+  EXPECT_TRUE(solved[2]);
+  EXPECT_DOUBLE_EQ(solutions[0].x(), symmetric_dyads[0].Solve(vectors[0]).value().x());
+  EXPECT_DOUBLE_EQ(solutions[0].y(), symmetric_dyads[0].Solve(vectors[0]).value().y());
+  EXPECT_DOUBLE_EQ(solutions[0].z(), symmetric_dyads[0].Solve(vectors[0]).value().z());
+  EXPECT_EQ(solutions[1], Vector<>::Zero());
+  EXPECT_DOUBLE_EQ(solutions[2].x(), symmetric_dyads[2].Solve(vectors[2]).value().x());
+  EXPECT_DOUBLE_EQ(solutions[2].y(), symmetric_dyads[2].Solve(vectors[2]).value().y());
+  EXPECT_DOUBLE_EQ(solutions[2].z(), symmetric_dyads[2].Solve(vectors[2]).value().z());
+}
+
 TEST(SymmetricDyad, Stream) {
   {
     std::ostringstream stream;
@@ -25,7 +25,13 @@
 #ifndef PHYSICAL_QUANTITIES_TEST_UNIT_HPP
 #define PHYSICAL_QUANTITIES_TEST_UNIT_HPP
 
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <gtest/gtest.h>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "../include/PhQ/Dyad.hpp"
 #include "../include/PhQ/PlanarVector.hpp"
@@ -964,6 +970,151 @@ void TestConvert(const Unit first_unit, const Unit second_unit, const long doubl
     EXPECT_DOUBLE_EQ(copied_converted_dyad.zy(), static_cast<long double>(first_value));
     EXPECT_DOUBLE_EQ(copied_converted_dyad.zz(), static_cast<long double>(first_value));
   }
+
+  // PhQ::ConvertInPlace(std::vector<PhQ::PlanarVector<float>>)
+  {
+    std::vector<PhQ::PlanarVector<float>> converted_planar_vectors(
+        2, PhQ::PlanarVector<float>{
+             static_cast<float>(first_value), static_cast<float>(first_value)});
+    PhQ::ConvertInPlace(converted_planar_vectors, first_unit, second_unit);
+    for (const PhQ::PlanarVector<float>& converted_planar_vector : converted_planar_vectors) {
+      EXPECT_FLOAT_EQ(converted_planar_vector.x(), static_cast<float>(second_value));
+      EXPECT_FLOAT_EQ(converted_planar_vector.y(), static_cast<float>(second_value));
+    }
+  }
+
+  // PhQ::Convert(std::vector<PhQ::Vector<double>>)
+  {
+    const std::vector<PhQ::Vector<double>> copied_converted_vectors{PhQ::Convert(
+        std::vector<PhQ::Vector<double>>(
+            3, PhQ::Vector<double>{static_cast<double>(second_value),
+                                   static_cast<double>(second_value),
+                                   static_cast<double>(second_value)}),
+        second_unit, first_unit)};
+    ASSERT_EQ(copied_converted_vectors.size(), 3U);
+    for (const PhQ::Vector<double>& copied_converted_vector : copied_converted_vectors) {
+      EXPECT_DOUBLE_EQ(copied_converted_vector.x(), static_cast<double>(first_value));
+      EXPECT_DOUBLE_EQ(copied_converted_vector.y(), static_cast<double>(first_value));
+      EXPECT_DOUBLE_EQ(copied_converted_vector.z(), static_cast<double>(first_value));
+    }
+  }
+
+  // PhQ::ConvertInPlace(PhQ::SymmetricDyad<double>*, std::size_t)
+  {
+    std::array<PhQ::SymmetricDyad<double>, 3> converted_symmetric_dyads;
+    converted_symmetric_dyads.fill(PhQ::SymmetricDyad<double>{
+      static_cast<double>(first_value), static_cast<double>(first_value),
+      static_cast<double>(first_value), static_cast<double>(first_value),
+      static_cast<double>(first_value), static_cast<double>(first_value)});
+    PhQ::ConvertInPlace(converted_symmetric_dyads.data(), 2, first_unit, second_unit);
+    for (std::size_t index = 0; index < 2; ++index) {
+      for (const double component : converted_symmetric_dyads[index].xx_xy_xz_yy_yz_zz()) {
+        EXPECT_DOUBLE_EQ(component, static_cast<double>(second_value));
+      }
+    }
+    for (const double component : converted_symmetric_dyads[2].xx_xy_xz_yy_yz_zz()) {
+      EXPECT_DOUBLE_EQ(component, static_cast<double>(first_value));
+    }
+  }
+
+  // PhQ::ConvertInPlace(std::vector<PhQ::Dyad<long double>>)
+  {
+    std::vector<PhQ::Dyad<long double>> converted_dyads(
+        2, PhQ::Dyad<long double>{
+             static_cast<long double>(second_value), static_cast<long double>(second_value),
+             static_cast<long double>(second_value), static_cast<long double>(second_value),
+             static_cast<long double>(second_value), static_cast<long double>(second_value),
+             static_cast<long double>(second_value), static_cast<long double>(second_value),
+             static_cast<long double>(second_value)});
+    PhQ::ConvertInPlace(converted_dyads, second_unit, first_unit);
+    for (const PhQ::Dyad<long double>& converted_dyad : converted_dyads) {
+      for (const long double component : converted_dyad.xx_xy_xz_yx_yy_yz_zx_zy_zz()) {
+        EXPECT_DOUBLE_EQ(component, static_cast<long double>(first_value));
+      }
+    }
+  }
+
+  // PhQ::ConvertInPlace(std::array<double*, 3>, std::size_t)
+  {
+    std::vector<double> x(2, static_cast<double>(first_value));
+    std::vector<double> y(2, static_cast<double>(first_value));
+    std::vector<double> z(2, static_cast<double>(first_value));
+    PhQ::ConvertInPlace<Unit, 3, double>(
+        {x.data(), y.data(), z.data()}, 2, first_unit, second_unit);
+    for (const std::vector<double>& component : {x, y, z}) {
+      EXPECT_DOUBLE_EQ(component[0], static_cast<double>(second_value));
+      EXPECT_DOUBLE_EQ(component[1], static_cast<double>(second_value));
+    }
+  }
+
+  // PhQ::ConvertInPlace(std::array<std::vector<float>, 2>)
+  {
+    std::array<std::vector<float>, 2> converted_components{
+      std::vector<float>(1, static_cast<float>(second_value)),
+      std::vector<float>(3, static_cast<float>(second_value))};
+    PhQ::ConvertInPlace(converted_components, second_unit, first_unit);
+    for (const std::vector<float>& converted_component : converted_components) {
+      for (const float value : converted_component) {
+        EXPECT_FLOAT_EQ(value, static_cast<float>(first_value));
+      }
+    }
+  }
+
+  // PhQ::UnitConversion<float>
+  {
+    const PhQ::UnitConversion<Unit, float> conversion{first_unit, second_unit};
+    EXPECT_EQ(conversion.OriginalUnit(), first_unit);
+    EXPECT_EQ(conversion.NewUnit(), second_unit);
+    EXPECT_FLOAT_EQ(
+        conversion.Convert(static_cast<float>(first_value)), static_cast<float>(second_value));
+    std::vector<float> converted_std_vector{
+      static_cast<float>(first_value), static_cast<float>(first_value),
+      static_cast<float>(first_value)};
+    conversion.ConvertInPlace(converted_std_vector);
+    EXPECT_FLOAT_EQ(converted_std_vector[0], static_cast<float>(second_value));
+    EXPECT_FLOAT_EQ(converted_std_vector[1], static_cast<float>(second_value));
+    EXPECT_FLOAT_EQ(converted_std_vector[2], static_cast<float>(second_value));
+  }
+
+  // PhQ::UnitConversion<double>
+  {
+    const PhQ::UnitConversion<Unit, double> conversion{second_unit, first_unit};
+    EXPECT_DOUBLE_EQ(
+        conversion.Convert(static_cast<double>(second_value)), static_cast<double>(first_value));
+    std::array<double, 3> converted_array{
+      static_cast<double>(second_value), static_cast<double>(second_value),
+      static_cast<double>(second_value)};
+    conversion.ConvertInPlace(converted_array);
+    EXPECT_DOUBLE_EQ(converted_array[0], static_cast<double>(first_value));
+    EXPECT_DOUBLE_EQ(converted_array[1], static_cast<double>(first_value));
+    EXPECT_DOUBLE_EQ(converted_array[2], static_cast<double>(first_value));
+    std::vector<PhQ::SymmetricDyad<double>> converted_symmetric_dyads(
+        2, PhQ::SymmetricDyad<double>{
+             static_cast<double>(second_value), static_cast<double>(second_value),
+             static_cast<double>(second_value), static_cast<double>(second_value),
+             static_cast<double>(second_value), static_cast<double>(second_value)});
+    conversion.ConvertInPlace(converted_symmetric_dyads);
+    for (const PhQ::SymmetricDyad<double>& converted_symmetric_dyad : converted_symmetric_dyads) {
+      for (const double component : converted_symmetric_dyad.xx_xy_xz_yy_yz_zz()) {
+        EXPECT_DOUBLE_EQ(component, static_cast<double>(first_value));
+      }
+    }
+    std::vector<double> x(2, static_cast<double>(second_value));
+    std::vector<double> y(2, static_cast<double>(second_value));
+    conversion.ConvertInPlace(std::array<double*, 2>{x.data(), y.data()}, 2);
+    for (const std::vector<double>& component : {x, y}) {
+      EXPECT_DOUBLE_EQ(component[0], static_cast<double>(first_value));
+      EXPECT_DOUBLE_EQ(component[1], static_cast<double>(first_value));
+    }
+  }
+
+  // PhQ::UnitConversion<long double>
+  {
+    const PhQ::UnitConversion<Unit, long double> conversion{first_unit, second_unit};
+    long double converted_value{static_cast<long double>(first_value)};
+    conversion.ConvertInPlace(converted_value);
+    EXPECT_DOUBLE_EQ(converted_value, static_cast<long double>(second_value));
+  }
 }
 
 /// \brief Tests the PhQ::ConvertStatically unit conversion functions for a given unit of measure.
@@ -1181,6 +1332,168 @@ void TestConvertStatically(const long double original_value, const long double n
   }
 }
 
+/// \brief Values at which the tables of conversions are tested: both signs, zero, and several
+/// orders of magnitude, small enough that no conversion between two units of measure overflows.
+template <typename NumericType>
+inline constexpr std::array<NumericType, 8> TableOfConversionsTestValues{
+  static_cast<NumericType>(1.234567890123456789L), static_cast<NumericType>(-9.87654321L),
+  static_cast<NumericType>(0.0L),                  static_cast<NumericType>(3.0e-3L),
+  static_cast<NumericType>(-271.828182845904523L), static_cast<NumericType>(456.0L),
+  static_cast<NumericType>(-7.0e-2L),              static_cast<NumericType>(1.0e3L)};
+
+/// \brief Tests that a linear conversion applied to a sequence of values yields bitwise identical
+/// results to given expected values. The test values are repeated over a sequence long enough to be
+/// processed by the vectorized kernels, including their remainder handling.
+template <typename NumericType>
+void TestLinearConversion(const LinearConversion<NumericType>& linear_conversion,
+                          const std::array<NumericType, 8>& expected) {
+  constexpr std::array<NumericType, 8> values{TableOfConversionsTestValues<NumericType>};
+  std::vector<NumericType> converted(2 * VectorizationThreshold + 3);
+  for (std::size_t index = 0; index < converted.size(); ++index) {
+    converted[index] = values[index % values.size()];
+  }
+  linear_conversion.Apply(converted.data(), converted.size());
+  for (std::size_t index = 0; index < converted.size(); ++index) {
+    EXPECT_EQ(converted[index], expected[index % expected.size()]);
+    EXPECT_EQ(std::signbit(converted[index]), std::signbit(expected[index % expected.size()]));
+  }
+}
+
+/// \brief Evaluates the conversion of a given value from the standard unit of measure of a given
+/// unit type to a given unit of measure of that type with the PhQ::Internal::Conversion
+/// specialization.
+template <typename Unit, Unit UnitValue, typename NumericType>
+constexpr NumericType EvaluateFromStandard(NumericType value) noexcept {
+  Conversion<Unit, UnitValue>::FromStandard(value);
+  return value;
+}
+
+/// \brief Evaluates the conversion of a given value from a given unit of measure of a given unit
+/// type to the standard unit of measure of that type with the PhQ::Internal::Conversion
+/// specialization.
+template <typename Unit, Unit UnitValue, typename NumericType>
+constexpr NumericType EvaluateToStandard(NumericType value) noexcept {
+  Conversion<Unit, UnitValue>::ToStandard(value);
+  return value;
+}
+
+/// \brief Evaluates a given scalar conversion function at each of the test values.
+template <typename NumericType>
+constexpr std::array<NumericType, 8> EvaluateAtTestValues(
+    NumericType (*const function)(NumericType) noexcept) {
+  std::array<NumericType, 8> results{};
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    results[index] = function(TableOfConversionsTestValues<NumericType>[index]);
+  }
+  return results;
+}
+
+/// \brief Determines at compile time whether the conversions of the test values from every unit of
+/// measure of a given type to every unit of measure of that type remain within the range of a given
+/// floating-point numeric type. Some pairs of units of measure differ by so many orders of
+/// magnitude that their conversions overflow single-precision numbers. The result is indexed by the
+/// original unit and then by the new unit.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+constexpr std::array<std::array<bool, sizeof...(Indices)>, sizeof...(Indices)> AreWithinRange(
+    std::index_sequence<Indices...> /*indices*/) {
+  constexpr std::array<long double (*)(long double) noexcept, sizeof...(Indices)> to_standard{
+    EvaluateToStandard<Unit, static_cast<Unit>(Indices), long double>...};
+  constexpr std::array<long double (*)(long double) noexcept, sizeof...(Indices)> from_standard{
+    EvaluateFromStandard<Unit, static_cast<Unit>(Indices), long double>...};
+  constexpr long double limit{static_cast<long double>(std::numeric_limits<NumericType>::max())
+                              / 2.0L};
+  std::array<std::array<bool, sizeof...(Indices)>, sizeof...(Indices)> within_range{};
+  for (std::size_t original = 0; original < sizeof...(Indices); ++original) {
+    for (std::size_t updated = 0; updated < sizeof...(Indices); ++updated) {
+      within_range[original][updated] = true;
+      for (const NumericType value : TableOfConversionsTestValues<NumericType>) {
+        const long double standard{to_standard[original](static_cast<long double>(value))};
+        const long double converted{from_standard[updated](standard)};
+        if (standard > limit || standard < -limit || converted > limit || converted < -limit) {
+          within_range[original][updated] = false;
+        }
+      }
+    }
+  }
+  return within_range;
+}
+
+/// \brief Evaluates at compile time the conversions of the test values from every unit of measure
+/// of a given type to every unit of measure of that type with the PhQ::Internal::Conversion
+/// specializations, in the same order of operations as PhQ::ConvertStatically. Conversions that
+/// would overflow are left as zero. The result is indexed by the original unit, then by the new
+/// unit, and then by the test value.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+constexpr std::array<std::array<std::array<NumericType, 8>, sizeof...(Indices)>,
+                     sizeof...(Indices)>
+EvaluateConversions(std::index_sequence<Indices...> indices) {
+  constexpr std::array<NumericType (*)(NumericType) noexcept, sizeof...(Indices)> to_standard{
+    EvaluateToStandard<Unit, static_cast<Unit>(Indices), NumericType>...};
+  constexpr std::array<NumericType (*)(NumericType) noexcept, sizeof...(Indices)> from_standard{
+    EvaluateFromStandard<Unit, static_cast<Unit>(Indices), NumericType>...};
+  constexpr std::array<std::array<bool, sizeof...(Indices)>, sizeof...(Indices)> within_range{
+    AreWithinRange<Unit, NumericType>(indices)};
+  std::array<std::array<std::array<NumericType, 8>, sizeof...(Indices)>, sizeof...(Indices)>
+      conversions{};
+  for (std::size_t original = 0; original < sizeof...(Indices); ++original) {
+    for (std::size_t updated = 0; updated < sizeof...(Indices); ++updated) {
+      if (within_range[original][updated]) {
+        for (std::size_t index = 0; index < 8; ++index) {
+          const NumericType value{TableOfConversionsTestValues<NumericType>[index]};
+          conversions[original][updated][index] =
+              original == updated ? value : from_standard[updated](to_standard[original](value));
+        }
+      }
+    }
+  }
+  return conversions;
+}
+
+/// \brief Tests the dense tables of conversions for every unit of measure of a given type. Verifies
+/// that the conversion steps to and from the standard unit of measure, and the conversions between
+/// every pair of units of measure that do not overflow, yield bitwise identical results to the
+/// PhQ::Internal::Conversion specializations evaluated at compile time.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+void TestTableOfConversions(std::index_sequence<Indices...> indices) {
+  constexpr std::array<std::array<NumericType, 8>, sizeof...(Indices)> to_standard{
+    EvaluateAtTestValues<NumericType>(
+        EvaluateToStandard<Unit, static_cast<Unit>(Indices), NumericType>)...};
+  constexpr std::array<std::array<NumericType, 8>, sizeof...(Indices)> from_standard{
+    EvaluateAtTestValues<NumericType>(
+        EvaluateFromStandard<Unit, static_cast<Unit>(Indices), NumericType>)...};
+  constexpr std::array<std::array<bool, sizeof...(Indices)>, sizeof...(Indices)> within_range{
+    AreWithinRange<Unit, NumericType>(indices)};
+  constexpr std::array<std::array<std::array<NumericType, 8>, sizeof...(Indices)>,
+                       sizeof...(Indices)>
+      conversions{EvaluateConversions<Unit, NumericType>(indices)};
+  const ConversionStep<NumericType> identity{ConversionStep<NumericType>::Identity()};
+  for (std::size_t original = 0; original < sizeof...(Indices); ++original) {
+    TestLinearConversion<NumericType>(
+        {TableOfConversionsToStandard<Unit, NumericType>[original], identity},
+        to_standard[original]);
+    TestLinearConversion<NumericType>(
+        {identity, TableOfConversionsFromStandard<Unit, NumericType>[original]},
+        from_standard[original]);
+    for (std::size_t updated = 0; updated < sizeof...(Indices); ++updated) {
+      if (within_range[original][updated]) {
+        TestLinearConversion(
+            MakeLinearConversion<Unit, NumericType>(
+                static_cast<Unit>(original), static_cast<Unit>(updated)),
+            conversions[original][updated]);
+      }
+    }
+  }
+}
+
+/// \brief Tests the dense tables of conversions for every unit of measure of a given type and for
+/// every floating-point numeric type.
+template <typename Unit>
+void TestTableOfConversions() {
+  TestTableOfConversions<Unit, float>(std::make_index_sequence<NumberOfUnits<Unit>>());
+  TestTableOfConversions<Unit, double>(std::make_index_sequence<NumberOfUnits<Unit>>());
+  TestTableOfConversions<Unit, long double>(std::make_index_sequence<NumberOfUnits<Unit>>());
+}
+
 }  // namespace PhQ::Internal
 
 #endif  // PHYSICAL_QUANTITIES_TEST_UNIT_HPP
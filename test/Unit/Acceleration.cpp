@@ -359,6 +359,10 @@ TEST(UnitAcceleration, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Acceleration::MetrePerSquareSecond));
 }
 
+TEST(UnitAcceleration, TableOfConversions) {
+  Internal::TestTableOfConversions<Acceleration>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
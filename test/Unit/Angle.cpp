@@ -107,6 +107,10 @@ TEST(UnitAngle, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Angle::Radian));
 }
 
+TEST(UnitAngle, TableOfConversions) {
+  Internal::TestTableOfConversions<Angle>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
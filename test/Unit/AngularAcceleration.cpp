@@ -204,6 +204,10 @@ TEST(UnitAngularAcceleration, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(AngularAcceleration::RadianPerSquareSecond));
 }
 
+TEST(UnitAngularAcceleration, TableOfConversions) {
+  Internal::TestTableOfConversions<AngularAcceleration>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
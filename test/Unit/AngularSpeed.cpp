@@ -181,6 +181,10 @@ TEST(UnitAngularSpeed, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(AngularSpeed::RadianPerSecond));
 }
 
+TEST(UnitAngularSpeed, TableOfConversions) {
+  Internal::TestTableOfConversions<AngularSpeed>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
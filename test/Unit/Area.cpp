@@ -176,6 +176,10 @@ TEST(UnitArea, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Area::SquareMetre));
 }
 
+TEST(UnitArea, TableOfConversions) {
+  Internal::TestTableOfConversions<Area>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -199,6 +199,10 @@ TEST(UnitDiffusivity, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Diffusivity::SquareMetrePerSecond));
 }
 
+TEST(UnitDiffusivity, TableOfConversions) {
+  Internal::TestTableOfConversions<Diffusivity>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
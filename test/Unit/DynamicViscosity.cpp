@@ -142,6 +142,10 @@ TEST(UnitDynamicViscosity, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(DynamicViscosity::PascalSecond));
 }
 
+TEST(UnitDynamicViscosity, TableOfConversions) {
+  Internal::TestTableOfConversions<DynamicViscosity>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
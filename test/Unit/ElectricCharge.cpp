@@ -228,6 +228,10 @@ TEST(UnitAngle, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(ElectricCharge::Coulomb));
 }
 
+TEST(UnitAngle, TableOfConversions) {
+  Internal::TestTableOfConversions<ElectricCharge>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -159,6 +159,10 @@ TEST(UnitAngle, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(ElectricCurrent::Ampere));
 }
 
+TEST(UnitAngle, TableOfConversions) {
+  Internal::TestTableOfConversions<ElectricCurrent>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
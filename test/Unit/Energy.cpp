@@ -252,6 +252,10 @@ TEST(UnitEnergy, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Energy::Joule));
 }
 
+TEST(UnitEnergy, TableOfConversions) {
+  Internal::TestTableOfConversions<Energy>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -126,6 +126,10 @@ TEST(UnitEnergyFlux, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(EnergyFlux::WattPerSquareMetre));
 }
 
+TEST(UnitEnergyFlux, TableOfConversions) {
+  Internal::TestTableOfConversions<EnergyFlux>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -127,6 +127,10 @@ TEST(UnitForce, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Force::Newton));
 }
 
+TEST(UnitForce, TableOfConversions) {
+  Internal::TestTableOfConversions<Force>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -112,6 +112,10 @@ TEST(UnitFrequency, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Frequency::Hertz));
 }
 
+TEST(UnitFrequency, TableOfConversions) {
+  Internal::TestTableOfConversions<Frequency>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -124,6 +124,10 @@ TEST(UnitHeatCapacity, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(HeatCapacity::JoulePerKelvin));
 }
 
+TEST(UnitHeatCapacity, TableOfConversions) {
+  Internal::TestTableOfConversions<HeatCapacity>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -85,6 +85,8 @@ TEST(UnitLength, Convert) {
   Internal::TestConvert<Length>(Length::Metre, Length::Milliinch, value, value / 0.0000254L);
   Internal::TestConvert<Length>(Length::Metre, Length::Micrometre, value, value * 1000000.0L);
   Internal::TestConvert<Length>(Length::Metre, Length::Microinch, value, value / 0.0000000254L);
+  Internal::TestConvert<Length>(Length::Foot, Length::Millimetre, value, value * 304.8L);
+  Internal::TestConvert<Length>(Length::Mile, Length::Kilometre, value, value * 1.609344L);
 }
 
 TEST(UnitLength, ConvertStatically) {
@@ -107,6 +109,13 @@ TEST(UnitLength, ParseEnumeration) {
   EXPECT_EQ(ParseEnumeration<Length>("mil"), Length::Milliinch);
   EXPECT_EQ(ParseEnumeration<Length>("μm"), Length::Micrometre);
   EXPECT_EQ(ParseEnumeration<Length>("μin"), Length::Microinch);
+  EXPECT_EQ(ParseEnumeration<Length>("millimetres"), Length::Millimetre);
+  EXPECT_EQ(ParseEnumeration<Length>("thou"), Length::Milliinch);
+  EXPECT_EQ(ParseEnumeration<Length>("NM"), Length::NauticalMile);
+  EXPECT_EQ(ParseEnumeration<Length>("nautical miles"), Length::NauticalMile);
+  EXPECT_EQ(ParseEnumeration<Length>("nm"), std::nullopt);
+  EXPECT_EQ(ParseEnumeration<Length>(""), std::nullopt);
+  static_assert(ParseEnumeration<Length>("ft") == Length::Foot);
 }
 
 TEST(UnitLength, RelatedDimensions) {
@@ -142,6 +151,10 @@ TEST(UnitLength, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Length::Metre));
 }
 
+TEST(UnitLength, TableOfConversions) {
+  Internal::TestTableOfConversions<Length>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -111,6 +111,10 @@ TEST(UnitMass, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Mass::Kilogram));
 }
 
+TEST(UnitMass, TableOfConversions) {
+  Internal::TestTableOfConversions<Mass>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
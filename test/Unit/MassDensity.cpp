@@ -133,6 +133,10 @@ TEST(UnitMassDensity, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(MassDensity::KilogramPerCubicMetre));
 }
 
+TEST(UnitMassDensity, TableOfConversions) {
+  Internal::TestTableOfConversions<MassDensity>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
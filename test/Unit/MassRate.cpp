@@ -171,6 +171,10 @@ TEST(UnitMassRate, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(MassRate::KilogramPerSecond));
 }
 
+TEST(UnitMassRate, TableOfConversions) {
+  Internal::TestTableOfConversions<MassRate>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -184,6 +184,10 @@ TEST(UnitMemory, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Memory::Bit));
 }
 
+TEST(UnitMemory, TableOfConversions) {
+  Internal::TestTableOfConversions<Memory>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
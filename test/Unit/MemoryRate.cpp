@@ -444,6 +444,10 @@ TEST(UnitMemoryRate, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(MemoryRate::BitPerSecond));
 }
 
+TEST(UnitMemoryRate, TableOfConversions) {
+  Internal::TestTableOfConversions<MemoryRate>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
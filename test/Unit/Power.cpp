@@ -129,6 +129,10 @@ TEST(UnitPower, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Power::Watt));
 }
 
+TEST(UnitPower, TableOfConversions) {
+  Internal::TestTableOfConversions<Power>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -134,6 +134,10 @@ TEST(UnitPressure, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Pressure::Pascal));
 }
 
+TEST(UnitPressure, TableOfConversions) {
+  Internal::TestTableOfConversions<Pressure>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -118,6 +118,10 @@ TEST(UnitThermalExpansion, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(ReciprocalTemperature::PerKelvin));
 }
 
+TEST(UnitThermalExpansion, TableOfConversions) {
+  Internal::TestTableOfConversions<ReciprocalTemperature>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -109,6 +109,10 @@ TEST(UnitAngle, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(SolidAngle::Steradian));
 }
 
+TEST(UnitAngle, TableOfConversions) {
+  Internal::TestTableOfConversions<SolidAngle>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
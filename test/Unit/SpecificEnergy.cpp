@@ -124,6 +124,10 @@ TEST(UnitSpecificEnergy, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(SpecificEnergy::JoulePerKilogram));
 }
 
+TEST(UnitSpecificEnergy, TableOfConversions) {
+  Internal::TestTableOfConversions<SpecificEnergy>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -135,6 +135,10 @@ TEST(UnitSpecificHeatCapacity, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(SpecificHeatCapacity::JoulePerKilogramPerKelvin));
 }
 
+TEST(UnitSpecificHeatCapacity, TableOfConversions) {
+  Internal::TestTableOfConversions<SpecificHeatCapacity>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -125,6 +125,10 @@ TEST(UnitSpecificPower, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(SpecificPower::WattPerKilogram));
 }
 
+TEST(UnitSpecificPower, TableOfConversions) {
+  Internal::TestTableOfConversions<SpecificPower>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -290,6 +290,10 @@ TEST(UnitSpeed, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Speed::MetrePerSecond));
 }
 
+TEST(UnitSpeed, TableOfConversions) {
+  Internal::TestTableOfConversions<Speed>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -123,6 +123,10 @@ TEST(UnitSubstanceAmount, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(SubstanceAmount::Mole));
 }
 
+TEST(UnitSubstanceAmount, TableOfConversions) {
+  Internal::TestTableOfConversions<SubstanceAmount>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
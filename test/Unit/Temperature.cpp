@@ -75,6 +75,8 @@ TEST(UnitTemperature, Convert) {
       Temperature::Kelvin, Temperature::Rankine, value, value * 1.8L);
   Internal::TestConvert<Temperature>(
       Temperature::Kelvin, Temperature::Fahrenheit, value, (value * 1.8L) - 459.67L);
+  Internal::TestConvert<Temperature>(
+      Temperature::Celsius, Temperature::Rankine, value, (value + 273.15L) * 1.8L);
 }
 
 TEST(UnitTemperature, ConvertStatically) {
@@ -115,6 +117,10 @@ TEST(UnitTemperature, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Temperature::Kelvin));
 }
 
+TEST(UnitTemperature, TableOfConversions) {
+  Internal::TestTableOfConversions<Temperature>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
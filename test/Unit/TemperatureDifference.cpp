@@ -118,6 +118,10 @@ TEST(UnitTemperatureDifference, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(TemperatureDifference::Kelvin));
 }
 
+TEST(UnitTemperatureDifference, TableOfConversions) {
+  Internal::TestTableOfConversions<TemperatureDifference>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -151,6 +151,10 @@ TEST(UnitTemperatureGradient, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(TemperatureGradient::KelvinPerMetre));
 }
 
+TEST(UnitTemperatureGradient, TableOfConversions) {
+  Internal::TestTableOfConversions<TemperatureGradient>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
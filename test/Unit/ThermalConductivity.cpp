@@ -121,6 +121,10 @@ TEST(UnitThermalConductivity, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(ThermalConductivity::WattPerMetrePerKelvin));
 }
 
+TEST(UnitThermalConductivity, TableOfConversions) {
+  Internal::TestTableOfConversions<ThermalConductivity>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -110,6 +110,10 @@ TEST(UnitTime, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Time::Second));
 }
 
+TEST(UnitTime, TableOfConversions) {
+  Internal::TestTableOfConversions<Time>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
@@ -253,6 +253,10 @@ TEST(UnitTransportEnergyConsumption, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(TransportEnergyConsumption::JoulePerMetre));
 }
 
+TEST(UnitTransportEnergyConsumption, TableOfConversions) {
+  Internal::TestTableOfConversions<TransportEnergyConsumption>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
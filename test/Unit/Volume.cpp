@@ -168,6 +168,10 @@ TEST(UnitVolume, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(Volume::CubicMetre));
 }
 
+TEST(UnitVolume, TableOfConversions) {
+  Internal::TestTableOfConversions<Volume>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
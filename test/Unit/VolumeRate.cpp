@@ -391,6 +391,10 @@ TEST(UnitVolumeRate, Stream) {
   EXPECT_EQ(stream.str(), Abbreviation(VolumeRate::CubicMetrePerSecond));
 }
 
+TEST(UnitVolumeRate, TableOfConversions) {
+  Internal::TestTableOfConversions<VolumeRate>();
+}
+
 }  // namespace
 
 }  // namespace PhQ::Unit
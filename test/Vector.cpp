@@ -28,6 +28,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Base.hpp"
@@ -37,6 +38,25 @@ namespace PhQ {
 
 namespace {
 
+TEST(Vector, Append) {
+  const Vector first(1.0, -2.0, 3.0);
+  const Vector second(first * 0.5);
+  std::string buffer{"["};
+  first.AppendPrint(buffer);
+  buffer.push_back(',');
+  second.AppendPrint(buffer);
+  EXPECT_EQ(buffer, "[" + first.Print() + "," + second.Print());
+  buffer.clear();
+  first.AppendJSON(buffer);
+  EXPECT_EQ(buffer, first.JSON());
+  buffer.clear();
+  first.AppendXML(buffer);
+  EXPECT_EQ(buffer, first.XML());
+  buffer.clear();
+  first.AppendYAML(buffer);
+  EXPECT_EQ(buffer, first.YAML());
+}
+
 TEST(Vector, ArithmeticOperatorAddition) {
   EXPECT_EQ(Vector(1.0F, -2.0F, 3.0F) + Vector(2.0F, -4.0F, 6.0F), Vector(3.0F, -6.0F, 9.0F));
   EXPECT_EQ(Vector(1.0, -2.0, 3.0) + Vector(2.0, -4.0, 6.0), Vector(3.0, -6.0, 9.0));
@@ -0,0 +1,265 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Vectorization.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "../include/PhQ/Unit.hpp"
+#include "../include/PhQ/Unit/Energy.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Unit/Temperature.hpp"
+#include "Performance.hpp"
+
+namespace PhQ::Internal {
+
+namespace {
+
+constexpr std::array<InstructionSet, 4> InstructionSets{
+  InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512};
+
+/// \brief Returns whether the processor on which the tests run supports a given instruction set.
+bool IsSupported(const InstructionSet instruction_set) {
+  return static_cast<int>(instruction_set) <= static_cast<int>(SupportedInstructionSet());
+}
+
+/// \brief Returns a sequence of distinct values of a given size.
+template <typename NumericType>
+std::vector<NumericType> Values(const std::size_t size) {
+  std::vector<NumericType> values(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    values[index] = static_cast<NumericType>(1.234567890123456789L)
+                    * static_cast<NumericType>(static_cast<long double>(index) - 17.0L);
+  }
+  return values;
+}
+
+/// \brief Verifies that every supported instruction set divides sequences of every length from zero
+/// to a few vector widths exactly like the portable scalar code.
+template <typename NumericType>
+void TestDivideInPlace() {
+  const NumericType divisor{static_cast<NumericType>(0.3048L)};
+  for (const InstructionSet instruction_set : InstructionSets) {
+    if (!IsSupported(instruction_set)) {
+      continue;
+    }
+    for (std::size_t size = 0; size <= 100; ++size) {
+      std::vector<NumericType> expected{Values<NumericType>(size)};
+      DivideInPlaceScalar(expected.data(), size, divisor);
+      std::vector<NumericType> values{Values<NumericType>(size)};
+      DivideInPlace(instruction_set, values.data(), size, divisor);
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+/// \brief Verifies that every supported instruction set multiplies sequences of every length from
+/// zero to a few vector widths exactly like the portable scalar code.
+template <typename NumericType>
+void TestMultiplyInPlace() {
+  const NumericType factor{static_cast<NumericType>(0.3048L)};
+  for (const InstructionSet instruction_set : InstructionSets) {
+    if (!IsSupported(instruction_set)) {
+      continue;
+    }
+    for (std::size_t size = 0; size <= 100; ++size) {
+      std::vector<NumericType> expected{Values<NumericType>(size)};
+      MultiplyInPlaceScalar(expected.data(), size, factor);
+      std::vector<NumericType> values{Values<NumericType>(size)};
+      MultiplyInPlace(instruction_set, values.data(), size, factor);
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+/// \brief Verifies that every supported instruction set multiplies sequences of every length from
+/// zero to a few vector widths and adds an offset to them exactly like the portable scalar code.
+template <typename NumericType>
+void TestMultiplyAddInPlace() {
+  const NumericType factor{static_cast<NumericType>(1.8L)};
+  const NumericType offset{static_cast<NumericType>(-459.67L)};
+  for (const InstructionSet instruction_set : InstructionSets) {
+    if (!IsSupported(instruction_set)) {
+      continue;
+    }
+    for (std::size_t size = 0; size <= 100; ++size) {
+      std::vector<NumericType> expected{Values<NumericType>(size)};
+      MultiplyAddInPlaceScalar(expected.data(), size, factor, offset);
+      std::vector<NumericType> values{Values<NumericType>(size)};
+      MultiplyAddInPlace(instruction_set, values.data(), size, factor, offset);
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+/// \brief Verifies that converting each value of a sequence from kelvin to degrees Fahrenheit
+/// yields bitwise identical results whatever the length of the sequence and whatever the
+/// instruction set, on both sides of the length below which the portable scalar code runs directly.
+template <typename NumericType>
+void TestReproducibility() {
+  const NumericType factor{static_cast<NumericType>(1.8L)};
+  const NumericType offset{static_cast<NumericType>(-459.67L)};
+  constexpr std::size_t maximum_size{4 * VectorizationThreshold};
+
+  std::vector<NumericType> expected{Values<NumericType>(maximum_size)};
+  for (NumericType& value : expected) {
+    MultiplyAddInPlace(&value, 1, factor, offset);
+  }
+
+  for (std::size_t size = 0; size <= maximum_size; ++size) {
+    std::vector<NumericType> values{Values<NumericType>(size)};
+    MultiplyAddInPlace(values.data(), size, factor, offset);
+    EXPECT_EQ(std::memcmp(values.data(), expected.data(), size * sizeof(NumericType)), 0);
+    for (const InstructionSet instruction_set : InstructionSets) {
+      if (IsSupported(instruction_set)) {
+        values = Values<NumericType>(size);
+        MultiplyAddInPlace(instruction_set, values.data(), size, factor, offset);
+        EXPECT_EQ(std::memcmp(values.data(), expected.data(), size * sizeof(NumericType)), 0);
+      }
+    }
+  }
+}
+
+/// \brief Tests the performance of converting a buffer of values between two units of measure of a
+/// given type with the widest supported instruction set against a plain loop over the values, and
+/// records the throughput of both as test properties under a given name. Each call copies the
+/// values and then converts them in-place, so every value is read and written twice. The results
+/// of the vectorized conversion are checked bit-for-bit in the unit of measure tests.
+template <typename Unit, typename NumericType>
+void TestConversionPerformance(
+    const std::string& name, const Unit original_unit, const Unit new_unit) {
+  constexpr std::size_t size{1 << 16};
+  const LinearConversion<NumericType> conversion{
+    MakeLinearConversion<Unit, NumericType>(original_unit, new_unit)};
+
+  const std::vector<NumericType> original_values{Values<NumericType>(size)};
+  std::vector<NumericType> scalar_values;
+  std::vector<NumericType> vectorized_values;
+
+  const RelativePerformance performance{Internal::TestRelativePerformance(
+      [&]() {
+        vectorized_values = original_values;
+        conversion.Apply(vectorized_values.data(), size);
+      },
+      [&]() {
+        scalar_values = original_values;
+        for (NumericType& value : scalar_values) {
+          value = conversion.FromStandard().Evaluate(conversion.ToStandard().Evaluate(value));
+        }
+      })};
+
+  const double gigabytes{4.0 * static_cast<double>(size * sizeof(NumericType)) / 1.0e9};
+  ::testing::Test::RecordProperty(
+      name + "GigabytesPerSecond", std::to_string(gigabytes / performance.duration.count()));
+  ::testing::Test::RecordProperty(
+      name + "ScalarGigabytesPerSecond",
+      std::to_string(gigabytes / performance.reference_duration.count()));
+}
+
+TEST(Vectorization, DivideInPlaceDouble) {
+  TestDivideInPlace<double>();
+}
+
+TEST(Vectorization, DivideInPlaceFloat) {
+  TestDivideInPlace<float>();
+}
+
+TEST(Vectorization, DivideInPlaceLongDouble) {
+  TestDivideInPlace<long double>();
+}
+
+TEST(Vectorization, MultiplyAddInPlaceDouble) {
+  TestMultiplyAddInPlace<double>();
+}
+
+TEST(Vectorization, MultiplyAddInPlaceFloat) {
+  TestMultiplyAddInPlace<float>();
+}
+
+TEST(Vectorization, MultiplyAddInPlaceLongDouble) {
+  TestMultiplyAddInPlace<long double>();
+}
+
+TEST(Vectorization, MultiplyInPlaceDouble) {
+  TestMultiplyInPlace<double>();
+}
+
+TEST(Vectorization, MultiplyInPlaceFloat) {
+  TestMultiplyInPlace<float>();
+}
+
+TEST(Vectorization, MultiplyInPlaceLongDouble) {
+  TestMultiplyInPlace<long double>();
+}
+
+TEST(Vectorization, Performance) {
+  TestConversionPerformance<Unit::Length, double>(
+      "LengthDouble", Unit::Length::Foot, Unit::Length::Millimetre);
+  TestConversionPerformance<Unit::Length, float>(
+      "LengthFloat", Unit::Length::Foot, Unit::Length::Millimetre);
+  TestConversionPerformance<Unit::Pressure, double>(
+      "PressureDouble", Unit::Pressure::PoundPerSquareInch, Unit::Pressure::Kilopascal);
+  TestConversionPerformance<Unit::Pressure, float>(
+      "PressureFloat", Unit::Pressure::PoundPerSquareInch, Unit::Pressure::Kilopascal);
+  TestConversionPerformance<Unit::Energy, double>(
+      "EnergyDouble", Unit::Energy::Joule, Unit::Energy::FootPound);
+  TestConversionPerformance<Unit::Energy, float>(
+      "EnergyFloat", Unit::Energy::Joule, Unit::Energy::FootPound);
+  TestConversionPerformance<Unit::Speed, double>(
+      "SpeedDouble", Unit::Speed::MetrePerSecond, Unit::Speed::KilometrePerHour);
+  TestConversionPerformance<Unit::Speed, float>(
+      "SpeedFloat", Unit::Speed::MetrePerSecond, Unit::Speed::KilometrePerHour);
+  TestConversionPerformance<Unit::Temperature, double>(
+      "TemperatureDouble", Unit::Temperature::Fahrenheit, Unit::Temperature::Celsius);
+  TestConversionPerformance<Unit::Temperature, float>(
+      "TemperatureFloat", Unit::Temperature::Fahrenheit, Unit::Temperature::Celsius);
+}
+
+TEST(Vectorization, ReproducibilityDouble) {
+  TestReproducibility<double>();
+}
+
+TEST(Vectorization, ReproducibilityFloat) {
+  TestReproducibility<float>();
+}
+
+TEST(Vectorization, SupportedInstructionSet) {
+  EXPECT_EQ(SupportedInstructionSet(), DetectInstructionSet());
+#ifdef PHQ_VECTORIZATION_X86_64
+  EXPECT_NE(SupportedInstructionSet(), InstructionSet::Scalar);
+#else
+  EXPECT_EQ(SupportedInstructionSet(), InstructionSet::Scalar);
+#endif
+}
+
+}  // namespace
+
+}  // namespace PhQ::Internal
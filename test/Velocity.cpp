@@ -28,6 +28,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Angle.hpp"
@@ -54,6 +55,24 @@ TEST(Velocity, Angle) {
             Angle(90.0, Unit::Angle::Degree));
 }
 
+TEST(Velocity, Append) {
+  const Velocity velocity({1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond);
+  std::string buffer{"["};
+  velocity.AppendJSON(buffer);
+  buffer.push_back(',');
+  velocity.AppendJSON(buffer, Unit::Speed::MillimetrePerSecond);
+  EXPECT_EQ(buffer, "[" + velocity.JSON() + "," + velocity.JSON(Unit::Speed::MillimetrePerSecond));
+  buffer.clear();
+  velocity.AppendPrint(buffer);
+  EXPECT_EQ(buffer, velocity.Print());
+  buffer.clear();
+  velocity.AppendXML(buffer, Unit::Speed::MillimetrePerSecond);
+  EXPECT_EQ(buffer, velocity.XML(Unit::Speed::MillimetrePerSecond));
+  buffer.clear();
+  velocity.AppendYAML(buffer);
+  EXPECT_EQ(buffer, velocity.YAML());
+}
+
 TEST(Velocity, ArithmeticOperatorAddition) {
   EXPECT_EQ(Velocity({1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond)
                 + Velocity({2.0, -4.0, 6.0}, Unit::Speed::MetrePerSecond),